@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUAXISVISUAL_HH_
+#define IGNITION_RENDERING_CPU_CPUAXISVISUAL_HH_
+
+#include "ignition/rendering/base/BaseAxisVisual.hh"
+#include "ignition/rendering/cpu/CpuVisual.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the axis visual class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuAxisVisual :
+      public BaseAxisVisual<CpuVisual>
+    {
+      /// \brief Constructor
+      protected: CpuAxisVisual();
+
+      /// \brief Destructor
+      public: virtual ~CpuAxisVisual();
+
+      /// \brief Make scene our friend so it can create axis visuals
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
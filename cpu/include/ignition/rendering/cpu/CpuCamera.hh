@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUCAMERA_HH_
+#define IGNITION_RENDERING_CPU_CPUCAMERA_HH_
+
+#include <memory>
+#include <vector>
+
+#include "ignition/rendering/base/BaseCamera.hh"
+#include "ignition/rendering/cpu/CpuRenderTarget.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+#include "ignition/rendering/cpu/CpuSensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class CpuCameraPrivate;
+
+    /// \brief Cpu implementation of the camera class. The scene is
+    /// rasterized in tiles on the cpu workers and shaded with diffuse
+    /// lighting. Supported image formats are PF_R8G8B8, PF_B8G8R8,
+    /// PF_R8G8B8A8 and PF_B8G8R8A8.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuCamera :
+      public BaseCamera<CpuSensor>
+    {
+      /// \brief Constructor
+      protected: CpuCamera();
+
+      /// \brief Destructor
+      public: virtual ~CpuCamera();
+
+      // Documentation inherited.
+      public: virtual void SetImageFormat(PixelFormat _format) override;
+
+      // Documentation inherited.
+      public: virtual void Render() override;
+
+      // Documentation inherited.
+      public: virtual VisualPtr VisualAt(const ignition::math::Vector2i
+                  &_mousePos) override;
+
+      // Documentation inherited.
+      protected: virtual RenderTargetPtr RenderTarget() const override;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      // Documentation inherited.
+      protected: virtual bool RenderIds(unsigned int _width,
+                     unsigned int _height,
+                     std::vector<unsigned int> &_ids) override;
+
+      /// \brief Render texture the image is rendered to
+      protected: CpuRenderTexturePtr renderTexture;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<CpuCameraPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create cpu cameras
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUDEPTHCAMERA_HH_
+#define IGNITION_RENDERING_CPU_CPUDEPTHCAMERA_HH_
+
+#include <memory>
+#include <string>
+
+#include "ignition/rendering/base/BaseDepthCamera.hh"
+#include "ignition/rendering/cpu/CpuRenderTarget.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+#include "ignition/rendering/cpu/CpuSensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class CpuDepthCameraPrivate;
+
+    /// \brief Cpu implementation of the depth camera class. Depth is the
+    /// distance along the camera x axis, -inf in front of the near clip
+    /// plane and +inf where nothing is hit within the far clip plane. The
+    /// image format is always PF_FLOAT32_R.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuDepthCamera :
+      public BaseDepthCamera<CpuSensor>
+    {
+      /// \brief Constructor
+      protected: CpuDepthCamera();
+
+      /// \brief Destructor
+      public: virtual ~CpuDepthCamera();
+
+      // Documentation inherited.
+      public: virtual void CreateDepthTexture() override;
+
+      // Documentation inherited.
+      public: virtual void SetImageFormat(PixelFormat _format) override;
+
+      // Documentation inherited.
+      public: virtual void Render() override;
+
+      // Documentation inherited.
+      public: virtual void PostRender() override;
+
+      // Documentation inherited.
+      public: virtual const float *DepthData() const override;
+
+      // Documentation inherited.
+      public: virtual ignition::common::ConnectionPtr ConnectNewDepthFrame(
+          std::function<void(const float *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>  _subscriber) override;
+
+      // Documentation inherited.
+      public: virtual ignition::common::ConnectionPtr ConnectNewRgbPointCloud(
+          std::function<void(const float *, unsigned int, unsigned int,
+          unsigned int, const std::string &)>  _subscriber) override;
+
+      // Documentation inherited.
+      protected: virtual RenderTargetPtr RenderTarget() const override;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      /// \brief Render texture holding the depth image
+      protected: CpuRenderTexturePtr depthTexture;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<CpuDepthCameraPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create cpu depth cameras
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
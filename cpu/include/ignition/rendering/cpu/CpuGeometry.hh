@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUGEOMETRY_HH_
+#define IGNITION_RENDERING_CPU_CPUGEOMETRY_HH_
+
+#include <ignition/math/AxisAlignedBox.hh>
+
+#include "ignition/rendering/base/BaseGeometry.hh"
+#include "ignition/rendering/cpu/CpuObject.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the geometry class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuGeometry :
+      public BaseGeometry<CpuObject>
+    {
+      /// \brief Constructor
+      protected: CpuGeometry();
+
+      /// \brief Destructor
+      public: virtual ~CpuGeometry();
+
+      // Documentation inherited.
+      public: virtual bool HasParent() const override;
+
+      // Documentation inherited.
+      public: virtual VisualPtr Parent() const override;
+
+      /// \brief Get the bounds of the geometry in the frame of its visual,
+      /// before scaling
+      /// \return Bounding box, empty if the geometry has no extent
+      public: virtual math::AxisAlignedBox LocalBounds() const;
+
+      /// \brief Set the parent of this cpu geometry
+      /// \param[in] _parent Parent visual
+      protected: virtual void SetParent(CpuVisualPtr _parent);
+
+      /// \brief Parent visual
+      protected: CpuVisualPtr parent;
+
+      /// \brief Make cpu visual our friend so it can it can access function
+      /// for setting the parent of this geometry
+      private: friend class CpuVisual;
+    };
+    }
+  }
+}
+#endif
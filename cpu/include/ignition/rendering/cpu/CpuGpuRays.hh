@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUGPURAYS_HH_
+#define IGNITION_RENDERING_CPU_CPUGPURAYS_HH_
+
+#include <memory>
+#include <string>
+
+#include "ignition/rendering/base/BaseGpuRays.hh"
+#include "ignition/rendering/cpu/CpuRenderTarget.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+#include "ignition/rendering/cpu/CpuSensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class CpuGpuRaysPrivate;
+
+    /// \brief Cpu implementation of the gpu rays class. Every reading is
+    /// cast against the bounding volume hierarchy of the scene, so the
+    /// ranges are exact and do not depend on a rendered resolution.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuGpuRays :
+      public BaseGpuRays<CpuSensor>
+    {
+      /// \brief Constructor
+      protected: CpuGpuRays();
+
+      /// \brief Destructor
+      public: virtual ~CpuGpuRays();
+
+      // Documentation inherited.
+      public: virtual void Render() override;
+
+      // Documentation inherited.
+      public: virtual void PostRender() override;
+
+      // Documentation inherited.
+      public: virtual const float *Data() const override;
+
+      // Documentation inherited.
+      public: virtual void Copy(float *_data) override;
+
+      // Documentation inherited.
+      public: virtual ignition::common::ConnectionPtr ConnectNewGpuRaysFrame(
+          std::function<void(const float *_frame, unsigned int _width,
+          unsigned int _height, unsigned int _depth,
+          const std::string &_format)> _subscriber) override;
+
+      // Documentation inherited.
+      public: virtual ignition::common::ConnectionPtr ConnectNewGpuRaysData(
+          NewFrameListener _subscriber) override;
+
+      // Documentation inherited.
+      public: virtual RenderTargetPtr RenderTarget() const override;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      /// \brief Dummy render texture of the camera
+      protected: CpuRenderTexturePtr renderTexture;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<CpuGpuRaysPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create cpu gpu rays
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPULIGHT_HH_
+#define IGNITION_RENDERING_CPU_CPULIGHT_HH_
+
+#include "ignition/rendering/base/BaseLight.hh"
+#include "ignition/rendering/cpu/CpuNode.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the light class. Lights only take part
+    /// in diffuse shading, specular colors and shadows are stored but not
+    /// rendered.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuLight :
+      public BaseLight<CpuNode>
+    {
+      /// \brief Constructor
+      protected: CpuLight();
+
+      /// \brief Destructor
+      public: virtual ~CpuLight();
+
+      // Documentation inherited.
+      public: virtual math::Color DiffuseColor() const override;
+
+      // Documentation inherited.
+      public: virtual void SetDiffuseColor(const math::Color &_color) override;
+
+      // Documentation inherited.
+      public: virtual math::Color SpecularColor() const override;
+
+      // Documentation inherited.
+      public: virtual void SetSpecularColor(const math::Color &_color)
+                  override;
+
+      // Documentation inherited.
+      public: virtual double AttenuationConstant() const override;
+
+      // Documentation inherited.
+      public: virtual void SetAttenuationConstant(double _value) override;
+
+      // Documentation inherited.
+      public: virtual double AttenuationLinear() const override;
+
+      // Documentation inherited.
+      public: virtual void SetAttenuationLinear(double _value) override;
+
+      // Documentation inherited.
+      public: virtual double AttenuationQuadratic() const override;
+
+      // Documentation inherited.
+      public: virtual void SetAttenuationQuadratic(double _value) override;
+
+      // Documentation inherited.
+      public: virtual double AttenuationRange() const override;
+
+      // Documentation inherited.
+      public: virtual void SetAttenuationRange(double _range) override;
+
+      // Documentation inherited.
+      public: virtual bool CastShadows() const override;
+
+      // Documentation inherited.
+      public: virtual void SetCastShadows(bool _castShadows) override;
+
+      // Documentation inherited.
+      public: virtual double Intensity() const override;
+
+      // Documentation inherited.
+      public: virtual void SetIntensity(double _intensity) override;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      /// \brief Diffuse color
+      protected: math::Color diffuse;
+
+      /// \brief Specular color
+      protected: math::Color specular;
+
+      /// \brief Constant attenuation factor
+      protected: double attenConstant = 1.0;
+
+      /// \brief Linear attenuation factor
+      protected: double attenLinear = 0.0;
+
+      /// \brief Quadratic attenuation factor
+      protected: double attenQuadratic = 0.0;
+
+      /// \brief Distance beyond which the light has no effect
+      protected: double attenRange = 100.0;
+
+      /// \brief True if the light casts shadows
+      protected: bool castShadows = true;
+
+      /// \brief Light intensity
+      protected: double intensity = 1.0;
+    };
+
+    /// \brief Cpu implementation of the directional light class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuDirectionalLight :
+      public BaseDirectionalLight<CpuLight>
+    {
+      /// \brief Constructor
+      protected: CpuDirectionalLight();
+
+      /// \brief Destructor
+      public: virtual ~CpuDirectionalLight();
+
+      // Documentation inherited.
+      public: virtual math::Vector3d Direction() const override;
+
+      // Documentation inherited.
+      public: virtual void SetDirection(const math::Vector3d &_dir) override;
+
+      /// \brief Light direction in the frame of the light
+      protected: math::Vector3d direction;
+
+      /// \brief Make scene our friend so it can create cpu lights
+      private: friend class CpuScene;
+    };
+
+    /// \brief Cpu implementation of the point light class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuPointLight :
+      public BasePointLight<CpuLight>
+    {
+      /// \brief Constructor
+      protected: CpuPointLight();
+
+      /// \brief Destructor
+      public: virtual ~CpuPointLight();
+
+      /// \brief Make scene our friend so it can create cpu lights
+      private: friend class CpuScene;
+    };
+
+    /// \brief Cpu implementation of the spot light class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuSpotLight :
+      public BaseSpotLight<CpuLight>
+    {
+      /// \brief Constructor
+      protected: CpuSpotLight();
+
+      /// \brief Destructor
+      public: virtual ~CpuSpotLight();
+
+      // Documentation inherited.
+      public: virtual math::Vector3d Direction() const override;
+
+      // Documentation inherited.
+      public: virtual void SetDirection(const math::Vector3d &_dir) override;
+
+      // Documentation inherited.
+      public: virtual math::Angle InnerAngle() const override;
+
+      // Documentation inherited.
+      public: virtual void SetInnerAngle(const math::Angle &_angle) override;
+
+      // Documentation inherited.
+      public: virtual math::Angle OuterAngle() const override;
+
+      // Documentation inherited.
+      public: virtual void SetOuterAngle(const math::Angle &_angle) override;
+
+      // Documentation inherited.
+      public: virtual double Falloff() const override;
+
+      // Documentation inherited.
+      public: virtual void SetFalloff(double _falloff) override;
+
+      /// \brief Light direction in the frame of the light
+      protected: math::Vector3d direction;
+
+      /// \brief Full angle of the inner cone
+      protected: math::Angle innerAngle;
+
+      /// \brief Full angle of the outer cone
+      protected: math::Angle outerAngle;
+
+      /// \brief Falloff between the inner and outer cones
+      protected: double falloff = 1.0;
+
+      /// \brief Make scene our friend so it can create cpu lights
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
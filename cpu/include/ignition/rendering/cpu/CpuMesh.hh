@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUMESH_HH_
+#define IGNITION_RENDERING_CPU_CPUMESH_HH_
+
+#include <memory>
+#include <vector>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/base/BaseMesh.hh"
+#include "ignition/rendering/cpu/CpuGeometry.hh"
+#include "ignition/rendering/cpu/CpuObject.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Triangles of a sub-mesh in the frame of the mesh, shared by
+    /// all meshes created from the same mesh descriptor
+    struct CpuSubMeshData
+    {
+      /// \brief Vertex positions
+      std::vector<math::Vector3f> vertices;
+
+      /// \brief Normalized vertex normals, one per vertex
+      std::vector<math::Vector3f> normals;
+
+      /// \brief Vertex indices, three per triangle
+      std::vector<unsigned int> indices;
+
+      /// \brief Bounds of the vertices
+      math::AxisAlignedBox bounds;
+    };
+
+    /// \brief Cpu implementation of the mesh class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuMesh :
+      public BaseMesh<CpuGeometry>
+    {
+      /// \brief Constructor
+      protected: CpuMesh();
+
+      /// \brief Destructor
+      public: virtual ~CpuMesh();
+
+      // Documentation inherited.
+      public: virtual math::AxisAlignedBox LocalBounds() const override;
+
+      // Documentation inherited.
+      protected: virtual SubMeshStorePtr SubMeshes() const override;
+
+      /// \brief Sub-meshes of the mesh
+      protected: CpuSubMeshStorePtr subMeshes;
+
+      /// \brief Make scene our friend so it can create cpu meshes
+      private: friend class CpuScene;
+
+      /// \brief Make the mesh factory our friend so it can set the
+      /// sub-meshes
+      private: friend class CpuMeshFactory;
+    };
+
+    /// \brief Cpu implementation of the sub-mesh class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuSubMesh :
+      public BaseSubMesh<CpuObject>
+    {
+      /// \brief Constructor
+      protected: CpuSubMesh();
+
+      /// \brief Destructor
+      public: virtual ~CpuSubMesh();
+
+      /// \brief Get the triangles of the sub-mesh
+      /// \return Sub-mesh data, null if the sub-mesh has no triangles
+      public: std::shared_ptr<const CpuSubMeshData> Data() const;
+
+      // Documentation inherited.
+      protected: virtual void SetMaterialImpl(MaterialPtr _material)
+                     override;
+
+      /// \brief Triangles of the sub-mesh
+      protected: std::shared_ptr<const CpuSubMeshData> data;
+
+      /// \brief Make scene our friend so it can create cpu sub-meshes
+      private: friend class CpuScene;
+
+      /// \brief Make the sub-mesh factory our friend so it can create cpu
+      /// sub-meshes
+      private: friend class CpuSubMeshStoreFactory;
+    };
+    }
+  }
+}
+#endif
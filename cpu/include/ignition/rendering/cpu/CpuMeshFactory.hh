@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUMESHFACTORY_HH_
+#define IGNITION_RENDERING_CPU_CPUMESHFACTORY_HH_
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ignition/rendering/MeshDescriptor.hh"
+#include "ignition/rendering/cpu/CpuMesh.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Creates the sub-meshes of cpu meshes. The triangles of a
+    /// sub-mesh are converted once and shared by all meshes created from
+    /// the same descriptor.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuSubMeshStoreFactory
+    {
+      /// \brief Constructor
+      /// \param[in] _scene Scene the sub-meshes are created in
+      public: explicit CpuSubMeshStoreFactory(CpuScenePtr _scene);
+
+      /// \brief Destructor
+      public: virtual ~CpuSubMeshStoreFactory();
+
+      /// \brief Create the sub-meshes of a loaded mesh descriptor
+      /// \param[in] _desc Mesh descriptor
+      /// \return Sub-mesh store
+      public: virtual CpuSubMeshStorePtr Create(const MeshDescriptor &_desc);
+
+      /// \brief Get the triangles of a sub-mesh, converting them on first
+      /// use
+      /// \param[in] _desc Mesh descriptor
+      /// \param[in] _subMeshIndex Index of the sub-mesh
+      /// \return Sub-mesh data
+      protected: virtual std::shared_ptr<const CpuSubMeshData> Data(
+                     const MeshDescriptor &_desc,
+                     unsigned int _subMeshIndex);
+
+      /// \brief Get the name the data of a sub-mesh is cached under
+      /// \param[in] _desc Mesh descriptor
+      /// \param[in] _subMeshIndex Index of the sub-mesh
+      /// \return Cache key
+      protected: virtual std::string KeyName(const MeshDescriptor &_desc,
+                     unsigned int _subMeshIndex);
+
+      /// \brief Converted sub-meshes, by key name
+      protected: std::map<std::string, std::shared_ptr<const CpuSubMeshData>>
+                     data;
+
+      /// \brief Scene the sub-meshes are created in
+      protected: CpuScenePtr scene;
+    };
+
+    /// \brief Creates cpu meshes from mesh descriptors
+    class IGNITION_RENDERING_CPU_VISIBLE CpuMeshFactory
+    {
+      /// \brief Constructor
+      /// \param[in] _scene Scene the meshes are created in
+      public: explicit CpuMeshFactory(CpuScenePtr _scene);
+
+      /// \brief Destructor
+      public: virtual ~CpuMeshFactory();
+
+      /// \brief Create a mesh
+      /// \param[in] _desc Mesh descriptor
+      /// \return The new mesh, null on error
+      public: virtual CpuMeshPtr Create(const MeshDescriptor &_desc);
+
+      /// \brief Check that a loaded mesh descriptor can be created
+      /// \param[in] _desc Mesh descriptor
+      /// \return True if the descriptor is valid
+      protected: virtual bool Validate(const MeshDescriptor &_desc);
+
+      /// \brief Creates the sub-meshes
+      protected: CpuSubMeshStoreFactory subMeshStoreFactory;
+
+      /// \brief Scene the meshes are created in
+      protected: CpuScenePtr scene;
+    };
+    }
+  }
+}
+#endif
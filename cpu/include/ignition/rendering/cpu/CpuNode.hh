@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUNODE_HH_
+#define IGNITION_RENDERING_CPU_CPUNODE_HH_
+
+#include "ignition/rendering/base/BaseNode.hh"
+#include "ignition/rendering/cpu/CpuObject.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the Node class. The cpu engine has no
+    /// scene graph of its own, so the node keeps its pose and scale.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuNode :
+      public BaseNode<CpuObject>
+    {
+      /// \brief Constructor
+      protected: CpuNode();
+
+      /// \brief Destructor
+      public: virtual ~CpuNode();
+
+      // Documentation inherited.
+      public: virtual bool HasParent() const override;
+
+      // Documentation inherited.
+      public: virtual NodePtr Parent() const override;
+
+      // Documentation inherited.
+      public: virtual math::Vector3d LocalScale() const override;
+
+      // Documentation inherited.
+      public: virtual bool InheritScale() const override;
+
+      // Documentation inherited.
+      public: virtual void SetInheritScale(bool _inherit) override;
+
+      // Documentation inherited.
+      protected: virtual void SetLocalScaleImpl(
+                     const math::Vector3d &_scale) override;
+
+      // Documentation inherited.
+      protected: virtual NodeStorePtr Children() const override;
+
+      // Documentation inherited.
+      protected: virtual bool AttachChild(NodePtr _child) override;
+
+      // Documentation inherited.
+      protected: virtual bool DetachChild(NodePtr _child) override;
+
+      // Documentation inherited.
+      protected: virtual math::Pose3d RawLocalPose() const override;
+
+      // Documentation inherited.
+      protected: virtual void SetRawLocalPose(const math::Pose3d &_pose)
+                     override;
+
+      /// \brief Set the parent node
+      /// \param[in] _parent The parent cpu node
+      protected: virtual void SetParent(CpuNodePtr _parent);
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      /// \brief Get a shared pointer to this
+      /// \return Shared pointer to this
+      private: CpuNodePtr SharedThis();
+
+      /// \brief Pointer to the parent cpu node
+      protected: CpuNodePtr parent;
+
+      /// \brief Raw local pose of the node
+      protected: math::Pose3d pose;
+
+      /// \brief Local scale of the node
+      protected: math::Vector3d scale = math::Vector3d::One;
+
+      /// \brief True if the node inherits the scale of its parent
+      protected: bool inheritScale = true;
+
+      /// \brief A list of child nodes
+      protected: CpuNodeStorePtr children;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUOBJECT_HH_
+#define IGNITION_RENDERING_CPU_CPUOBJECT_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/base/BaseObject.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+#include "ignition/rendering/cpu/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the Object class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuObject :
+      public BaseObject
+    {
+      /// \brief Constructor
+      protected: CpuObject();
+
+      /// \brief Destructor
+      public: virtual ~CpuObject();
+
+      // Documentation inherited.
+      public: virtual ScenePtr Scene() const override;
+
+      /// \brief Pointer to the cpu scene
+      protected: CpuScenePtr scene;
+
+      /// \brief Make cpu scene our friend so it is able to create objects
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
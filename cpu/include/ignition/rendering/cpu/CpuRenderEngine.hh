@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPURENDERENGINE_HH_
+#define IGNITION_RENDERING_CPU_CPURENDERENGINE_HH_
+
+#include <map>
+#include <string>
+#include <ignition/common/SingletonT.hh>
+
+#include "ignition/rendering/RenderEnginePlugin.hh"
+#include "ignition/rendering/base/BaseRenderEngine.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Plugin for loading cpu render engine
+    class IGNITION_RENDERING_CPU_VISIBLE CpuRenderEnginePlugin :
+      public RenderEnginePlugin
+    {
+      /// \brief Constructor
+      public: CpuRenderEnginePlugin();
+
+      /// \brief Destructor
+      public: ~CpuRenderEnginePlugin() = default;
+
+      /// \brief Get the name of the render engine loaded by this plugin.
+      /// \return Name of render engine
+      public: std::string Name() const;
+
+      /// \brief Get a pointer to the render engine loaded by this plugin.
+      /// \return Render engine instance
+      public: RenderEngine *Engine() const;
+    };
+
+    /// \brief Render engine rasterizing scenes on the cpu, for machines
+    /// without a GPU such as headless continuous integration runners.
+    /// Rendering needs no display and no graphics driver.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuRenderEngine :
+      public virtual BaseRenderEngine,
+      public common::SingletonT<CpuRenderEngine>
+    {
+      /// \brief Constructor
+      private: CpuRenderEngine();
+
+      /// \brief Destructor
+      public: virtual ~CpuRenderEngine();
+
+      // Documentation inherited.
+      public: virtual std::string Name() const override;
+
+      // Documentation inherited.
+      protected: virtual ScenePtr CreateSceneImpl(unsigned int _id,
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual SceneStorePtr Scenes() const override;
+
+      // Documentation inherited.
+      protected: virtual bool LoadImpl(
+          const std::map<std::string, std::string> &_params) override;
+
+      // Documentation inherited.
+      protected: virtual bool InitImpl() override;
+
+      /// \brief Scenes created by the engine
+      private: CpuSceneStorePtr scenes;
+
+      /// \brief Singleton setup
+      private: friend class SingletonT<CpuRenderEngine>;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPURENDERTARGET_HH_
+#define IGNITION_RENDERING_CPU_CPURENDERTARGET_HH_
+
+#include <cstddef>
+#include <vector>
+
+#include "ignition/rendering/base/BaseRenderTarget.hh"
+#include "ignition/rendering/cpu/CpuObject.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the render target class, an image in
+    /// host memory
+    class IGNITION_RENDERING_CPU_VISIBLE CpuRenderTarget :
+      public virtual BaseRenderTarget<CpuObject>
+    {
+      /// \brief Constructor
+      protected: CpuRenderTarget();
+
+      /// \brief Destructor
+      public: virtual ~CpuRenderTarget();
+
+      // Documentation inherited.
+      public: virtual void Copy(Image &_image) const override;
+
+      /// \brief Get the pixels of the target, rows tightly packed in the
+      /// target format
+      /// \return Pixel buffer, sized once the target is rebuilt
+      public: unsigned char *Data();
+
+      /// \brief Get the size of the pixel buffer
+      /// \return Size in bytes, 0 until the target is built
+      public: size_t DataSize() const;
+
+      // Documentation inherited.
+      protected: virtual void RebuildImpl() override;
+
+      /// \brief Pixel buffer
+      protected: std::vector<unsigned char> buffer;
+    };
+
+    /// \brief Cpu implementation of the render texture class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuRenderTexture :
+      public virtual BaseRenderTexture<CpuRenderTarget>
+    {
+      /// \brief Constructor
+      protected: CpuRenderTexture();
+
+      /// \brief Destructor
+      public: virtual ~CpuRenderTexture();
+
+      /// \brief Make scene our friend so it can create render textures
+      private: friend class CpuScene;
+    };
+
+    /// \brief Render window mocked using a render texture.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuRenderWindow :
+      public virtual BaseRenderWindow<CpuRenderTexture>
+    {
+      /// \brief Constructor
+      protected: CpuRenderWindow();
+
+      /// \brief Destructor
+      public: virtual ~CpuRenderWindow();
+
+      /// \brief Render windows should only be created by the scene class
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPURENDERTYPES_HH_
+#define IGNITION_RENDERING_CPU_CPURENDERTYPES_HH_
+
+#include "ignition/rendering/base/BaseRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    class CpuArrowVisual;
+    class CpuAxisVisual;
+    class CpuCamera;
+    class CpuDepthCamera;
+    class CpuDirectionalLight;
+    class CpuGeometry;
+    class CpuGpuRays;
+    class CpuLight;
+    class CpuMaterial;
+    class CpuMesh;
+    class CpuMeshFactory;
+    class CpuNode;
+    class CpuObject;
+    class CpuPointLight;
+    class CpuRayQuery;
+    class CpuRenderEngine;
+    class CpuRenderTarget;
+    class CpuRenderTexture;
+    class CpuRenderWindow;
+    class CpuScene;
+    class CpuSensor;
+    class CpuSpotLight;
+    class CpuSubMesh;
+    class CpuVisual;
+
+    typedef BaseSceneStore<CpuScene>       CpuSceneStore;
+    typedef BaseNodeStore<CpuNode>         CpuNodeStore;
+    typedef BaseLightStore<CpuLight>       CpuLightStore;
+    typedef BaseSensorStore<CpuSensor>     CpuSensorStore;
+    typedef BaseVisualStore<CpuVisual>     CpuVisualStore;
+    typedef BaseGeometryStore<CpuGeometry> CpuGeometryStore;
+    typedef BaseSubMeshStore<CpuSubMesh>   CpuSubMeshStore;
+    typedef BaseMaterialMap<CpuMaterial>   CpuMaterialMap;
+
+    typedef shared_ptr<CpuArrowVisual>          CpuArrowVisualPtr;
+    typedef shared_ptr<CpuAxisVisual>           CpuAxisVisualPtr;
+    typedef shared_ptr<CpuCamera>               CpuCameraPtr;
+    typedef shared_ptr<CpuDepthCamera>          CpuDepthCameraPtr;
+    typedef shared_ptr<CpuDirectionalLight>     CpuDirectionalLightPtr;
+    typedef shared_ptr<CpuGeometry>             CpuGeometryPtr;
+    typedef shared_ptr<CpuGpuRays>              CpuGpuRaysPtr;
+    typedef shared_ptr<CpuLight>                CpuLightPtr;
+    typedef shared_ptr<CpuMaterial>             CpuMaterialPtr;
+    typedef shared_ptr<CpuMesh>                 CpuMeshPtr;
+    typedef shared_ptr<CpuMeshFactory>          CpuMeshFactoryPtr;
+    typedef shared_ptr<CpuNode>                 CpuNodePtr;
+    typedef shared_ptr<CpuObject>               CpuObjectPtr;
+    typedef shared_ptr<CpuPointLight>           CpuPointLightPtr;
+    typedef shared_ptr<CpuRayQuery>             CpuRayQueryPtr;
+    typedef shared_ptr<CpuRenderTarget>         CpuRenderTargetPtr;
+    typedef shared_ptr<CpuRenderTexture>        CpuRenderTexturePtr;
+    typedef shared_ptr<CpuRenderWindow>         CpuRenderWindowPtr;
+    typedef shared_ptr<CpuScene>                CpuScenePtr;
+    typedef shared_ptr<CpuSensor>               CpuSensorPtr;
+    typedef shared_ptr<CpuSpotLight>            CpuSpotLightPtr;
+    typedef shared_ptr<CpuSubMesh>              CpuSubMeshPtr;
+    typedef shared_ptr<CpuVisual>               CpuVisualPtr;
+    typedef shared_ptr<CpuSceneStore>           CpuSceneStorePtr;
+    typedef shared_ptr<CpuNodeStore>            CpuNodeStorePtr;
+    typedef shared_ptr<CpuLightStore>           CpuLightStorePtr;
+    typedef shared_ptr<CpuSensorStore>          CpuSensorStorePtr;
+    typedef shared_ptr<CpuVisualStore>          CpuVisualStorePtr;
+    typedef shared_ptr<CpuGeometryStore>        CpuGeometryStorePtr;
+    typedef shared_ptr<CpuSubMeshStore>         CpuSubMeshStorePtr;
+    typedef shared_ptr<CpuMaterialMap>          CpuMaterialMapPtr;
+    }
+  }
+}
+#endif
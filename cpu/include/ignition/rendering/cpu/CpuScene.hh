@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUSCENE_HH_
+#define IGNITION_RENDERING_CPU_CPUSCENE_HH_
+
+#include <memory>
+#include <string>
+
+#include "ignition/rendering/base/BaseScene.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+#include "ignition/rendering/cpu/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declarations
+    class CpuBvh;
+    class CpuScenePrivate;
+    struct CpuSceneData;
+
+    /// \brief Cpu implementation of the scene class. The triangles and
+    /// lights of the scene are collected in the world frame the first time
+    /// a sensor renders after PreRender, and shared by all sensors of the
+    /// frame.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuScene :
+      public BaseScene
+    {
+      /// \brief Constructor
+      /// \param[in] _id Unique scene id
+      /// \param[in] _name Scene name
+      protected: CpuScene(unsigned int _id, const std::string &_name);
+
+      /// \brief Destructor
+      public: virtual ~CpuScene();
+
+      // Documentation inherited.
+      public: virtual RenderEngine *Engine() const override;
+
+      // Documentation inherited.
+      public: virtual VisualPtr RootVisual() const override;
+
+      // Documentation inherited.
+      public: virtual math::Color AmbientLight() const override;
+
+      // Documentation inherited.
+      public: virtual void SetAmbientLight(const math::Color &_color)
+                  override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      /// \brief Get the triangles and lights of the scene in the world
+      /// frame, collecting them if the scene changed since the last call
+      /// \return Scene data, valid until the next PreRender
+      public: const CpuSceneData &SceneData();
+
+      /// \brief Get the bounding volume hierarchy over the triangles of the
+      /// scene data, building it if the scene changed since the last call
+      /// \return Bounding volume hierarchy, valid until the next PreRender
+      public: const CpuBvh &Bvh();
+
+      // Documentation inherited.
+      protected: virtual bool LoadImpl() override;
+
+      // Documentation inherited.
+      protected: virtual bool InitImpl() override;
+
+      // Documentation inherited.
+      protected: virtual DirectionalLightPtr CreateDirectionalLightImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual PointLightPtr CreatePointLightImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual SpotLightPtr CreateSpotLightImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual CameraPtr CreateCameraImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual DepthCameraPtr CreateDepthCameraImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GpuRaysPtr CreateGpuRaysImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual VisualPtr CreateVisualImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual ArrowVisualPtr CreateArrowVisualImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual AxisVisualPtr CreateAxisVisualImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GeometryPtr CreateBoxImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GeometryPtr CreateConeImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GeometryPtr CreateCylinderImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GeometryPtr CreatePlaneImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GeometryPtr CreateSphereImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual MeshPtr CreateMeshImpl(unsigned int _id,
+                     const std::string &_name,
+                     const MeshDescriptor &_desc) override;
+
+      // Documentation inherited.
+      protected: virtual CapsulePtr CreateCapsuleImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual GridPtr CreateGridImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual MarkerPtr CreateMarkerImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual LidarVisualPtr CreateLidarVisualImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual HeightmapPtr CreateHeightmapImpl(unsigned int _id,
+                     const std::string &_name,
+                     const HeightmapDescriptor &_desc) override;
+
+      // Documentation inherited.
+      protected: virtual WireBoxPtr CreateWireBoxImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual LightVisualPtr CreateLightVisualImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual MaterialPtr CreateMaterialImpl(unsigned int _id,
+                     const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual RenderTexturePtr CreateRenderTextureImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual RenderWindowPtr CreateRenderWindowImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      // Documentation inherited.
+      protected: virtual RayQueryPtr CreateRayQueryImpl(
+                     unsigned int _id, const std::string &_name) override;
+
+      /// \brief Set the id, name and scene of a new object and initialize it
+      /// \param[in] _object Object to initialize
+      /// \param[in] _id Unique object id
+      /// \param[in] _name Unique object name
+      /// \return True on success
+      protected: virtual bool InitObject(CpuObjectPtr _object,
+                     unsigned int _id, const std::string &_name);
+
+      // Documentation inherited.
+      protected: virtual LightStorePtr Lights() const override;
+
+      // Documentation inherited.
+      protected: virtual SensorStorePtr Sensors() const override;
+
+      // Documentation inherited.
+      protected: virtual VisualStorePtr Visuals() const override;
+
+      // Documentation inherited.
+      protected: virtual MaterialMapPtr Materials() const override;
+
+      /// \brief Collect the triangles of a visual and its children
+      /// \param[in] _visual Visual to collect
+      /// \param[out] _data Scene data the triangles are appended to
+      private: void CollectVisual(const CpuVisualPtr &_visual,
+                   CpuSceneData &_data) const;
+
+      /// \brief Collect the lights of the scene
+      /// \param[out] _data Scene data the lights are appended to
+      private: void CollectLights(CpuSceneData &_data) const;
+
+      /// \brief Create the root visual
+      private: void CreateRootVisual();
+
+      /// \brief Create the mesh factory
+      private: void CreateMeshFactory();
+
+      /// \brief Create the object stores
+      private: void CreateStores();
+
+      /// \brief Get a shared pointer to this scene
+      /// \return Shared pointer to this scene
+      private: CpuScenePtr SharedThis();
+
+      /// \brief Root visual of the scene
+      protected: CpuVisualPtr rootVisual;
+
+      /// \brief Creates the meshes of the scene
+      protected: CpuMeshFactoryPtr meshFactory;
+
+      /// \brief Lights of the scene
+      protected: CpuLightStorePtr lights;
+
+      /// \brief Sensors of the scene
+      protected: CpuSensorStorePtr sensors;
+
+      /// \brief Visuals of the scene
+      protected: CpuVisualStorePtr visuals;
+
+      /// \brief Materials of the scene
+      protected: CpuMaterialMapPtr materials;
+
+      /// \brief Ambient light color
+      protected: math::Color ambientLight;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<CpuScenePrivate> dataPtr;
+
+      /// \brief Make render engine our friend so it can create cpu scenes
+      private: friend class CpuRenderEngine;
+    };
+    }
+  }
+}
+#endif
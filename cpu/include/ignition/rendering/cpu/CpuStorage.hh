@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUSTORAGE_HH_
+#define IGNITION_RENDERING_CPU_CPUSTORAGE_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseStorage.hh"
+
+#include "ignition/rendering/cpu/CpuGeometry.hh"
+#include "ignition/rendering/cpu/CpuLight.hh"
+#include "ignition/rendering/cpu/CpuMaterial.hh"
+#include "ignition/rendering/cpu/CpuMesh.hh"
+#include "ignition/rendering/cpu/CpuNode.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuSensor.hh"
+#include "ignition/rendering/cpu/CpuVisual.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    template class BaseSceneStore<CpuScene>;
+    template class BaseNodeStore<CpuNode>;
+    template class BaseLightStore<CpuLight>;
+    template class BaseSensorStore<CpuSensor>;
+    template class BaseVisualStore<CpuVisual>;
+    template class BaseGeometryStore<CpuGeometry>;
+    template class BaseSubMeshStore<CpuSubMesh>;
+    template class BaseMaterialMap<CpuMaterial>;
+
+    typedef BaseSceneStore<CpuScene>       CpuSceneStore;
+    typedef BaseNodeStore<CpuNode>         CpuNodeStore;
+    typedef BaseLightStore<CpuLight>       CpuLightStore;
+    typedef BaseSensorStore<CpuSensor>     CpuSensorStore;
+    typedef BaseVisualStore<CpuVisual>     CpuVisualStore;
+    typedef BaseGeometryStore<CpuGeometry> CpuGeometryStore;
+    typedef BaseSubMeshStore<CpuSubMesh>   CpuSubMeshStore;
+    typedef BaseMaterialMap<CpuMaterial>   CpuMaterialMap;
+
+    typedef std::shared_ptr<CpuSceneStore>    CpuSceneStorePtr;
+    typedef std::shared_ptr<CpuNodeStore>     CpuNodeStorePtr;
+    typedef std::shared_ptr<CpuLightStore>    CpuLightStorePtr;
+    typedef std::shared_ptr<CpuSensorStore>   CpuSensorStorePtr;
+    typedef std::shared_ptr<CpuVisualStore>   CpuVisualStorePtr;
+    typedef std::shared_ptr<CpuGeometryStore> CpuGeometryStorePtr;
+    typedef std::shared_ptr<CpuSubMeshStore>  CpuSubMeshStorePtr;
+    typedef std::shared_ptr<CpuMaterialMap>   CpuMaterialMapPtr;
+    }
+  }
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUVISUAL_HH_
+#define IGNITION_RENDERING_CPU_CPUVISUAL_HH_
+
+#include "ignition/rendering/base/BaseVisual.hh"
+#include "ignition/rendering/cpu/CpuNode.hh"
+#include "ignition/rendering/cpu/CpuRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Cpu implementation of the visual class
+    class IGNITION_RENDERING_CPU_VISIBLE CpuVisual :
+      public BaseVisual<CpuNode>
+    {
+      /// \brief Constructor
+      protected: CpuVisual();
+
+      /// \brief Destructor
+      public: virtual ~CpuVisual();
+
+      // Documentation inherited.
+      public: virtual void SetVisible(bool _visible) override;
+
+      /// \brief Get whether the visual is visible. Hidden visuals hide
+      /// their children too.
+      /// \return True if the visual is visible
+      public: bool Visible() const;
+
+      // Documentation inherited.
+      public: virtual ignition::math::AxisAlignedBox BoundingBox()
+                  const override;
+
+      // Documentation inherited.
+      public: virtual ignition::math::AxisAlignedBox LocalBoundingBox()
+                  const override;
+
+      /// \brief Recursively loop through this visual's children
+      /// to obtain the bounding box.
+      /// \param[in,out] _box The bounding box.
+      /// \param[in] _local A flag indicating if the local bounding box is to
+      /// be calculated.
+      /// \param[in] _pose World pose of the visual
+      private: void BoundsHelper(ignition::math::AxisAlignedBox &_box,
+                   bool _local, const ignition::math::Pose3d &_pose) const;
+
+      // Documentation inherited.
+      protected: virtual GeometryStorePtr Geometries() const override;
+
+      // Documentation inherited.
+      protected: virtual bool AttachGeometry(GeometryPtr _geometry) override;
+
+      // Documentation inherited.
+      protected: virtual bool DetachGeometry(GeometryPtr _geometry) override;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      /// \brief Get a shared pointer to this.
+      /// \return Shared pointer to this
+      private: CpuVisualPtr SharedThis();
+
+      /// \brief Pointer to the attached geometries
+      protected: CpuGeometryStorePtr geometries;
+
+      /// \brief True if the visual is visible
+      protected: bool visible = true;
+
+      /// \brief Make scene our friend so it can create cpu visuals
+      private: friend class CpuScene;
+    };
+    }
+  }
+}
+#endif
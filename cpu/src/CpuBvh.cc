@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "CpuBvh.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Maximum number of triangles of a leaf
+static const unsigned int kLeafSize = 4u;
+
+/// \brief Maximum depth of the traversal stack
+static const unsigned int kStackSize = 64u;
+
+/// \brief Maximum depth of a leaf. The traversal stack holds one sibling
+/// per level above the current node plus its two children, so it can not
+/// overflow. Median splits keep the hierarchy balanced, this only caps
+/// degenerate inputs, whose deepest leaves then get more triangles.
+static const unsigned int kMaxDepth = kStackSize - 2u;
+
+//////////////////////////////////////////////////
+void CpuBvh::Build(const CpuSceneData &_data)
+{
+  this->data = &_data;
+  this->nodes.clear();
+
+  unsigned int count = static_cast<unsigned int>(_data.triangles.size());
+  this->order.resize(count);
+  std::iota(this->order.begin(), this->order.end(), 0u);
+  this->centroids.resize(count);
+  for (unsigned int i = 0u; i < count; ++i)
+  {
+    const CpuTriangle &tri = _data.triangles[i];
+    this->centroids[i] =
+        (tri.vertices[0] + tri.vertices[1] + tri.vertices[2]) / 3.0f;
+  }
+
+  if (count == 0u)
+    return;
+
+  // a binary tree with leaves of at least one triangle
+  this->nodes.reserve(2u * count);
+  this->BuildNode(0u, count, 0u);
+}
+
+//////////////////////////////////////////////////
+unsigned int CpuBvh::BuildNode(unsigned int _begin, unsigned int _end,
+    unsigned int _depth)
+{
+  unsigned int index = static_cast<unsigned int>(this->nodes.size());
+  this->nodes.emplace_back();
+
+  Node node;
+  math::Vector3f cMin(this->centroids[this->order[_begin]]);
+  math::Vector3f cMax(cMin);
+  for (unsigned int k = 0u; k < 3u; ++k)
+  {
+    node.min[k] = std::numeric_limits<float>::max();
+    node.max[k] = -std::numeric_limits<float>::max();
+  }
+  for (unsigned int i = _begin; i < _end; ++i)
+  {
+    const CpuTriangle &tri = this->data->triangles[this->order[i]];
+    for (const auto &v : tri.vertices)
+    {
+      for (unsigned int k = 0u; k < 3u; ++k)
+      {
+        node.min[k] = std::min(node.min[k], v[k]);
+        node.max[k] = std::max(node.max[k], v[k]);
+      }
+    }
+    cMin.Min(this->centroids[this->order[i]]);
+    cMax.Max(this->centroids[this->order[i]]);
+  }
+
+  // split along the longest axis of the centroids
+  math::Vector3f extent = cMax - cMin;
+  unsigned int axis = 0u;
+  if (extent.Y() > extent[axis])
+    axis = 1u;
+  if (extent.Z() > extent[axis])
+    axis = 2u;
+
+  if (_end - _begin <= kLeafSize || extent[axis] <= 0.0f ||
+      _depth >= kMaxDepth)
+  {
+    node.index = _begin;
+    node.count = _end - _begin;
+    node.axis = 0u;
+    this->nodes[index] = node;
+    return index;
+  }
+
+  unsigned int mid = _begin + (_end - _begin) / 2u;
+  std::nth_element(this->order.begin() + _begin, this->order.begin() + mid,
+      this->order.begin() + _end,
+      [this, axis](unsigned int _a, unsigned int _b)
+      {
+        return this->centroids[_a][axis] < this->centroids[_b][axis];
+      });
+
+  // the first child is built right after this node
+  this->BuildNode(_begin, mid, _depth + 1u);
+  node.index = this->BuildNode(mid, _end, _depth + 1u);
+  node.count = 0u;
+  node.axis = axis;
+  this->nodes[index] = node;
+  return index;
+}
+
+//////////////////////////////////////////////////
+bool CpuBvh::Intersect(const math::Vector3f &_origin,
+    const math::Vector3f &_dir, float _min, float _max, uint32_t _mask,
+    CpuHit &_hit) const
+{
+  if (this->nodes.empty())
+    return false;
+
+  const float origin[3] = {_origin.X(), _origin.Y(), _origin.Z()};
+  const float invDir[3] = {1.0f / _dir.X(), 1.0f / _dir.Y(), 1.0f / _dir.Z()};
+
+  float closest = _max;
+  bool found = false;
+  unsigned int stack[kStackSize];
+  unsigned int size = 0u;
+  stack[size++] = 0u;
+  while (size > 0u)
+  {
+    unsigned int nodeIndex = stack[--size];
+    const Node &node = this->nodes[nodeIndex];
+
+    // slab test against the bounding box
+    float tMin = _min;
+    float tMax = closest;
+    for (unsigned int k = 0u; k < 3u; ++k)
+    {
+      float t0 = (node.min[k] - origin[k]) * invDir[k];
+      float t1 = (node.max[k] - origin[k]) * invDir[k];
+      if (t0 > t1)
+        std::swap(t0, t1);
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+    }
+    if (tMin > tMax)
+      continue;
+
+    if (node.count > 0u)
+    {
+      for (unsigned int i = node.index; i < node.index + node.count; ++i)
+      {
+        unsigned int triIndex = this->order[i];
+        const CpuTriangle &tri = this->data->triangles[triIndex];
+
+        // Moller-Trumbore
+        math::Vector3f e1 = tri.vertices[1] - tri.vertices[0];
+        math::Vector3f e2 = tri.vertices[2] - tri.vertices[0];
+        math::Vector3f p = _dir.Cross(e2);
+        float det = e1.Dot(p);
+        if (std::abs(det) < 1e-12f)
+          continue;
+        float invDet = 1.0f / det;
+        math::Vector3f s = _origin - tri.vertices[0];
+        float u = s.Dot(p) * invDet;
+        if (u < 0.0f || u > 1.0f)
+          continue;
+        math::Vector3f q = s.Cross(e1);
+        float v = _dir.Dot(q) * invDet;
+        if (v < 0.0f || u + v > 1.0f)
+          continue;
+        float t = e2.Dot(q) * invDet;
+        if (t < _min || t >= closest)
+          continue;
+        if (!(this->data->surfaces[tri.surface].visibilityFlags & _mask))
+          continue;
+
+        closest = t;
+        _hit.distance = t;
+        _hit.triangle = triIndex;
+        _hit.u = u;
+        _hit.v = v;
+        found = true;
+      }
+      continue;
+    }
+
+    // visit the child nearer to the ray origin first
+    unsigned int first = nodeIndex + 1u;
+    unsigned int second = node.index;
+    if (invDir[node.axis] < 0.0f)
+      std::swap(first, second);
+    // guaranteed by the depth limit of the hierarchy
+    assert(size + 2u <= kStackSize);
+    stack[size++] = second;
+    stack[size++] = first;
+  }
+  return found;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUBVH_HH_
+#define IGNITION_RENDERING_CPU_CPUBVH_HH_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/cpu/Export.hh"
+
+#include "CpuSceneData.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Closest intersection of a ray with the triangles of a scene
+    struct CpuHit
+    {
+      /// \brief Distance along the ray
+      float distance = std::numeric_limits<float>::infinity();
+
+      /// \brief Index of the triangle hit
+      unsigned int triangle = std::numeric_limits<unsigned int>::max();
+
+      /// \brief Barycentric coordinate of the second vertex
+      float u = 0.0f;
+
+      /// \brief Barycentric coordinate of the third vertex
+      float v = 0.0f;
+    };
+
+    /// \brief Bounding volume hierarchy over the triangles of a scene, used
+    /// to cast the rays of lidars and ray queries
+    class IGNITION_RENDERING_CPU_VISIBLE CpuBvh
+    {
+      /// \brief Build the hierarchy over the triangles of a scene. The scene
+      /// data must outlive the hierarchy or the next call to Build.
+      /// \param[in] _data Scene data
+      public: void Build(const CpuSceneData &_data);
+
+      /// \brief Find the closest triangle hit by a ray. Triangles are double
+      /// sided.
+      /// \param[in] _origin Ray origin
+      /// \param[in] _dir Normalized ray direction
+      /// \param[in] _min Minimum distance of a hit
+      /// \param[in] _max Maximum distance of a hit
+      /// \param[in] _mask Visibility mask, triangles of visuals whose
+      /// visibility flags do not match are ignored
+      /// \param[out] _hit Closest hit
+      /// \return True if a triangle was hit
+      public: bool Intersect(const math::Vector3f &_origin,
+                  const math::Vector3f &_dir, float _min, float _max,
+                  uint32_t _mask, CpuHit &_hit) const;
+
+      /// \brief Node of the hierarchy. Inner nodes have their first child
+      /// right after them.
+      private: struct Node
+      {
+        /// \brief Minimum corner of the bounding box
+        float min[3];
+
+        /// \brief Maximum corner of the bounding box
+        float max[3];
+
+        /// \brief First triangle of a leaf, or index of the second child of
+        /// an inner node
+        unsigned int index;
+
+        /// \brief Number of triangles of a leaf, 0 for inner nodes
+        unsigned int count;
+
+        /// \brief Axis an inner node is split along
+        unsigned int axis;
+      };
+
+      /// \brief Build the subtree over a range of the triangle order
+      /// \param[in] _begin First triangle
+      /// \param[in] _end One past the last triangle
+      /// \param[in] _depth Depth of the subtree root
+      /// \return Index of the subtree root
+      private: unsigned int BuildNode(unsigned int _begin, unsigned int _end,
+                   unsigned int _depth);
+
+      /// \brief Scene data the hierarchy was built over
+      private: const CpuSceneData *data = nullptr;
+
+      /// \brief Nodes, the root first
+      private: std::vector<Node> nodes;
+
+      /// \brief Triangle indices in leaf order
+      private: std::vector<unsigned int> order;
+
+      /// \brief Centroids of the triangles
+      private: std::vector<math::Vector3f> centroids;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,400 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "CpuBvh.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Visibility flags of the test surfaces
+static const uint32_t kFlags = 0x1u;
+
+/////////////////////////////////////////////////
+/// \brief Find the closest triangle hit by a ray by testing all triangles
+/// \param[in] _data Scene data
+/// \param[in] _origin Ray origin
+/// \param[in] _dir Normalized ray direction
+/// \param[in] _min Minimum distance of a hit
+/// \param[in] _max Maximum distance of a hit
+/// \param[in] _mask Visibility mask
+/// \param[out] _hit Closest hit
+/// \return True if a triangle was hit
+static bool BruteForceIntersect(const CpuSceneData &_data,
+    const math::Vector3f &_origin, const math::Vector3f &_dir, float _min,
+    float _max, uint32_t _mask, CpuHit &_hit)
+{
+  bool found = false;
+  float closest = _max;
+  for (unsigned int i = 0u; i < _data.triangles.size(); ++i)
+  {
+    const CpuTriangle &tri = _data.triangles[i];
+    if (!(_data.surfaces[tri.surface].visibilityFlags & _mask))
+      continue;
+
+    math::Vector3f e1 = tri.vertices[1] - tri.vertices[0];
+    math::Vector3f e2 = tri.vertices[2] - tri.vertices[0];
+    math::Vector3f p = _dir.Cross(e2);
+    float det = e1.Dot(p);
+    if (std::abs(det) < 1e-12f)
+      continue;
+    float invDet = 1.0f / det;
+    math::Vector3f s = _origin - tri.vertices[0];
+    float u = s.Dot(p) * invDet;
+    if (u < 0.0f || u > 1.0f)
+      continue;
+    math::Vector3f q = s.Cross(e1);
+    float v = _dir.Dot(q) * invDet;
+    if (v < 0.0f || u + v > 1.0f)
+      continue;
+    float t = e2.Dot(q) * invDet;
+    if (t < _min || t >= closest)
+      continue;
+
+    closest = t;
+    _hit.distance = t;
+    _hit.triangle = i;
+    found = true;
+  }
+  return found;
+}
+
+/////////////////////////////////////////////////
+/// \brief Add a triangle to a scene
+/// \param[in] _data Scene data
+/// \param[in] _a First vertex
+/// \param[in] _b Second vertex
+/// \param[in] _c Third vertex
+/// \param[in] _surface Surface index
+static void AddTriangle(CpuSceneData &_data, const math::Vector3f &_a,
+    const math::Vector3f &_b, const math::Vector3f &_c,
+    unsigned int _surface = 0u)
+{
+  CpuTriangle tri;
+  tri.vertices[0] = _a;
+  tri.vertices[1] = _b;
+  tri.vertices[2] = _c;
+  tri.surface = _surface;
+  _data.triangles.push_back(tri);
+}
+
+/////////////////////////////////////////////////
+/// \brief Fill a scene with random triangles in a cube
+/// \param[in] _data Scene data
+/// \param[in] _count Number of triangles
+/// \param[in] _rng Random number generator
+static void RandomTriangles(CpuSceneData &_data, unsigned int _count,
+    std::mt19937 &_rng)
+{
+  std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+  std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+  CpuSurface surface;
+  surface.visibilityFlags = kFlags;
+  _data.surfaces.push_back(surface);
+  for (unsigned int i = 0u; i < _count; ++i)
+  {
+    math::Vector3f center(position(_rng), position(_rng), position(_rng));
+    math::Vector3f vertices[3];
+    for (auto &v : vertices)
+      v = center + math::Vector3f(offset(_rng), offset(_rng), offset(_rng));
+    AddTriangle(_data, vertices[0], vertices[1], vertices[2]);
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Get a random normalized direction
+/// \param[in] _rng Random number generator
+/// \return Direction
+static math::Vector3f RandomDirection(std::mt19937 &_rng)
+{
+  std::normal_distribution<float> normal;
+  math::Vector3f dir;
+  do
+  {
+    dir.Set(normal(_rng), normal(_rng), normal(_rng));
+  } while (dir.Length() < 1e-3f);
+  return dir.Normalize();
+}
+
+/////////////////////////////////////////////////
+TEST(CpuBvhTest, Empty)
+{
+  CpuSceneData data;
+  CpuBvh bvh;
+  bvh.Build(data);
+
+  CpuHit hit;
+  EXPECT_FALSE(bvh.Intersect(math::Vector3f::Zero, math::Vector3f::UnitX,
+      0.0f, 100.0f, kFlags, hit));
+  EXPECT_FALSE(std::isfinite(hit.distance));
+}
+
+/////////////////////////////////////////////////
+TEST(CpuBvhTest, SingleTriangle)
+{
+  CpuSceneData data;
+  CpuSurface surface;
+  surface.visibilityFlags = kFlags;
+  data.surfaces.push_back(surface);
+  AddTriangle(data, math::Vector3f(2, -1, -1), math::Vector3f(2, 1, -1),
+      math::Vector3f(2, 0, 1));
+
+  CpuBvh bvh;
+  bvh.Build(data);
+
+  // hit from both sides
+  CpuHit hit;
+  EXPECT_TRUE(bvh.Intersect(math::Vector3f::Zero, math::Vector3f::UnitX,
+      0.0f, 100.0f, kFlags, hit));
+  EXPECT_FLOAT_EQ(2.0f, hit.distance);
+  EXPECT_EQ(0u, hit.triangle);
+  EXPECT_FLOAT_EQ(0.25f, hit.u);
+  EXPECT_FLOAT_EQ(0.5f, hit.v);
+
+  hit = CpuHit();
+  EXPECT_TRUE(bvh.Intersect(math::Vector3f(4, 0, 0), -math::Vector3f::UnitX,
+      0.0f, 100.0f, kFlags, hit));
+  EXPECT_FLOAT_EQ(2.0f, hit.distance);
+
+  // pointing away, out of range, beside the triangle and masked out
+  hit = CpuHit();
+  EXPECT_FALSE(bvh.Intersect(math::Vector3f::Zero, -math::Vector3f::UnitX,
+      0.0f, 100.0f, kFlags, hit));
+  EXPECT_FALSE(bvh.Intersect(math::Vector3f::Zero, math::Vector3f::UnitX,
+      0.0f, 1.5f, kFlags, hit));
+  EXPECT_FALSE(bvh.Intersect(math::Vector3f::Zero, math::Vector3f::UnitX,
+      2.5f, 100.0f, kFlags, hit));
+  EXPECT_FALSE(bvh.Intersect(math::Vector3f(0, 2, 0), math::Vector3f::UnitX,
+      0.0f, 100.0f, kFlags, hit));
+  EXPECT_FALSE(bvh.Intersect(math::Vector3f::Zero, math::Vector3f::UnitX,
+      0.0f, 100.0f, ~kFlags, hit));
+  EXPECT_FALSE(std::isfinite(hit.distance));
+}
+
+/////////////////////////////////////////////////
+TEST(CpuBvhTest, RandomRays)
+{
+  std::mt19937 rng(1234u);
+  CpuSceneData data;
+  RandomTriangles(data, 2000u, rng);
+
+  CpuBvh bvh;
+  bvh.Build(data);
+
+  // rays from inside and outside of the triangle cloud, both hits and
+  // misses must match testing every triangle
+  std::uniform_real_distribution<float> position(-15.0f, 15.0f);
+  unsigned int hits = 0u;
+  unsigned int misses = 0u;
+  for (unsigned int i = 0u; i < 5000u; ++i)
+  {
+    math::Vector3f origin(position(rng), position(rng), position(rng));
+    math::Vector3f dir = RandomDirection(rng);
+    float minRange = (i % 3u == 0u) ? 1.0f : 0.0f;
+    float maxRange = (i % 2u == 0u) ? 8.0f : 100.0f;
+
+    CpuHit expected;
+    bool expectedFound = BruteForceIntersect(data, origin, dir, minRange,
+        maxRange, kFlags, expected);
+    CpuHit hit;
+    bool found = bvh.Intersect(origin, dir, minRange, maxRange, kFlags, hit);
+    ASSERT_EQ(expectedFound, found) << "ray " << i;
+    if (found)
+    {
+      EXPECT_FLOAT_EQ(expected.distance, hit.distance) << "ray " << i;
+      EXPECT_EQ(expected.triangle, hit.triangle) << "ray " << i;
+      EXPECT_GE(hit.distance, minRange);
+      EXPECT_LT(hit.distance, maxRange);
+      ++hits;
+    }
+    else
+    {
+      ++misses;
+    }
+  }
+
+  // make sure both cases were covered
+  EXPECT_GT(hits, 500u);
+  EXPECT_GT(misses, 500u);
+}
+
+/////////////////////////////////////////////////
+TEST(CpuBvhTest, AxisAlignedRays)
+{
+  // rays parallel to the axes have infinite inverse components in the slab
+  // test
+  std::mt19937 rng(42u);
+  CpuSceneData data;
+  RandomTriangles(data, 500u, rng);
+
+  CpuBvh bvh;
+  bvh.Build(data);
+
+  std::uniform_real_distribution<float> position(-12.0f, 12.0f);
+  const math::Vector3f axes[] = {math::Vector3f::UnitX, math::Vector3f::UnitY,
+      math::Vector3f::UnitZ, -math::Vector3f::UnitX, -math::Vector3f::UnitY,
+      -math::Vector3f::UnitZ};
+  unsigned int hits = 0u;
+  for (unsigned int i = 0u; i < 3000u; ++i)
+  {
+    math::Vector3f origin(position(rng), position(rng), position(rng));
+    const math::Vector3f &dir = axes[i % 6u];
+
+    CpuHit expected;
+    bool expectedFound = BruteForceIntersect(data, origin, dir, 0.0f,
+        100.0f, kFlags, expected);
+    CpuHit hit;
+    bool found = bvh.Intersect(origin, dir, 0.0f, 100.0f, kFlags, hit);
+    ASSERT_EQ(expectedFound, found) << "ray " << i;
+    if (found)
+    {
+      EXPECT_FLOAT_EQ(expected.distance, hit.distance) << "ray " << i;
+      EXPECT_EQ(expected.triangle, hit.triangle) << "ray " << i;
+      ++hits;
+    }
+  }
+  EXPECT_GT(hits, 100u);
+}
+
+/////////////////////////////////////////////////
+TEST(CpuBvhTest, VisibilityMask)
+{
+  std::mt19937 rng(7u);
+  CpuSceneData data;
+  RandomTriangles(data, 1000u, rng);
+
+  // every other triangle is on a surface the mask filters out
+  CpuSurface hidden;
+  hidden.visibilityFlags = 0x2u;
+  data.surfaces.push_back(hidden);
+  for (unsigned int i = 0u; i < data.triangles.size(); i += 2u)
+    data.triangles[i].surface = 1u;
+
+  CpuBvh bvh;
+  bvh.Build(data);
+
+  std::uniform_real_distribution<float> position(-15.0f, 15.0f);
+  for (unsigned int i = 0u; i < 2000u; ++i)
+  {
+    math::Vector3f origin(position(rng), position(rng), position(rng));
+    math::Vector3f dir = RandomDirection(rng);
+    for (uint32_t mask : {kFlags, 0x2u, 0x3u})
+    {
+      CpuHit expected;
+      bool expectedFound = BruteForceIntersect(data, origin, dir, 0.0f,
+          100.0f, mask, expected);
+      CpuHit hit;
+      bool found = bvh.Intersect(origin, dir, 0.0f, 100.0f, mask, hit);
+      ASSERT_EQ(expectedFound, found) << "ray " << i << " mask " << mask;
+      if (found)
+      {
+        EXPECT_EQ(expected.triangle, hit.triangle);
+        if (mask == kFlags)
+        {
+          EXPECT_EQ(1u, hit.triangle % 2u);
+        }
+        else if (mask == 0x2u)
+        {
+          EXPECT_EQ(0u, hit.triangle % 2u);
+        }
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(CpuBvhTest, Degenerate)
+{
+  // many triangles sharing a centroid can not be split, and flat triangles
+  // have a flat bounding box
+  CpuSceneData data;
+  CpuSurface surface;
+  surface.visibilityFlags = kFlags;
+  data.surfaces.push_back(surface);
+  for (unsigned int i = 0u; i < 1000u; ++i)
+  {
+    float angle = i * 0.01f;
+    math::Vector3f a(std::cos(angle), std::sin(angle), 0.0f);
+    math::Vector3f b(std::cos(angle + 2.0944f), std::sin(angle + 2.0944f),
+        0.0f);
+    math::Vector3f c(std::cos(angle + 4.1888f), std::sin(angle + 4.1888f),
+        0.0f);
+    AddTriangle(data, a, b, c);
+  }
+  // a row of triangles along x in the plane z = 0
+  for (unsigned int i = 0u; i < 1000u; ++i)
+  {
+    float x = 2.0f + i * 0.1f;
+    AddTriangle(data, math::Vector3f(x, -0.05f, 0.0f),
+        math::Vector3f(x + 0.1f, -0.05f, 0.0f),
+        math::Vector3f(x + 0.05f, 0.05f, 0.0f));
+  }
+
+  CpuBvh bvh;
+  bvh.Build(data);
+
+  // straight down through the shared centroid
+  CpuHit hit;
+  EXPECT_TRUE(bvh.Intersect(math::Vector3f(0, 0, 5), -math::Vector3f::UnitZ,
+      0.0f, 100.0f, kFlags, hit));
+  EXPECT_FLOAT_EQ(5.0f, hit.distance);
+
+  // down onto every 10th triangle of the row, and between rows
+  for (unsigned int i = 0u; i < 1000u; i += 10u)
+  {
+    float x = 2.0f + i * 0.1f + 0.05f;
+    hit = CpuHit();
+    EXPECT_TRUE(bvh.Intersect(math::Vector3f(x, 0, 1),
+        -math::Vector3f::UnitZ, 0.0f, 100.0f, kFlags, hit)) << i;
+    EXPECT_FLOAT_EQ(1.0f, hit.distance);
+    EXPECT_FALSE(bvh.Intersect(math::Vector3f(x, 0.2f, 1),
+        -math::Vector3f::UnitZ, 0.0f, 100.0f, kFlags, hit)) << i;
+  }
+
+  // random rays against the brute force result
+  std::mt19937 rng(99u);
+  std::uniform_real_distribution<float> position(-5.0f, 110.0f);
+  std::uniform_real_distribution<float> height(-3.0f, 3.0f);
+  for (unsigned int i = 0u; i < 2000u; ++i)
+  {
+    math::Vector3f origin(position(rng), height(rng), height(rng));
+    math::Vector3f dir = RandomDirection(rng);
+    CpuHit expected;
+    bool expectedFound = BruteForceIntersect(data, origin, dir, 0.0f,
+        100.0f, kFlags, expected);
+    hit = CpuHit();
+    bool found = bvh.Intersect(origin, dir, 0.0f, 100.0f, kFlags, hit);
+    ASSERT_EQ(expectedFound, found) << "ray " << i;
+    if (found)
+    {
+      EXPECT_FLOAT_EQ(expected.distance, hit.distance) << "ray " << i;
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
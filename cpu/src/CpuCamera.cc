@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/PixelFormat.hh"
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/cpu/CpuCamera.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+
+#include "CpuRasterizer.hh"
+#include "CpuShading.hh"
+#include "CpuWorkers.hh"
+
+/// \brief Private data for the CpuCamera class
+class ignition::rendering::CpuCameraPrivate
+{
+  /// \brief Rasterizer of the color image
+  public: CpuRasterizer rasterizer;
+
+  /// \brief Fragments of the color image
+  public: std::vector<CpuFragment> fragments;
+
+  /// \brief Rasterizer of the id buffer
+  public: CpuRasterizer idRasterizer;
+
+  /// \brief Fragments of the id buffer
+  public: std::vector<CpuFragment> idFragments;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuCamera::CpuCamera()
+  : dataPtr(new CpuCameraPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+CpuCamera::~CpuCamera()
+{
+}
+
+//////////////////////////////////////////////////
+void CpuCamera::Init()
+{
+  BaseCamera::Init();
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->renderTexture = std::dynamic_pointer_cast<CpuRenderTexture>(base);
+  this->renderTexture->SetFormat(PF_R8G8B8);
+  this->Reset();
+}
+
+//////////////////////////////////////////////////
+void CpuCamera::SetImageFormat(PixelFormat _format)
+{
+  switch (_format)
+  {
+    case PF_R8G8B8:
+    case PF_B8G8R8:
+    case PF_R8G8B8A8:
+    case PF_B8G8R8A8:
+      BaseCamera::SetImageFormat(_format);
+      break;
+    default:
+      ignerr << "Image format not supported by cpu camera: "
+             << PixelUtil::Name(_format) << ", using "
+             << PixelUtil::Name(PF_R8G8B8) << std::endl;
+      BaseCamera::SetImageFormat(PF_R8G8B8);
+      break;
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuCamera::Render()
+{
+  IGN_RENDERING_TRACE_ZONE("CpuCamera::Render");
+  auto start = std::chrono::steady_clock::now();
+
+  const CpuSceneData &data = this->scene->SceneData();
+  unsigned int width = this->ImageWidth();
+  unsigned int height = this->ImageHeight();
+  PixelFormat format = this->ImageFormat();
+  unsigned int channels = PixelUtil::ChannelCount(format);
+  bool bgr = format == PF_B8G8R8 || format == PF_B8G8R8A8;
+
+  this->renderStats = rendering::RenderStats();
+  unsigned char *out = this->renderTexture->Data();
+  if (!out || this->renderTexture->DataSize() !=
+      PixelUtil::MemorySize(format, width, height))
+  {
+    return;
+  }
+
+  CpuView view;
+  view.pose = this->WorldPose();
+  view.width = width;
+  view.height = height;
+  view.hfov = this->HFOV().Radian();
+  view.aspect = this->AspectRatio();
+  view.near = this->NearClipPlane();
+  view.far = this->FarClipPlane();
+  view.mask = this->VisibilityMask();
+  this->dataPtr->rasterizer.Render(data, view, this->dataPtr->fragments);
+
+  // shade the image row by row on the workers
+  math::Vector3f eye(view.pose.Pos().X(), view.pose.Pos().Y(),
+      view.pose.Pos().Z());
+  const std::vector<CpuFragment> &fragments = this->dataPtr->fragments;
+  CpuWorkers::Instance().Run(height, [&](unsigned int _row)
+  {
+    unsigned char *pixel = out + static_cast<size_t>(_row) * width * channels;
+    const CpuFragment *fragment = &fragments[static_cast<size_t>(_row) * width];
+    for (unsigned int x = 0; x < width; ++x, pixel += channels, ++fragment)
+    {
+      math::Color color = CpuShade(data, *fragment, eye);
+      uint8_t r = static_cast<uint8_t>(
+          std::clamp(color.R(), 0.0f, 1.0f) * 255.0f + 0.5f);
+      uint8_t g = static_cast<uint8_t>(
+          std::clamp(color.G(), 0.0f, 1.0f) * 255.0f + 0.5f);
+      uint8_t b = static_cast<uint8_t>(
+          std::clamp(color.B(), 0.0f, 1.0f) * 255.0f + 0.5f);
+      pixel[0] = bgr ? b : r;
+      pixel[1] = g;
+      pixel[2] = bgr ? r : b;
+      if (channels == 4u)
+      {
+        pixel[3] = static_cast<uint8_t>(
+            std::clamp(color.A(), 0.0f, 1.0f) * 255.0f + 0.5f);
+      }
+    }
+  });
+
+  // every submesh of the scene counts as one draw call
+  this->renderStats.drawCalls =
+      static_cast<unsigned int>(data.surfaces.size());
+  this->renderStats.passCount = 1u;
+  this->renderStats.triangles = this->dataPtr->rasterizer.TriangleCount();
+  this->renderStats.cpuTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+//////////////////////////////////////////////////
+VisualPtr CpuCamera::VisualAt(const ignition::math::Vector2i &_mousePos)
+{
+  std::map<unsigned int, unsigned int> visuals = this->VisualsAt({_mousePos});
+  if (visuals.empty())
+    return VisualPtr();
+  return this->scene->VisualById(visuals.begin()->first);
+}
+
+//////////////////////////////////////////////////
+RenderTargetPtr CpuCamera::RenderTarget() const
+{
+  return this->renderTexture;
+}
+
+//////////////////////////////////////////////////
+bool CpuCamera::RenderIds(unsigned int _width, unsigned int _height,
+    std::vector<unsigned int> &_ids)
+{
+  IGN_RENDERING_TRACE_ZONE("CpuCamera::RenderIds");
+  const CpuSceneData &data = this->scene->SceneData();
+
+  CpuView view;
+  view.pose = this->WorldPose();
+  view.width = _width;
+  view.height = _height;
+  view.hfov = this->HFOV().Radian();
+  view.aspect = this->AspectRatio();
+  view.near = this->NearClipPlane();
+  view.far = this->FarClipPlane();
+  view.mask = this->VisibilityMask();
+  this->dataPtr->idRasterizer.Render(data, view, this->dataPtr->idFragments);
+
+  _ids.resize(this->dataPtr->idFragments.size());
+  for (size_t i = 0; i < _ids.size(); ++i)
+  {
+    unsigned int triangle = this->dataPtr->idFragments[i].triangle;
+    _ids[i] = (triangle < data.triangles.size()) ?
+        data.surfaces[data.triangles[triangle].surface].visualId : 0u;
+  }
+  return true;
+}
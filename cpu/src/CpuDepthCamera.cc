@@ -0,0 +1,259 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/cpu/CpuDepthCamera.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+
+#include "CpuRasterizer.hh"
+#include "CpuShading.hh"
+#include "CpuWorkers.hh"
+
+/// \brief Private data for the CpuDepthCamera class
+class ignition::rendering::CpuDepthCameraPrivate
+{
+  /// \brief Rasterizer of the depth image
+  public: CpuRasterizer rasterizer;
+
+  /// \brief Fragments of the depth image
+  public: std::vector<CpuFragment> fragments;
+
+  /// \brief Depth image
+  public: std::vector<float> depth;
+
+  /// \brief Point cloud, four floats per point
+  public: std::vector<float> pointCloud;
+
+  /// \brief Event used to emit depth frames
+  public: ignition::common::EventT<void(const float *, unsigned int,
+              unsigned int, unsigned int, const std::string &)> newDepthFrame;
+
+  /// \brief Event used to emit point clouds
+  public: ignition::common::EventT<void(const float *, unsigned int,
+              unsigned int, unsigned int, const std::string &)>
+              newRgbPointCloud;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Near clip distance the scene is rasterized with, so that
+/// surfaces in front of the near clip plane of the camera can be reported
+static const double kRasterNear = 1e-4;
+
+//////////////////////////////////////////////////
+CpuDepthCamera::CpuDepthCamera()
+  : dataPtr(new CpuDepthCameraPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+CpuDepthCamera::~CpuDepthCamera()
+{
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCamera::Init()
+{
+  BaseDepthCamera::Init();
+  this->CreateDepthTexture();
+  this->Reset();
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCamera::CreateDepthTexture()
+{
+  if (this->depthTexture)
+    return;
+
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->depthTexture = std::dynamic_pointer_cast<CpuRenderTexture>(base);
+  this->depthTexture->SetFormat(PF_FLOAT32_R);
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCamera::SetImageFormat(PixelFormat /*_format*/)
+{
+  // depth images are always single channel floats
+  BaseDepthCamera::SetImageFormat(PF_FLOAT32_R);
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCamera::Render()
+{
+  IGN_RENDERING_TRACE_ZONE("CpuDepthCamera::Render");
+  auto start = std::chrono::steady_clock::now();
+
+  const CpuSceneData &data = this->scene->SceneData();
+  unsigned int width = this->ImageWidth();
+  unsigned int height = this->ImageHeight();
+  double nearClip = this->NearClipPlane();
+
+  CpuView view;
+  view.pose = this->WorldPose();
+  view.width = width;
+  view.height = height;
+  view.hfov = this->HFOV().Radian();
+  view.aspect = this->AspectRatio();
+  view.near = kRasterNear;
+  view.far = this->FarClipPlane();
+  view.mask = this->VisibilityMask();
+  this->dataPtr->rasterizer.Render(data, view, this->dataPtr->fragments);
+
+  bool pointCloud = this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u;
+  size_t count = static_cast<size_t>(width) * height;
+  this->dataPtr->depth.resize(count);
+  if (pointCloud)
+    this->dataPtr->pointCloud.resize(count * 4u);
+
+  // inverse focal lengths of the rasterizer projection
+  double tanH = std::tan(view.hfov * 0.5);
+  double invFx = tanH / (width * 0.5);
+  double invFy = tanH / view.aspect / (height * 0.5);
+
+  const float posInf = std::numeric_limits<float>::infinity();
+  math::Vector3f eye(view.pose.Pos().X(), view.pose.Pos().Y(),
+      view.pose.Pos().Z());
+  CpuWorkers::Instance().Run(height, [&](unsigned int _row)
+  {
+    size_t offset = static_cast<size_t>(_row) * width;
+    const CpuFragment *fragment = &this->dataPtr->fragments[offset];
+    float *depth = &this->dataPtr->depth[offset];
+    for (unsigned int x = 0; x < width; ++x)
+    {
+      float d = fragment[x].depth;
+      if (fragment[x].triangle >= data.triangles.size())
+        d = posInf;
+      else if (d < nearClip)
+        d = -posInf;
+      depth[x] = d;
+
+      if (!pointCloud)
+        continue;
+
+      float *point = &this->dataPtr->pointCloud[(offset + x) * 4u];
+      if (std::isinf(d))
+      {
+        point[0] = point[1] = point[2] = d;
+      }
+      else
+      {
+        point[0] = d;
+        point[1] = static_cast<float>((width * 0.5 - (x + 0.5)) * invFx * d);
+        point[2] = static_cast<float>(
+            (height * 0.5 - (_row + 0.5)) * invFy * d);
+      }
+
+      // pack the color in the last float
+      math::Color color = CpuShade(data, fragment[x], eye);
+      uint32_t rgba =
+          static_cast<uint32_t>(color.R() * 255.0f + 0.5f) << 24 |
+          static_cast<uint32_t>(color.G() * 255.0f + 0.5f) << 16 |
+          static_cast<uint32_t>(color.B() * 255.0f + 0.5f) << 8 |
+          static_cast<uint32_t>(color.A() * 255.0f + 0.5f);
+      std::memcpy(&point[3], &rgba, sizeof(float));
+    }
+  });
+
+  // keep the render target in sync so that Copy returns the depth image
+  if (this->depthTexture->DataSize() == count * sizeof(float))
+  {
+    std::memcpy(this->depthTexture->Data(), this->dataPtr->depth.data(),
+        count * sizeof(float));
+  }
+
+  this->renderStats = rendering::RenderStats();
+  // every submesh of the scene counts as one draw call
+  this->renderStats.drawCalls =
+      static_cast<unsigned int>(data.surfaces.size());
+  this->renderStats.passCount = 1u;
+  this->renderStats.triangles = this->dataPtr->rasterizer.TriangleCount();
+  this->renderStats.cpuTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+//////////////////////////////////////////////////
+void CpuDepthCamera::PostRender()
+{
+  IGN_RENDERING_TRACE_ZONE("CpuDepthCamera::PostRender");
+  this->depthTexture->PostRender();
+
+  unsigned int width = this->ImageWidth();
+  unsigned int height = this->ImageHeight();
+  if (this->dataPtr->depth.size() != static_cast<size_t>(width) * height)
+    return;
+
+  {
+    IGN_RENDERING_TRACE_ZONE("CpuDepthCamera::NewDepthFrame");
+    this->dataPtr->newDepthFrame(
+        this->dataPtr->depth.data(), width, height, 1, "FLOAT32");
+  }
+  if (this->saveFrameEnabled)
+  {
+    this->SaveNextFrame(this->FrameImage(
+        this->dataPtr->depth.data(), width, height, PF_FLOAT32_R));
+  }
+
+  if (this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u &&
+      this->dataPtr->pointCloud.size() == this->dataPtr->depth.size() * 4u)
+  {
+    IGN_RENDERING_TRACE_ZONE("CpuDepthCamera::NewRgbPointCloud");
+    this->dataPtr->newRgbPointCloud(
+        this->dataPtr->pointCloud.data(), width, height, 4,
+        "PF_FLOAT32_RGBA");
+  }
+}
+
+//////////////////////////////////////////////////
+const float *CpuDepthCamera::DepthData() const
+{
+  if (this->dataPtr->depth.empty())
+    return nullptr;
+  return this->dataPtr->depth.data();
+}
+
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr CpuDepthCamera::ConnectNewDepthFrame(
+    std::function<void(const float *, unsigned int, unsigned int,
+      unsigned int, const std::string &)>  _subscriber)
+{
+  return this->dataPtr->newDepthFrame.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr CpuDepthCamera::ConnectNewRgbPointCloud(
+    std::function<void(const float *, unsigned int, unsigned int,
+      unsigned int, const std::string &)>  _subscriber)
+{
+  return this->dataPtr->newRgbPointCloud.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+RenderTargetPtr CpuDepthCamera::RenderTarget() const
+{
+  return this->depthTexture;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "ignition/rendering/cpu/CpuGeometry.hh"
+
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuVisual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuGeometry::CpuGeometry()
+{
+}
+
+//////////////////////////////////////////////////
+CpuGeometry::~CpuGeometry()
+{
+}
+
+//////////////////////////////////////////////////
+bool CpuGeometry::HasParent() const
+{
+  return this->parent != nullptr;
+}
+
+//////////////////////////////////////////////////
+VisualPtr CpuGeometry::Parent() const
+{
+  return this->parent;
+}
+
+//////////////////////////////////////////////////
+math::AxisAlignedBox CpuGeometry::LocalBounds() const
+{
+  return math::AxisAlignedBox();
+}
+
+//////////////////////////////////////////////////
+void CpuGeometry::SetParent(CpuVisualPtr _parent)
+{
+  this->parent = _parent;
+}
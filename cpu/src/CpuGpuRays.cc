@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Event.hh>
+
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/cpu/CpuGpuRays.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+
+#include "CpuBvh.hh"
+#include "CpuWorkers.hh"
+
+/// \brief Private data for the CpuGpuRays class
+class ignition::rendering::CpuGpuRaysPrivate
+{
+  /// \brief Range of every reading, row by row from the minimum vertical
+  /// angle
+  public: std::vector<float> ranges;
+
+  /// \brief Retro value of every reading
+  public: std::vector<float> retros;
+
+  /// \brief Float readings in the layout of the data format, used by the
+  /// newGpuRaysFrame event
+  public: std::vector<float> scan;
+
+  /// \brief Readings of the data formats that do not store floats only
+  public: std::vector<unsigned char> buffer;
+
+  /// \brief Width of the last readings
+  public: unsigned int width = 0u;
+
+  /// \brief Height of the last readings
+  public: unsigned int height = 0u;
+
+  /// \brief Data format of the last readings
+  public: GpuRaysDataFormat format = GRDF_RANGE_RETRO;
+
+  /// \brief Event triggered when new float readings are available
+  public: ignition::common::EventT<void(const float *,
+              unsigned int, unsigned int, unsigned int,
+              const std::string &)> newGpuRaysFrame;
+
+  /// \brief Event triggered when new readings are available, in any data
+  /// format
+  public: ignition::common::EventT<void(const void *,
+              unsigned int, unsigned int, unsigned int,
+              const std::string &)> newGpuRaysData;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Largest retro value reported
+static const float kMaxRetro = 2000.0f;
+
+//////////////////////////////////////////////////
+CpuGpuRays::CpuGpuRays()
+  : dataPtr(new CpuGpuRaysPrivate)
+{
+}
+
+//////////////////////////////////////////////////
+CpuGpuRays::~CpuGpuRays()
+{
+}
+
+//////////////////////////////////////////////////
+void CpuGpuRays::Init()
+{
+  BaseGpuRays::Init();
+
+  // create dummy render texture
+  RenderTexturePtr base = this->scene->CreateRenderTexture();
+  this->renderTexture = std::dynamic_pointer_cast<CpuRenderTexture>(base);
+  this->renderTexture->SetFormat(PF_FLOAT32_RGB);
+  this->renderTexture->SetWidth(1);
+  this->renderTexture->SetHeight(1);
+}
+
+//////////////////////////////////////////////////
+void CpuGpuRays::Render()
+{
+  IGN_RENDERING_TRACE_ZONE("CpuGpuRays::Render");
+  auto start = std::chrono::steady_clock::now();
+
+  unsigned int width = static_cast<unsigned int>(
+      std::max(this->RangeCount(), 0));
+  unsigned int height = static_cast<unsigned int>(
+      std::max(this->VerticalRangeCount(), 1));
+
+  if (height <= 1u &&
+      !math::equal(this->vMinAngle, this->vMaxAngle))
+  {
+    ignwarn << "Vertical angle range set but vertical range count is 1, "
+            << "using the minimum vertical angle" << std::endl;
+    this->vMaxAngle = this->vMinAngle;
+  }
+
+  double hStep = width > 1u ?
+      (this->maxAngle - this->minAngle) / (width - 1u) : 0.0;
+  double vStep = height > 1u ?
+      (this->vMaxAngle - this->vMinAngle) / (height - 1u) : 0.0;
+
+  size_t count = static_cast<size_t>(width) * height;
+  this->dataPtr->ranges.resize(count);
+  this->dataPtr->retros.resize(count);
+  this->dataPtr->width = width;
+  this->dataPtr->height = height;
+
+  const CpuBvh &bvh = this->scene->Bvh();
+  const CpuSceneData &data = this->scene->SceneData();
+  math::Pose3d pose = this->WorldPose();
+  math::Vector3f origin(pose.Pos().X(), pose.Pos().Y(), pose.Pos().Z());
+  float nearClip = static_cast<float>(this->NearClipPlane());
+  float farClip = static_cast<float>(this->FarClipPlane());
+  uint32_t mask = this->VisibilityMask();
+
+  CpuWorkers::Instance().Run(height, [&](unsigned int _row)
+  {
+    double v = this->vMinAngle + _row * vStep;
+    double cosV = std::cos(v);
+    double sinV = std::sin(v);
+    size_t offset = static_cast<size_t>(_row) * width;
+    for (unsigned int i = 0; i < width; ++i)
+    {
+      double h = this->minAngle + i * hStep;
+      math::Vector3d dir = pose.Rot().RotateVector(math::Vector3d(
+          cosV * std::cos(h), cosV * std::sin(h), sinV));
+      math::Vector3f rayDir(dir.X(), dir.Y(), dir.Z());
+
+      CpuHit hit;
+      float range = this->dataMaxVal;
+      float retro = 0.0f;
+      if (bvh.Intersect(origin, rayDir, 0.0f, farClip, mask, hit))
+      {
+        range = hit.distance < nearClip ? this->dataMinVal : hit.distance;
+        const CpuSurface &surface =
+            data.surfaces[data.triangles[hit.triangle].surface];
+        retro = std::min(surface.retro, kMaxRetro);
+      }
+      this->dataPtr->ranges[offset + i] = range;
+      this->dataPtr->retros[offset + i] = retro;
+    }
+  });
+
+  this->renderStats = rendering::RenderStats();
+  this->renderStats.passCount = 1u;
+  this->renderStats.cpuTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+//////////////////////////////////////////////////
+void CpuGpuRays::PostRender()
+{
+  IGN_RENDERING_TRACE_ZONE("CpuGpuRays::PostRender");
+  unsigned int width = this->dataPtr->width;
+  unsigned int height = this->dataPtr->height;
+  size_t count = static_cast<size_t>(width) * height;
+  const std::vector<float> &ranges = this->dataPtr->ranges;
+  const std::vector<float> &retros = this->dataPtr->retros;
+  if (ranges.size() != count)
+    return;
+
+  this->dataPtr->format = this->dataFormat;
+  std::string formatStr = this->DataFormatString();
+  switch (this->dataFormat)
+  {
+    case GRDF_RANGE_INTENSITY_U8:
+    {
+      // ranges of all readings followed by the intensities of all readings
+      this->dataPtr->buffer.resize(count * (sizeof(float) + 1u));
+      std::memcpy(this->dataPtr->buffer.data(), ranges.data(),
+          count * sizeof(float));
+      unsigned char *intensities =
+          this->dataPtr->buffer.data() + count * sizeof(float);
+      for (size_t i = 0; i < count; ++i)
+      {
+        float intensity = std::clamp(retros[i] / kMaxRetro, 0.0f, 1.0f);
+        intensities[i] = static_cast<unsigned char>(
+            std::floor(intensity * 255.0f + 0.5f));
+      }
+      IGN_RENDERING_TRACE_ZONE("CpuGpuRays::NewGpuRaysData");
+      this->dataPtr->newGpuRaysData(this->dataPtr->buffer.data(),
+          width, height, this->Channels(), formatStr);
+      break;
+    }
+    case GRDF_RANGE_U16_MM:
+    {
+      this->dataPtr->buffer.resize(count * sizeof(uint16_t));
+      uint16_t *mm = reinterpret_cast<uint16_t *>(
+          this->dataPtr->buffer.data());
+      for (size_t i = 0; i < count; ++i)
+      {
+        double value = std::floor(ranges[i] * 1000.0 + 0.5);
+        mm[i] = static_cast<uint16_t>(std::clamp(value, 0.0, 65535.0));
+      }
+      IGN_RENDERING_TRACE_ZONE("CpuGpuRays::NewGpuRaysData");
+      this->dataPtr->newGpuRaysData(this->dataPtr->buffer.data(),
+          width, height, this->Channels(), formatStr);
+      break;
+    }
+    case GRDF_RANGE:
+    case GRDF_RANGE_RETRO:
+    default:
+    {
+      if (this->dataFormat == GRDF_RANGE)
+      {
+        this->dataPtr->scan = ranges;
+      }
+      else
+      {
+        this->dataPtr->scan.resize(count * 3u);
+        for (size_t i = 0; i < count; ++i)
+        {
+          this->dataPtr->scan[i * 3u] = ranges[i];
+          this->dataPtr->scan[i * 3u + 1u] = retros[i];
+          this->dataPtr->scan[i * 3u + 2u] = 0.0f;
+        }
+      }
+      IGN_RENDERING_TRACE_ZONE("CpuGpuRays::NewGpuRaysFrame");
+      this->dataPtr->newGpuRaysFrame(this->dataPtr->scan.data(),
+          width, height, this->Channels(), formatStr);
+      this->dataPtr->newGpuRaysData(this->dataPtr->scan.data(),
+          width, height, this->Channels(), formatStr);
+      break;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+const float *CpuGpuRays::Data() const
+{
+  if ((this->dataPtr->format != GRDF_RANGE_RETRO &&
+      this->dataPtr->format != GRDF_RANGE) || this->dataPtr->scan.empty())
+  {
+    return nullptr;
+  }
+  return this->dataPtr->scan.data();
+}
+
+//////////////////////////////////////////////////
+void CpuGpuRays::Copy(float *_dataDest)
+{
+  const float *data = this->Data();
+  if (!data)
+    return;
+
+  std::memcpy(_dataDest, data, this->dataPtr->scan.size() * sizeof(float));
+}
+
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr CpuGpuRays::ConnectNewGpuRaysFrame(
+    std::function<void(const float *_frame, unsigned int _width,
+    unsigned int _height, unsigned int _depth,
+    const std::string &_format)> _subscriber)
+{
+  return this->dataPtr->newGpuRaysFrame.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr CpuGpuRays::ConnectNewGpuRaysData(
+    NewFrameListener _subscriber)
+{
+  return this->dataPtr->newGpuRaysData.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+RenderTargetPtr CpuGpuRays::RenderTarget() const
+{
+  return this->renderTexture;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/GpuRays.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+#include "ignition/rendering/cpu/CpuRenderEngine.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+class CpuGpuRaysTest : public testing::Test
+{
+  // Documentation inherited
+  protected: void SetUp() override
+  {
+    this->engine = CpuRenderEngine::Instance();
+    ASSERT_TRUE(this->engine->Load());
+    ASSERT_TRUE(this->engine->Init());
+    this->scene = this->engine->CreateScene("scene");
+    ASSERT_NE(nullptr, this->scene);
+  }
+
+  // Documentation inherited
+  protected: void TearDown() override
+  {
+    if (this->scene)
+      this->engine->DestroyScene(this->scene);
+  }
+
+  /// \brief Render engine under test
+  protected: CpuRenderEngine *engine = nullptr;
+
+  /// \brief Scene of the test
+  protected: ScenePtr scene;
+};
+
+/////////////////////////////////////////////////
+TEST_F(CpuGpuRaysTest, Ranges)
+{
+  const double hMinAngle = -0.6;
+  const double hMaxAngle = 0.6;
+  const double vMinAngle = -0.3;
+  const double vMaxAngle = 0.3;
+  const unsigned int hRayCount = 41u;
+  const unsigned int vRayCount = 11u;
+  const double nearClip = 0.1;
+  const double farClip = 10.0;
+
+  VisualPtr root = this->scene->RootVisual();
+  GpuRaysPtr gpuRays = this->scene->CreateGpuRays();
+  ASSERT_NE(nullptr, gpuRays);
+  gpuRays->SetNearClipPlane(nearClip);
+  gpuRays->SetFarClipPlane(farClip);
+  gpuRays->SetAngleMin(hMinAngle);
+  gpuRays->SetAngleMax(hMaxAngle);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalAngleMin(vMinAngle);
+  gpuRays->SetVerticalAngleMax(vMaxAngle);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  root->AddChild(gpuRays);
+
+  // wall facing the sensor, its front face 2.95 m away
+  VisualPtr wall = this->scene->CreateVisual();
+  wall->AddGeometry(this->scene->CreateBox());
+  wall->SetLocalScale(0.1, 20.0, 20.0);
+  wall->SetLocalPosition(3.0, 0.0, 0.0);
+  wall->SetUserData("laser_retro", 500.0);
+  root->AddChild(wall);
+
+  const unsigned int channels = gpuRays->Channels();
+  ASSERT_EQ(3u, channels);
+  std::vector<float> scan(hRayCount * vRayCount * channels);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+
+  // readings are stored row by row from the lowest vertical angle
+  const double hStep = (hMaxAngle - hMinAngle) / (hRayCount - 1u);
+  const double vStep = (vMaxAngle - vMinAngle) / (vRayCount - 1u);
+  for (unsigned int v = 0u; v < vRayCount; ++v)
+  {
+    double vAngle = vMinAngle + v * vStep;
+    for (unsigned int h = 0u; h < hRayCount; ++h)
+    {
+      double hAngle = hMinAngle + h * hStep;
+      double expected = 2.95 / (std::cos(hAngle) * std::cos(vAngle));
+      unsigned int index = (v * hRayCount + h) * channels;
+      EXPECT_NEAR(expected, scan[index], 1e-4) << h << " " << v;
+      EXPECT_NEAR(500.0, scan[index + 1], 1e-3) << h << " " << v;
+    }
+  }
+
+  // out of range readings are infinite without clamping
+  wall->SetLocalPosition(12.0, 0.0, 0.0);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  for (unsigned int i = 0u; i < hRayCount * vRayCount; ++i)
+  {
+    EXPECT_TRUE(std::isinf(scan[i * channels]));
+    EXPECT_GT(scan[i * channels], 0.0f);
+    EXPECT_FLOAT_EQ(0.0f, scan[i * channels + 1]);
+  }
+
+  // and at the far clip distance with clamping
+  gpuRays->SetClamp(true);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  for (unsigned int i = 0u; i < hRayCount * vRayCount; ++i)
+    EXPECT_FLOAT_EQ(farClip, scan[i * channels]);
+
+  // closer than the near clip distance
+  wall->SetLocalPosition(0.1, 0.0, 0.0);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  for (unsigned int i = 0u; i < hRayCount * vRayCount; ++i)
+    EXPECT_FLOAT_EQ(nearClip, scan[i * channels]);
+
+  gpuRays->SetClamp(false);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  for (unsigned int i = 0u; i < hRayCount * vRayCount; ++i)
+  {
+    EXPECT_TRUE(std::isinf(scan[i * channels]));
+    EXPECT_LT(scan[i * channels], 0.0f);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuGpuRaysTest, VisibilityMask)
+{
+  VisualPtr root = this->scene->RootVisual();
+  GpuRaysPtr gpuRays = this->scene->CreateGpuRays();
+  ASSERT_NE(nullptr, gpuRays);
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(10.0);
+  gpuRays->SetAngleMin(-0.1);
+  gpuRays->SetAngleMax(0.1);
+  gpuRays->SetRayCount(3u);
+  gpuRays->SetVerticalRayCount(1u);
+  gpuRays->SetVisibilityMask(0x1u);
+  root->AddChild(gpuRays);
+
+  // the nearer box is hidden from the sensor
+  VisualPtr hidden = this->scene->CreateVisual();
+  hidden->AddGeometry(this->scene->CreateBox());
+  hidden->SetLocalPosition(2.0, 0.0, 0.0);
+  hidden->SetVisibilityFlags(0x2u);
+  root->AddChild(hidden);
+
+  VisualPtr visible = this->scene->CreateVisual();
+  visible->AddGeometry(this->scene->CreateBox());
+  visible->SetLocalPosition(5.0, 0.0, 0.0);
+  visible->SetVisibilityFlags(0x1u);
+  root->AddChild(visible);
+
+  std::vector<float> scan(3u * gpuRays->Channels());
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  EXPECT_NEAR(4.5, scan[gpuRays->Channels()], 1e-4);
+
+  gpuRays->SetVisibilityMask(0x3u);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  EXPECT_NEAR(1.5, scan[gpuRays->Channels()], 1e-4);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
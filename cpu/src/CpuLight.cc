@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "ignition/rendering/cpu/CpuLight.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+// CpuLight
+//////////////////////////////////////////////////
+CpuLight::CpuLight()
+{
+}
+
+//////////////////////////////////////////////////
+CpuLight::~CpuLight()
+{
+}
+
+//////////////////////////////////////////////////
+math::Color CpuLight::DiffuseColor() const
+{
+  return this->diffuse;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetDiffuseColor(const math::Color &_color)
+{
+  this->diffuse = _color;
+}
+
+//////////////////////////////////////////////////
+math::Color CpuLight::SpecularColor() const
+{
+  return this->specular;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetSpecularColor(const math::Color &_color)
+{
+  this->specular = _color;
+}
+
+//////////////////////////////////////////////////
+double CpuLight::AttenuationConstant() const
+{
+  return this->attenConstant;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetAttenuationConstant(double _value)
+{
+  this->attenConstant = _value;
+}
+
+//////////////////////////////////////////////////
+double CpuLight::AttenuationLinear() const
+{
+  return this->attenLinear;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetAttenuationLinear(double _value)
+{
+  this->attenLinear = _value;
+}
+
+//////////////////////////////////////////////////
+double CpuLight::AttenuationQuadratic() const
+{
+  return this->attenQuadratic;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetAttenuationQuadratic(double _value)
+{
+  this->attenQuadratic = _value;
+}
+
+//////////////////////////////////////////////////
+double CpuLight::AttenuationRange() const
+{
+  return this->attenRange;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetAttenuationRange(double _range)
+{
+  this->attenRange = _range;
+}
+
+//////////////////////////////////////////////////
+bool CpuLight::CastShadows() const
+{
+  return this->castShadows;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetCastShadows(bool _castShadows)
+{
+  this->castShadows = _castShadows;
+}
+
+//////////////////////////////////////////////////
+double CpuLight::Intensity() const
+{
+  return this->intensity;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::SetIntensity(double _intensity)
+{
+  this->intensity = _intensity;
+}
+
+//////////////////////////////////////////////////
+void CpuLight::Init()
+{
+  CpuNode::Init();
+  this->Reset();
+}
+
+//////////////////////////////////////////////////
+// CpuDirectionalLight
+//////////////////////////////////////////////////
+CpuDirectionalLight::CpuDirectionalLight()
+{
+}
+
+//////////////////////////////////////////////////
+CpuDirectionalLight::~CpuDirectionalLight()
+{
+}
+
+//////////////////////////////////////////////////
+math::Vector3d CpuDirectionalLight::Direction() const
+{
+  return this->direction;
+}
+
+//////////////////////////////////////////////////
+void CpuDirectionalLight::SetDirection(const math::Vector3d &_dir)
+{
+  this->direction = _dir;
+}
+
+//////////////////////////////////////////////////
+// CpuPointLight
+//////////////////////////////////////////////////
+CpuPointLight::CpuPointLight()
+{
+}
+
+//////////////////////////////////////////////////
+CpuPointLight::~CpuPointLight()
+{
+}
+
+//////////////////////////////////////////////////
+// CpuSpotLight
+//////////////////////////////////////////////////
+CpuSpotLight::CpuSpotLight()
+{
+}
+
+//////////////////////////////////////////////////
+CpuSpotLight::~CpuSpotLight()
+{
+}
+
+//////////////////////////////////////////////////
+math::Vector3d CpuSpotLight::Direction() const
+{
+  return this->direction;
+}
+
+//////////////////////////////////////////////////
+void CpuSpotLight::SetDirection(const math::Vector3d &_dir)
+{
+  this->direction = _dir;
+}
+
+//////////////////////////////////////////////////
+math::Angle CpuSpotLight::InnerAngle() const
+{
+  return this->innerAngle;
+}
+
+//////////////////////////////////////////////////
+void CpuSpotLight::SetInnerAngle(const math::Angle &_angle)
+{
+  this->innerAngle = _angle;
+}
+
+//////////////////////////////////////////////////
+math::Angle CpuSpotLight::OuterAngle() const
+{
+  return this->outerAngle;
+}
+
+//////////////////////////////////////////////////
+void CpuSpotLight::SetOuterAngle(const math::Angle &_angle)
+{
+  this->outerAngle = _angle;
+}
+
+//////////////////////////////////////////////////
+double CpuSpotLight::Falloff() const
+{
+  return this->falloff;
+}
+
+//////////////////////////////////////////////////
+void CpuSpotLight::SetFalloff(double _falloff)
+{
+  this->falloff = _falloff;
+}
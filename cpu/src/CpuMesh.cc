@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "ignition/rendering/cpu/CpuMesh.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuStorage.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuMesh::CpuMesh()
+{
+}
+
+//////////////////////////////////////////////////
+CpuMesh::~CpuMesh()
+{
+}
+
+//////////////////////////////////////////////////
+math::AxisAlignedBox CpuMesh::LocalBounds() const
+{
+  math::AxisAlignedBox box;
+  if (!this->subMeshes)
+    return box;
+
+  for (unsigned int i = 0; i < this->subMeshes->Size(); ++i)
+  {
+    CpuSubMeshPtr subMesh = this->subMeshes->DerivedByIndex(i);
+    if (subMesh && subMesh->Data())
+      box.Merge(subMesh->Data()->bounds);
+  }
+  return box;
+}
+
+//////////////////////////////////////////////////
+SubMeshStorePtr CpuMesh::SubMeshes() const
+{
+  return this->subMeshes;
+}
+
+//////////////////////////////////////////////////
+CpuSubMesh::CpuSubMesh()
+{
+}
+
+//////////////////////////////////////////////////
+CpuSubMesh::~CpuSubMesh()
+{
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<const CpuSubMeshData> CpuSubMesh::Data() const
+{
+  return this->data;
+}
+
+//////////////////////////////////////////////////
+void CpuSubMesh::SetMaterialImpl(MaterialPtr)
+{
+  // the material is read when the scene triangles are collected
+}
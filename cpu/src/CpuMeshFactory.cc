@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <sstream>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Mesh.hh>
+#include <ignition/common/SubMesh.hh>
+
+#include "ignition/rendering/cpu/CpuMeshFactory.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuStorage.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+// CpuMeshFactory
+//////////////////////////////////////////////////
+CpuMeshFactory::CpuMeshFactory(CpuScenePtr _scene) :
+  subMeshStoreFactory(_scene),
+  scene(_scene)
+{
+}
+
+//////////////////////////////////////////////////
+CpuMeshFactory::~CpuMeshFactory()
+{
+}
+
+//////////////////////////////////////////////////
+CpuMeshPtr CpuMeshFactory::Create(const MeshDescriptor &_desc)
+{
+  MeshDescriptor normDesc = _desc;
+  normDesc.Load();
+
+  if (!this->Validate(normDesc))
+    return nullptr;
+
+  CpuSubMeshStorePtr subMeshStore = this->subMeshStoreFactory.Create(normDesc);
+  if (!subMeshStore)
+    return nullptr;
+
+  CpuMeshPtr mesh(new CpuMesh);
+  mesh->subMeshes = subMeshStore;
+  return mesh;
+}
+
+//////////////////////////////////////////////////
+bool CpuMeshFactory::Validate(const MeshDescriptor &_desc)
+{
+  if (!_desc.mesh && _desc.meshName.empty())
+  {
+    ignerr << "Invalid mesh-descriptor, no mesh specified" << std::endl;
+    return false;
+  }
+
+  if (!_desc.mesh)
+  {
+    ignerr << "Cannot load null mesh [" << _desc.meshName << "]" << std::endl;
+    return false;
+  }
+
+  if (_desc.mesh->SubMeshCount() == 0)
+  {
+    ignerr << "Cannot load mesh with zero sub-meshes" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+// CpuSubMeshStoreFactory
+//////////////////////////////////////////////////
+CpuSubMeshStoreFactory::CpuSubMeshStoreFactory(CpuScenePtr _scene) :
+  scene(_scene)
+{
+}
+
+//////////////////////////////////////////////////
+CpuSubMeshStoreFactory::~CpuSubMeshStoreFactory()
+{
+}
+
+//////////////////////////////////////////////////
+CpuSubMeshStorePtr CpuSubMeshStoreFactory::Create(
+    const MeshDescriptor &_desc)
+{
+  unsigned int count = _desc.mesh->SubMeshCount();
+  const std::string searchName = _desc.subMeshName;
+
+  CpuSubMeshStorePtr store(new CpuSubMeshStore);
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    auto subMesh = _desc.mesh->SubMeshByIndex(i).lock();
+    if (!subMesh)
+      continue;
+
+    const std::string foundName = subMesh->Name();
+
+    if (searchName.empty() || foundName == searchName)
+    {
+      CpuSubMeshPtr sm(new CpuSubMesh);
+      sm->id = i;
+      sm->name = foundName;
+      sm->scene = this->scene;
+      sm->data = this->Data(_desc, i);
+
+      common::MaterialPtr material;
+      material = _desc.mesh->MaterialByIndex(subMesh->MaterialIndex());
+      MaterialPtr mat = this->scene->CreateMaterial();
+      if (material)
+      {
+        mat->CopyFrom(*material);
+      }
+      else
+      {
+        MaterialPtr defaultMat = this->scene->Material("Default/White");
+        if (defaultMat != nullptr)
+          mat->CopyFrom(defaultMat);
+      }
+      // assign material to submesh who will make a copy of this material
+      sm->SetMaterial(mat);
+
+      // clean up the material created by factory
+      this->scene->DestroyMaterial(mat);
+
+      store->Add(sm);
+    }
+  }
+
+  return store;
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<const CpuSubMeshData> CpuSubMeshStoreFactory::Data(
+    const MeshDescriptor &_desc, unsigned int _subMeshIndex)
+{
+  const std::string keyName = this->KeyName(_desc, _subMeshIndex);
+  auto iter = this->data.find(keyName);
+  if (iter != this->data.end())
+    return iter->second;
+
+  auto source = _desc.mesh->SubMeshByIndex(_subMeshIndex).lock();
+  if (!source)
+    return nullptr;
+
+  if (source->SubMeshPrimitiveType() != common::SubMesh::TRIANGLES)
+  {
+    ignwarn << "Sub-mesh [" << source->Name() << "] is not made of "
+            << "triangles and will not be rendered" << std::endl;
+    this->data[keyName] = nullptr;
+    return nullptr;
+  }
+
+  // recenter a copy of the vertices if requested
+  common::SubMesh subMesh(*source);
+  if (_desc.centerSubMesh)
+    subMesh.Center(math::Vector3d::Zero);
+
+  std::shared_ptr<CpuSubMeshData> result(new CpuSubMeshData);
+  unsigned int vertexCount = subMesh.VertexCount();
+  result->vertices.resize(vertexCount);
+  for (unsigned int i = 0; i < vertexCount; ++i)
+  {
+    const math::Vector3d &v = subMesh.Vertex(i);
+    result->vertices[i].Set(v.X(), v.Y(), v.Z());
+    result->bounds.Merge(math::AxisAlignedBox(v, v));
+  }
+
+  if (subMesh.IndexCount() > 0)
+  {
+    unsigned int indexCount = subMesh.IndexCount() / 3 * 3;
+    result->indices.reserve(indexCount);
+    for (unsigned int i = 0; i < indexCount; ++i)
+    {
+      int index = subMesh.Index(i);
+      if (index < 0 || static_cast<unsigned int>(index) >= vertexCount)
+        index = 0;
+      result->indices.push_back(static_cast<unsigned int>(index));
+    }
+  }
+  else
+  {
+    for (unsigned int i = 0; i < vertexCount / 3 * 3; ++i)
+      result->indices.push_back(i);
+  }
+
+  // use the normals of the mesh, or average the normals of the faces
+  // around each vertex when it has none
+  result->normals.assign(vertexCount, math::Vector3f::Zero);
+  if (subMesh.NormalCount() == vertexCount)
+  {
+    for (unsigned int i = 0; i < vertexCount; ++i)
+    {
+      const math::Vector3d &n = subMesh.Normal(i);
+      result->normals[i].Set(n.X(), n.Y(), n.Z());
+    }
+  }
+  else
+  {
+    for (unsigned int i = 0; i + 2 < result->indices.size(); i += 3)
+    {
+      const unsigned int *tri = &result->indices[i];
+      math::Vector3f n =
+          (result->vertices[tri[1]] - result->vertices[tri[0]]).Cross(
+           result->vertices[tri[2]] - result->vertices[tri[0]]);
+      for (unsigned int k = 0; k < 3; ++k)
+        result->normals[tri[k]] += n;
+    }
+  }
+  for (auto &n : result->normals)
+    n.Normalize();
+
+  this->data[keyName] = result;
+  return result;
+}
+
+//////////////////////////////////////////////////
+std::string CpuSubMeshStoreFactory::KeyName(const MeshDescriptor &_desc,
+    unsigned int _subMeshIndex)
+{
+  const std::string tail = (_desc.centerSubMesh) ? "_centered" : "_original";
+
+  std::stringstream ss;
+  auto subMesh = _desc.mesh->SubMeshByIndex(_subMeshIndex).lock();
+  ss << _desc.meshName << "::" << subMesh->Name() << tail;
+  return ss.str();
+}
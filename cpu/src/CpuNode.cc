@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/cpu/CpuNode.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuStorage.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuNode::CpuNode()
+{
+}
+
+//////////////////////////////////////////////////
+CpuNode::~CpuNode()
+{
+}
+
+//////////////////////////////////////////////////
+bool CpuNode::HasParent() const
+{
+  return this->parent != nullptr;
+}
+
+//////////////////////////////////////////////////
+NodePtr CpuNode::Parent() const
+{
+  return this->parent;
+}
+
+//////////////////////////////////////////////////
+math::Vector3d CpuNode::LocalScale() const
+{
+  return this->scale;
+}
+
+//////////////////////////////////////////////////
+bool CpuNode::InheritScale() const
+{
+  return this->inheritScale;
+}
+
+//////////////////////////////////////////////////
+void CpuNode::SetInheritScale(bool _inherit)
+{
+  this->inheritScale = _inherit;
+}
+
+//////////////////////////////////////////////////
+void CpuNode::SetLocalScaleImpl(const math::Vector3d &_scale)
+{
+  this->scale = _scale;
+}
+
+//////////////////////////////////////////////////
+NodeStorePtr CpuNode::Children() const
+{
+  return this->children;
+}
+
+//////////////////////////////////////////////////
+bool CpuNode::AttachChild(NodePtr _child)
+{
+  CpuNodePtr derived = std::dynamic_pointer_cast<CpuNode>(_child);
+
+  if (!derived)
+  {
+    ignerr << "Cannot attach node created by another render-engine"
+        << std::endl;
+    return false;
+  }
+
+  CpuNodePtr self = this->SharedThis();
+  for (NodePtr p = self; p != nullptr; p = p->Parent())
+  {
+    if (p == _child)
+    {
+      ignerr << "Node cycle detected. Not adding Node: " << _child->Name()
+             << std::endl;
+      return false;
+    }
+  }
+
+  derived->SetParent(self);
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool CpuNode::DetachChild(NodePtr _child)
+{
+  CpuNodePtr derived = std::dynamic_pointer_cast<CpuNode>(_child);
+
+  if (!derived)
+  {
+    ignerr << "Cannot detach node created by another render-engine"
+        << std::endl;
+    return false;
+  }
+
+  derived->SetParent(nullptr);
+  return true;
+}
+
+//////////////////////////////////////////////////
+math::Pose3d CpuNode::RawLocalPose() const
+{
+  return this->pose;
+}
+
+//////////////////////////////////////////////////
+void CpuNode::SetRawLocalPose(const math::Pose3d &_pose)
+{
+  this->pose = _pose;
+}
+
+//////////////////////////////////////////////////
+void CpuNode::SetParent(CpuNodePtr _parent)
+{
+  this->parent = _parent;
+}
+
+//////////////////////////////////////////////////
+void CpuNode::Init()
+{
+  this->children = CpuNodeStorePtr(new CpuNodeStore);
+}
+
+//////////////////////////////////////////////////
+CpuNodePtr CpuNode::SharedThis()
+{
+  ObjectPtr object = shared_from_this();
+  return std::dynamic_pointer_cast<CpuNode>(object);
+}
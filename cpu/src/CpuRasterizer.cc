@@ -0,0 +1,342 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <ignition/math/Matrix3.hh>
+
+#include "ignition/rendering/Trace.hh"
+
+#include "CpuRasterizer.hh"
+#include "CpuWorkers.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Width and height of a tile in pixels
+static const unsigned int kTileSize = 32u;
+
+/// \brief Number of triangles set up by one task
+static const unsigned int kSetupChunkSize = 4096u;
+
+/// \brief Vertex of a triangle being clipped against the near plane
+struct ClipVertex
+{
+  /// \brief Position in the camera frame
+  float p[3];
+
+  /// \brief Barycentric coordinate of the second scene vertex
+  float b1;
+
+  /// \brief Barycentric coordinate of the third scene vertex
+  float b2;
+};
+
+/// \brief Signed area of the parallelogram spanned by two edges
+static inline float Edge(float _ax, float _ay, float _bx, float _by,
+    float _px, float _py)
+{
+  return (_bx - _ax) * (_py - _ay) - (_by - _ay) * (_px - _ax);
+}
+
+//////////////////////////////////////////////////
+void CpuRasterizer::Render(const CpuSceneData &_data, const CpuView &_view,
+    std::vector<CpuFragment> &_fragments)
+{
+  IGN_RENDERING_TRACE_ZONE("CpuRasterizer::Render");
+
+  _fragments.resize(static_cast<size_t>(_view.width) * _view.height);
+  this->triangles.clear();
+  if (_view.width == 0u || _view.height == 0u)
+    return;
+
+  CpuWorkers &workers = CpuWorkers::Instance();
+
+  // transform, clip and project in parallel chunks
+  unsigned int triangleCount =
+      static_cast<unsigned int>(_data.triangles.size());
+  unsigned int chunkCount =
+      (triangleCount + kSetupChunkSize - 1u) / kSetupChunkSize;
+  if (this->chunks.size() < chunkCount)
+    this->chunks.resize(chunkCount);
+  workers.Run(chunkCount, [&](unsigned int _chunk)
+      {
+        unsigned int begin = _chunk * kSetupChunkSize;
+        unsigned int end = std::min(begin + kSetupChunkSize, triangleCount);
+        this->chunks[_chunk].clear();
+        this->Setup(_data, _view, begin, end, this->chunks[_chunk]);
+      });
+
+  // bin in scene order, so that equal depths resolve the same way in
+  // every frame
+  for (unsigned int i = 0u; i < chunkCount; ++i)
+  {
+    this->triangles.insert(this->triangles.end(),
+        this->chunks[i].begin(), this->chunks[i].end());
+  }
+
+  this->tileColumns = (_view.width + kTileSize - 1u) / kTileSize;
+  unsigned int tileRows = (_view.height + kTileSize - 1u) / kTileSize;
+  unsigned int tileCount = this->tileColumns * tileRows;
+  if (this->bins.size() < tileCount)
+    this->bins.resize(tileCount);
+  for (unsigned int i = 0u; i < tileCount; ++i)
+    this->bins[i].clear();
+
+  for (unsigned int i = 0u; i < this->triangles.size(); ++i)
+  {
+    const ScreenTriangle &tri = this->triangles[i];
+    for (int ty = tri.minY / static_cast<int>(kTileSize);
+         ty <= tri.maxY / static_cast<int>(kTileSize); ++ty)
+    {
+      for (int tx = tri.minX / static_cast<int>(kTileSize);
+           tx <= tri.maxX / static_cast<int>(kTileSize); ++tx)
+      {
+        this->bins[ty * this->tileColumns + tx].push_back(i);
+      }
+    }
+  }
+
+  workers.Run(tileCount, [&](unsigned int _tile)
+      {
+        this->RasterizeTile(_tile, _view, _fragments);
+      });
+}
+
+//////////////////////////////////////////////////
+unsigned int CpuRasterizer::TriangleCount() const
+{
+  return static_cast<unsigned int>(this->triangles.size());
+}
+
+//////////////////////////////////////////////////
+void CpuRasterizer::Setup(const CpuSceneData &_data, const CpuView &_view,
+    unsigned int _begin, unsigned int _end,
+    std::vector<ScreenTriangle> &_out) const
+{
+  // world to camera transform
+  math::Matrix3d rot(_view.pose.Rot().Inverse());
+  float r[3][3];
+  for (unsigned int i = 0u; i < 3u; ++i)
+  {
+    for (unsigned int j = 0u; j < 3u; ++j)
+      r[i][j] = static_cast<float>(rot(i, j));
+  }
+  const math::Vector3d &pos = _view.pose.Pos();
+  const float t[3] = {static_cast<float>(pos.X()),
+      static_cast<float>(pos.Y()), static_cast<float>(pos.Z())};
+
+  const float nearClip = static_cast<float>(_view.near);
+  const float farClip = static_cast<float>(_view.far);
+  const float tanH = static_cast<float>(std::tan(_view.hfov * 0.5));
+  const float tanV = tanH / static_cast<float>(_view.aspect);
+  const float halfWidth = _view.width * 0.5f;
+  const float halfHeight = _view.height * 0.5f;
+  const float fx = halfWidth / tanH;
+  const float fy = halfHeight / tanV;
+  const float maxX = static_cast<float>(_view.width) - 1.0f;
+  const float maxY = static_cast<float>(_view.height) - 1.0f;
+
+  for (unsigned int index = _begin; index < _end; ++index)
+  {
+    const CpuTriangle &tri = _data.triangles[index];
+    if (!(_data.surfaces[tri.surface].visibilityFlags & _view.mask))
+      continue;
+
+    ClipVertex in[3];
+    for (unsigned int v = 0u; v < 3u; ++v)
+    {
+      const math::Vector3f &w = tri.vertices[v];
+      float d[3] = {w.X() - t[0], w.Y() - t[1], w.Z() - t[2]};
+      for (unsigned int k = 0u; k < 3u; ++k)
+        in[v].p[k] = r[k][0] * d[0] + r[k][1] * d[1] + r[k][2] * d[2];
+      in[v].b1 = v == 1u ? 1.0f : 0.0f;
+      in[v].b2 = v == 2u ? 1.0f : 0.0f;
+    }
+
+    // reject triangles entirely outside one of the frustum planes
+    unsigned int outNear = 0u, outFar = 0u, outLeft = 0u, outRight = 0u,
+        outTop = 0u, outBottom = 0u;
+    for (const auto &v : in)
+    {
+      outNear += v.p[0] < nearClip;
+      outFar += v.p[0] > farClip;
+      outLeft += v.p[1] > v.p[0] * tanH;
+      outRight += v.p[1] < -v.p[0] * tanH;
+      outTop += v.p[2] > v.p[0] * tanV;
+      outBottom += v.p[2] < -v.p[0] * tanV;
+    }
+    if (outNear == 3u || outFar == 3u || outLeft == 3u || outRight == 3u ||
+        outTop == 3u || outBottom == 3u)
+    {
+      continue;
+    }
+
+    // clip against the near plane, which turns the triangle into a
+    // polygon of up to four vertices
+    ClipVertex poly[4];
+    unsigned int count = 0u;
+    if (outNear == 0u)
+    {
+      std::copy(in, in + 3, poly);
+      count = 3u;
+    }
+    else
+    {
+      for (unsigned int v = 0u; v < 3u; ++v)
+      {
+        const ClipVertex &a = in[v];
+        const ClipVertex &b = in[(v + 1u) % 3u];
+        bool aIn = a.p[0] >= nearClip;
+        bool bIn = b.p[0] >= nearClip;
+        if (aIn)
+          poly[count++] = a;
+        if (aIn != bIn)
+        {
+          float s = (nearClip - a.p[0]) / (b.p[0] - a.p[0]);
+          ClipVertex &c = poly[count++];
+          for (unsigned int k = 0u; k < 3u; ++k)
+            c.p[k] = a.p[k] + s * (b.p[k] - a.p[k]);
+          c.p[0] = nearClip;
+          c.b1 = a.b1 + s * (b.b1 - a.b1);
+          c.b2 = a.b2 + s * (b.b2 - a.b2);
+        }
+      }
+    }
+
+    // project
+    float sx[4], sy[4], invDepth[4];
+    for (unsigned int v = 0u; v < count; ++v)
+    {
+      invDepth[v] = 1.0f / poly[v].p[0];
+      sx[v] = halfWidth - fx * poly[v].p[1] * invDepth[v];
+      sy[v] = halfHeight - fy * poly[v].p[2] * invDepth[v];
+    }
+
+    // triangulate as a fan
+    for (unsigned int v = 1u; v + 1u < count; ++v)
+    {
+      unsigned int ids[3] = {0u, v, v + 1u};
+      float area = Edge(sx[ids[0]], sy[ids[0]], sx[ids[1]], sy[ids[1]],
+          sx[ids[2]], sy[ids[2]]);
+      if (!(std::abs(area) > 0.0f))
+        continue;
+
+      // triangles are double sided, keep a single winding
+      if (area < 0.0f)
+        std::swap(ids[1], ids[2]);
+
+      ScreenTriangle st;
+      float x0 = sx[ids[0]], x1 = sx[ids[0]];
+      float y0 = sy[ids[0]], y1 = sy[ids[0]];
+      for (unsigned int k = 0u; k < 3u; ++k)
+      {
+        const ClipVertex &c = poly[ids[k]];
+        st.x[k] = sx[ids[k]];
+        st.y[k] = sy[ids[k]];
+        st.invDepth[k] = invDepth[ids[k]];
+        st.b1[k] = c.b1;
+        st.b2[k] = c.b2;
+        x0 = std::min(x0, st.x[k]);
+        x1 = std::max(x1, st.x[k]);
+        y0 = std::min(y0, st.y[k]);
+        y1 = std::max(y1, st.y[k]);
+      }
+
+      // pixels whose centers may be covered
+      x0 = std::max(std::ceil(x0 - 0.5f), 0.0f);
+      y0 = std::max(std::ceil(y0 - 0.5f), 0.0f);
+      x1 = std::min(std::floor(x1 - 0.5f), maxX);
+      y1 = std::min(std::floor(y1 - 0.5f), maxY);
+      if (x0 > x1 || y0 > y1)
+        continue;
+
+      st.minX = static_cast<int>(x0);
+      st.minY = static_cast<int>(y0);
+      st.maxX = static_cast<int>(x1);
+      st.maxY = static_cast<int>(y1);
+      st.triangle = index;
+      _out.push_back(st);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuRasterizer::RasterizeTile(unsigned int _tile, const CpuView &_view,
+    std::vector<CpuFragment> &_fragments) const
+{
+  const int width = static_cast<int>(_view.width);
+  const int tileX0 = static_cast<int>((_tile % this->tileColumns) * kTileSize);
+  const int tileY0 = static_cast<int>((_tile / this->tileColumns) * kTileSize);
+  const int tileX1 =
+      std::min(tileX0 + static_cast<int>(kTileSize), width) - 1;
+  const int tileY1 = std::min(tileY0 + static_cast<int>(kTileSize),
+      static_cast<int>(_view.height)) - 1;
+  const float farClip = static_cast<float>(_view.far);
+
+  const CpuFragment empty;
+  for (int py = tileY0; py <= tileY1; ++py)
+  {
+    std::fill(_fragments.begin() + py * width + tileX0,
+        _fragments.begin() + py * width + tileX1 + 1, empty);
+  }
+
+  for (unsigned int index : this->bins[_tile])
+  {
+    const ScreenTriangle &tri = this->triangles[index];
+    const float invArea = 1.0f / Edge(tri.x[0], tri.y[0], tri.x[1],
+        tri.y[1], tri.x[2], tri.y[2]);
+
+    const int x0 = std::max(tri.minX, tileX0);
+    const int x1 = std::min(tri.maxX, tileX1);
+    const int y0 = std::max(tri.minY, tileY0);
+    const int y1 = std::min(tri.maxY, tileY1);
+    for (int py = y0; py <= y1; ++py)
+    {
+      const float cy = py + 0.5f;
+      for (int px = x0; px <= x1; ++px)
+      {
+        const float cx = px + 0.5f;
+        float l0 = Edge(tri.x[1], tri.y[1], tri.x[2], tri.y[2], cx, cy);
+        float l1 = Edge(tri.x[2], tri.y[2], tri.x[0], tri.y[0], cx, cy);
+        float l2 = Edge(tri.x[0], tri.y[0], tri.x[1], tri.y[1], cx, cy);
+        if (l0 < 0.0f || l1 < 0.0f || l2 < 0.0f)
+          continue;
+
+        // perspective correct interpolation
+        float q0 = l0 * invArea * tri.invDepth[0];
+        float q1 = l1 * invArea * tri.invDepth[1];
+        float q2 = l2 * invArea * tri.invDepth[2];
+        float sum = q0 + q1 + q2;
+        float depth = 1.0f / sum;
+
+        CpuFragment &fragment = _fragments[py * width + px];
+        if (depth > farClip || !(depth < fragment.depth))
+          continue;
+
+        fragment.depth = depth;
+        fragment.triangle = tri.triangle;
+        fragment.b1 =
+            (q0 * tri.b1[0] + q1 * tri.b1[1] + q2 * tri.b1[2]) * depth;
+        fragment.b2 =
+            (q0 * tri.b2[0] + q1 * tri.b2[1] + q2 * tri.b2[2]) * depth;
+      }
+    }
+  }
+}
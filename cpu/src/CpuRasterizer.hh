@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPURASTERIZER_HH_
+#define IGNITION_RENDERING_CPU_CPURASTERIZER_HH_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <ignition/math/Pose3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/cpu/Export.hh"
+
+#include "CpuSceneData.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Camera a scene is rasterized from. The camera looks along its
+    /// x axis, with y to the left and z up.
+    struct CpuView
+    {
+      /// \brief World pose of the camera
+      math::Pose3d pose;
+
+      /// \brief Image width in pixels
+      unsigned int width = 0u;
+
+      /// \brief Image height in pixels
+      unsigned int height = 0u;
+
+      /// \brief Horizontal field of view in radians
+      double hfov = 0.0;
+
+      /// \brief Image width divided by image height
+      double aspect = 1.0;
+
+      /// \brief Distance of the near clipping plane
+      double near = 0.0;
+
+      /// \brief Distance of the far clipping plane
+      double far = 0.0;
+
+      /// \brief Visibility mask, visuals whose flags do not match are not
+      /// rasterized
+      uint32_t mask = 0u;
+    };
+
+    /// \brief Closest triangle covering a pixel
+    struct CpuFragment
+    {
+      /// \brief Distance along the camera x axis, infinity if no triangle
+      /// covers the pixel
+      float depth = std::numeric_limits<float>::infinity();
+
+      /// \brief Index of the triangle in the scene data, max if none
+      unsigned int triangle = std::numeric_limits<unsigned int>::max();
+
+      /// \brief Barycentric coordinate of the second vertex
+      float b1 = 0.0f;
+
+      /// \brief Barycentric coordinate of the third vertex
+      float b2 = 0.0f;
+    };
+
+    /// \brief Tiled rasterizer producing the closest triangle of every
+    /// pixel. Triangles are set up and binned to tiles, then the tiles are
+    /// rasterized in parallel on the cpu workers. Scratch buffers are kept
+    /// between frames, so each sensor owns its rasterizer.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuRasterizer
+    {
+      /// \brief Rasterize the triangles of a scene
+      /// \param[in] _data Scene data
+      /// \param[in] _view Camera to rasterize from
+      /// \param[out] _fragments Row major fragments, resized to the image
+      public: void Render(const CpuSceneData &_data, const CpuView &_view,
+                  std::vector<CpuFragment> &_fragments);
+
+      /// \brief Get the number of triangles in the frustum in the last call
+      /// to Render, after clipping
+      /// \return Number of triangles
+      public: unsigned int TriangleCount() const;
+
+      /// \brief Triangle projected to the image
+      private: struct ScreenTriangle
+      {
+        /// \brief Horizontal pixel coordinates of the vertices
+        float x[3];
+
+        /// \brief Vertical pixel coordinates of the vertices
+        float y[3];
+
+        /// \brief Inverse depth of the vertices
+        float invDepth[3];
+
+        /// \brief Barycentric coordinates of the vertices in the scene
+        /// triangle, for the second vertex
+        float b1[3];
+
+        /// \brief Barycentric coordinates of the vertices in the scene
+        /// triangle, for the third vertex
+        float b2[3];
+
+        /// \brief Index of the scene triangle
+        unsigned int triangle;
+
+        /// \brief Pixel bounds, inclusive
+        int minX, minY, maxX, maxY;
+      };
+
+      /// \brief Transform, clip and project a range of scene triangles
+      /// \param[in] _data Scene data
+      /// \param[in] _view Camera
+      /// \param[in] _begin First triangle
+      /// \param[in] _end One past the last triangle
+      /// \param[out] _out Projected triangles
+      private: void Setup(const CpuSceneData &_data, const CpuView &_view,
+                   unsigned int _begin, unsigned int _end,
+                   std::vector<ScreenTriangle> &_out) const;
+
+      /// \brief Rasterize the triangles binned to a tile
+      /// \param[in] _tile Tile index
+      /// \param[in] _view Camera
+      /// \param[out] _fragments Fragments of the image
+      private: void RasterizeTile(unsigned int _tile, const CpuView &_view,
+                   std::vector<CpuFragment> &_fragments) const;
+
+      /// \brief Projected triangles of every setup chunk
+      private: std::vector<std::vector<ScreenTriangle>> chunks;
+
+      /// \brief Projected triangles of the frame
+      private: std::vector<ScreenTriangle> triangles;
+
+      /// \brief Indices of the projected triangles overlapping each tile
+      private: std::vector<std::vector<unsigned int>> bins;
+
+      /// \brief Number of tile columns
+      private: unsigned int tileColumns = 0u;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,309 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "CpuRasterizer.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Visibility flags of the test surfaces
+static const uint32_t kFlags = 0x1u;
+
+/////////////////////////////////////////////////
+/// \brief Test fixture with a camera at the origin looking along x, with
+/// a focal length of 32 pixels in both directions
+class CpuRasterizerTest : public testing::Test
+{
+  // Documentation inherited
+  protected: void SetUp() override
+  {
+    this->view.width = 64u;
+    this->view.height = 48u;
+    this->view.hfov = IGN_PI * 0.5;
+    this->view.aspect = 64.0 / 48.0;
+    this->view.near = 0.1;
+    this->view.far = 100.0;
+    this->view.mask = kFlags;
+
+    CpuSurface surface;
+    surface.visibilityFlags = kFlags;
+    this->data.surfaces.push_back(surface);
+  }
+
+  /// \brief Add a quad made of two triangles
+  /// \param[in] _a First corner
+  /// \param[in] _b Second corner
+  /// \param[in] _c Third corner, opposite to the first one
+  /// \param[in] _d Fourth corner
+  protected: void AddQuad(const math::Vector3f &_a, const math::Vector3f &_b,
+                 const math::Vector3f &_c, const math::Vector3f &_d)
+  {
+    this->AddTriangle(_a, _b, _c);
+    this->AddTriangle(_a, _c, _d);
+  }
+
+  /// \brief Add a triangle on the first surface
+  /// \param[in] _a First vertex
+  /// \param[in] _b Second vertex
+  /// \param[in] _c Third vertex
+  protected: void AddTriangle(const math::Vector3f &_a,
+                 const math::Vector3f &_b, const math::Vector3f &_c)
+  {
+    CpuTriangle tri;
+    tri.vertices[0] = _a;
+    tri.vertices[1] = _b;
+    tri.vertices[2] = _c;
+    this->data.triangles.push_back(tri);
+  }
+
+  /// \brief Get the fragment of a pixel
+  /// \param[in] _x Pixel column
+  /// \param[in] _y Pixel row
+  /// \return Fragment
+  protected: const CpuFragment &Fragment(unsigned int _x, unsigned int _y)
+  {
+    return this->fragments[_y * this->view.width + _x];
+  }
+
+  /// \brief Count the pixels covered by a triangle
+  /// \return Number of pixels
+  protected: unsigned int Coverage() const
+  {
+    unsigned int count = 0u;
+    for (const auto &fragment : this->fragments)
+      count += std::isfinite(fragment.depth) ? 1u : 0u;
+    return count;
+  }
+
+  /// \brief Scene to rasterize
+  protected: CpuSceneData data;
+
+  /// \brief Camera
+  protected: CpuView view;
+
+  /// \brief Rasterized fragments
+  protected: std::vector<CpuFragment> fragments;
+
+  /// \brief Rasterizer under test
+  protected: CpuRasterizer rasterizer;
+};
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, Empty)
+{
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  ASSERT_EQ(64u * 48u, this->fragments.size());
+  EXPECT_EQ(0u, this->Coverage());
+  EXPECT_EQ(0u, this->rasterizer.TriangleCount());
+  EXPECT_EQ(std::numeric_limits<unsigned int>::max(),
+      this->Fragment(10, 10).triangle);
+
+  // no pixels
+  this->view.width = 0u;
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_TRUE(this->fragments.empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, Depth)
+{
+  // wall facing the camera filling the image
+  this->AddQuad(math::Vector3f(2, 10, -10), math::Vector3f(2, -10, -10),
+      math::Vector3f(2, -10, 10), math::Vector3f(2, 10, 10));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(64u * 48u, this->Coverage());
+  EXPECT_EQ(2u, this->rasterizer.TriangleCount());
+  for (const auto &fragment : this->fragments)
+  {
+    EXPECT_NEAR(2.0f, fragment.depth, 1e-4f);
+    EXPECT_LT(fragment.triangle, 2u);
+    EXPECT_GE(fragment.b1, -1e-4f);
+    EXPECT_GE(fragment.b2, -1e-4f);
+    EXPECT_LE(fragment.b1 + fragment.b2, 1.0f + 1e-4f);
+  }
+
+  // a nearer wall added after the first one hides it
+  this->AddQuad(math::Vector3f(1, 10, -10), math::Vector3f(1, -10, -10),
+      math::Vector3f(1, -10, 10), math::Vector3f(1, 10, 10));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(4u, this->rasterizer.TriangleCount());
+  for (const auto &fragment : this->fragments)
+  {
+    EXPECT_NEAR(1.0f, fragment.depth, 1e-4f);
+    EXPECT_GE(fragment.triangle, 2u);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, PerspectiveDepth)
+{
+  // wall in the plane x + y / 4 = 3, further away on the right side of
+  // the image. Depth is interpolated perspective correctly.
+  this->AddQuad(math::Vector3f(1, 8, -10), math::Vector3f(5, -8, -10),
+      math::Vector3f(5, -8, 10), math::Vector3f(1, 8, 10));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(64u * 48u, this->Coverage());
+
+  for (unsigned int y = 0u; y < 48u; y += 7u)
+  {
+    for (unsigned int x = 0u; x < 64u; ++x)
+    {
+      // the pixel ray is (1, (32 - cx) / 32, (24 - cy) / 32) * depth
+      float slope = (32.0f - (x + 0.5f)) / 32.0f;
+      float expected = 3.0f / (1.0f + 0.25f * slope);
+      EXPECT_NEAR(expected, this->Fragment(x, y).depth, 1e-3f)
+          << x << " " << y;
+    }
+  }
+  EXPECT_LT(this->Fragment(0, 24).depth, this->Fragment(63, 24).depth);
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, Coverage)
+{
+  // square with a side of 1 at a distance of 2 covers 16 x 16 pixels in
+  // the middle of the image, across the tile boundary at column 32
+  this->AddQuad(math::Vector3f(2, 0.5f, -0.5f),
+      math::Vector3f(2, -0.5f, -0.5f), math::Vector3f(2, -0.5f, 0.5f),
+      math::Vector3f(2, 0.5f, 0.5f));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(256u, this->Coverage());
+
+  for (unsigned int y = 0u; y < 48u; ++y)
+  {
+    for (unsigned int x = 0u; x < 64u; ++x)
+    {
+      bool inside = x >= 24u && x < 40u && y >= 16u && y < 32u;
+      EXPECT_EQ(inside, std::isfinite(this->Fragment(x, y).depth))
+          << x << " " << y;
+    }
+  }
+
+  // the shared diagonal is covered once, each pixel belongs to one of the
+  // triangles
+  unsigned int first = 0u;
+  for (const auto &fragment : this->fragments)
+    first += fragment.triangle == 0u ? 1u : 0u;
+  EXPECT_GT(first, 100u);
+  EXPECT_LT(first, 156u);
+
+  // winding does not matter
+  this->data.triangles.clear();
+  this->AddQuad(math::Vector3f(2, 0.5f, 0.5f),
+      math::Vector3f(2, -0.5f, 0.5f), math::Vector3f(2, -0.5f, -0.5f),
+      math::Vector3f(2, 0.5f, -0.5f));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(256u, this->Coverage());
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, NearClipping)
+{
+  // ground plane half a meter below the camera, starting behind it
+  this->AddQuad(math::Vector3f(-5, 50, -0.5f), math::Vector3f(-5, -50, -0.5f),
+      math::Vector3f(50, -50, -0.5f), math::Vector3f(50, 50, -0.5f));
+  this->view.near = 1.0;
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_GE(this->rasterizer.TriangleCount(), 2u);
+
+  for (unsigned int y = 0u; y < 48u; ++y)
+  {
+    // the pixel ray reaches the plane at a depth of 16 / (cy - 24)
+    float cy = y + 0.5f;
+    for (unsigned int x = 0u; x < 64u; ++x)
+    {
+      const CpuFragment &fragment = this->Fragment(x, y);
+      float expected = cy > 24.0f ? 16.0f / (cy - 24.0f) :
+          std::numeric_limits<float>::infinity();
+      if (expected < 1.0f || !std::isfinite(expected))
+      {
+        // above the horizon, or clipped by the near plane
+        EXPECT_FALSE(std::isfinite(fragment.depth)) << x << " " << y;
+      }
+      else
+      {
+        EXPECT_NEAR(expected, fragment.depth, expected * 1e-3f)
+            << x << " " << y;
+        EXPECT_GE(fragment.depth, 1.0f);
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, Culling)
+{
+  // behind the camera, outside the field of view, beyond the far plane
+  this->AddTriangle(math::Vector3f(-2, 1, 0), math::Vector3f(-2, -1, 0),
+      math::Vector3f(-2, 0, 1));
+  this->AddTriangle(math::Vector3f(1, 2, 0), math::Vector3f(1, 3, 0),
+      math::Vector3f(1, 2, 1));
+  this->AddTriangle(math::Vector3f(1, 0, 2), math::Vector3f(1, 1, 2),
+      math::Vector3f(1, 0, 3));
+  this->AddTriangle(math::Vector3f(200, 1, 0), math::Vector3f(200, -1, 0),
+      math::Vector3f(200, 0, 1));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(0u, this->rasterizer.TriangleCount());
+  EXPECT_EQ(0u, this->Coverage());
+
+  // crossing the far plane is cut per pixel
+  this->data.triangles.clear();
+  this->AddQuad(math::Vector3f(50, 100, -10), math::Vector3f(150, -100, -10),
+      math::Vector3f(150, -100, 10), math::Vector3f(50, 100, 10));
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  unsigned int coverage = this->Coverage();
+  EXPECT_GT(coverage, 0u);
+  EXPECT_LT(coverage, 64u * 48u);
+  for (const auto &fragment : this->fragments)
+  {
+    if (std::isfinite(fragment.depth))
+    {
+      EXPECT_LE(fragment.depth, 100.0f);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(CpuRasterizerTest, VisibilityMask)
+{
+  this->AddQuad(math::Vector3f(2, 10, -10), math::Vector3f(2, -10, -10),
+      math::Vector3f(2, -10, 10), math::Vector3f(2, 10, 10));
+  this->data.surfaces[0].visibilityFlags = 0x2u;
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(0u, this->Coverage());
+
+  this->view.mask = 0x3u;
+  this->rasterizer.Render(this->data, this->view, this->fragments);
+  EXPECT_EQ(64u * 48u, this->Coverage());
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <limits>
+
+#include "ignition/rendering/cpu/CpuRayQuery.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+
+#include "CpuBvh.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuRayQuery::CpuRayQuery()
+{
+}
+
+//////////////////////////////////////////////////
+CpuRayQuery::~CpuRayQuery()
+{
+}
+
+//////////////////////////////////////////////////
+RayQueryResult CpuRayQuery::ClosestPoint()
+{
+  RayQueryResult result;
+  if (!this->scene)
+    return result;
+
+  math::Vector3d dir = this->direction.Normalized();
+  math::Vector3f origin(this->origin.X(), this->origin.Y(), this->origin.Z());
+  math::Vector3f rayDir(dir.X(), dir.Y(), dir.Z());
+
+  CpuHit hit;
+  const CpuBvh &bvh = this->scene->Bvh();
+  if (!bvh.Intersect(origin, rayDir, 0.0f,
+      std::numeric_limits<float>::max(), UINT32_MAX, hit) ||
+      hit.distance <= 0.0f)
+  {
+    return result;
+  }
+
+  const CpuSceneData &data = this->scene->SceneData();
+  const CpuTriangle &tri = data.triangles[hit.triangle];
+  math::Vector3f normal = (tri.vertices[1] - tri.vertices[0]).Cross(
+      tri.vertices[2] - tri.vertices[0]);
+  if (normal.Dot(rayDir) > 0.0f)
+    normal = -normal;
+  normal.Normalize();
+
+  result.distance = hit.distance;
+  result.point = this->origin + dir * hit.distance;
+  result.objectId = data.surfaces[tri.surface].visualId;
+  result.normal.Set(normal.X(), normal.Y(), normal.Z());
+  return result;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <ignition/plugin/Register.hh>
+
+#include "ignition/rendering/RenderEngineManager.hh"
+#include "ignition/rendering/cpu/CpuRenderEngine.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuStorage.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuRenderEnginePlugin::CpuRenderEnginePlugin()
+{
+}
+
+//////////////////////////////////////////////////
+std::string CpuRenderEnginePlugin::Name() const
+{
+  return CpuRenderEngine::Instance()->Name();
+}
+
+//////////////////////////////////////////////////
+RenderEngine *CpuRenderEnginePlugin::Engine() const
+{
+  return CpuRenderEngine::Instance();
+}
+
+//////////////////////////////////////////////////
+CpuRenderEngine::CpuRenderEngine()
+{
+  // render passes are shaders of the gpu engines, sensors of this engine
+  // add noise with CpuNoisePass instead
+  this->renderPassSystem.reset();
+}
+
+//////////////////////////////////////////////////
+CpuRenderEngine::~CpuRenderEngine()
+{
+}
+
+//////////////////////////////////////////////////
+std::string CpuRenderEngine::Name() const
+{
+  return "cpu";
+}
+
+//////////////////////////////////////////////////
+ScenePtr CpuRenderEngine::CreateSceneImpl(unsigned int _id,
+    const std::string &_name)
+{
+  auto scene = CpuScenePtr(new CpuScene(_id, _name));
+  this->scenes->Add(scene);
+  return scene;
+}
+
+//////////////////////////////////////////////////
+SceneStorePtr CpuRenderEngine::Scenes() const
+{
+  return this->scenes;
+}
+
+//////////////////////////////////////////////////
+bool CpuRenderEngine::LoadImpl(
+    const std::map<std::string, std::string> &/*_params*/)
+{
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool CpuRenderEngine::InitImpl()
+{
+  this->scenes = CpuSceneStorePtr(new CpuSceneStore);
+  return true;
+}
+
+// Register this plugin
+IGNITION_ADD_PLUGIN(ignition::rendering::CpuRenderEnginePlugin,
+                    ignition::rendering::RenderEnginePlugin)
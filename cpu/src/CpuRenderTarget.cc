@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstring>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/cpu/CpuRenderTarget.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+// CpuRenderTarget
+//////////////////////////////////////////////////
+CpuRenderTarget::CpuRenderTarget()
+{
+}
+
+//////////////////////////////////////////////////
+CpuRenderTarget::~CpuRenderTarget()
+{
+}
+
+//////////////////////////////////////////////////
+void CpuRenderTarget::Copy(Image &_image) const
+{
+  if (_image.Width() != this->width || _image.Height() != this->height)
+  {
+    ignerr << "Invalid image dimensions" << std::endl;
+    return;
+  }
+
+  if (_image.Format() != this->format)
+  {
+    ignerr << "Invalid image format" << std::endl;
+    return;
+  }
+
+  if (_image.MemorySize() != this->buffer.size())
+    return;
+
+  std::memcpy(_image.Data<unsigned char>(), this->buffer.data(),
+      this->buffer.size());
+}
+
+//////////////////////////////////////////////////
+unsigned char *CpuRenderTarget::Data()
+{
+  return this->buffer.data();
+}
+
+//////////////////////////////////////////////////
+size_t CpuRenderTarget::DataSize() const
+{
+  return this->buffer.size();
+}
+
+//////////////////////////////////////////////////
+void CpuRenderTarget::RebuildImpl()
+{
+  this->buffer.assign(
+      PixelUtil::MemorySize(this->format, this->width, this->height), 0u);
+}
+
+//////////////////////////////////////////////////
+// CpuRenderTexture
+//////////////////////////////////////////////////
+CpuRenderTexture::CpuRenderTexture()
+{
+}
+
+//////////////////////////////////////////////////
+CpuRenderTexture::~CpuRenderTexture()
+{
+}
+
+//////////////////////////////////////////////////
+// CpuRenderWindow
+//////////////////////////////////////////////////
+CpuRenderWindow::CpuRenderWindow()
+{
+}
+
+//////////////////////////////////////////////////
+CpuRenderWindow::~CpuRenderWindow()
+{
+}
@@ -0,0 +1,605 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <variant>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/cpu/CpuArrowVisual.hh"
+#include "ignition/rendering/cpu/CpuAxisVisual.hh"
+#include "ignition/rendering/cpu/CpuCamera.hh"
+#include "ignition/rendering/cpu/CpuDepthCamera.hh"
+#include "ignition/rendering/cpu/CpuGeometry.hh"
+#include "ignition/rendering/cpu/CpuGpuRays.hh"
+#include "ignition/rendering/cpu/CpuLight.hh"
+#include "ignition/rendering/cpu/CpuMaterial.hh"
+#include "ignition/rendering/cpu/CpuMesh.hh"
+#include "ignition/rendering/cpu/CpuMeshFactory.hh"
+#include "ignition/rendering/cpu/CpuRayQuery.hh"
+#include "ignition/rendering/cpu/CpuRenderEngine.hh"
+#include "ignition/rendering/cpu/CpuRenderTarget.hh"
+#include "ignition/rendering/cpu/CpuScene.hh"
+#include "ignition/rendering/cpu/CpuStorage.hh"
+#include "ignition/rendering/cpu/CpuVisual.hh"
+
+#include "CpuBvh.hh"
+#include "CpuSceneData.hh"
+
+/// \brief Private data for the CpuScene class
+class ignition::rendering::CpuScenePrivate
+{
+  /// \brief Triangles and lights of the scene in the world frame
+  public: CpuSceneData data;
+
+  /// \brief Bounding volume hierarchy over the scene triangles
+  public: CpuBvh bvh;
+
+  /// \brief True if the scene data must be collected again
+  public: bool dataDirty = true;
+
+  /// \brief True if the hierarchy must be built again
+  public: bool bvhDirty = true;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuScene::CpuScene(unsigned int _id, const std::string &_name) :
+  BaseScene(_id, _name),
+  dataPtr(new CpuScenePrivate)
+{
+  this->ambientLight = math::Color::Black;
+  this->backgroundColor = math::Color::Black;
+}
+
+//////////////////////////////////////////////////
+CpuScene::~CpuScene()
+{
+}
+
+//////////////////////////////////////////////////
+RenderEngine *CpuScene::Engine() const
+{
+  return CpuRenderEngine::Instance();
+}
+
+//////////////////////////////////////////////////
+VisualPtr CpuScene::RootVisual() const
+{
+  return this->rootVisual;
+}
+
+//////////////////////////////////////////////////
+math::Color CpuScene::AmbientLight() const
+{
+  return this->ambientLight;
+}
+
+//////////////////////////////////////////////////
+void CpuScene::SetAmbientLight(const math::Color &_color)
+{
+  this->ambientLight = _color;
+}
+
+//////////////////////////////////////////////////
+void CpuScene::PreRender()
+{
+  BaseScene::PreRender();
+  this->dataPtr->dataDirty = true;
+  this->dataPtr->bvhDirty = true;
+}
+
+//////////////////////////////////////////////////
+const CpuSceneData &CpuScene::SceneData()
+{
+  if (!this->dataPtr->dataDirty)
+    return this->dataPtr->data;
+
+  IGN_RENDERING_TRACE_ZONE("CpuScene::SceneData");
+  CpuSceneData &data = this->dataPtr->data;
+  data.triangles.clear();
+  data.surfaces.clear();
+  data.lights.clear();
+  data.ambient = this->ambientLight;
+  data.background = this->backgroundColor;
+
+  if (this->rootVisual)
+    this->CollectVisual(this->rootVisual, data);
+  this->CollectLights(data);
+
+  this->dataPtr->dataDirty = false;
+  this->dataPtr->bvhDirty = true;
+  return data;
+}
+
+//////////////////////////////////////////////////
+const CpuBvh &CpuScene::Bvh()
+{
+  const CpuSceneData &data = this->SceneData();
+  if (this->dataPtr->bvhDirty)
+  {
+    IGN_RENDERING_TRACE_ZONE("CpuScene::Bvh");
+    this->dataPtr->bvh.Build(data);
+    this->dataPtr->bvhDirty = false;
+  }
+  return this->dataPtr->bvh;
+}
+
+//////////////////////////////////////////////////
+void CpuScene::CollectVisual(const CpuVisualPtr &_visual,
+    CpuSceneData &_data) const
+{
+  // hidden visuals hide their children too
+  if (!_visual->Visible())
+    return;
+
+  math::Pose3d pose = _visual->WorldPose();
+  math::Vector3d scale = _visual->WorldScale();
+  math::Vector3f s(scale.X(), scale.Y(), scale.Z());
+  math::Vector3f invScale(
+      math::equal(s.X(), 0.0f) ? 0.0f : 1.0f / s.X(),
+      math::equal(s.Y(), 0.0f) ? 0.0f : 1.0f / s.Y(),
+      math::equal(s.Z(), 0.0f) ? 0.0f : 1.0f / s.Z());
+  math::Quaternionf rot(pose.Rot().W(), pose.Rot().X(), pose.Rot().Y(),
+      pose.Rot().Z());
+  math::Vector3f pos(pose.Pos().X(), pose.Pos().Y(), pose.Pos().Z());
+
+  // laser retro of the visual, as set by gpu rays users
+  float retro = 0.0f;
+  Variant userData = _visual->UserData("laser_retro");
+  if (const float *value = std::get_if<float>(&userData))
+    retro = *value;
+  else if (const double *value = std::get_if<double>(&userData))
+    retro = static_cast<float>(*value);
+  else if (const int *value = std::get_if<int>(&userData))
+    retro = static_cast<float>(*value);
+  retro = std::max(retro, 0.0f);
+
+  for (unsigned int g = 0; g < _visual->GeometryCount(); ++g)
+  {
+    CpuMeshPtr mesh =
+        std::dynamic_pointer_cast<CpuMesh>(_visual->GeometryByIndex(g));
+    if (!mesh)
+      continue;
+
+    for (unsigned int m = 0; m < mesh->SubMeshCount(); ++m)
+    {
+      CpuSubMeshPtr subMesh =
+          std::dynamic_pointer_cast<CpuSubMesh>(mesh->SubMeshByIndex(m));
+      if (!subMesh || !subMesh->Data())
+        continue;
+
+      CpuSurface surface;
+      MaterialPtr material = subMesh->Material();
+      if (material)
+      {
+        surface.ambient = material->Ambient();
+        surface.diffuse = material->Diffuse();
+        surface.emissive = material->Emissive();
+        surface.lighting = material->LightingEnabled();
+      }
+      surface.retro = retro;
+      surface.visualId = _visual->Id();
+      surface.visibilityFlags = _visual->VisibilityFlags();
+      unsigned int surfaceIndex =
+          static_cast<unsigned int>(_data.surfaces.size());
+      _data.surfaces.push_back(surface);
+
+      const CpuSubMeshData &subMeshData = *subMesh->Data();
+      for (size_t i = 0; i + 2 < subMeshData.indices.size(); i += 3)
+      {
+        CpuTriangle tri;
+        tri.surface = surfaceIndex;
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+          unsigned int index = subMeshData.indices[i + k];
+          tri.vertices[k] = rot * (subMeshData.vertices[index] * s) + pos;
+          tri.normals[k] = rot * (subMeshData.normals[index] * invScale);
+          tri.normals[k].Normalize();
+        }
+        _data.triangles.push_back(tri);
+      }
+    }
+  }
+
+  for (unsigned int c = 0; c < _visual->ChildCount(); ++c)
+  {
+    CpuVisualPtr child =
+        std::dynamic_pointer_cast<CpuVisual>(_visual->ChildByIndex(c));
+    if (child)
+      this->CollectVisual(child, _data);
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuScene::CollectLights(CpuSceneData &_data) const
+{
+  for (unsigned int i = 0; i < this->lights->Size(); ++i)
+  {
+    CpuLightPtr light = this->lights->DerivedByIndex(i);
+    if (!light)
+      continue;
+
+    math::Pose3d pose = light->WorldPose();
+    CpuLightData data;
+    data.position.Set(pose.Pos().X(), pose.Pos().Y(), pose.Pos().Z());
+    data.diffuse = light->DiffuseColor() *
+        static_cast<float>(light->Intensity());
+    data.attenuationConstant =
+        static_cast<float>(light->AttenuationConstant());
+    data.attenuationLinear = static_cast<float>(light->AttenuationLinear());
+    data.attenuationQuadratic =
+        static_cast<float>(light->AttenuationQuadratic());
+    data.range = static_cast<float>(light->AttenuationRange());
+
+    math::Vector3d direction;
+    if (auto directional =
+        std::dynamic_pointer_cast<CpuDirectionalLight>(light))
+    {
+      data.type = CLT_DIRECTIONAL;
+      direction = directional->Direction();
+    }
+    else if (auto spot = std::dynamic_pointer_cast<CpuSpotLight>(light))
+    {
+      data.type = CLT_SPOT;
+      direction = spot->Direction();
+      data.cosInner = static_cast<float>(
+          std::cos(spot->InnerAngle().Radian() * 0.5));
+      data.cosOuter = static_cast<float>(
+          std::cos(spot->OuterAngle().Radian() * 0.5));
+      data.falloff = static_cast<float>(spot->Falloff());
+    }
+    else
+    {
+      data.type = CLT_POINT;
+    }
+    direction = (pose.Rot() * direction).Normalize();
+    data.direction.Set(direction.X(), direction.Y(), direction.Z());
+
+    _data.lights.push_back(data);
+  }
+}
+
+//////////////////////////////////////////////////
+bool CpuScene::LoadImpl()
+{
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool CpuScene::InitImpl()
+{
+  this->CreateStores();
+  this->CreateRootVisual();
+  this->CreateMeshFactory();
+  return true;
+}
+
+//////////////////////////////////////////////////
+DirectionalLightPtr CpuScene::CreateDirectionalLightImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuDirectionalLightPtr light(new CpuDirectionalLight);
+  bool result = this->InitObject(light, _id, _name);
+  return (result) ? light : nullptr;
+}
+
+//////////////////////////////////////////////////
+PointLightPtr CpuScene::CreatePointLightImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuPointLightPtr light(new CpuPointLight);
+  bool result = this->InitObject(light, _id, _name);
+  return (result) ? light : nullptr;
+}
+
+//////////////////////////////////////////////////
+SpotLightPtr CpuScene::CreateSpotLightImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuSpotLightPtr light(new CpuSpotLight);
+  bool result = this->InitObject(light, _id, _name);
+  return (result) ? light : nullptr;
+}
+
+//////////////////////////////////////////////////
+CameraPtr CpuScene::CreateCameraImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuCameraPtr camera(new CpuCamera);
+  bool result = this->InitObject(camera, _id, _name);
+  return (result) ? camera : nullptr;
+}
+
+//////////////////////////////////////////////////
+DepthCameraPtr CpuScene::CreateDepthCameraImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuDepthCameraPtr camera(new CpuDepthCamera);
+  bool result = this->InitObject(camera, _id, _name);
+  return (result) ? camera : nullptr;
+}
+
+//////////////////////////////////////////////////
+GpuRaysPtr CpuScene::CreateGpuRaysImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuGpuRaysPtr gpuRays(new CpuGpuRays);
+  bool result = this->InitObject(gpuRays, _id, _name);
+  return (result) ? gpuRays : nullptr;
+}
+
+//////////////////////////////////////////////////
+VisualPtr CpuScene::CreateVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuVisualPtr visual(new CpuVisual);
+  bool result = this->InitObject(visual, _id, _name);
+  return (result) ? visual : nullptr;
+}
+
+//////////////////////////////////////////////////
+ArrowVisualPtr CpuScene::CreateArrowVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuArrowVisualPtr visual(new CpuArrowVisual);
+  bool result = this->InitObject(visual, _id, _name);
+  return (result) ? visual : nullptr;
+}
+
+//////////////////////////////////////////////////
+AxisVisualPtr CpuScene::CreateAxisVisualImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuAxisVisualPtr visual(new CpuAxisVisual);
+  bool result = this->InitObject(visual, _id, _name);
+  return (result) ? visual : nullptr;
+}
+
+//////////////////////////////////////////////////
+GeometryPtr CpuScene::CreateBoxImpl(unsigned int _id,
+    const std::string &_name)
+{
+  MeshDescriptor descriptor("unit_box");
+  return this->CreateMeshImpl(_id, _name, descriptor);
+}
+
+//////////////////////////////////////////////////
+GeometryPtr CpuScene::CreateConeImpl(unsigned int _id,
+    const std::string &_name)
+{
+  MeshDescriptor descriptor("unit_cone");
+  return this->CreateMeshImpl(_id, _name, descriptor);
+}
+
+//////////////////////////////////////////////////
+GeometryPtr CpuScene::CreateCylinderImpl(unsigned int _id,
+    const std::string &_name)
+{
+  MeshDescriptor descriptor("unit_cylinder");
+  return this->CreateMeshImpl(_id, _name, descriptor);
+}
+
+//////////////////////////////////////////////////
+GeometryPtr CpuScene::CreatePlaneImpl(unsigned int _id,
+    const std::string &_name)
+{
+  MeshDescriptor descriptor("unit_plane");
+  return this->CreateMeshImpl(_id, _name, descriptor);
+}
+
+//////////////////////////////////////////////////
+GeometryPtr CpuScene::CreateSphereImpl(unsigned int _id,
+    const std::string &_name)
+{
+  MeshDescriptor descriptor("unit_sphere");
+  return this->CreateMeshImpl(_id, _name, descriptor);
+}
+
+//////////////////////////////////////////////////
+MeshPtr CpuScene::CreateMeshImpl(unsigned int _id, const std::string &_name,
+    const MeshDescriptor &_desc)
+{
+  CpuMeshPtr mesh = this->meshFactory->Create(_desc);
+  if (nullptr == mesh)
+    return nullptr;
+
+  bool result = this->InitObject(mesh, _id, _name);
+  return (result) ? mesh : nullptr;
+}
+
+//////////////////////////////////////////////////
+CapsulePtr CpuScene::CreateCapsuleImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "Capsule not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return CapsulePtr();
+}
+
+//////////////////////////////////////////////////
+GridPtr CpuScene::CreateGridImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "Grid not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return GridPtr();
+}
+
+//////////////////////////////////////////////////
+MarkerPtr CpuScene::CreateMarkerImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "Marker not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return MarkerPtr();
+}
+
+//////////////////////////////////////////////////
+LidarVisualPtr CpuScene::CreateLidarVisualImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "LidarVisual not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return LidarVisualPtr();
+}
+
+//////////////////////////////////////////////////
+HeightmapPtr CpuScene::CreateHeightmapImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/, const HeightmapDescriptor &/*_desc*/)
+{
+  ignerr << "Heightmap not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return HeightmapPtr();
+}
+
+//////////////////////////////////////////////////
+WireBoxPtr CpuScene::CreateWireBoxImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "WireBox not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return WireBoxPtr();
+}
+
+//////////////////////////////////////////////////
+LightVisualPtr CpuScene::CreateLightVisualImpl(unsigned int /*_id*/,
+    const std::string &/*_name*/)
+{
+  ignerr << "LightVisual not supported by: " << this->Engine()->Name()
+         << std::endl;
+  return LightVisualPtr();
+}
+
+//////////////////////////////////////////////////
+MaterialPtr CpuScene::CreateMaterialImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuMaterialPtr material(new CpuMaterial);
+  bool result = this->InitObject(material, _id, _name);
+  return (result) ? material : nullptr;
+}
+
+//////////////////////////////////////////////////
+RenderTexturePtr CpuScene::CreateRenderTextureImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuRenderTexturePtr renderTexture(new CpuRenderTexture);
+  bool result = this->InitObject(renderTexture, _id, _name);
+  return (result) ? renderTexture : nullptr;
+}
+
+//////////////////////////////////////////////////
+RenderWindowPtr CpuScene::CreateRenderWindowImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuRenderWindowPtr renderWindow(new CpuRenderWindow);
+  bool result = this->InitObject(renderWindow, _id, _name);
+  return (result) ? renderWindow : nullptr;
+}
+
+//////////////////////////////////////////////////
+RayQueryPtr CpuScene::CreateRayQueryImpl(unsigned int _id,
+    const std::string &_name)
+{
+  CpuRayQueryPtr rayQuery(new CpuRayQuery);
+  bool result = this->InitObject(rayQuery, _id, _name);
+  return (result) ? rayQuery : nullptr;
+}
+
+//////////////////////////////////////////////////
+bool CpuScene::InitObject(CpuObjectPtr _object, unsigned int _id,
+    const std::string &_name)
+{
+  // assign needed varibles
+  _object->id = _id;
+  _object->name = _name;
+  _object->scene = this->SharedThis();
+
+  // initialize object
+  _object->Load();
+  _object->Init();
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+LightStorePtr CpuScene::Lights() const
+{
+  return this->lights;
+}
+
+//////////////////////////////////////////////////
+SensorStorePtr CpuScene::Sensors() const
+{
+  return this->sensors;
+}
+
+//////////////////////////////////////////////////
+VisualStorePtr CpuScene::Visuals() const
+{
+  return this->visuals;
+}
+
+//////////////////////////////////////////////////
+MaterialMapPtr CpuScene::Materials() const
+{
+  return this->materials;
+}
+
+//////////////////////////////////////////////////
+void CpuScene::CreateRootVisual()
+{
+  // create unregistered visual
+  this->rootVisual = CpuVisualPtr(new CpuVisual);
+  unsigned int rootId = this->CreateObjectId();
+  std::string rootName = this->CreateObjectName(rootId, "ROOT");
+
+  // check if root visual created successfully
+  if (!this->InitObject(this->rootVisual, rootId, rootName))
+  {
+    ignerr << "Unable to create root visual" << std::endl;
+    this->rootVisual = nullptr;
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuScene::CreateMeshFactory()
+{
+  CpuScenePtr sharedThis = this->SharedThis();
+  this->meshFactory = CpuMeshFactoryPtr(new CpuMeshFactory(sharedThis));
+}
+
+//////////////////////////////////////////////////
+void CpuScene::CreateStores()
+{
+  this->lights = CpuLightStorePtr(new CpuLightStore);
+  this->sensors = CpuSensorStorePtr(new CpuSensorStore);
+  this->visuals = CpuVisualStorePtr(new CpuVisualStore);
+  this->materials = CpuMaterialMapPtr(new CpuMaterialMap);
+}
+
+//////////////////////////////////////////////////
+CpuScenePtr CpuScene::SharedThis()
+{
+  ScenePtr sharedBase = this->shared_from_this();
+  return std::dynamic_pointer_cast<CpuScene>(sharedBase);
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUSCENEDATA_HH_
+#define IGNITION_RENDERING_CPU_CPUSCENEDATA_HH_
+
+#include <cstdint>
+#include <vector>
+
+#include <ignition/math/Color.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Shading and sensor properties shared by the triangles of a
+    /// sub-mesh
+    struct CpuSurface
+    {
+      /// \brief Ambient color of the material
+      math::Color ambient;
+
+      /// \brief Diffuse color of the material
+      math::Color diffuse;
+
+      /// \brief Emissive color of the material
+      math::Color emissive;
+
+      /// \brief False to use the diffuse color without lighting
+      bool lighting = true;
+
+      /// \brief Laser retro value of the visual, 0 if it has none
+      float retro = 0.0f;
+
+      /// \brief Id of the visual the sub-mesh is attached to
+      unsigned int visualId = 0u;
+
+      /// \brief Visibility flags of the visual
+      uint32_t visibilityFlags = 0u;
+    };
+
+    /// \brief Triangle in the world frame
+    struct CpuTriangle
+    {
+      /// \brief Vertex positions
+      math::Vector3f vertices[3];
+
+      /// \brief Vertex normals, normalized
+      math::Vector3f normals[3];
+
+      /// \brief Index of the surface of the triangle
+      unsigned int surface = 0u;
+    };
+
+    /// \brief Type of a light
+    enum CpuLightType
+    {
+      /// \brief Directional light
+      CLT_DIRECTIONAL = 0,
+
+      /// \brief Point light
+      CLT_POINT = 1,
+
+      /// \brief Spot light
+      CLT_SPOT = 2
+    };
+
+    /// \brief Light in the world frame
+    struct CpuLightData
+    {
+      /// \brief Light type
+      CpuLightType type = CLT_POINT;
+
+      /// \brief Light position
+      math::Vector3f position;
+
+      /// \brief Normalized light direction of directional and spot lights
+      math::Vector3f direction;
+
+      /// \brief Diffuse color scaled by the intensity
+      math::Color diffuse;
+
+      /// \brief Constant attenuation factor
+      float attenuationConstant = 1.0f;
+
+      /// \brief Linear attenuation factor
+      float attenuationLinear = 0.0f;
+
+      /// \brief Quadratic attenuation factor
+      float attenuationQuadratic = 0.0f;
+
+      /// \brief Distance beyond which the light has no effect
+      float range = 0.0f;
+
+      /// \brief Cosine of half the inner angle of a spot light
+      float cosInner = 1.0f;
+
+      /// \brief Cosine of half the outer angle of a spot light
+      float cosOuter = 0.0f;
+
+      /// \brief Spot light falloff exponent
+      float falloff = 1.0f;
+    };
+
+    /// \brief Geometry and lights of a scene in the world frame, collected
+    /// once per frame and shared by all sensors rendering it
+    struct CpuSceneData
+    {
+      /// \brief Triangles of all visible meshes
+      std::vector<CpuTriangle> triangles;
+
+      /// \brief Surfaces referenced by the triangles
+      std::vector<CpuSurface> surfaces;
+
+      /// \brief Lights of the scene
+      std::vector<CpuLightData> lights;
+
+      /// \brief Ambient light color of the scene
+      math::Color ambient;
+
+      /// \brief Background color of the scene
+      math::Color background;
+    };
+    }
+  }
+}
+#endif
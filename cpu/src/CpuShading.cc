@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "CpuShading.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+math::Vector3f ignition::rendering::CpuFragmentPosition(
+    const CpuSceneData &_data, const CpuFragment &_fragment)
+{
+  const CpuTriangle &tri = _data.triangles[_fragment.triangle];
+  float b0 = 1.0f - _fragment.b1 - _fragment.b2;
+  return tri.vertices[0] * b0 + tri.vertices[1] * _fragment.b1 +
+      tri.vertices[2] * _fragment.b2;
+}
+
+//////////////////////////////////////////////////
+math::Color ignition::rendering::CpuShade(const CpuSceneData &_data,
+    const CpuFragment &_fragment, const math::Vector3f &_eye)
+{
+  if (_fragment.triangle >= _data.triangles.size())
+    return _data.background;
+
+  const CpuTriangle &tri = _data.triangles[_fragment.triangle];
+  const CpuSurface &surface = _data.surfaces[tri.surface];
+  if (!surface.lighting)
+    return surface.diffuse;
+
+  float b0 = 1.0f - _fragment.b1 - _fragment.b2;
+  math::Vector3f position = CpuFragmentPosition(_data, _fragment);
+  math::Vector3f normal = tri.normals[0] * b0 +
+      tri.normals[1] * _fragment.b1 + tri.normals[2] * _fragment.b2;
+  if (normal.SquaredLength() <= 0.0f)
+  {
+    normal = (tri.vertices[1] - tri.vertices[0]).Cross(
+        tri.vertices[2] - tri.vertices[0]);
+  }
+  normal.Normalize();
+
+  // triangles are double sided
+  if (normal.Dot(_eye - position) < 0.0f)
+    normal = -normal;
+
+  float r = surface.emissive.R() + surface.ambient.R() * _data.ambient.R();
+  float g = surface.emissive.G() + surface.ambient.G() * _data.ambient.G();
+  float b = surface.emissive.B() + surface.ambient.B() * _data.ambient.B();
+
+  for (const auto &light : _data.lights)
+  {
+    math::Vector3f toLight;
+    float attenuation = 1.0f;
+    if (light.type == CLT_DIRECTIONAL)
+    {
+      toLight = -light.direction;
+    }
+    else
+    {
+      toLight = light.position - position;
+      float distance = toLight.Length();
+      if (light.range > 0.0f && distance > light.range)
+        continue;
+      if (distance > 0.0f)
+        toLight /= distance;
+      float denominator = light.attenuationConstant +
+          light.attenuationLinear * distance +
+          light.attenuationQuadratic * distance * distance;
+      if (denominator > 0.0f)
+        attenuation = 1.0f / denominator;
+    }
+
+    float lambert = normal.Dot(toLight);
+    if (lambert <= 0.0f)
+      continue;
+
+    if (light.type == CLT_SPOT)
+    {
+      float rho = -toLight.Dot(light.direction);
+      float spot = 0.0f;
+      if (light.cosInner > light.cosOuter)
+      {
+        spot = std::min(std::max((rho - light.cosOuter) /
+            (light.cosInner - light.cosOuter), 0.0f), 1.0f);
+        spot = std::pow(spot, light.falloff);
+      }
+      else
+      {
+        spot = rho >= light.cosOuter ? 1.0f : 0.0f;
+      }
+      attenuation *= spot;
+    }
+
+    float factor = lambert * attenuation;
+    r += surface.diffuse.R() * light.diffuse.R() * factor;
+    g += surface.diffuse.G() * light.diffuse.G() * factor;
+    b += surface.diffuse.B() * light.diffuse.B() * factor;
+  }
+
+  return math::Color(std::min(r, 1.0f), std::min(g, 1.0f),
+      std::min(b, 1.0f), surface.diffuse.A());
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUSHADING_HH_
+#define IGNITION_RENDERING_CPU_CPUSHADING_HH_
+
+#include <ignition/math/Color.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+
+#include "CpuRasterizer.hh"
+#include "CpuSceneData.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Compute the color of a fragment: the emissive and ambient
+    /// colors of its surface plus the diffuse contribution of every light,
+    /// with the normal facing the eye. Specular highlights, shadows,
+    /// textures and transparency are not rendered.
+    /// \param[in] _data Scene data the fragment was rasterized from
+    /// \param[in] _fragment Fragment
+    /// \param[in] _eye World position of the camera
+    /// \return Fragment color, the background color if no triangle covers
+    /// the fragment
+    math::Color CpuShade(const CpuSceneData &_data,
+        const CpuFragment &_fragment, const math::Vector3f &_eye);
+
+    /// \brief Get the world position of a fragment on its triangle
+    /// \param[in] _data Scene data the fragment was rasterized from
+    /// \param[in] _fragment Fragment covered by a triangle
+    /// \return World position
+    math::Vector3f CpuFragmentPosition(const CpuSceneData &_data,
+        const CpuFragment &_fragment);
+    }
+  }
+}
+#endif
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/cpu/CpuGeometry.hh"
+#include "ignition/rendering/cpu/CpuStorage.hh"
+#include "ignition/rendering/cpu/CpuVisual.hh"
+#include "ignition/rendering/Utils.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuVisual::CpuVisual()
+{
+}
+
+//////////////////////////////////////////////////
+CpuVisual::~CpuVisual()
+{
+}
+
+//////////////////////////////////////////////////
+void CpuVisual::SetVisible(bool _visible)
+{
+  this->visible = _visible;
+}
+
+//////////////////////////////////////////////////
+bool CpuVisual::Visible() const
+{
+  return this->visible;
+}
+
+//////////////////////////////////////////////////
+ignition::math::AxisAlignedBox CpuVisual::LocalBoundingBox() const
+{
+  ignition::math::AxisAlignedBox box;
+  this->BoundsHelper(box, true /* local frame */, this->WorldPose());
+  return box;
+}
+
+//////////////////////////////////////////////////
+ignition::math::AxisAlignedBox CpuVisual::BoundingBox() const
+{
+  ignition::math::AxisAlignedBox box;
+  this->BoundsHelper(box, false /* world frame */, this->WorldPose());
+  return box;
+}
+
+//////////////////////////////////////////////////
+void CpuVisual::BoundsHelper(ignition::math::AxisAlignedBox &_box,
+    bool _local, const ignition::math::Pose3d &_pose) const
+{
+  ignition::math::Vector3d scale = this->WorldScale();
+  ignition::math::Pose3d worldPose = this->WorldPose();
+
+  // Assume world transform
+  ignition::math::Pose3d transform = worldPose;
+
+  // If local frame, transform relative to the visual the box was asked for
+  if (_local)
+  {
+    ignition::math::Quaterniond parentRotInv = _pose.Rot().Inverse();
+    transform = ignition::math::Pose3d(
+        parentRotInv * (worldPose.Pos() - _pose.Pos()),
+        parentRotInv * worldPose.Rot());
+  }
+
+  for (unsigned int i = 0; i < this->GeometryCount(); ++i)
+  {
+    CpuGeometryPtr geometry =
+        std::dynamic_pointer_cast<CpuGeometry>(this->GeometryByIndex(i));
+    if (!geometry)
+      continue;
+
+    ignition::math::AxisAlignedBox bounds = geometry->LocalBounds();
+    if (bounds.Min().X() > bounds.Max().X())
+      continue;
+
+    // size to object's scale, then transform to world or local space
+    ignition::math::AxisAlignedBox box(scale * bounds.Min(),
+        scale * bounds.Max());
+    _box.Merge(transformAxisAlignedBox(box, transform));
+  }
+
+  for (unsigned int i = 0; i < this->ChildCount(); ++i)
+  {
+    CpuVisualPtr visual =
+        std::dynamic_pointer_cast<CpuVisual>(this->ChildByIndex(i));
+    if (visual)
+      visual->BoundsHelper(_box, _local, _pose);
+  }
+}
+
+//////////////////////////////////////////////////
+GeometryStorePtr CpuVisual::Geometries() const
+{
+  return this->geometries;
+}
+
+//////////////////////////////////////////////////
+bool CpuVisual::AttachGeometry(GeometryPtr _geometry)
+{
+  if (!_geometry)
+  {
+    ignerr << "Cannot attach null geometry." << std::endl;
+    return false;
+  }
+
+  CpuGeometryPtr derived =
+      std::dynamic_pointer_cast<CpuGeometry>(_geometry);
+
+  if (!derived)
+  {
+    ignerr << "Cannot attach geometry created by another render-engine"
+          << std::endl;
+    return false;
+  }
+
+  derived->SetParent(this->SharedThis());
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool CpuVisual::DetachGeometry(GeometryPtr _geometry)
+{
+  CpuGeometryPtr derived =
+      std::dynamic_pointer_cast<CpuGeometry>(_geometry);
+
+  if (!derived)
+  {
+    ignerr << "Cannot detach geometry created by another render-engine"
+          << std::endl;
+    return false;
+  }
+
+  derived->SetParent(nullptr);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void CpuVisual::Init()
+{
+  BaseVisual::Init();
+  this->geometries = CpuGeometryStorePtr(new CpuGeometryStore);
+}
+
+//////////////////////////////////////////////////
+CpuVisualPtr CpuVisual::SharedThis()
+{
+  ObjectPtr object = shared_from_this();
+  return std::dynamic_pointer_cast<CpuVisual>(object);
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+
+#include "CpuWorkers.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+CpuWorkers::CpuWorkers(unsigned int _threadCount)
+{
+  for (unsigned int i = 1u; i < _threadCount; ++i)
+    this->threads.emplace_back(&CpuWorkers::Work, this);
+}
+
+//////////////////////////////////////////////////
+CpuWorkers::~CpuWorkers()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stop = true;
+  }
+  this->startCondition.notify_all();
+  for (auto &thread : this->threads)
+    thread.join();
+}
+
+//////////////////////////////////////////////////
+CpuWorkers &CpuWorkers::Instance()
+{
+  static CpuWorkers workers(
+      std::max(std::thread::hardware_concurrency(), 1u));
+  return workers;
+}
+
+//////////////////////////////////////////////////
+unsigned int CpuWorkers::ThreadCount() const
+{
+  return static_cast<unsigned int>(this->threads.size()) + 1u;
+}
+
+//////////////////////////////////////////////////
+void CpuWorkers::Run(unsigned int _count,
+    const std::function<void(unsigned int)> &_task)
+{
+  // not worth waking up the workers
+  if (this->threads.empty() || _count <= 1u)
+  {
+    for (unsigned int i = 0u; i < _count; ++i)
+      _task(i);
+    return;
+  }
+
+  std::lock_guard<std::mutex> runLock(this->runMutex);
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->task = &_task;
+    this->count = _count;
+    this->next.store(0u, std::memory_order_relaxed);
+    this->busy = static_cast<unsigned int>(this->threads.size());
+    ++this->job;
+  }
+  this->startCondition.notify_all();
+
+  this->Drain(_count, _task);
+
+  std::unique_lock<std::mutex> lock(this->mutex);
+  this->doneCondition.wait(lock, [this] { return this->busy == 0u; });
+  this->task = nullptr;
+}
+
+//////////////////////////////////////////////////
+void CpuWorkers::Work()
+{
+  uint64_t lastJob = 0u;
+  while (true)
+  {
+    const std::function<void(unsigned int)> *jobTask = nullptr;
+    unsigned int jobCount = 0u;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->startCondition.wait(lock, [this, lastJob]
+          {
+            return this->stop || this->job != lastJob;
+          });
+      if (this->stop)
+        return;
+      lastJob = this->job;
+      jobTask = this->task;
+      jobCount = this->count;
+    }
+
+    this->Drain(jobCount, *jobTask);
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (--this->busy == 0u)
+      this->doneCondition.notify_one();
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuWorkers::Drain(unsigned int _count,
+    const std::function<void(unsigned int)> &_task)
+{
+  for (unsigned int i = this->next.fetch_add(1u); i < _count;
+       i = this->next.fetch_add(1u))
+  {
+    _task(i);
+  }
+}
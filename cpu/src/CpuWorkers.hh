@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPU_CPUWORKERS_HH_
+#define IGNITION_RENDERING_CPU_CPUWORKERS_HH_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/cpu/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Threads kept alive between frames that run the tiles and
+    /// rays of the sensors of the cpu render engine. Starting threads every
+    /// frame costs more than rendering a small sensor.
+    class IGNITION_RENDERING_CPU_VISIBLE CpuWorkers
+    {
+      /// \brief Constructor
+      /// \param[in] _threadCount Number of threads running tasks, including
+      /// the thread calling Run
+      public: explicit CpuWorkers(unsigned int _threadCount);
+
+      /// \brief Destructor, stops the threads
+      public: ~CpuWorkers();
+
+      /// \brief Get the workers shared by all scenes, with one thread per
+      /// hardware thread
+      /// \return The workers
+      public: static CpuWorkers &Instance();
+
+      /// \brief Get the number of threads running tasks
+      /// \return Number of threads, including the thread calling Run
+      public: unsigned int ThreadCount() const;
+
+      /// \brief Run a task for every index in [0, _count) and wait for all
+      /// of them. Tasks are handed out in index order, the calling thread
+      /// runs tasks too. Calls from several threads are run one after the
+      /// other.
+      /// \param[in] _count Number of tasks
+      /// \param[in] _task Task, called with the task index
+      public: void Run(unsigned int _count,
+                  const std::function<void(unsigned int)> &_task);
+
+      /// \brief Loop of a worker thread
+      private: void Work();
+
+      /// \brief Run tasks of the current job until none is left
+      /// \param[in] _count Number of tasks
+      /// \param[in] _task Task
+      private: void Drain(unsigned int _count,
+                   const std::function<void(unsigned int)> &_task);
+
+      /// \brief Worker threads
+      private: std::vector<std::thread> threads;
+
+      /// \brief Serializes calls to Run
+      private: std::mutex runMutex;
+
+      /// \brief Protects the job members below
+      private: std::mutex mutex;
+
+      /// \brief Notified when a job starts or the workers stop
+      private: std::condition_variable startCondition;
+
+      /// \brief Notified when the last worker finished a job
+      private: std::condition_variable doneCondition;
+
+      /// \brief Task of the current job
+      private: const std::function<void(unsigned int)> *task = nullptr;
+
+      /// \brief Number of tasks of the current job
+      private: unsigned int count = 0u;
+
+      /// \brief Index of the next task to run
+      private: std::atomic<unsigned int> next{0u};
+
+      /// \brief Number of workers still running the current job
+      private: unsigned int busy = 0u;
+
+      /// \brief Incremented for every job
+      private: uint64_t job = 0u;
+
+      /// \brief True to stop the workers
+      private: bool stop = false;
+    };
+    }
+  }
+}
+#endif
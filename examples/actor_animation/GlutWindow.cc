@@ -33,6 +33,7 @@
 #include <mutex>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <ignition/math/Matrix4.hh>
 #include <ignition/common/Console.hh>
@@ -44,6 +45,7 @@
 #include <ignition/rendering/OrbitViewController.hh>
 #include <ignition/rendering/RayQuery.hh>
 #include <ignition/rendering/Scene.hh>
+#include <ignition/rendering/Utils.hh>
 
 #include "GlutWindow.hh"
 #include "example_config.hh"
@@ -62,6 +64,10 @@ unsigned int g_cameraIndex = 0;
 ir::ImagePtr g_image;
 std::vector<ir::VisualPtr> g_visuals;
 std::vector<ir::VisualPtr> g_allVisuals;
+std::vector<ir::MeshPtr> g_meshes;
+std::map<std::string, unsigned int> g_boneIndices;
+std::vector<ignition::math::Matrix4d> g_boneTfs;
+double g_poseUpdateTime = 0.0;
 ic::SkeletonPtr g_skel;
 ic::SkeletonAnimation *g_skelAnim;
 unsigned int g_animIdx = 0;
@@ -246,33 +252,36 @@ void handleMouse()
 //////////////////////////////////////////////////
 void updatePose(double _time)
 {
-  // manually update the bone pose
-  for (auto &v : g_visuals)
-  {
+  auto start = std::chrono::steady_clock::now();
+
+  // all actors share the same skeleton so the pose is computed once
   //! [update pose]
-    std::map<std::string, ignition::math::Matrix4d> animFrames;
-    animFrames = g_skelAnim->PoseAt(_time, true);
-    std::map<std::string, ignition::math::Matrix4d> skinFrames;
-    for (auto pair : animFrames)
-    {
-      std::string animNodeName = pair.first;
-      auto animTf = pair.second;
+  std::map<std::string, ignition::math::Matrix4d> animFrames;
+  animFrames = g_skelAnim->PoseAt(_time, true);
 
-      std::string skinName =
-          g_skel->NodeNameAnimToSkin(g_animIdx, animNodeName);
-      ignition::math::Matrix4d skinTf =
-              g_skel->AlignTranslation(g_animIdx, animNodeName)
-              * animTf * g_skel->AlignRotation(g_animIdx, animNodeName);
+  std::vector<ignition::math::Matrix4d> boneTfs = g_boneTfs;
+  for (auto pair : animFrames)
+  {
+    std::string animNodeName = pair.first;
+    auto animTf = pair.second;
 
-      skinFrames[skinName] = skinTf;
-    }
+    auto it = g_boneIndices.find(animNodeName);
+    if (it == g_boneIndices.end())
+      continue;
 
-    // set bone transforms
-    ir::MeshPtr mesh =
-        std::dynamic_pointer_cast<ir::Mesh>(v->GeometryByIndex(0));
-    mesh->SetSkeletonLocalTransforms(skinFrames);
-  //! [update pose]
+    ignition::math::Matrix4d skinTf =
+            g_skel->AlignTranslation(g_animIdx, animNodeName)
+            * animTf * g_skel->AlignRotation(g_animIdx, animNodeName);
+
+    boneTfs[it->second] = skinTf;
   }
+
+  // set bone transforms of all meshes by bone index
+  ir::setSkeletonBoneTransforms(g_meshes, boneTfs);
+  //! [update pose]
+
+  g_poseUpdateTime = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - start).count();
 }
 
 //////////////////////////////////////////////////
@@ -333,6 +342,31 @@ void updateActor()
       g_visuals.push_back(g_allVisuals[idx]);
     }
 
+    // resolve bone names to indices once, the actors share the skeleton
+    g_meshes.clear();
+    g_boneIndices.clear();
+    g_boneTfs.clear();
+    for (auto &v : g_visuals)
+    {
+      g_meshes.push_back(
+          std::dynamic_pointer_cast<ir::Mesh>(v->GeometryByIndex(0)));
+    }
+    if (!g_meshes.empty())
+    {
+      ir::MeshPtr mesh = g_meshes.front();
+      auto tfs = mesh->SkeletonLocalTransforms();
+      for (const auto &boneName : mesh->SkeletonBoneNames())
+        g_boneTfs.push_back(tfs[boneName]);
+
+      for (const auto &[animNodeName, tf] : g_skelAnim->PoseAt(0.0, true))
+      {
+        int idx = mesh->SkeletonBoneIndex(
+            g_skel->NodeNameAnimToSkin(g_animIdx, animNodeName));
+        if (idx >= 0)
+          g_boneIndices[animNodeName] = static_cast<unsigned int>(idx);
+      }
+    }
+
     // enabled selected animation
     for (auto &v : g_visuals)
     {
@@ -430,6 +464,11 @@ void displayCB()
   text << std::setw(30) << "Manual skeleton update: " << manual;
   text << std::setw(30) << "Root bone weight:: " << std::setprecision(2)
        << g_rootBoneWeight;
+  if (g_manualBoneUpdate)
+  {
+    text << std::setw(20) << "Pose update: " << std::setprecision(3)
+         << g_poseUpdateTime << " ms";
+  }
   drawText(10, 10, text.str());
 
   glutSwapBuffers();
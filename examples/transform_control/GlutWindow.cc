@@ -264,7 +264,10 @@ void handleMouse()
     double ny = 1.0 -
         2.0 * g_mouse.y / static_cast<double>(rayCamera->ImageHeight());
     g_rayQuery->SetFromCamera(rayCamera, ignition::math::Vector2d(nx, ny));
-    g_target  = g_rayQuery->ClosestPoint();
+
+    // single selection buffer render instead of testing mesh triangles
+    g_target = rayCamera->PickAt(
+        ignition::math::Vector2i(g_mouse.x, g_mouse.y));
     if (!g_target)
     {
       // set point to be 10m away if no intersection found
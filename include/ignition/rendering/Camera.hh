@@ -17,14 +17,19 @@
 #ifndef IGNITION_RENDERING_CAMERA_HH_
 #define IGNITION_RENDERING_CAMERA_HH_
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include <ignition/common/Event.hh>
 #include <ignition/math/Matrix4.hh>
+#include <ignition/math/Vector2.hh>
 
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Image.hh"
 #include "ignition/rendering/PixelFormat.hh"
+#include "ignition/rendering/RayQueryResult.hh"
+#include "ignition/rendering/RenderStats.hh"
 #include "ignition/rendering/Sensor.hh"
 #include "ignition/rendering/Scene.hh"
 
@@ -74,7 +79,7 @@ namespace ignition
 
       /// \brief Get the total image memory size in bytes
       /// \return The image memory size in bytes
-      public: virtual unsigned int ImageMemorySize() const = 0;
+      public: virtual std::size_t ImageMemorySize() const = 0;
 
       /// \brief Get the camera's horizontal field-of-view
       /// \return Angle containing the camera's horizontal field-of-view
@@ -140,6 +145,53 @@ namespace ignition
       public: virtual VisualPtr VisualAt(const ignition::math::Vector2i
                   &_mousePos) = 0;
 
+      /// \brief Get the visuals in a rectangle of the image. The ids of all
+      /// visuals are rendered once over the full view of the camera into an
+      /// id buffer, which is reused by later calls until the camera moves,
+      /// its image size or the buffer scale changes, or the scene is
+      /// rendered again.
+      /// \param[in] _start A corner of the rectangle in pixels
+      /// \param[in] _end The opposite corner in pixels, inclusive
+      /// \return Ids of the visuals found, mapped to the number of pixels of
+      /// the id buffer they cover
+      /// \sa SetSelectionBufferScale
+      public: virtual std::map<unsigned int, unsigned int> VisualsInRect(
+                  const ignition::math::Vector2i &_start,
+                  const ignition::math::Vector2i &_end) = 0;
+
+      /// \brief Get the visuals at several image positions, e.g. all the
+      /// pointers hovering the image. Uses the same id buffer as
+      /// VisualsInRect.
+      /// \param[in] _points Positions in pixels
+      /// \return Ids of the visuals found, mapped to the number of positions
+      /// they cover
+      public: virtual std::map<unsigned int, unsigned int> VisualsAt(
+                  const std::vector<ignition::math::Vector2i> &_points) = 0;
+
+      /// \brief Set the resolution of the id buffer used by VisualsInRect
+      /// and VisualsAt relative to the image size. Lower values render and
+      /// read back faster but may miss small visuals.
+      /// \param[in] _scale Scale in (0, 1], 1 by default
+      public: virtual void SetSelectionBufferScale(double _scale) = 0;
+
+      /// \brief Get the resolution of the id buffer relative to the image
+      /// size
+      /// \return Scale of the id buffer
+      public: virtual double SelectionBufferScale() const = 0;
+
+      /// \brief Get the closest surface at an image position in a single
+      /// render of the selection buffer, which writes the visual id along
+      /// with the distance and normal of the surface. Replaces a VisualAt
+      /// followed by a RayQuery::ClosestPoint, which tests the triangles of
+      /// meshes on the CPU. Render engines without a GPU pick fall back to
+      /// a RayQuery.
+      /// \param[in] _pos Image position in pixels
+      /// \return Id of the visual hit, distance from the camera, and the
+      /// point and surface normal in world frame. Evaluates to false if
+      /// nothing was hit.
+      public: virtual RayQueryResult PickAt(
+                  const ignition::math::Vector2i &_pos) = 0;
+
       /// \brief Renders a new frame.
       /// This is a convenience function for single-camera scenes. It wraps the
       /// pre-render, render, and post-render into a single
@@ -173,9 +225,44 @@ namespace ignition
       /// can be called multiple times after PostRender has been called,
       /// without rendering the scene again. Calling this function before a
       /// single image has been rendered will have undefined behavior.
+      /// The frame is encoded and written on a worker thread of
+      /// FrameSaver::Default, the extension of the file name selects the
+      /// format (png, jpg, pfm or raw).
       /// \param[in] _name Name of the output file
+      /// \return True if the frame was queued for writing, false if it was
+      /// dropped because frames are saved slower than they are rendered
+      /// \sa FrameSaver
       public: virtual bool SaveFrame(const std::string &_name) = 0;
 
+      /// \brief Enable or disable saving every rendered frame. Frames are
+      /// written to the directory set by SetSaveFramePath, named after the
+      /// camera and numbered in render order. Color frames are saved as png,
+      /// float frames such as depth images as pfm.
+      /// \param[in] _enable True to save every frame
+      /// \sa SetSaveFramePath
+      public: virtual void EnableSaveFrame(const bool _enable) = 0;
+
+      /// \brief Get whether every rendered frame is saved
+      /// \return True if frames are saved
+      public: virtual bool SaveFrameEnabled() const = 0;
+
+      /// \brief Set the directory rendered frames are saved to when saving
+      /// is enabled. The directory is created if it does not exist.
+      /// \param[in] _path Output directory
+      /// \sa EnableSaveFrame
+      public: virtual void SetSaveFramePath(const std::string &_path) = 0;
+
+      /// \brief Get the directory rendered frames are saved to
+      /// \return Output directory
+      public: virtual std::string SaveFramePath() const = 0;
+
+      /// \brief Get statistics of the last frame rendered by this camera,
+      /// such as the number of draw calls and the time the CPU and GPU spent
+      /// on it. Fields the render engine does not report keep their
+      /// defaults.
+      /// \return Render statistics
+      public: virtual rendering::RenderStats RenderStats() const = 0;
+
       /// \brief Subscribes a new listener to this camera's new frame event
       /// \param[in] _listener New camera listener callback
       public: virtual common::ConnectionPtr ConnectNewImageFrame(
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CAMERAARRAY_HH_
+#define IGNITION_RENDERING_CAMERAARRAY_HH_
+
+#include <functional>
+#include <string>
+
+#include <ignition/common/Event.hh>
+#include <ignition/math/Angle.hh>
+#include <ignition/math/Pose3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/PixelFormat.hh"
+#include "ignition/rendering/Sensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class CameraArray CameraArray.hh ignition/rendering/CameraArray.hh
+    /// \brief Renders many small views of the scene into the tiles of a
+    /// single texture. All views are rendered by one render call and read
+    /// back with one copy, which removes the per camera overhead of
+    /// workloads that run tens to hundreds of low resolution cameras, such
+    /// as reinforcement learning.
+    ///
+    /// All views share the image size, field of view and clip planes. The
+    /// pose of each view is relative to the camera array. Views are laid
+    /// out row by row, ColumnCount views per row.
+    class IGNITION_RENDERING_VISIBLE CameraArray :
+      public virtual Sensor
+    {
+      /// \brief Callback function for new view frames
+      /// \param[in] _data Pointer to the first pixel of the view
+      /// \param[in] _view Index of the view
+      /// \param[in] _width Width of the view in pixels
+      /// \param[in] _height Height of the view in pixels
+      /// \param[in] _stride Number of bytes between the start of two rows
+      /// \param[in] _format Pixel format of the view
+      public: typedef std::function<void(const unsigned char *_data,
+                  unsigned int _view, unsigned int _width,
+                  unsigned int _height, unsigned int _stride,
+                  PixelFormat _format)> NewViewFrameListener;
+
+      /// \brief Destructor
+      public: virtual ~CameraArray() { }
+
+      /// \brief Set the number of views
+      /// \param[in] _count Number of views
+      public: virtual void SetViewCount(unsigned int _count) = 0;
+
+      /// \brief Get the number of views
+      /// \return Number of views
+      public: virtual unsigned int ViewCount() const = 0;
+
+      /// \brief Set the pose of a view relative to the camera array. Views
+      /// look along their +X axis with +Z up.
+      /// \param[in] _index Index of the view
+      /// \param[in] _pose Pose of the view
+      public: virtual void SetViewPose(unsigned int _index,
+                  const math::Pose3d &_pose) = 0;
+
+      /// \brief Get the pose of a view relative to the camera array
+      /// \param[in] _index Index of the view
+      /// \return Pose of the view, identity if the index is invalid
+      public: virtual math::Pose3d ViewPose(unsigned int _index) const = 0;
+
+      /// \brief Set the width of each view
+      /// \param[in] _width Width in pixels
+      public: virtual void SetImageWidth(unsigned int _width) = 0;
+
+      /// \brief Get the width of each view
+      /// \return Width in pixels
+      public: virtual unsigned int ImageWidth() const = 0;
+
+      /// \brief Set the height of each view
+      /// \param[in] _height Height in pixels
+      public: virtual void SetImageHeight(unsigned int _height) = 0;
+
+      /// \brief Get the height of each view
+      /// \return Height in pixels
+      public: virtual unsigned int ImageHeight() const = 0;
+
+      /// \brief Get the pixel format of the views
+      /// \return Pixel format, PF_R8G8B8
+      public: virtual PixelFormat ImageFormat() const = 0;
+
+      /// \brief Set the horizontal field of view of each view
+      /// \param[in] _hfov Horizontal field of view
+      public: virtual void SetHFOV(const math::Angle &_hfov) = 0;
+
+      /// \brief Get the horizontal field of view of each view
+      /// \return Horizontal field of view
+      public: virtual math::Angle HFOV() const = 0;
+
+      /// \brief Set the near clip distance of the views
+      /// \param[in] _near Near clip distance
+      public: virtual void SetNearClipPlane(double _near) = 0;
+
+      /// \brief Get the near clip distance of the views
+      /// \return Near clip distance
+      public: virtual double NearClipPlane() const = 0;
+
+      /// \brief Set the far clip distance of the views
+      /// \param[in] _far Far clip distance
+      public: virtual void SetFarClipPlane(double _far) = 0;
+
+      /// \brief Get the far clip distance of the views
+      /// \return Far clip distance
+      public: virtual double FarClipPlane() const = 0;
+
+      /// \brief Get the number of views per row of the atlas
+      /// \return Number of columns
+      public: virtual unsigned int ColumnCount() const = 0;
+
+      /// \brief Get the number of rows of the atlas
+      /// \return Number of rows
+      public: virtual unsigned int RowCount() const = 0;
+
+      /// \brief Render all views and read them back. Calls Scene::PreRender
+      /// first.
+      public: virtual void Update() = 0;
+
+      /// \brief Render all views. This assumes PreRender() has already
+      /// been called on the parent Scene.
+      public: virtual void Render() = 0;
+
+      /// \brief Get the atlas holding all views from the last update. The
+      /// atlas is ColumnCount * ImageWidth pixels wide and RowCount *
+      /// ImageHeight pixels high.
+      /// \return Atlas data, null before the first update
+      public: virtual const unsigned char *Data() const = 0;
+
+      /// \brief Subscribes a new listener to the views of new frames. The
+      /// listener is called once per view after each update, with a pointer
+      /// into the atlas.
+      /// \param[in] _listener New view frame listener
+      /// \return Connection that must be kept in scope
+      public: virtual common::ConnectionPtr ConnectNewImageFrame(
+                  NewViewFrameListener _listener) = 0;
+    };
+    }
+  }
+}
+#endif
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_CPUNOISEPASS_HH_
+#define IGNITION_RENDERING_CPUNOISEPASS_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <ignition/common/SuppressWarning.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/NoiseGenerator.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      // forward declaration
+      class CpuNoisePassPrivate;
+
+      /// \brief Adds noise to sensor data on the cpu, for data that does not
+      /// go through a render pass such as gpu rays, thermal and depth frames.
+      /// The noise of element i of a frame is
+      ///   bias + gaussian(mean, stddev) + uniform(-amplitude, amplitude)
+      /// and the result is then rounded to a multiple of the quantization
+      /// step and clamped. Non finite values are left unchanged.
+      ///
+      /// Noise comes from a NoiseGenerator, so the output only depends on the
+      /// seed, the frame and the element index, and not on the number of
+      /// threads the buffer is processed with.
+      ///
+      /// The pass is attached to a sensor by wrapping the callback given to
+      /// its frame event, e.g.
+      ///   gpuRays->ConnectNewGpuRaysFrame(pass.WrapFloatFrame(callback));
+      /// The wrapped callback receives a noisy copy of the frame. The pass
+      /// must outlive the connection.
+      class IGNITION_RENDERING_VISIBLE CpuNoisePass
+      {
+        /// \brief Callback of float frame events, e.g. gpu rays and depth
+        /// frames
+        public: typedef std::function<void(const float *, unsigned int,
+            unsigned int, unsigned int, const std::string &)>
+            FloatFrameCallback;
+
+        /// \brief Callback of 16 bit frame events, e.g. thermal frames
+        public: typedef std::function<void(const uint16_t *, unsigned int,
+            unsigned int, unsigned int, const std::string &)>
+            U16FrameCallback;
+
+        /// \brief Constructor
+        /// \param[in] _seed Seed of the noise
+        public: explicit CpuNoisePass(uint64_t _seed = 0u);
+
+        /// \brief Destructor
+        public: ~CpuNoisePass();
+
+        /// \brief Get the noise generator
+        /// \return Generator of the pass
+        public: const NoiseGenerator &Generator() const;
+
+        /// \brief Set the seed of the noise
+        /// \param[in] _seed New seed
+        public: void SetSeed(uint64_t _seed);
+
+        /// \brief Get the mean of the Gaussian noise
+        /// \return Mean of the Gaussian noise
+        public: double Mean() const;
+
+        /// \brief Set the mean of the Gaussian noise
+        /// \param[in] _mean Mean of the Gaussian noise
+        public: void SetMean(double _mean);
+
+        /// \brief Get the standard deviation of the Gaussian noise
+        /// \return Standard deviation of the Gaussian noise
+        public: double StdDev() const;
+
+        /// \brief Set the standard deviation of the Gaussian noise
+        /// \param[in] _stdDev Standard deviation, zero disables the Gaussian
+        /// noise
+        public: void SetStdDev(double _stdDev);
+
+        /// \brief Get the bias added to all values. As in GaussianNoisePass
+        /// it is drawn from the bias mean and standard deviation and its sign
+        /// is then picked at random, using the seed of the pass.
+        /// \return Bias on output
+        public: double Bias() const;
+
+        /// \brief Set the mean of the bias value
+        /// \param[in] _biasMean Mean of the bias
+        /// \sa SetBiasStdDev
+        public: void SetBiasMean(double _biasMean);
+
+        /// \brief Set the standard deviation of the bias value
+        /// \param[in] _biasStdDev Standard deviation of the bias
+        /// \sa SetBiasMean
+        public: void SetBiasStdDev(double _biasStdDev);
+
+        /// \brief Get the amplitude of the uniform noise
+        /// \return Amplitude of the uniform noise
+        public: double UniformAmplitude() const;
+
+        /// \brief Set the amplitude of the uniform noise, which is drawn from
+        /// [-amplitude, amplitude)
+        /// \param[in] _amplitude Amplitude, zero disables the uniform noise
+        public: void SetUniformAmplitude(double _amplitude);
+
+        /// \brief Get the quantization step
+        /// \return Quantization step
+        public: double Quantization() const;
+
+        /// \brief Set the quantization step. Noisy values are rounded to the
+        /// nearest multiple of the step.
+        /// \param[in] _step Quantization step, zero disables quantization
+        public: void SetQuantization(double _step);
+
+        /// \brief Set the range noisy values are clamped to. Integer buffers
+        /// are always clamped to the range of their type as well.
+        /// \param[in] _min Minimum value
+        /// \param[in] _max Maximum value
+        public: void SetClamp(double _min, double _max);
+
+        /// \brief Get the minimum value of the clamp range
+        /// \return Minimum value, -inf by default
+        public: double ClampMin() const;
+
+        /// \brief Get the maximum value of the clamp range
+        /// \return Maximum value, +inf by default
+        public: double ClampMax() const;
+
+        /// \brief Set the channel noise is added to, e.g. 0 to only add noise
+        /// to the range of gpu rays readings and not to their retro value
+        /// \param[in] _channel Channel index, -1 for all channels
+        public: void SetChannel(int _channel);
+
+        /// \brief Get the channel noise is added to
+        /// \return Channel index, -1 for all channels
+        public: int Channel() const;
+
+        /// \brief Set the number of threads a buffer is processed with. The
+        /// result does not depend on it.
+        /// \param[in] _count Number of threads, 0 to use one per hardware
+        /// thread
+        public: void SetThreadCount(unsigned int _count);
+
+        /// \brief Get the number of threads a buffer is processed with
+        /// \return Number of threads, 0 for one per hardware thread
+        public: unsigned int ThreadCount() const;
+
+        /// \brief Add noise to a float buffer in place
+        /// \param[in,out] _data Buffer of _count elements of _channels values
+        /// \param[in] _count Number of elements, e.g. width * height
+        /// \param[in] _channels Number of values per element
+        /// \param[in] _frame Frame number the noise is drawn for
+        public: void Apply(float *_data, std::size_t _count,
+                    unsigned int _channels, uint64_t _frame) const;
+
+        /// \brief Add noise to a 16 bit buffer in place
+        /// \param[in,out] _data Buffer of _count elements of _channels values
+        /// \param[in] _count Number of elements, e.g. width * height
+        /// \param[in] _channels Number of values per element
+        /// \param[in] _frame Frame number the noise is drawn for
+        public: void Apply(uint16_t *_data, std::size_t _count,
+                    unsigned int _channels, uint64_t _frame) const;
+
+        /// \brief Add noise to an 8 bit buffer in place
+        /// \param[in,out] _data Buffer of _count elements of _channels values
+        /// \param[in] _count Number of elements, e.g. width * height
+        /// \param[in] _channels Number of values per element
+        /// \param[in] _frame Frame number the noise is drawn for
+        public: void Apply(uint8_t *_data, std::size_t _count,
+                    unsigned int _channels, uint64_t _frame) const;
+
+        /// \brief Wrap the callback of a float frame event so that it gets
+        /// noisy frames. Frames are numbered from 0 in the order the wrapped
+        /// callback is called.
+        /// \param[in] _callback Callback to wrap
+        /// \return Callback to connect to the event
+        public: FloatFrameCallback WrapFloatFrame(
+                    FloatFrameCallback _callback);
+
+        /// \brief Wrap the callback of a 16 bit frame event so that it gets
+        /// noisy frames. Frames are numbered from 0 in the order the wrapped
+        /// callback is called.
+        /// \param[in] _callback Callback to wrap
+        /// \return Callback to connect to the event
+        public: U16FrameCallback WrapU16Frame(U16FrameCallback _callback);
+
+        IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Private data
+        private: std::unique_ptr<CpuNoisePassPrivate> dataPtr;
+        IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
+    }
+  }
+}
+#endif
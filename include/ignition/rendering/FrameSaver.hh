@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_FRAMESAVER_HH_
+#define IGNITION_RENDERING_FRAMESAVER_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <ignition/common/SuppressWarning.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/Image.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      // forward declaration
+      class FrameSaverPrivate;
+
+      /// \brief Writes images to files on a pool of worker threads so that
+      /// encoding does not stall rendering. Frames wait in a bounded queue.
+      /// When the queue is full Save blocks for at most MaxWait for room and
+      /// then drops the frame, which is counted in DroppedCount.
+      ///
+      /// The file format is chosen from the extension of the file name:
+      /// - .png: 8 bit grayscale, bayer, RGB and BGR images and 16 bit
+      ///   grayscale images
+      /// - .jpg, .jpeg: 8 bit grayscale, bayer, RGB and BGR images
+      /// - .pfm: 32 bit float images, e.g. depth images
+      /// - .raw: the pixels as they are in memory, rows tightly packed
+      class IGNITION_RENDERING_VISIBLE FrameSaver
+      {
+        /// \brief Constructor
+        /// \param[in] _workerCount Number of encoder threads
+        /// \param[in] _queueSize Maximum number of frames waiting to be
+        /// encoded
+        public: explicit FrameSaver(unsigned int _workerCount = 2u,
+                    unsigned int _queueSize = 16u);
+
+        /// \brief Destructor. Writes the frames still queued and stops the
+        /// worker threads.
+        public: ~FrameSaver();
+
+        /// \brief Get the saver used by cameras
+        /// \return The default saver
+        public: static FrameSaver &Default();
+
+        /// \brief Queue an image to be written to a file. The image buffer
+        /// is shared with the queue, not copied, so it must not be written
+        /// to until the frame has been saved. Images from Camera::CreateImage
+        /// are fine to drop right after this call since their buffers are
+        /// recycled only once the saver is done with them.
+        /// \param[in] _image Image to save
+        /// \param[in] _filename Name of the output file
+        /// \return True if the frame was queued, false if the image or file
+        /// name are invalid or the frame was dropped
+        public: bool Save(const Image &_image, const std::string &_filename);
+
+        /// \brief Set how long Save waits for room in a full queue before
+        /// dropping the frame
+        /// \param[in] _wait Maximum wait, zero drops frames right away
+        public: void SetMaxWait(std::chrono::milliseconds _wait);
+
+        /// \brief Get how long Save waits for room in a full queue
+        /// \return Maximum wait
+        public: std::chrono::milliseconds MaxWait() const;
+
+        /// \brief Block until all queued frames are written
+        public: void Flush();
+
+        /// \brief Get the number of frames waiting or being encoded
+        /// \return Number of pending frames
+        public: unsigned int PendingCount() const;
+
+        /// \brief Get the number of frames written
+        /// \return Number of saved frames
+        public: uint64_t SavedCount() const;
+
+        /// \brief Get the number of frames that could not be written
+        /// \return Number of failed frames
+        public: uint64_t FailedCount() const;
+
+        /// \brief Get the number of frames dropped because the queue was full
+        /// \return Number of dropped frames
+        public: uint64_t DroppedCount() const;
+
+        /// \brief Write an image to a file on the calling thread
+        /// \param[in] _image Image to save
+        /// \param[in] _filename Name of the output file, its extension
+        /// selects the format
+        /// \return True on success
+        public: static bool Write(const Image &_image,
+                    const std::string &_filename);
+
+        IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Private data
+        private: std::unique_ptr<FrameSaverPrivate> dataPtr;
+        IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
+    }
+  }
+}
+#endif
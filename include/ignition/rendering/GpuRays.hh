@@ -32,6 +32,30 @@ namespace ignition
   {
     inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
     //
+    /// \brief Enum for the layout of the gpu rays data
+    enum IGNITION_RENDERING_VISIBLE GpuRaysDataFormat
+    {
+      /// \brief 3 floats per reading: range, retro and an unused value.
+      /// Format string: "PF_FLOAT32_RGB"
+      GRDF_RANGE_RETRO          = 0,
+
+      /// \brief 1 float per reading: range.
+      /// Format string: "PF_FLOAT32_R"
+      GRDF_RANGE                = 1,
+
+      /// \brief Range as a float and retro as an 8 bit intensity, where
+      /// 255 is a retro value of 2000. The frame holds the ranges of all
+      /// readings followed by the intensities of all readings.
+      /// Format string: "RANGE_FLOAT32_INTENSITY_U8"
+      GRDF_RANGE_INTENSITY_U8   = 2,
+
+      /// \brief 1 unsigned 16 bit integer per reading: range in
+      /// millimeters. Negative ranges are 0, ranges beyond 65.535 m and
+      /// infinite ranges are 65535.
+      /// Format string: "RANGE_U16_MM"
+      GRDF_RANGE_U16_MM         = 3
+    };
+
     /// \class GpuRays GpuRays.hh ignition/rendering/GpuRays.hh
     /// \brief Generate depth ray data.
     class IGNITION_RENDERING_VISIBLE GpuRays :
@@ -45,10 +69,13 @@ namespace ignition
       public: virtual ~GpuRays() { }
 
       /// \brief All things needed to get back z buffer for gpu rays data.
-      /// \return Array of gpu rays data.
+      /// \return Array of gpu rays data. Null if the data format does not
+      /// store floats only.
+      /// \sa SetDataFormat
       public: virtual const float *Data() const = 0;
 
       /// \brief Copy to the specified memory direction the gpu rays data.
+      /// Does nothing if the data format does not store floats only.
       public: virtual void Copy(float *_data) = 0;
 
       /// \brief Configure behaviour for data values outside of camera range
@@ -66,7 +93,8 @@ namespace ignition
       /// generated. The callback function parameters are:
       ///   _frame:   Image frame is an array of floats. Size is equal
       ///             to width * height * channels
-      ///             Each gpu rays reading occupies 3 floats
+      ///             With the default data format each gpu rays reading
+      ///             occupies 3 floats
       ///             Index 0: depth value
       ///             Index 1: retro value
       ///             Index 2: 0. Not used
@@ -74,12 +102,52 @@ namespace ignition
       ///   _height:  Height o image, i.e. number of scans in vertical direction
       ///   _channels: Number of channels, i.e. 3 floats per gpu rays reading
       ///   _format:  Pixel format of the image frame.
+      /// The callback is not called if the data format does not store floats
+      /// only, use ConnectNewGpuRaysData instead.
       /// \return A pointer to the connection. This must be kept in scope.
+      /// \sa SetDataFormat
       public: virtual common::ConnectionPtr ConnectNewGpuRaysFrame(
                   std::function<void(const float *_frame, unsigned int _width,
                   unsigned int _height, unsigned int _depth,
                   const std::string &)> _subscriber) = 0;
 
+      /// \brief Connect to a gpu rays data signal. Unlike
+      /// ConnectNewGpuRaysFrame, this is called for every data format.
+      /// \param[in] _subscriber Callback that is called when new data is
+      /// generated. The callback function parameters are:
+      ///   _data:    Frame in the layout described by DataFormat()
+      ///   _width:   Number of data in the horizonal scan
+      ///   _height:  Number of scans in vertical direction
+      ///   _channels: Number of values per gpu rays reading
+      ///   _format:  Format string of the data format
+      /// \return A pointer to the connection. This must be kept in scope.
+      /// \sa GpuRaysDataFormat
+      public: virtual common::ConnectionPtr ConnectNewGpuRaysData(
+                  NewFrameListener _subscriber) = 0;
+
+      /// \brief Set the layout of the gpu rays data. The compact formats
+      /// reduce the amount of data copied from the gpu every frame.
+      /// \param[in] _format New data format
+      /// \sa GpuRaysDataFormat
+      public: virtual void SetDataFormat(GpuRaysDataFormat _format) = 0;
+
+      /// \brief Get the layout of the gpu rays data
+      /// \return Data format, GRDF_RANGE_RETRO by default
+      public: virtual GpuRaysDataFormat DataFormat() const = 0;
+
+      /// \brief Set the scale of the resolution the scene is rendered at
+      /// before the rays sample it. At 1, the default, the resolution along
+      /// each axis matches the angular spacing of the rays. Lower values
+      /// render fewer pixels at the cost of range accuracy. Must be set
+      /// before the first update. Engines that do not support it ignore it.
+      /// \param[in] _scale Resolution scale, must be positive
+      public: virtual void SetResolutionScale(double _scale) = 0;
+
+      /// \brief Get the scale of the resolution the scene is rendered at
+      /// \return Resolution scale
+      /// \sa SetResolutionScale
+      public: virtual double ResolutionScale() const = 0;
+
       /// \brief Set sensor horizontal or vertical
       /// \param[in] _horizontal True if horizontal, false if not
       public: virtual void SetIsHorizontal(const bool _horizontal) = 0;
@@ -17,6 +17,7 @@
 #ifndef IGNITION_RENDERING_IMAGE_HH_
 #define IGNITION_RENDERING_IMAGE_HH_
 
+#include <cstddef>
 #include <memory>
 
 #include <ignition/common/SuppressWarning.hh>
@@ -32,7 +33,10 @@ namespace ignition
     inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
     //
     /// \class Image Image.hh ignition/rendering/Image.hh
-    /// \brief Encapsulates a raw image buffer and relevant properties
+    /// \brief Encapsulates a raw image buffer and relevant properties.
+    /// Copies of an image share its buffer. Buffers come from an ImagePool
+    /// and are 64 byte aligned. An image may be a view of a region of
+    /// another image, the rows of a view are Stride() bytes apart.
     class IGNITION_RENDERING_VISIBLE Image
     {
       /// \brief Shared pointer to raw image buffer
@@ -41,13 +45,23 @@ namespace ignition
       /// \brief Default constructor
       public: Image() = default;
 
-      /// \brief Constructor
+      /// \brief Constructor. The buffer is taken from the default
+      /// ImagePool.
       /// \param[in] _width Image width in pixels
       /// \param[in] _height Image height in pixels
       /// \param[in] _format Image pixel format
       public: Image(unsigned int _width, unsigned int _height,
                   PixelFormat _format);
 
+      /// \brief Constructor of an image using an existing buffer
+      /// \param[in] _width Image width in pixels
+      /// \param[in] _height Image height in pixels
+      /// \param[in] _format Image pixel format
+      /// \param[in] _data Buffer of the image
+      /// \param[in] _stride Number of bytes between the start of two rows
+      private: Image(unsigned int _width, unsigned int _height,
+                   PixelFormat _format, DataPtr _data, unsigned int _stride);
+
       /// \brief Destructor
       public: ~Image();
 
@@ -67,9 +81,27 @@ namespace ignition
       /// \return The image channel depth
       public: unsigned int Depth() const;
 
-      /// \brief Get image channel depth
-      /// \return The image channel depth
-      public: unsigned int MemorySize() const;
+      /// \brief Get the size of the image pixels in bytes, i.e. the
+      /// product of width, height and bytes per pixel. Row padding of views
+      /// is not included.
+      /// \return The image size in bytes
+      public: std::size_t MemorySize() const;
+
+      /// \brief Get the number of bytes between the start of two rows. This
+      /// is the row size of the parent image for views.
+      /// \return The row stride in bytes
+      public: unsigned int Stride() const;
+
+      /// \brief Create a view of a region of this image. The view shares
+      /// the buffer of this image, no pixels are copied.
+      /// \param[in] _x Column of the first pixel of the region
+      /// \param[in] _y Row of the first pixel of the region
+      /// \param[in] _width Width of the region in pixels
+      /// \param[in] _height Height of the region in pixels
+      /// \return View of the region or an empty image if the region is not
+      /// inside the image
+      public: Image View(unsigned int _x, unsigned int _y,
+                  unsigned int _width, unsigned int _height) const;
 
       /// \brief Get a const pointer to image data
       /// \return The const pointer to image data
@@ -100,10 +132,16 @@ namespace ignition
       /// \brief Image pixel format
       private: PixelFormat format = PF_UNKNOWN;
 
+      /// \brief Number of bytes between the start of two rows
+      private: unsigned int stride = 0;
+
       IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
       /// \brief Pointer to the image data
       private: DataPtr data = nullptr;
       IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief The pool creates images around its buffers
+      private: friend class ImagePool;
     };
 
     //////////////////////////////////////////////////
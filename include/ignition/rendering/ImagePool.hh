@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_IMAGEPOOL_HH_
+#define IGNITION_RENDERING_IMAGEPOOL_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ignition/common/SuppressWarning.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/PixelFormat.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      // forward declaration
+      class ImagePoolPrivate;
+
+      /// \brief Recycles the buffers of images. Buffers are 64 byte aligned
+      /// and grouped in size classes, with at most 25% of a buffer unused.
+      /// When the last image using a buffer is destroyed the buffer goes
+      /// back to the pool and is handed to the next image of the same size
+      /// class. Images created with the Image constructor use the default
+      /// pool, so capturing into a new image every frame does not allocate
+      /// once the pool is warm.
+      ///
+      /// The pool is thread safe. Images may outlive their pool, their
+      /// buffers are then freed instead of being recycled.
+      class IGNITION_RENDERING_VISIBLE ImagePool
+      {
+        /// \brief Alignment of the image buffers in bytes
+        public: static constexpr std::size_t kAlignment = 64u;
+
+        /// \brief Constructor
+        /// \param[in] _maxCachedSize Maximum size in bytes of the unused
+        /// buffers kept for reuse
+        public: explicit ImagePool(std::size_t _maxCachedSize = 256u << 20);
+
+        /// \brief Destructor. Frees the unused buffers.
+        public: ~ImagePool();
+
+        /// \brief Get the pool used by the Image constructor
+        /// \return The default pool
+        public: static ImagePool &Default();
+
+        /// \brief Create an image with a buffer from this pool
+        /// \param[in] _width Image width in pixels
+        /// \param[in] _height Image height in pixels
+        /// \param[in] _format Image pixel format
+        /// \return The new image
+        public: Image Acquire(unsigned int _width, unsigned int _height,
+                    PixelFormat _format);
+
+        /// \brief Set the maximum size of the unused buffers kept for reuse.
+        /// Unused buffers above the limit are freed.
+        /// \param[in] _size Size in bytes, 0 disables reuse
+        public: void SetMaxCachedSize(std::size_t _size);
+
+        /// \brief Get the maximum size of the unused buffers kept for reuse
+        /// \return Size in bytes
+        public: std::size_t MaxCachedSize() const;
+
+        /// \brief Get the size of the unused buffers currently kept
+        /// \return Size in bytes
+        public: std::size_t CachedSize() const;
+
+        /// \brief Get the number of buffers allocated by this pool since it
+        /// was created, i.e. the acquisitions that could not reuse a buffer
+        /// \return Number of allocations
+        public: uint64_t AllocationCount() const;
+
+        /// \brief Free all unused buffers
+        public: void Clear();
+
+        /// \brief Get the size class of a buffer, which is the size actually
+        /// allocated for it
+        /// \param[in] _size Requested size in bytes
+        /// \return Size class in bytes
+        public: static std::size_t SizeClass(std::size_t _size);
+
+        IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Private data. Shared with the buffers handed out so that
+        /// they can be returned as long as the pool exists.
+        private: std::shared_ptr<ImagePoolPrivate> dataPtr;
+        IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
+    }
+  }
+}
+#endif
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_INSTANCEBATCH_HH_
+#define IGNITION_RENDERING_INSTANCEBATCH_HH_
+
+#include <vector>
+
+#include <ignition/math/Color.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+#include <ignition/math/Vector4.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Object.hh"
+#include "ignition/rendering/RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class InstanceBatch InstanceBatch.hh
+    /// ignition/rendering/InstanceBatch.hh
+    /// \brief A fixed number of instances of the same mesh and material.
+    /// Instances are not part of the scene graph, their poses are expressed
+    /// in the world frame and can be updated in bulk. This is much cheaper
+    /// than creating one visual per object for large numbers of repeated
+    /// objects such as trees, boxes on shelves or debris.
+    ///
+    /// The ogre engine draws each sub-mesh of a batch with a single draw
+    /// call, instance colours are instance data. The ogre2 engine draws the
+    /// instances sharing a colour with a shared material, so every distinct
+    /// instance colour adds a draw call.
+    class IGNITION_RENDERING_VISIBLE InstanceBatch :
+      public virtual Object
+    {
+      /// \brief Destructor
+      public: virtual ~InstanceBatch() { }
+
+      /// \brief Get the number of instances
+      /// \return Number of instances
+      public: virtual unsigned int InstanceCount() const = 0;
+
+      /// \brief Get the material shared by the instances
+      /// \return Batch material, null if the mesh materials are used
+      public: virtual MaterialPtr Material() const = 0;
+
+      /// \brief Set the world pose of an instance
+      /// \param[in] _index Instance index
+      /// \param[in] _pose World pose
+      public: virtual void SetInstancePose(unsigned int _index,
+                  const math::Pose3d &_pose) = 0;
+
+      /// \brief Get the world pose of an instance
+      /// \param[in] _index Instance index
+      /// \return World pose
+      public: virtual math::Pose3d InstancePose(unsigned int _index)
+                  const = 0;
+
+      /// \brief Set the world poses of all instances
+      /// \param[in] _poses World poses, one per instance. If there are
+      /// fewer poses than instances only the first instances are updated.
+      public: virtual void SetInstancePoses(
+                  const std::vector<math::Pose3d> &_poses) = 0;
+
+      /// \brief Set the scale of an instance
+      /// \param[in] _index Instance index
+      /// \param[in] _scale Scale
+      public: virtual void SetInstanceScale(unsigned int _index,
+                  const math::Vector3d &_scale) = 0;
+
+      /// \brief Get the scale of an instance
+      /// \param[in] _index Instance index
+      /// \return Scale
+      public: virtual math::Vector3d InstanceScale(unsigned int _index)
+                  const = 0;
+
+      /// \brief Set the scales of all instances
+      /// \param[in] _scales Scales, one per instance
+      public: virtual void SetInstanceScales(
+                  const std::vector<math::Vector3d> &_scales) = 0;
+
+      /// \brief Set the diffuse colour of an instance. Instances use the
+      /// diffuse colour of the batch material by default.
+      /// \param[in] _index Instance index
+      /// \param[in] _color Diffuse colour
+      public: virtual void SetInstanceColor(unsigned int _index,
+                  const math::Color &_color) = 0;
+
+      /// \brief Get the diffuse colour of an instance
+      /// \param[in] _index Instance index
+      /// \return Diffuse colour
+      public: virtual math::Color InstanceColor(unsigned int _index)
+                  const = 0;
+
+      /// \brief Set the diffuse colours of all instances
+      /// \param[in] _colors Diffuse colours, one per instance
+      public: virtual void SetInstanceColors(
+                  const std::vector<math::Color> &_colors) = 0;
+
+      /// \brief Set a custom shader parameter of an instance. The parameter
+      /// is passed to the renderables of the instance and can be read by
+      /// custom shaders, the built-in materials ignore it.
+      /// \param[in] _index Instance index
+      /// \param[in] _param Custom parameter
+      public: virtual void SetInstanceCustomParameter(unsigned int _index,
+                  const math::Vector4d &_param) = 0;
+
+      /// \brief Get the custom shader parameter of an instance
+      /// \param[in] _index Instance index
+      /// \return Custom parameter
+      public: virtual math::Vector4d InstanceCustomParameter(
+                  unsigned int _index) const = 0;
+
+      /// \brief Set the custom shader parameters of all instances
+      /// \param[in] _params Custom parameters, one per instance
+      public: virtual void SetInstanceCustomParameters(
+                  const std::vector<math::Vector4d> &_params) = 0;
+
+      /// \brief Set the visibility of an instance
+      /// \param[in] _index Instance index
+      /// \param[in] _visible True to show the instance
+      public: virtual void SetInstanceVisible(unsigned int _index,
+                  bool _visible) = 0;
+
+      /// \brief Get the visibility of an instance
+      /// \param[in] _index Instance index
+      /// \return True if the instance is visible
+      public: virtual bool InstanceVisible(unsigned int _index) const = 0;
+    };
+    }
+  }
+}
+#endif
@@ -20,6 +20,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <ignition/math/Matrix4.hh>
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Geometry.hh"
@@ -94,6 +95,32 @@ namespace ignition
       public: virtual void UpdateSkeletonAnimation(
           std::chrono::steady_clock::duration _time) = 0;
 
+      /// \brief Get the number of bones in the skeleton
+      /// \return Number of skeleton bones, 0 if the mesh has no skeleton
+      public: virtual unsigned int SkeletonBoneCount() const = 0;
+
+      /// \brief Get the names of the skeleton bones ordered by bone index.
+      /// The order is defined by the render engine, use this function or
+      /// SkeletonBoneIndex to resolve bone names to indices once and then
+      /// update the pose with SetSkeletonBoneTransforms.
+      /// \return Bone names ordered by bone index
+      public: virtual std::vector<std::string> SkeletonBoneNames() const = 0;
+
+      /// \brief Get the index of a skeleton bone
+      /// \param[in] _name Name of the bone
+      /// \return Index of the bone or -1 if the bone does not exist
+      public: virtual int SkeletonBoneIndex(const std::string &_name)
+            const = 0;
+
+      /// \brief Set local transforms of the skeleton bones by bone index.
+      /// This avoids the per bone name lookups of SetSkeletonLocalTransforms
+      /// and should be preferred when animating many meshes every frame.
+      /// \param[in] _tfs Local transformations of the skeleton bones ordered
+      /// by bone index. If there are fewer transforms than bones only the
+      /// first bones are updated.
+      public: virtual void SetSkeletonBoneTransforms(
+            const std::vector<math::Matrix4d> &_tfs) = 0;
+
       /// \brief Get the sub-mesh count
       /// \return The sub-mesh count
       public: virtual unsigned int SubMeshCount() const = 0;
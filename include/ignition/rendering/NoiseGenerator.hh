@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_NOISEGENERATOR_HH_
+#define IGNITION_RENDERING_NOISEGENERATOR_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <ignition/common/SuppressWarning.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      // forward declaration
+      class NoiseGeneratorPrivate;
+
+      /// \brief Counter-based random number generator for sensor noise
+      /// computed on the cpu. Values are produced by the Philox4x32-10
+      /// generator keyed by the seed, with the frame and the element index
+      /// as the counter. Element i of a frame therefore always gets the same
+      /// value for a given seed, however a buffer is split between threads.
+      ///
+      /// Each counter gives four 32 bit words, so elements are generated in
+      /// blocks of four and a block is computed for several counters at a
+      /// time to let the compiler vectorize the rounds.
+      class IGNITION_RENDERING_VISIBLE NoiseGenerator
+      {
+        /// \brief Constructor
+        /// \param[in] _seed Seed of the generator
+        public: explicit NoiseGenerator(uint64_t _seed = 0u);
+
+        /// \brief Copy constructor
+        /// \param[in] _other Generator to copy
+        public: NoiseGenerator(const NoiseGenerator &_other);
+
+        /// \brief Destructor
+        public: ~NoiseGenerator();
+
+        /// \brief Assignment operator
+        /// \param[in] _other Generator to copy
+        /// \return Reference to this generator
+        public: NoiseGenerator &operator=(const NoiseGenerator &_other);
+
+        /// \brief Get the seed
+        /// \return Seed of the generator
+        public: uint64_t Seed() const;
+
+        /// \brief Set the seed
+        /// \param[in] _seed Seed of the generator
+        public: void SetSeed(uint64_t _seed);
+
+        /// \brief Generate uniform values in [0, 1)
+        /// \param[in] _frame Frame the values are generated for
+        /// \param[in] _index Index of the first element
+        /// \param[out] _out Generated values
+        /// \param[in] _count Number of values to generate
+        public: void Uniform(uint64_t _frame, uint64_t _index, float *_out,
+                    std::size_t _count) const;
+
+        /// \brief Generate normally distributed values using the Box-Muller
+        /// transform
+        /// \param[in] _frame Frame the values are generated for
+        /// \param[in] _index Index of the first element
+        /// \param[out] _out Generated values
+        /// \param[in] _count Number of values to generate
+        /// \param[in] _mean Mean of the distribution
+        /// \param[in] _stdDev Standard deviation of the distribution
+        public: void Gaussian(uint64_t _frame, uint64_t _index, float *_out,
+                    std::size_t _count, float _mean = 0.0f,
+                    float _stdDev = 1.0f) const;
+
+        /// \brief Compute one Philox4x32-10 block
+        /// \param[in] _counter Counter, four words
+        /// \param[in] _key Key, two words
+        /// \param[out] _out Random words, four words
+        public: static void Philox(const uint32_t _counter[4],
+                    const uint32_t _key[2], uint32_t _out[4]);
+
+        IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Private data
+        private: std::unique_ptr<NoiseGeneratorPrivate> dataPtr;
+        IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
+    }
+  }
+}
+#endif
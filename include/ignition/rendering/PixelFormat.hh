@@ -17,6 +17,7 @@
 #ifndef IGNITION_RENDERING_PIXELFORMAT_HH_
 #define IGNITION_RENDERING_PIXELFORMAT_HH_
 
+#include <cstddef>
 #include <string>
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Export.hh"
@@ -104,8 +105,8 @@ namespace ignition
       /// \param[in] _format Image pixel format
       /// \param[in] _width Image width in pixels
       /// \param[in] _height Image height in pixels
-      /// \return The number of bytes per pixel
-      public: static unsigned int MemorySize(PixelFormat _format,
+      /// \return The image size in bytes
+      public: static std::size_t MemorySize(PixelFormat _format,
                   unsigned int _width, unsigned int _height);
 
       /// \brief Get enum value by human-readable name. The given string should
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_RANGENOISEPASS_HH_
+#define IGNITION_RENDERING_RANGENOISEPASS_HH_
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+#include "ignition/rendering/GaussianNoisePass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class RangeNoisePass RangeNoisePass.hh \
+     * ignition/rendering/RangeNoisePass.hh
+     */
+    /// \brief A Gaussian noise render pass for range sensors such as gpu
+    /// rays. After the noise is added, ranges are quantized and rays are
+    /// dropped at random, dropped rays read as out of range.
+    class IGNITION_RENDERING_VISIBLE RangeNoisePass
+      : public virtual GaussianNoisePass
+    {
+      /// \brief Constructor
+      public: RangeNoisePass();
+
+      /// \brief Destructor
+      public: virtual ~RangeNoisePass();
+
+      /// \brief Accessor for the quantization step.
+      /// \return Range quantization step, 0 if ranges are not quantized.
+      public: virtual double Quantization() const = 0;
+
+      /// \brief Set the quantization step. Noisy ranges are rounded to the
+      /// nearest multiple of the step.
+      /// \param[in] _step Range quantization step, 0 to disable it.
+      public: virtual void SetQuantization(double _step) = 0;
+
+      /// \brief Accessor for the dropout probability.
+      /// \return Probability that a ray is dropped.
+      public: virtual double DropoutProbability() const = 0;
+
+      /// \brief Set the probability that a ray is dropped.
+      /// \param[in] _probability Dropout probability in [0, 1].
+      public: virtual void SetDropoutProbability(double _probability) = 0;
+    };
+    }
+  }
+}
+#endif
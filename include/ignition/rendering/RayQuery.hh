@@ -22,6 +22,7 @@
 
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/RayQueryResult.hh"
 #include "ignition/rendering/Scene.hh"
 #include "ignition/rendering/Visual.hh"
 
@@ -31,27 +32,6 @@ namespace ignition
   {
     inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
     //
-    /// \brief A class that stores ray query intersection results.
-    class IGNITION_RENDERING_VISIBLE RayQueryResult
-    {
-      /// \brief Intersection distance
-      public: double distance = -1;
-
-      /// \brief Intersection point in 3d space
-      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
-      public: math::Vector3d point;
-      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
-
-      /// \brief Intersected object id
-      public: unsigned int objectId = 0;
-
-      /// \brief Returns false if result is not valid
-      public: operator bool()
-              {
-                return distance > 0;
-              }
-    };
-
     /// \class RayQuery RayQuery.hh ignition/rendering/RayQuery.hh
     /// \brief A Ray Query class used for computing ray object intersections
     class IGNITION_RENDERING_VISIBLE RayQuery
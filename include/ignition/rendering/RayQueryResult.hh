@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_RAYQUERYRESULT_HH_
+#define IGNITION_RENDERING_RAYQUERYRESULT_HH_
+
+#include <ignition/common/SuppressWarning.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief A class that stores ray query intersection results.
+    class IGNITION_RENDERING_VISIBLE RayQueryResult
+    {
+      /// \brief Intersection distance
+      public: double distance = -1;
+
+      /// \brief Intersection point in 3d space
+      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: math::Vector3d point;
+      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Intersected object id
+      public: unsigned int objectId = 0;
+
+      /// \brief Surface normal at the intersection point in 3d space,
+      /// facing the ray origin. Zero if the query does not compute it.
+      IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+      public: math::Vector3d normal;
+      IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+
+      /// \brief Returns false if result is not valid
+      public: operator bool()
+              {
+                return distance > 0;
+              }
+    };
+    }
+  }
+}
+#endif
@@ -19,7 +19,9 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include "ignition/rendering/config.hh"
+#include "ignition/rendering/RenderStats.hh"
 #include "ignition/rendering/RenderTypes.hh"
 #include "ignition/rendering/Export.hh"
 
@@ -163,12 +165,29 @@ namespace ignition
       public: virtual ScenePtr CreateScene(unsigned int _id,
                   const std::string &_name) = 0;
 
+      /// \brief Update all sensors of the given scenes. The scenes are
+      /// prepared for rendering first, then all their sensors are rendered
+      /// and finally their results are published. Render engines that
+      /// support it submit the work of all sensors in a single frame instead
+      /// of one frame per sensor, which is much cheaper for many small
+      /// scenes, e.g. parallel training environments.
+      /// \param[in] _scenes Scenes to render. The scenes must have been
+      /// created by this render engine.
+      public: virtual void RenderScenes(const std::vector<ScenePtr> &_scenes)
+                  = 0;
+
       /// \brief Add path to media resource location
       /// \param[in] _paths Absolute path to resource location
       public: virtual void AddResourcePath(const std::string &_path) = 0;
 
       /// \brief Get the render pass system for this engine.
       public: virtual RenderPassSystemPtr RenderPassSystem() const = 0;
+
+      /// \brief Get the GPU resources loaded by this engine, for all of its
+      /// scenes. Fields the render engine does not report are 0.
+      /// \return Resource statistics
+      public: virtual rendering::EngineResourceStats ResourceStats() const
+                  = 0;
     };
     }
   }
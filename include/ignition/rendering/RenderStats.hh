@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_RENDERSTATS_HH_
+#define IGNITION_RENDERING_RENDERSTATS_HH_
+
+#include <cstdint>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Statistics of the last frame rendered by a camera
+    /// \sa Camera::RenderStats
+    class IGNITION_RENDERING_VISIBLE RenderStats
+    {
+      /// \brief Number of draw calls, also known as batches
+      public: unsigned int drawCalls = 0u;
+
+      /// \brief Number of triangles drawn
+      public: uint64_t triangles = 0u;
+
+      /// \brief Number of compositor passes executed, 0 if the render
+      /// engine does not report it
+      public: unsigned int passCount = 0u;
+
+      /// \brief Time spent by the CPU in Camera::Render, in seconds
+      public: double cpuTime = 0.0;
+
+      /// \brief Time spent by the GPU on the frame, in seconds. Measured
+      /// with timer queries and read back without stalling, so it lags a
+      /// frame or two behind. Negative if not available.
+      public: double gpuTime = -1.0;
+    };
+
+    /// \brief Resources used by a scene
+    /// \sa Scene::ResourceStats
+    class IGNITION_RENDERING_VISIBLE ResourceStats
+    {
+      /// \brief Number of renderable objects in the scene
+      public: unsigned int objectCount = 0u;
+
+      /// \brief Number of compositor workspaces rendering the scene
+      public: unsigned int workspaceCount = 0u;
+
+      /// \brief Number of meshes shared by the procedurally generated
+      /// geometries of the scene, e.g. capsules and wire boxes. Geometries
+      /// with the same parameters use the same mesh.
+      public: unsigned int sharedMeshCount = 0u;
+    };
+
+    /// \brief GPU resources loaded by a render engine. They are shared by
+    /// all scenes of the render engine.
+    /// \sa RenderEngine::ResourceStats
+    class IGNITION_RENDERING_VISIBLE EngineResourceStats
+    {
+      /// \brief Number of materials loaded by the render engine
+      public: unsigned int materialCount = 0u;
+
+      /// \brief Number of textures loaded by the render engine
+      public: unsigned int textureCount = 0u;
+
+      /// \brief Memory used by the textures, in bytes
+      public: uint64_t textureBytes = 0u;
+
+      /// \brief Memory used by vertex and index buffers, in bytes
+      public: uint64_t bufferBytes = 0u;
+
+      /// \brief Memory reserved for vertex and index buffers, in bytes.
+      /// Engines that allocate buffers in large pools reserve more than
+      /// they use.
+      public: uint64_t bufferCapacityBytes = 0u;
+    };
+    }
+  }
+}
+#endif
@@ -49,6 +49,7 @@ namespace ignition
     class ArrowVisual;
     class AxisVisual;
     class Camera;
+    class CameraArray;
     class Capsule;
     class DepthCamera;
     class DirectionalLight;
@@ -59,6 +60,7 @@ namespace ignition
     class Grid;
     class Heightmap;
     class Image;
+    class InstanceBatch;
     class Light;
     class LightVisual;
     class JointVisual;
@@ -72,6 +74,7 @@ namespace ignition
     class ObjectFactory;
     class ParticleEmitter;
     class PointLight;
+    class RangeNoisePass;
     class RayQuery;
     class RenderEngine;
     class RenderPass;
@@ -101,6 +104,10 @@ namespace ignition
     /// \brief Shared pointer to Camera
     typedef shared_ptr<Camera> CameraPtr;
 
+    /// \def CameraArrayPtr
+    /// \brief Shared pointer to CameraArray
+    typedef shared_ptr<CameraArray> CameraArrayPtr;
+
     /// \def DepthCameraPtr
     /// \brief Shared pointer to DepthCamera
     typedef shared_ptr<DepthCamera> DepthCameraPtr;
@@ -177,6 +184,10 @@ namespace ignition
     /// \brief Shared pointer to Node
     typedef shared_ptr<Node> NodePtr;
 
+    /// \def InstanceBatchPtr
+    /// \brief Shared pointer to InstanceBatch
+    typedef shared_ptr<InstanceBatch> InstanceBatchPtr;
+
     /// \def ObjectPtr
     /// \brief Shared pointer to Object
     typedef shared_ptr<Object> ObjectPtr;
@@ -193,6 +204,10 @@ namespace ignition
     /// \brief Shared pointer to PointLight
     typedef shared_ptr<PointLight> PointLightPtr;
 
+    /// \def RangeNoisePassPtr
+    /// \brief Shared pointer to RangeNoisePass
+    typedef shared_ptr<RangeNoisePass> RangeNoisePassPtr;
+
     /// \def RayQueryPtr
     /// \brief Shared pointer to RayQuery
     typedef shared_ptr<RayQuery> RayQueryPtr;
@@ -259,6 +274,10 @@ namespace ignition
     /// \brief Shared pointer to const Camera
     typedef shared_ptr<const Camera> ConstCameraPtr;
 
+    /// \def const CameraArrayPtr
+    /// \brief Shared pointer to const CameraArray
+    typedef shared_ptr<const CameraArray> ConstCameraArrayPtr;
+
     /// \def const DepthCameraPtr
     /// \brief Shared pointer to const DepthCamera
     typedef shared_ptr<const DepthCamera> ConstDepthCameraPtr;
@@ -335,6 +354,10 @@ namespace ignition
     /// \brief Shared pointer to const PointLight
     typedef shared_ptr<const PointLight> ConstPointLightPtr;
 
+    /// \def const RangeNoisePassPtr
+    /// \brief Shared pointer to const RangeNoisePass
+    typedef shared_ptr<const RangeNoisePass> ConstRangeNoisePassPtr;
+
     /// \def RayQueryPtr
     /// \brief Shared pointer to RayQuery
     typedef shared_ptr<const RayQuery> ConstRayQueryPtr;
@@ -30,6 +30,7 @@
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/HeightmapDescriptor.hh"
 #include "ignition/rendering/MeshDescriptor.hh"
+#include "ignition/rendering/RenderStats.hh"
 #include "ignition/rendering/RenderTypes.hh"
 #include "ignition/rendering/Storage.hh"
 #include "ignition/rendering/Export.hh"
@@ -707,6 +708,34 @@ namespace ignition
       public: virtual GpuRaysPtr CreateGpuRays(
                   unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Create new camera array. A unique ID and name will
+      /// automatically be assigned to the camera array.
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray() = 0;
+
+      /// \brief Create new camera array with the given ID. A unique name
+      /// will automatically be assigned to the camera array. If the given
+      /// ID is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new camera array
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray(unsigned int _id) = 0;
+
+      /// \brief Create new camera array with the given name. A unique ID
+      /// will automatically be assigned to the camera array. If the given
+      /// name is already in use, NULL will be returned.
+      /// \param[in] _name Name of the new camera array
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  const std::string &_name) = 0;
+
+      /// \brief Create new camera array with the given name. If either
+      /// the given ID or name is already in use, NULL will be returned.
+      /// \param[in] _id ID of the new camera array
+      /// \param[in] _name Name of the new camera array
+      /// \return The created camera array
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  unsigned int _id, const std::string &_name) = 0;
+
       /// \brief Create new visual. A unique ID and name will
       /// automatically be assigned to the visual.
       /// \return The created visual
@@ -1007,6 +1036,37 @@ namespace ignition
       public: virtual ParticleEmitterPtr CreateParticleEmitter(
                   unsigned int _id, const std::string &_name) = 0;
 
+      /// \brief Create a batch of instances of the same mesh and material,
+      /// see InstanceBatch. The instances are drawn with hardware
+      /// instancing, with a few draw calls for the whole batch rather than
+      /// one per instance.
+      /// \param[in] _desc Descriptor of the mesh to instance
+      /// \param[in] _material Material shared by the instances. If null the
+      /// materials of the mesh are used.
+      /// \param[in] _count Number of instances
+      /// \return The created instance batch or null if instancing is not
+      /// supported by the render engine
+      public: virtual InstanceBatchPtr CreateInstanceBatch(
+                  const MeshDescriptor &_desc, MaterialPtr _material,
+                  unsigned int _count) = 0;
+
+      /// \brief Merge the geometries of all visible static visuals that
+      /// share a material into a few large batches, split into regions so
+      /// they can still be culled. Baked visuals are skipped when preparing
+      /// the scene for rendering. Calling this function again rebuilds the
+      /// batches from the current set of static visuals.
+      /// \sa Visual::SetStatic
+      public: virtual void BakeStaticGeometry() = 0;
+
+      /// \brief Destroy the baked static geometry and restore the baked
+      /// visuals
+      public: virtual void ClearStaticGeometry() = 0;
+
+      /// \brief Get the number of batches of baked static geometry. Each
+      /// batch is drawn with a single draw call.
+      /// \return Number of batches, 0 if nothing is baked
+      public: virtual unsigned int StaticGeometryBatchCount() const = 0;
+
       /// \brief Enable sky in the scene.
       /// \param[in] _enabled True to enable sky
       public: virtual void SetSkyEnabled(bool _enabled) = 0;
@@ -1019,6 +1079,13 @@ namespace ignition
       /// changes by traversing scene-graph, calling PreRender on all objects
       public: virtual void PreRender() = 0;
 
+      /// \brief Get the resources used by this scene. Materials, textures
+      /// and buffers are shared by all scenes of a render engine, see
+      /// RenderEngine::ResourceStats. Fields the render engine does not
+      /// report are 0.
+      /// \return Resource statistics
+      public: virtual rendering::ResourceStats ResourceStats() const = 0;
+
       /// \brief Remove and destroy all objects from the scene graph. This does
       /// not completely destroy scene resources, so new objects can be created
       /// and added to the scene afterwards.
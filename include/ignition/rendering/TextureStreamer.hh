@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_TEXTURESTREAMER_HH_
+#define IGNITION_RENDERING_TEXTURESTREAMER_HH_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Image.hh>
+#include <ignition/common/SuppressWarning.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      // forward declaration
+      class TextureStreamerPrivate;
+
+      /// \brief Decodes texture images on background worker threads so that
+      /// render engines do not block while large textures are loaded.
+      ///
+      /// Each requested texture first becomes available as a low resolution
+      /// placeholder (the tail of its mip chain) and is upgraded to full
+      /// resolution on a later Update call. Decoded textures are kept within
+      /// a configurable memory budget: once the budget is exceeded the least
+      /// recently used textures that are no longer requested first lose
+      /// their full resolution level and are then evicted entirely.
+      ///
+      /// Request, Release, Update and TextureData are expected to be called
+      /// from the render thread.
+      class IGNITION_RENDERING_VISIBLE TextureStreamer
+      {
+        /// \brief Streaming state of a texture
+        public: enum class State
+        {
+          /// \brief Texture data is not available (yet)
+          UNLOADED = 0,
+
+          /// \brief Low resolution placeholder is available
+          PLACEHOLDER = 1,
+
+          /// \brief Full resolution texture is available
+          FINAL = 2,
+
+          /// \brief Texture could not be decoded, the render engine should
+          /// fall back to loading it synchronously
+          FAILED = 3
+        };
+
+        /// \brief Decoded texture data
+        public: struct Data
+        {
+          /// \brief Width of texture in pixels
+          unsigned int width = 0u;
+
+          /// \brief Height of texture in pixels
+          unsigned int height = 0u;
+
+          /// \brief Pixel format of the data
+          common::Image::PixelFormatType format =
+              common::Image::UNKNOWN_PIXEL_FORMAT;
+
+          /// \brief Tightly packed pixel data, row by row
+          std::shared_ptr<const std::vector<unsigned char>> bytes;
+        };
+
+        /// \brief State change of a texture reported by Update
+        public: struct Transition
+        {
+          /// \brief Texture file name
+          std::string filename;
+
+          /// \brief State before the update
+          State previous = State::UNLOADED;
+
+          /// \brief State after the update
+          State current = State::UNLOADED;
+        };
+
+        /// \brief Constructor
+        /// \param[in] _workerCount Number of decoding threads
+        public: explicit TextureStreamer(unsigned int _workerCount = 2u);
+
+        /// \brief Destructor. Waits for the decoding threads to finish their
+        /// current texture.
+        public: ~TextureStreamer();
+
+        /// \brief Request a texture. Decoding is started in the background
+        /// if the full resolution texture is not available. Every call must
+        /// be matched with a call to Release.
+        /// \param[in] _filename Full path to the texture image
+        public: void Request(const std::string &_filename);
+
+        /// \brief Release a texture previously requested. Textures without
+        /// any requests become candidates for eviction.
+        /// \param[in] _filename Full path to the texture image
+        public: void Release(const std::string &_filename);
+
+        /// \brief Advance the published state of all textures by at most one
+        /// level and evict unused textures if the memory budget is exceeded.
+        /// Spreading the upgrades over several calls guarantees that the
+        /// placeholder is always reported before the final texture.
+        /// \return List of textures whose state changed
+        public: std::vector<Transition> Update();
+
+        /// \brief Get the published state of a texture
+        /// \param[in] _filename Full path to the texture image
+        /// \return Texture state
+        public: State TextureState(const std::string &_filename) const;
+
+        /// \brief Get the texture data matching the published state, i.e.
+        /// the placeholder or the final texture.
+        /// \param[in] _filename Full path to the texture image
+        /// \return Texture data, with null bytes if no data is available
+        public: Data TextureData(const std::string &_filename) const;
+
+        /// \brief Set the memory budget for decoded textures
+        /// \param[in] _bytes Budget in bytes
+        public: void SetMemoryBudget(uint64_t _bytes);
+
+        /// \brief Get the memory budget for decoded textures
+        /// \return Budget in bytes
+        public: uint64_t MemoryBudget() const;
+
+        /// \brief Get the memory used by decoded textures
+        /// \return Memory usage in bytes
+        public: uint64_t MemoryUsage() const;
+
+        /// \brief Set the max size of the placeholder textures. The mip chain
+        /// is reduced until both dimensions fit in this size.
+        /// \param[in] _size Max width and height in pixels
+        public: void SetPlaceholderSize(unsigned int _size);
+
+        /// \brief Get the max size of the placeholder textures
+        /// \return Max width and height in pixels
+        public: unsigned int PlaceholderSize() const;
+
+        /// \brief Block until all pending textures are decoded
+        /// \param[in] _timeout Max time to wait
+        /// \return True if there are no more pending textures
+        public: bool Wait(std::chrono::milliseconds _timeout);
+
+        /// \brief Generate the next level of a mip chain by averaging 2x2
+        /// pixel blocks.
+        /// \param[in] _data Texture data to reduce
+        /// \return Texture data with half the width and height (rounded up)
+        public: static Data HalfSize(const Data &_data);
+
+        IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
+        /// \brief Pointer to private data
+        private: std::unique_ptr<TextureStreamerPrivate> dataPtr;
+        IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
+      };
+    }
+  }
+}
+#endif
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_TRACE_HH_
+#define IGNITION_RENDERING_TRACE_HH_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+      /// \brief Captures the time spent in trace zones of the hot paths of
+      /// the library and exports it in the Chrome trace event format, to be
+      /// viewed in chrome://tracing or Perfetto.
+      ///
+      /// Zones are placed with IGN_RENDERING_TRACE_ZONE, which compiles to
+      /// nothing unless the library is configured with
+      /// IGN_RENDERING_TRACING. While no capture runs a zone costs a single
+      /// relaxed atomic load. During a capture every thread records into its
+      /// own ring buffer without locking, the oldest events of a thread are
+      /// overwritten once its buffer is full.
+      ///
+      /// Start, Stop, EventCount and the export functions may be called from
+      /// any thread. Export after Stop to get a consistent trace.
+      class IGNITION_RENDERING_VISIBLE Trace
+      {
+        /// \brief Start capturing, discarding the events of the previous
+        /// capture
+        public: static void Start();
+
+        /// \brief Stop capturing. Events are kept until the next Start.
+        public: static void Stop();
+
+        /// \brief Get whether a capture is running
+        /// \return True if capturing
+        public: static bool Capturing()
+                {
+                  return capturing.load(std::memory_order_relaxed);
+                }
+
+        /// \brief Set the number of events kept per thread. Applies to
+        /// threads recording their first event afterwards.
+        /// \param[in] _count Number of events, 65536 by default
+        public: static void SetEventsPerThread(std::size_t _count);
+
+        /// \brief Get the number of events kept per thread
+        /// \return Number of events
+        public: static std::size_t EventsPerThread();
+
+        /// \brief Get the number of events of the current capture that are
+        /// still in the buffers
+        /// \return Number of events
+        public: static std::size_t EventCount();
+
+        /// \brief Get the number of events of the current capture that were
+        /// overwritten because a thread buffer was full
+        /// \return Number of lost events
+        public: static uint64_t LostEventCount();
+
+        /// \brief Get the current capture as Chrome trace event JSON
+        /// \return JSON document
+        public: static std::string ChromeTraceJson();
+
+        /// \brief Write the current capture to a file as Chrome trace event
+        /// JSON
+        /// \param[in] _filename Output file
+        /// \return True on success
+        public: static bool ExportChromeTrace(const std::string &_filename);
+
+        /// \brief Record a completed zone on the calling thread. Called by
+        /// TraceZone.
+        /// \param[in] _name Zone name. Must outlive the capture, e.g. a
+        /// string literal.
+        /// \param[in] _start Start time from Now
+        /// \param[in] _end End time from Now
+        public: static void Record(const char *_name, int64_t _start,
+                    int64_t _end);
+
+        /// \brief Get the current time of the trace clock
+        /// \return Time in nanoseconds
+        public: static int64_t Now();
+
+        /// \brief True while capturing
+        private: static std::atomic<bool> capturing;
+      };
+
+      /// \brief Records the time between its construction and destruction
+      /// as a trace zone if a capture is running. Use through
+      /// IGN_RENDERING_TRACE_ZONE so that zones compile out.
+      class TraceZone
+      {
+        /// \brief Constructor
+        /// \param[in] _name Zone name, must be a string literal
+        public: explicit TraceZone(const char *_name)
+                : name(Trace::Capturing() ? _name : nullptr),
+                  start(this->name ? Trace::Now() : 0)
+                {
+                }
+
+        /// \brief Destructor, records the zone
+        public: ~TraceZone()
+                {
+                  if (this->name)
+                    Trace::Record(this->name, this->start, Trace::Now());
+                }
+
+        /// \brief Zone name, null if no capture was running
+        private: const char *name;
+
+        /// \brief Start time of the zone
+        private: int64_t start;
+      };
+    }
+  }
+}
+
+#define IGN_RENDERING_TRACE_CONCAT_IMPL(_a, _b) _a##_b
+#define IGN_RENDERING_TRACE_CONCAT(_a, _b) \
+  IGN_RENDERING_TRACE_CONCAT_IMPL(_a, _b)
+
+/// \def IGN_RENDERING_TRACE_ZONE(_name)
+/// \brief Trace the rest of the enclosing scope under a string literal name
+#ifdef IGN_RENDERING_TRACING
+#define IGN_RENDERING_TRACE_ZONE(_name) \
+  ignition::rendering::TraceZone \
+  IGN_RENDERING_TRACE_CONCAT(ignRenderingTraceZone, __LINE__)(_name)
+#else
+#define IGN_RENDERING_TRACE_ZONE(_name)
+#endif
+
+#endif
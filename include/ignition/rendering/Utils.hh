@@ -23,9 +23,11 @@
 #include <ignition/math/AxisAlignedBox.hh>
 #include <ignition/math/Vector3.hh>
 #include <ignition/math/Pose3.hh>
+#include <ignition/math/Matrix4.hh>
 
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/Export.hh"
+#include "ignition/rendering/RenderTypes.hh"
 
 namespace ignition
 {
@@ -49,6 +51,32 @@ namespace ignition
     ignition::math::AxisAlignedBox transformAxisAlignedBox(
         const ignition::math::AxisAlignedBox &_box,
         const ignition::math::Pose3d &_pose);
+
+    /// \brief Set the same skeleton pose on many meshes that share a
+    /// skeleton definition, e.g. a crowd of actors created from one mesh.
+    /// The bone count is only queried on the first mesh and the transforms
+    /// are applied by bone index, see Mesh::SetSkeletonBoneTransforms.
+    /// \param[in] _meshes Meshes to update
+    /// \param[in] _tfs Local bone transforms ordered by bone index
+    /// \return True if all meshes were updated, false if a mesh is null or
+    /// the number of transforms differs from the bone count of the first
+    /// mesh
+    IGNITION_RENDERING_VISIBLE
+    bool setSkeletonBoneTransforms(const std::vector<MeshPtr> &_meshes,
+        const std::vector<ignition::math::Matrix4d> &_tfs);
+
+    /// \brief Set individual skeleton poses on many meshes that share a
+    /// skeleton definition.
+    /// \param[in] _meshes Meshes to update
+    /// \param[in] _tfs Local bone transforms ordered by bone index, one
+    /// list per mesh
+    /// \return True if all meshes were updated, false if the number of
+    /// poses does not match the number of meshes, a mesh is null or the
+    /// number of transforms of a pose differs from the bone count of the
+    /// first mesh
+    IGNITION_RENDERING_VISIBLE
+    bool setSkeletonBoneTransforms(const std::vector<MeshPtr> &_meshes,
+        const std::vector<std::vector<ignition::math::Matrix4d>> &_tfs);
     }
   }
 }
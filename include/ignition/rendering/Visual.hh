@@ -149,6 +149,20 @@ namespace ignition
       /// \return The local bounding box
       public: virtual ignition::math::AxisAlignedBox LocalBoundingBox()
               const = 0;
+
+      /// \brief Mark the visual as static. Static visuals are not expected
+      /// to move and their geometries are merged with the geometries of
+      /// other static visuals when Scene::BakeStaticGeometry is called.
+      /// Modifying the pose, scale, geometries, material or visibility of a
+      /// baked visual removes it from the baked geometry again. Moving or
+      /// hiding the parent of a baked visual is not detected.
+      /// \param[in] _static True if the visual is static
+      /// \sa Scene::BakeStaticGeometry
+      public: virtual void SetStatic(bool _static) = 0;
+
+      /// \brief Get whether the visual is static
+      /// \return True if the visual is static
+      public: virtual bool Static() const = 0;
     };
     }
   }
@@ -17,20 +17,33 @@
 #ifndef IGNITION_RENDERING_BASE_BASECAMERA_HH_
 #define IGNITION_RENDERING_BASE_BASECAMERA_HH_
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <ignition/math/Matrix3.hh>
 #include <ignition/math/Pose3.hh>
 
 #include <ignition/common/Event.hh>
 #include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
 #include <ignition/common/SuppressWarning.hh>
 
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/FrameSaver.hh"
 #include "ignition/rendering/Image.hh"
+#include "ignition/rendering/RayQuery.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/base/BaseRenderTarget.hh"
+#include "ignition/rendering/base/BaseScene.hh"
 
 namespace ignition
 {
@@ -59,7 +72,7 @@ namespace ignition
 
       public: virtual PixelFormat ImageFormat() const override;
 
-      public: virtual unsigned int ImageMemorySize() const override;
+      public: virtual std::size_t ImageMemorySize() const override;
 
       public: virtual void SetImageFormat(PixelFormat _format) override;
 
@@ -99,6 +112,22 @@ namespace ignition
 
       public: virtual bool SaveFrame(const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual void EnableSaveFrame(const bool _enable) override;
+
+      // Documentation inherited.
+      public: virtual bool SaveFrameEnabled() const override;
+
+      // Documentation inherited.
+      public: virtual void SetSaveFramePath(const std::string &_path)
+                  override;
+
+      // Documentation inherited.
+      public: virtual std::string SaveFramePath() const override;
+
+      // Documentation inherited.
+      public: virtual rendering::RenderStats RenderStats() const override;
+
       public: virtual common::ConnectionPtr ConnectNewImageFrame(
                   Camera::NewFrameListener _listener) override;
 
@@ -108,6 +137,26 @@ namespace ignition
       public: virtual VisualPtr VisualAt(const ignition::math::Vector2i
                   &_mousePos) override;
 
+      // Documentation inherited.
+      public: virtual std::map<unsigned int, unsigned int> VisualsInRect(
+                  const ignition::math::Vector2i &_start,
+                  const ignition::math::Vector2i &_end) override;
+
+      // Documentation inherited.
+      public: virtual std::map<unsigned int, unsigned int> VisualsAt(
+                  const std::vector<ignition::math::Vector2i> &_points)
+                  override;
+
+      // Documentation inherited.
+      public: virtual void SetSelectionBufferScale(double _scale) override;
+
+      // Documentation inherited.
+      public: virtual double SelectionBufferScale() const override;
+
+      // Documentation inherited.
+      public: virtual RayQueryResult PickAt(
+                  const ignition::math::Vector2i &_pos) override;
+
       // Documentation inherited.
       public: virtual math::Matrix4d ProjectionMatrix() const override;
 
@@ -180,6 +229,49 @@ namespace ignition
 
       protected: virtual void *CreateImageBuffer() const;
 
+      /// \brief Queue a rendered frame to be saved in the save frame path
+      /// under the next file name of this camera. Called every frame when
+      /// saving is enabled.
+      /// \param[in] _image Rendered frame. Its buffer is shared with the
+      /// queue and must not be written to afterwards.
+      /// \return True if the frame was queued
+      protected: bool SaveNextFrame(const Image &_image);
+
+      /// \brief Copy a frame kept in a buffer of the camera, e.g. a depth
+      /// frame read back from the GPU, to a new image that can be saved
+      /// \param[in] _data Frame data, rows tightly packed
+      /// \param[in] _width Frame width in pixels
+      /// \param[in] _height Frame height in pixels
+      /// \param[in] _format Frame pixel format
+      /// \return Image holding a copy of the frame
+      protected: static Image FrameImage(const void *_data,
+                     unsigned int _width, unsigned int _height,
+                     PixelFormat _format);
+
+      /// \brief Render the ids of the visuals over the full view of the
+      /// camera. Render engines supporting VisualsInRect and VisualsAt
+      /// implement this.
+      /// \param[in] _width Width of the id buffer in pixels
+      /// \param[in] _height Height of the id buffer in pixels
+      /// \param[out] _ids Visual id of each pixel, row by row from the top
+      /// left, 0 where there is no visual
+      /// \return True on success
+      protected: virtual bool RenderIds(unsigned int _width,
+                     unsigned int _height, std::vector<unsigned int> &_ids);
+
+      /// \brief Render the id buffer unless the one rendered last is still
+      /// valid
+      /// \return True if the id buffer is available
+      protected: bool UpdateIdBuffer();
+
+      /// \brief Map an image position to a column or row of the id buffer
+      /// \param[in] _pos Image position in pixels, in the image
+      /// \param[in] _imageSize Image size in pixels
+      /// \param[in] _bufferSize Id buffer size in pixels
+      /// \return Id buffer position
+      protected: static unsigned int IdBufferPos(int _pos,
+                     unsigned int _imageSize, unsigned int _bufferSize);
+
       protected: virtual void Load() override;
 
       protected: virtual void Reset();
@@ -192,6 +284,41 @@ namespace ignition
 
       protected: ImagePtr imageBuffer;
 
+      /// \brief Directory frames are saved to when saving is enabled
+      protected: std::string saveFramePath;
+
+      /// \brief True to save every rendered frame
+      protected: bool saveFrameEnabled = false;
+
+      /// \brief Number of frames saved by SaveNextFrame, numbers the files
+      protected: unsigned int saveFrameCount = 0u;
+
+      /// \brief Statistics of the last frame, filled in by the render
+      /// engine
+      protected: rendering::RenderStats renderStats;
+
+      /// \brief Visual id of each pixel of the id buffer, empty until
+      /// rendered
+      protected: std::vector<unsigned int> idBuffer;
+
+      /// \brief Width of the id buffer in pixels
+      protected: unsigned int idBufferWidth = 0u;
+
+      /// \brief Height of the id buffer in pixels
+      protected: unsigned int idBufferHeight = 0u;
+
+      /// \brief View matrix the id buffer was rendered with
+      protected: math::Matrix4d idBufferView;
+
+      /// \brief Projection matrix the id buffer was rendered with
+      protected: math::Matrix4d idBufferProjection;
+
+      /// \brief Scene change generation the id buffer was rendered at
+      protected: uint64_t idBufferGeneration = 0u;
+
+      /// \brief Resolution of the id buffer relative to the image size
+      protected: double selectionBufferScale = 1.0;
+
       /// \brief Near clipping plane distance
       protected: double nearClip = 0.01;
 
@@ -280,7 +407,7 @@ namespace ignition
 
     //////////////////////////////////////////////////
     template <class T>
-    unsigned int BaseCamera<T>::ImageMemorySize() const
+    std::size_t BaseCamera<T>::ImageMemorySize() const
     {
       PixelFormat format = this->ImageFormat();
       unsigned int width = this->ImageWidth();
@@ -306,6 +433,7 @@ namespace ignition
     template <class T>
     void BaseCamera<T>::PreRender()
     {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::PreRender");
       T::PreRender();
 
       this->RenderTarget()->PreRender();
@@ -368,7 +496,15 @@ namespace ignition
     template <class T>
     void BaseCamera<T>::PostRender()
     {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::PostRender");
       this->RenderTarget()->PostRender();
+
+      if (this->saveFrameEnabled)
+      {
+        Image image = this->CreateImage();
+        this->Copy(image);
+        this->SaveNextFrame(image);
+      }
     }
 
     //////////////////////////////////////////////////
@@ -394,6 +530,7 @@ namespace ignition
     template <class T>
     void BaseCamera<T>::Capture(Image &_image)
     {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::Capture");
       this->Update();
       this->Copy(_image);
     }
@@ -402,14 +539,81 @@ namespace ignition
     template <class T>
     void BaseCamera<T>::Copy(Image &_image) const
     {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::Copy");
       this->RenderTarget()->Copy(_image);
     }
 
     //////////////////////////////////////////////////
     template <class T>
-    bool BaseCamera<T>::SaveFrame(const std::string &/*_name*/)
+    bool BaseCamera<T>::SaveFrame(const std::string &_name)
     {
-      return false;
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::SaveFrame");
+      Image image = this->CreateImage();
+      this->Copy(image);
+      return FrameSaver::Default().Save(image, _name);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::EnableSaveFrame(const bool _enable)
+    {
+      this->saveFrameEnabled = _enable;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::SaveFrameEnabled() const
+    {
+      return this->saveFrameEnabled;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetSaveFramePath(const std::string &_path)
+    {
+      this->saveFramePath = _path;
+      if (!_path.empty() && !common::createDirectories(_path))
+      {
+        ignerr << "Unable to create directory [" << _path
+               << "] to save frames of camera [" << this->Name() << "]"
+               << std::endl;
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseCamera<T>::SaveFramePath() const
+    {
+      return this->saveFramePath;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    rendering::RenderStats BaseCamera<T>::RenderStats() const
+    {
+      return this->renderStats;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::SaveNextFrame(const Image &_image)
+    {
+      // scoped camera names contain characters unfit for file names
+      std::string name = this->Name();
+      for (char &c : name)
+      {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-')
+          c = '_';
+      }
+
+      std::ostringstream filename;
+      filename << name << "-" << std::setw(6) << std::setfill('0')
+               << this->saveFrameCount++ << "."
+               << (PixelUtil::BytesPerChannel(_image.Format()) ==
+                   sizeof(float) ? "pfm" : "png");
+      std::string path = this->saveFramePath.empty() ? filename.str() :
+          common::joinPaths(this->saveFramePath, filename.str());
+      return FrameSaver::Default().Save(_image, path);
     }
 
     //////////////////////////////////////////////////
@@ -420,13 +624,23 @@ namespace ignition
       return newFrameEvent.Connect(_listener);
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    Image BaseCamera<T>::FrameImage(const void *_data, unsigned int _width,
+        unsigned int _height, PixelFormat _format)
+    {
+      Image image(_width, _height, _format);
+      std::memcpy(image.Data(), _data, image.MemorySize());
+      return image;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void *BaseCamera<T>::CreateImageBuffer() const
     {
       // TODO(anyone): determine proper type
-      unsigned int size = this->ImageMemorySize();
-      return new unsigned char *[size];
+      std::size_t size = this->ImageMemorySize();
+      return new unsigned char[size];
     }
 
     //////////////////////////////////////////////////
@@ -538,6 +752,194 @@ namespace ignition
       return VisualPtr();
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    std::map<unsigned int, unsigned int> BaseCamera<T>::VisualsInRect(
+        const ignition::math::Vector2i &_start,
+        const ignition::math::Vector2i &_end)
+    {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::VisualsInRect");
+      std::map<unsigned int, unsigned int> result;
+
+      int width = static_cast<int>(this->ImageWidth());
+      int height = static_cast<int>(this->ImageHeight());
+      int minX = std::max(std::min(_start.X(), _end.X()), 0);
+      int maxX = std::min(std::max(_start.X(), _end.X()), width - 1);
+      int minY = std::max(std::min(_start.Y(), _end.Y()), 0);
+      int maxY = std::min(std::max(_start.Y(), _end.Y()), height - 1);
+      if (minX > maxX || minY > maxY)
+        return result;
+
+      if (!this->UpdateIdBuffer())
+        return result;
+
+      unsigned int x0 =
+          IdBufferPos(minX, this->ImageWidth(), this->idBufferWidth);
+      unsigned int x1 =
+          IdBufferPos(maxX, this->ImageWidth(), this->idBufferWidth);
+      unsigned int y0 =
+          IdBufferPos(minY, this->ImageHeight(), this->idBufferHeight);
+      unsigned int y1 =
+          IdBufferPos(maxY, this->ImageHeight(), this->idBufferHeight);
+
+      // visuals cover runs of pixels, count a run before looking it up
+      unsigned int runId = 0u;
+      unsigned int runCount = 0u;
+      for (unsigned int y = y0; y <= y1; ++y)
+      {
+        const unsigned int *row =
+            this->idBuffer.data() + y * this->idBufferWidth;
+        for (unsigned int x = x0; x <= x1; ++x)
+        {
+          if (row[x] != runId)
+          {
+            if (runId)
+              result[runId] += runCount;
+            runId = row[x];
+            runCount = 0u;
+          }
+          ++runCount;
+        }
+      }
+      if (runId)
+        result[runId] += runCount;
+
+      return result;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::map<unsigned int, unsigned int> BaseCamera<T>::VisualsAt(
+        const std::vector<ignition::math::Vector2i> &_points)
+    {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::VisualsAt");
+      std::map<unsigned int, unsigned int> result;
+      if (_points.empty() || !this->UpdateIdBuffer())
+        return result;
+
+      int width = static_cast<int>(this->ImageWidth());
+      int height = static_cast<int>(this->ImageHeight());
+      for (const auto &point : _points)
+      {
+        if (point.X() < 0 || point.Y() < 0 || point.X() >= width ||
+            point.Y() >= height)
+          continue;
+
+        unsigned int x =
+            IdBufferPos(point.X(), this->ImageWidth(), this->idBufferWidth);
+        unsigned int y =
+            IdBufferPos(point.Y(), this->ImageHeight(), this->idBufferHeight);
+        unsigned int id = this->idBuffer[y * this->idBufferWidth + x];
+        if (id)
+          ++result[id];
+      }
+      return result;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCamera<T>::SetSelectionBufferScale(double _scale)
+    {
+      if (_scale <= 0.0 || _scale > 1.0)
+      {
+        ignerr << "Selection buffer scale must be in (0, 1], got ["
+               << _scale << "]" << std::endl;
+        return;
+      }
+      this->selectionBufferScale = _scale;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseCamera<T>::SelectionBufferScale() const
+    {
+      return this->selectionBufferScale;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    RayQueryResult BaseCamera<T>::PickAt(const ignition::math::Vector2i &_pos)
+    {
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::PickAt");
+      RayQueryResult result;
+      RayQueryPtr rayQuery = this->Scene()->CreateRayQuery();
+      if (!rayQuery)
+        return result;
+
+      CameraPtr camera =
+          std::dynamic_pointer_cast<Camera>(this->shared_from_this());
+      double nx = 2.0 * _pos.X() /
+          static_cast<double>(this->ImageWidth()) - 1.0;
+      double ny = 1.0 - 2.0 * _pos.Y() /
+          static_cast<double>(this->ImageHeight());
+      rayQuery->SetFromCamera(camera, math::Vector2d(nx, ny));
+      return rayQuery->ClosestPoint();
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::RenderIds(unsigned int /*_width*/,
+        unsigned int /*_height*/, std::vector<unsigned int> &/*_ids*/)
+    {
+      ignerr << "Id buffer not implemented for the render engine"
+             << std::endl;
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseCamera<T>::UpdateIdBuffer()
+    {
+      unsigned int width = std::max(1u, static_cast<unsigned int>(std::lround(
+          this->ImageWidth() * this->selectionBufferScale)));
+      unsigned int height = std::max(1u, static_cast<unsigned int>(
+          std::lround(this->ImageHeight() * this->selectionBufferScale)));
+
+      uint64_t generation = 0u;
+      auto baseScene = std::dynamic_pointer_cast<BaseScene>(this->Scene());
+      if (baseScene)
+        generation = baseScene->ChangeGeneration();
+
+      math::Matrix4d view = this->ViewMatrix();
+      math::Matrix4d projection = this->ProjectionMatrix();
+
+      // reuse the id buffer while the camera and the scene are unchanged
+      if (!this->idBuffer.empty() && width == this->idBufferWidth &&
+          height == this->idBufferHeight &&
+          generation == this->idBufferGeneration &&
+          view == this->idBufferView &&
+          projection == this->idBufferProjection)
+      {
+        return true;
+      }
+
+      IGN_RENDERING_TRACE_ZONE("BaseCamera::UpdateIdBuffer");
+      this->idBuffer.clear();
+      if (!this->RenderIds(width, height, this->idBuffer) ||
+          this->idBuffer.size() != static_cast<size_t>(width) * height)
+      {
+        this->idBuffer.clear();
+        return false;
+      }
+
+      this->idBufferWidth = width;
+      this->idBufferHeight = height;
+      this->idBufferGeneration = generation;
+      this->idBufferView = view;
+      this->idBufferProjection = projection;
+      return true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCamera<T>::IdBufferPos(int _pos, unsigned int _imageSize,
+        unsigned int _bufferSize)
+    {
+      unsigned int pos = static_cast<unsigned int>(
+          static_cast<uint64_t>(_pos) * _bufferSize / _imageSize);
+      return std::min(pos, _bufferSize - 1u);
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseCamera<T>::SetHFOV(const math::Angle &_hfov)
@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASECAMERAARRAY_HH_
+#define IGNITION_RENDERING_BASE_BASECAMERAARRAY_HH_
+
+#include <cmath>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/CameraArray.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/base/BaseSensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BaseCameraArray BaseCameraArray.hh
+    /// ignition/rendering/base/BaseCameraArray.hh
+    /// \brief Stores the views of a camera array and the atlas layout.
+    /// Render engines rebuild their resources when the layout changes, see
+    /// layoutDirty.
+    template <class T>
+    class BaseCameraArray :
+      public virtual CameraArray,
+      public virtual T
+    {
+      /// \brief Constructor
+      protected: BaseCameraArray();
+
+      /// \brief Destructor
+      public: virtual ~BaseCameraArray();
+
+      // Documentation inherited.
+      public: virtual void SetViewCount(unsigned int _count) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ViewCount() const override;
+
+      // Documentation inherited.
+      public: virtual void SetViewPose(unsigned int _index,
+                  const math::Pose3d &_pose) override;
+
+      // Documentation inherited.
+      public: virtual math::Pose3d ViewPose(unsigned int _index) const
+                  override;
+
+      // Documentation inherited.
+      public: virtual void SetImageWidth(unsigned int _width) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ImageWidth() const override;
+
+      // Documentation inherited.
+      public: virtual void SetImageHeight(unsigned int _height) override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ImageHeight() const override;
+
+      // Documentation inherited.
+      public: virtual PixelFormat ImageFormat() const override;
+
+      // Documentation inherited.
+      public: virtual void SetHFOV(const math::Angle &_hfov) override;
+
+      // Documentation inherited.
+      public: virtual math::Angle HFOV() const override;
+
+      // Documentation inherited.
+      public: virtual void SetNearClipPlane(double _near) override;
+
+      // Documentation inherited.
+      public: virtual double NearClipPlane() const override;
+
+      // Documentation inherited.
+      public: virtual void SetFarClipPlane(double _far) override;
+
+      // Documentation inherited.
+      public: virtual double FarClipPlane() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int ColumnCount() const override;
+
+      // Documentation inherited.
+      public: virtual unsigned int RowCount() const override;
+
+      // Documentation inherited.
+      public: virtual void Update() override;
+
+      /// \brief Poses of the views relative to the camera array
+      protected: std::vector<math::Pose3d> viewPoses;
+
+      /// \brief Width of each view
+      protected: unsigned int imageWidth = 84u;
+
+      /// \brief Height of each view
+      protected: unsigned int imageHeight = 84u;
+
+      /// \brief Horizontal field of view of each view
+      protected: math::Angle hfov = math::Angle(IGN_PI * 0.5);
+
+      /// \brief Near clip distance
+      protected: double nearClip = 0.01;
+
+      /// \brief Far clip distance
+      protected: double farClip = 1000.0;
+
+      /// \brief True if the number or the size of the views changed since
+      /// the render engine resources were created
+      protected: bool layoutDirty = true;
+
+      /// \brief True if a view pose, the field of view or the clip planes
+      /// changed since the view cameras were last updated
+      protected: bool viewsDirty = true;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseCameraArray<T>::BaseCameraArray()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseCameraArray<T>::~BaseCameraArray()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetViewCount(unsigned int _count)
+    {
+      if (_count == this->viewPoses.size())
+        return;
+      this->viewPoses.resize(_count, math::Pose3d::Zero);
+      this->layoutDirty = true;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::ViewCount() const
+    {
+      return static_cast<unsigned int>(this->viewPoses.size());
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetViewPose(unsigned int _index,
+        const math::Pose3d &_pose)
+    {
+      if (_index >= this->viewPoses.size())
+      {
+        ignerr << "Invalid view index [" << _index << "]" << std::endl;
+        return;
+      }
+      this->viewPoses[_index] = _pose;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Pose3d BaseCameraArray<T>::ViewPose(unsigned int _index) const
+    {
+      if (_index >= this->viewPoses.size())
+        return math::Pose3d::Zero;
+      return this->viewPoses[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetImageWidth(unsigned int _width)
+    {
+      if (_width == 0u)
+      {
+        ignerr << "Camera array image width must be positive" << std::endl;
+        return;
+      }
+      this->imageWidth = _width;
+      this->layoutDirty = true;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::ImageWidth() const
+    {
+      return this->imageWidth;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetImageHeight(unsigned int _height)
+    {
+      if (_height == 0u)
+      {
+        ignerr << "Camera array image height must be positive" << std::endl;
+        return;
+      }
+      this->imageHeight = _height;
+      this->layoutDirty = true;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::ImageHeight() const
+    {
+      return this->imageHeight;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    PixelFormat BaseCameraArray<T>::ImageFormat() const
+    {
+      return PF_R8G8B8;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetHFOV(const math::Angle &_hfov)
+    {
+      this->hfov = _hfov;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Angle BaseCameraArray<T>::HFOV() const
+    {
+      return this->hfov;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetNearClipPlane(double _near)
+    {
+      this->nearClip = _near;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseCameraArray<T>::NearClipPlane() const
+    {
+      return this->nearClip;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::SetFarClipPlane(double _far)
+    {
+      this->farClip = _far;
+      this->viewsDirty = true;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseCameraArray<T>::FarClipPlane() const
+    {
+      return this->farClip;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::ColumnCount() const
+    {
+      // as square as possible
+      unsigned int count = this->ViewCount();
+      if (count == 0u)
+        return 0u;
+      return static_cast<unsigned int>(
+          std::ceil(std::sqrt(static_cast<double>(count))));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseCameraArray<T>::RowCount() const
+    {
+      unsigned int columns = this->ColumnCount();
+      if (columns == 0u)
+        return 0u;
+      return (this->ViewCount() + columns - 1u) / columns;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseCameraArray<T>::Update()
+    {
+      this->Scene()->PreRender();
+      this->Render();
+      this->PostRender();
+    }
+    }
+  }
+}
+#endif
@@ -68,6 +68,22 @@ namespace ignition
                   unsigned int _height, unsigned int _depth,
                   const std::string &_format)> _subscriber) override;
 
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewGpuRaysData(
+                  NewFrameListener _subscriber) override;
+
+      // Documentation inherited.
+      public: virtual void SetDataFormat(GpuRaysDataFormat _format) override;
+
+      // Documentation inherited.
+      public: virtual GpuRaysDataFormat DataFormat() const override;
+
+      // Documentation inherited.
+      public: virtual void SetResolutionScale(double _scale) override;
+
+      // Documentation inherited.
+      public: virtual double ResolutionScale() const override;
+
       /// \brief Pointer to the render target
       public: virtual RenderTargetPtr RenderTarget() const override = 0;
 
@@ -197,9 +213,19 @@ namespace ignition
       /// \brief Resolution of vertical rays
       protected: double vResolution = 1;
 
+      /// \brief Get the format string of the current data format
+      /// \return Format string passed to the new data callbacks
+      protected: std::string DataFormatString() const;
+
       /// \brief Number of channels used to store the data
       protected: unsigned int channels = 1u;
 
+      /// \brief Layout of the gpu rays data
+      protected: GpuRaysDataFormat dataFormat = GRDF_RANGE_RETRO;
+
+      /// \brief Scale of the resolution the scene is rendered at
+      protected: double resolutionScale = 1.0;
+
       private: friend class OgreScene;
     };
 
@@ -265,6 +291,80 @@ namespace ignition
       return nullptr;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    ignition::common::ConnectionPtr BaseGpuRays<T>::ConnectNewGpuRaysData(
+          NewFrameListener)
+    {
+      return nullptr;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseGpuRays<T>::SetDataFormat(GpuRaysDataFormat _format)
+    {
+      this->dataFormat = _format;
+
+      switch (this->dataFormat)
+      {
+        case GRDF_RANGE:
+        case GRDF_RANGE_U16_MM:
+          this->channels = 1u;
+          break;
+        case GRDF_RANGE_INTENSITY_U8:
+          this->channels = 2u;
+          break;
+        case GRDF_RANGE_RETRO:
+        default:
+          this->channels = 3u;
+          break;
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    GpuRaysDataFormat BaseGpuRays<T>::DataFormat() const
+    {
+      return this->dataFormat;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseGpuRays<T>::SetResolutionScale(double _scale)
+    {
+      if (_scale <= 0.0)
+      {
+        ignerr << "GpuRays resolution scale must be positive" << std::endl;
+        return;
+      }
+      this->resolutionScale = _scale;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseGpuRays<T>::ResolutionScale() const
+    {
+      return this->resolutionScale;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::string BaseGpuRays<T>::DataFormatString() const
+    {
+      switch (this->dataFormat)
+      {
+        case GRDF_RANGE:
+          return "PF_FLOAT32_R";
+        case GRDF_RANGE_INTENSITY_U8:
+          return "RANGE_FLOAT32_INTENSITY_U8";
+        case GRDF_RANGE_U16_MM:
+          return "RANGE_U16_MM";
+        case GRDF_RANGE_RETRO:
+        default:
+          return "PF_FLOAT32_RGB";
+      }
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseGpuRays<T>::SetIsHorizontal(const bool _horizontal)
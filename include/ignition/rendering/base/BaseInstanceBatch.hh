@@ -0,0 +1,421 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASEINSTANCEBATCH_HH_
+#define IGNITION_RENDERING_BASE_BASEINSTANCEBATCH_HH_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/InstanceBatch.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/MeshDescriptor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \class BaseInstanceBatch BaseInstanceBatch.hh
+    /// ignition/rendering/base/BaseInstanceBatch.hh
+    /// \brief Stores the per instance data of an instance batch and tracks
+    /// which instances changed since the last PreRender call. Render engines
+    /// apply the changes in UpdateInstances.
+    template <class T>
+    class BaseInstanceBatch :
+      public virtual InstanceBatch,
+      public virtual T
+    {
+      /// \brief Flags describing which data of an instance changed
+      protected: enum DirtyFlags : uint8_t
+      {
+        /// \brief Pose or scale changed
+        DIRTY_TRANSFORM = 1,
+
+        /// \brief Colour changed
+        DIRTY_COLOR = 2,
+
+        /// \brief Custom parameter changed
+        DIRTY_CUSTOM_PARAMETER = 4,
+
+        /// \brief Visibility changed
+        DIRTY_VISIBILITY = 8
+      };
+
+      /// \brief Constructor
+      protected: BaseInstanceBatch();
+
+      /// \brief Destructor
+      public: virtual ~BaseInstanceBatch();
+
+      // Documentation inherited.
+      public: virtual unsigned int InstanceCount() const override;
+
+      // Documentation inherited.
+      public: virtual MaterialPtr Material() const override;
+
+      // Documentation inherited.
+      public: virtual void SetInstancePose(unsigned int _index,
+                  const math::Pose3d &_pose) override;
+
+      // Documentation inherited.
+      public: virtual math::Pose3d InstancePose(unsigned int _index)
+                  const override;
+
+      // Documentation inherited.
+      public: virtual void SetInstancePoses(
+                  const std::vector<math::Pose3d> &_poses) override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceScale(unsigned int _index,
+                  const math::Vector3d &_scale) override;
+
+      // Documentation inherited.
+      public: virtual math::Vector3d InstanceScale(unsigned int _index)
+                  const override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceScales(
+                  const std::vector<math::Vector3d> &_scales) override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceColor(unsigned int _index,
+                  const math::Color &_color) override;
+
+      // Documentation inherited.
+      public: virtual math::Color InstanceColor(unsigned int _index)
+                  const override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceColors(
+                  const std::vector<math::Color> &_colors) override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceCustomParameter(unsigned int _index,
+                  const math::Vector4d &_param) override;
+
+      // Documentation inherited.
+      public: virtual math::Vector4d InstanceCustomParameter(
+                  unsigned int _index) const override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceCustomParameters(
+                  const std::vector<math::Vector4d> &_params) override;
+
+      // Documentation inherited.
+      public: virtual void SetInstanceVisible(unsigned int _index,
+                  bool _visible) override;
+
+      // Documentation inherited.
+      public: virtual bool InstanceVisible(unsigned int _index) const
+                  override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      /// \brief Set the mesh, material and number of instances. Must be
+      /// called by the scene before the batch is initialized.
+      /// \param[in] _desc Mesh descriptor
+      /// \param[in] _material Batch material, can be null
+      /// \param[in] _count Number of instances
+      protected: void SetInstanceData(const MeshDescriptor &_desc,
+                  MaterialPtr _material, unsigned int _count);
+
+      /// \brief Apply the changed instance data to the render engine. The
+      /// changed instances are marked in the dirtyFlags list, which is
+      /// cleared after the call.
+      protected: virtual void UpdateInstances() = 0;
+
+      /// \brief Check if the instance index is valid, print an error if not
+      /// \param[in] _index Instance index
+      /// \return True if the index is valid
+      protected: bool ValidIndex(unsigned int _index) const;
+
+      /// \brief Mark an instance as changed
+      /// \param[in] _index Instance index
+      /// \param[in] _flags Dirty flags to add
+      protected: void MarkDirty(unsigned int _index, uint8_t _flags);
+
+      /// \brief Descriptor of the instanced mesh
+      protected: MeshDescriptor meshDescriptor;
+
+      /// \brief Batch material
+      protected: MaterialPtr material;
+
+      /// \brief Instance poses
+      protected: std::vector<math::Pose3d> poses;
+
+      /// \brief Instance scales
+      protected: std::vector<math::Vector3d> scales;
+
+      /// \brief Instance colours
+      protected: std::vector<math::Color> colors;
+
+      /// \brief Instance custom parameters
+      protected: std::vector<math::Vector4d> customParameters;
+
+      /// \brief Instance visibility
+      protected: std::vector<bool> visibility;
+
+      /// \brief Dirty flags of each instance
+      protected: std::vector<uint8_t> dirtyFlags;
+
+      /// \brief True if any instance changed
+      protected: bool dirty = false;
+    };
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseInstanceBatch<T>::BaseInstanceBatch()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseInstanceBatch<T>::~BaseInstanceBatch()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceData(const MeshDescriptor &_desc,
+        MaterialPtr _material, unsigned int _count)
+    {
+      this->meshDescriptor = _desc;
+      this->material = _material;
+
+      math::Color color = _material ? _material->Diffuse() : math::Color::White;
+      this->poses.assign(_count, math::Pose3d::Zero);
+      this->scales.assign(_count, math::Vector3d::One);
+      this->colors.assign(_count, color);
+      this->customParameters.assign(_count, math::Vector4d::Zero);
+      this->visibility.assign(_count, true);
+      this->dirtyFlags.assign(_count, 0u);
+      this->dirty = false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseInstanceBatch<T>::InstanceCount() const
+    {
+      return static_cast<unsigned int>(this->poses.size());
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    MaterialPtr BaseInstanceBatch<T>::Material() const
+    {
+      return this->material;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstancePose(unsigned int _index,
+        const math::Pose3d &_pose)
+    {
+      if (!this->ValidIndex(_index))
+        return;
+      this->poses[_index] = _pose;
+      this->MarkDirty(_index, DIRTY_TRANSFORM);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Pose3d BaseInstanceBatch<T>::InstancePose(unsigned int _index) const
+    {
+      if (!this->ValidIndex(_index))
+        return math::Pose3d::Zero;
+      return this->poses[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstancePoses(
+        const std::vector<math::Pose3d> &_poses)
+    {
+      size_t count = std::min(_poses.size(), this->poses.size());
+      std::copy(_poses.begin(), _poses.begin() + count, this->poses.begin());
+      for (size_t i = 0; i < count; ++i)
+        this->dirtyFlags[i] |= DIRTY_TRANSFORM;
+      this->dirty = this->dirty || count > 0u;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceScale(unsigned int _index,
+        const math::Vector3d &_scale)
+    {
+      if (!this->ValidIndex(_index))
+        return;
+      this->scales[_index] = _scale;
+      this->MarkDirty(_index, DIRTY_TRANSFORM);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector3d BaseInstanceBatch<T>::InstanceScale(unsigned int _index)
+        const
+    {
+      if (!this->ValidIndex(_index))
+        return math::Vector3d::One;
+      return this->scales[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceScales(
+        const std::vector<math::Vector3d> &_scales)
+    {
+      size_t count = std::min(_scales.size(), this->scales.size());
+      std::copy(_scales.begin(), _scales.begin() + count,
+          this->scales.begin());
+      for (size_t i = 0; i < count; ++i)
+        this->dirtyFlags[i] |= DIRTY_TRANSFORM;
+      this->dirty = this->dirty || count > 0u;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceColor(unsigned int _index,
+        const math::Color &_color)
+    {
+      if (!this->ValidIndex(_index))
+        return;
+      this->colors[_index] = _color;
+      this->MarkDirty(_index, DIRTY_COLOR);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Color BaseInstanceBatch<T>::InstanceColor(unsigned int _index) const
+    {
+      if (!this->ValidIndex(_index))
+        return math::Color::White;
+      return this->colors[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceColors(
+        const std::vector<math::Color> &_colors)
+    {
+      size_t count = std::min(_colors.size(), this->colors.size());
+      for (size_t i = 0; i < count; ++i)
+      {
+        if (this->colors[i] == _colors[i])
+          continue;
+        this->colors[i] = _colors[i];
+        this->dirtyFlags[i] |= DIRTY_COLOR;
+        this->dirty = true;
+      }
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceCustomParameter(unsigned int _index,
+        const math::Vector4d &_param)
+    {
+      if (!this->ValidIndex(_index))
+        return;
+      this->customParameters[_index] = _param;
+      this->MarkDirty(_index, DIRTY_CUSTOM_PARAMETER);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    math::Vector4d BaseInstanceBatch<T>::InstanceCustomParameter(
+        unsigned int _index) const
+    {
+      if (!this->ValidIndex(_index))
+        return math::Vector4d::Zero;
+      return this->customParameters[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceCustomParameters(
+        const std::vector<math::Vector4d> &_params)
+    {
+      size_t count = std::min(_params.size(), this->customParameters.size());
+      std::copy(_params.begin(), _params.begin() + count,
+          this->customParameters.begin());
+      for (size_t i = 0; i < count; ++i)
+        this->dirtyFlags[i] |= DIRTY_CUSTOM_PARAMETER;
+      this->dirty = this->dirty || count > 0u;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::SetInstanceVisible(unsigned int _index,
+        bool _visible)
+    {
+      if (!this->ValidIndex(_index))
+        return;
+      this->visibility[_index] = _visible;
+      this->MarkDirty(_index, DIRTY_VISIBILITY);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseInstanceBatch<T>::InstanceVisible(unsigned int _index) const
+    {
+      if (!this->ValidIndex(_index))
+        return false;
+      return this->visibility[_index];
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::PreRender()
+    {
+      T::PreRender();
+
+      if (!this->dirty)
+        return;
+
+      this->UpdateInstances();
+      std::fill(this->dirtyFlags.begin(), this->dirtyFlags.end(), 0u);
+      this->dirty = false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseInstanceBatch<T>::ValidIndex(unsigned int _index) const
+    {
+      if (_index < this->poses.size())
+        return true;
+
+      ignerr << "Instance index [" << _index << "] out of range, instance "
+             << "batch [" << this->Name() << "] has " << this->poses.size()
+             << " instances" << std::endl;
+      return false;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseInstanceBatch<T>::MarkDirty(unsigned int _index, uint8_t _flags)
+    {
+      this->dirtyFlags[_index] |= _flags;
+      this->dirty = true;
+    }
+    }
+  }
+}
+#endif
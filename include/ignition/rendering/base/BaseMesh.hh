@@ -17,9 +17,11 @@
 #ifndef IGNITION_RENDERING_BASE_BASEMESH_HH_
 #define IGNITION_RENDERING_BASE_BASEMESH_HH_
 
+#include <iterator>
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "ignition/rendering/Mesh.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/Storage.hh"
@@ -72,6 +74,21 @@ namespace ignition
       public: virtual void UpdateSkeletonAnimation(
             std::chrono::steady_clock::duration _time) override;
 
+      // Documentation inherited.
+      public: virtual unsigned int SkeletonBoneCount() const override;
+
+      // Documentation inherited.
+      public: virtual std::vector<std::string> SkeletonBoneNames() const
+            override;
+
+      // Documentation inherited.
+      public: virtual int SkeletonBoneIndex(const std::string &_name) const
+            override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneTransforms(
+            const std::vector<math::Matrix4d> &_tfs) override;
+
       public: virtual unsigned int SubMeshCount() const override;
 
       public: virtual bool HasSubMesh(ConstSubMeshPtr _subMesh) const override;
@@ -222,6 +239,52 @@ namespace ignition
     {
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    unsigned int BaseMesh<T>::SkeletonBoneCount() const
+    {
+      return static_cast<unsigned int>(this->SkeletonBoneNames().size());
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    std::vector<std::string> BaseMesh<T>::SkeletonBoneNames() const
+    {
+      // engines without native bone indices use the name order
+      std::vector<std::string> names;
+      for (auto const &it : this->SkeletonLocalTransforms())
+        names.push_back(it.first);
+      return names;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    int BaseMesh<T>::SkeletonBoneIndex(const std::string &_name) const
+    {
+      // engines with native bone indices override this with a cached lookup
+      auto tfs = this->SkeletonLocalTransforms();
+      auto it = tfs.find(_name);
+      if (it == tfs.end())
+        return -1;
+      return static_cast<int>(std::distance(tfs.begin(), it));
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseMesh<T>::SetSkeletonBoneTransforms(
+        const std::vector<math::Matrix4d> &_tfs)
+    {
+      // reuse the map of the current transforms, its keys are already in
+      // bone index order
+      std::map<std::string, math::Matrix4d> tfs =
+          this->SkeletonLocalTransforms();
+      auto it = tfs.begin();
+      for (unsigned int i = 0; i < _tfs.size() && it != tfs.end(); ++i, ++it)
+        it->second = _tfs[i];
+      tfs.erase(it, tfs.end());
+      this->SetSkeletonLocalTransforms(tfs);
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     unsigned int BaseMesh<T>::SubMeshCount() const
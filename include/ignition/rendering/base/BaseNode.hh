@@ -20,6 +20,7 @@
 #include <string>
 #include "ignition/rendering/Node.hh"
 #include "ignition/rendering/Storage.hh"
+#include "ignition/rendering/base/BaseScene.hh"
 #include "ignition/rendering/base/BaseStorage.hh"
 
 namespace ignition
@@ -185,6 +186,10 @@ namespace ignition
       protected: virtual void SetLocalScaleImpl(
                      const math::Vector3d &_scale) = 0;
 
+      /// \brief Tell the scene that this node changed in a way that
+      /// affects its rendering, see BaseScene::MarkChanged
+      protected: void MarkSceneChanged();
+
       protected: math::Vector3d origin;
     };
 
@@ -228,6 +233,7 @@ namespace ignition
       if (this->AttachChild(_child))
       {
         this->Children()->Add(_child);
+        this->MarkSceneChanged();
       }
     }
 
@@ -236,7 +242,11 @@ namespace ignition
     NodePtr BaseNode<T>::RemoveChild(NodePtr _child)
     {
       NodePtr child = this->Children()->Remove(_child);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->DetachChild(child);
+        this->MarkSceneChanged();
+      }
       return child;
     }
 
@@ -245,7 +255,11 @@ namespace ignition
     NodePtr BaseNode<T>::RemoveChildById(unsigned int _id)
     {
       NodePtr child = this->Children()->RemoveById(_id);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->DetachChild(child);
+        this->MarkSceneChanged();
+      }
       return child;
     }
 
@@ -254,7 +268,11 @@ namespace ignition
     NodePtr BaseNode<T>::RemoveChildByName(const std::string &_name)
     {
       NodePtr child = this->Children()->RemoveByName(_name);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->DetachChild(child);
+        this->MarkSceneChanged();
+      }
       return child;
     }
 
@@ -263,7 +281,11 @@ namespace ignition
     NodePtr BaseNode<T>::RemoveChildByIndex(unsigned int _index)
     {
       NodePtr child = this->Children()->RemoveByIndex(_index);
-      if (child) this->DetachChild(child);
+      if (child)
+      {
+        this->DetachChild(child);
+        this->MarkSceneChanged();
+      }
       return child;
     }
 
@@ -321,6 +343,7 @@ namespace ignition
       }
 
       this->SetRawLocalPose(pose);
+      this->MarkSceneChanged();
     }
 
     //////////////////////////////////////////////////
@@ -574,6 +597,15 @@ namespace ignition
 
 
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseNode<T>::MarkSceneChanged()
+    {
+      auto baseScene = std::dynamic_pointer_cast<BaseScene>(this->Scene());
+      if (baseScene)
+        baseScene->MarkChanged();
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseNode<T>::Destroy()
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_BASE_BASERANGENOISEPASS_HH_
+#define IGNITION_RENDERING_BASE_BASERANGENOISEPASS_HH_
+
+#include <algorithm>
+
+#include "ignition/rendering/RangeNoisePass.hh"
+#include "ignition/rendering/base/BaseGaussianNoisePass.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class BaseRangeNoisePass BaseRangeNoisePass.hh \
+     * ignition/rendering/base/BaseRangeNoisePass.hh
+     */
+    /// \brief Base range noise render pass.
+    template <class T>
+    class BaseRangeNoisePass :
+      public virtual RangeNoisePass,
+      public BaseGaussianNoisePass<T>
+    {
+      /// \brief Constructor
+      protected: BaseRangeNoisePass();
+
+      /// \brief Destructor
+      public: virtual ~BaseRangeNoisePass();
+
+      // Documentation inherited.
+      public: double Quantization() const override;
+
+      // Documentation inherited.
+      public: void SetQuantization(double _step) override;
+
+      // Documentation inherited.
+      public: double DropoutProbability() const override;
+
+      // Documentation inherited.
+      public: void SetDropoutProbability(double _probability) override;
+
+      /// \brief Range quantization step
+      protected: double quantization = 0.0;
+
+      /// \brief Probability that a ray is dropped
+      protected: double dropoutProbability = 0.0;
+    };
+
+    //////////////////////////////////////////////////
+    // BaseRangeNoisePass
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseRangeNoisePass<T>::BaseRangeNoisePass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    BaseRangeNoisePass<T>::~BaseRangeNoisePass()
+    {
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseRangeNoisePass<T>::Quantization() const
+    {
+      return this->quantization;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRangeNoisePass<T>::SetQuantization(double _step)
+    {
+      this->quantization = std::max(0.0, _step);
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    double BaseRangeNoisePass<T>::DropoutProbability() const
+    {
+      return this->dropoutProbability;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseRangeNoisePass<T>::SetDropoutProbability(double _probability)
+    {
+      this->dropoutProbability = std::min(std::max(_probability, 0.0), 1.0);
+    }
+    }
+  }
+}
+#endif
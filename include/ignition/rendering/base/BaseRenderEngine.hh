@@ -85,14 +85,32 @@ namespace ignition
 
       public: virtual void Destroy() override;
 
+      // Documentation Inherited
+      public: virtual void RenderScenes(const std::vector<ScenePtr> &_scenes)
+                  override;
+
       // Documentation Inherited
       public: virtual void AddResourcePath(const std::string &_path) override;
 
       // Documentation Inherited
       public: virtual RenderPassSystemPtr RenderPassSystem() const override;
 
+      // Documentation Inherited
+      public: virtual rendering::EngineResourceStats ResourceStats() const
+                  override;
+
       protected: virtual void PrepareScene(ScenePtr _scene);
 
+      /// \brief Called by RenderScenes before the sensors are rendered.
+      /// Render engines that can batch the work of several sensors start
+      /// collecting it here.
+      protected: virtual void BeginRenderBatch();
+
+      /// \brief Called by RenderScenes after all sensors were rendered and
+      /// before their results are published. Render engines that batch the
+      /// work of several sensors submit it here.
+      protected: virtual void EndRenderBatch();
+
       protected: virtual unsigned int NextSceneId();
 
       /// \brief Engine implementation of Load function.
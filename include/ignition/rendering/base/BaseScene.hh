@@ -18,6 +18,7 @@
 #define IGNITION_RENDERING_BASE_BASESCENE_HH_
 
 #include <array>
+#include <cstdint>
 #include <set>
 #include <string>
 
@@ -330,6 +331,21 @@ namespace ignition
       public: virtual GpuRaysPtr CreateGpuRays(const unsigned int _id,
                   const std::string &_name) override;
 
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray() override;
+
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  const unsigned int _id) override;
+
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray(
+                  const std::string &_name) override;
+
+      // Documentation inherited.
+      public: virtual CameraArrayPtr CreateCameraArray(const unsigned int _id,
+                  const std::string &_name) override;
+
       public: virtual VisualPtr CreateVisual() override;
 
       public: virtual VisualPtr CreateVisual(unsigned int _id) override;
@@ -457,6 +473,11 @@ namespace ignition
       // Documentation inherited.
       public: virtual ParticleEmitterPtr CreateParticleEmitter() override;
 
+      // Documentation inherited.
+      public: virtual InstanceBatchPtr CreateInstanceBatch(
+                  const MeshDescriptor &_desc, MaterialPtr _material,
+                  unsigned int _count) override;
+
       // Documentation inherited.
       public: virtual ParticleEmitterPtr CreateParticleEmitter(unsigned int _id)
                       override;
@@ -475,8 +496,35 @@ namespace ignition
       // Documentation inherited.
       public: virtual bool SkyEnabled() const override;
 
+      // Documentation inherited.
+      public: virtual void BakeStaticGeometry() override;
+
+      // Documentation inherited.
+      public: virtual void ClearStaticGeometry() override;
+
+      // Documentation inherited.
+      public: virtual unsigned int StaticGeometryBatchCount() const override;
+
       public: virtual void PreRender() override;
 
+      /// \internal
+      /// \brief Record a change to the scene that affects what it looks
+      /// like: a node pose, a visual's visibility or material, or nodes and
+      /// geometries being added or removed.
+      public: void MarkChanged();
+
+      /// \internal
+      /// \brief Get the scene change generation. It is incremented by
+      /// MarkChanged. Data derived from a render of the scene, such as the
+      /// id buffer of a camera, is still valid as long as the generation is
+      /// unchanged.
+      /// \return Scene change generation
+      public: uint64_t ChangeGeneration() const;
+
+      // Documentation inherited.
+      public: virtual rendering::ResourceStats ResourceStats() const
+                  override;
+
       public: virtual void Clear() override;
 
       public: virtual void Destroy() override;
@@ -529,6 +577,17 @@ namespace ignition
                    return GpuRaysPtr();
                  }
 
+      /// \brief Implementation for creating a camera array.
+      /// \param[in] _id Unique id
+      /// \param[in] _name Name of the camera array
+      protected: virtual CameraArrayPtr CreateCameraArrayImpl(
+                     unsigned int /*_id*/, const std::string & /*_name*/)
+                 {
+                   ignerr << "CameraArray not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return CameraArrayPtr();
+                 }
+
       protected: virtual VisualPtr CreateVisualImpl(unsigned int _id,
                      const std::string &_name) = 0;
 
@@ -648,6 +707,22 @@ namespace ignition
                    return ParticleEmitterPtr();
                  }
 
+      /// \brief Implementation for creating an instance batch.
+      /// \param[in] _id Unique id.
+      /// \param[in] _name Name of the instance batch.
+      /// \param[in] _desc Descriptor of the mesh to instance
+      /// \param[in] _material Material shared by the instances
+      /// \param[in] _count Number of instances
+      /// \return Pointer to the created instance batch.
+      protected: virtual InstanceBatchPtr CreateInstanceBatchImpl(
+                     unsigned int, const std::string &,
+                     const MeshDescriptor &, MaterialPtr, unsigned int)
+                 {
+                   ignerr << "InstanceBatch not supported by: "
+                          << this->Engine()->Name() << std::endl;
+                   return InstanceBatchPtr();
+                 }
+
       protected: virtual LightStorePtr Lights() const = 0;
 
       protected: virtual SensorStorePtr Sensors() const = 0;
@@ -707,6 +782,9 @@ namespace ignition
 
       private: unsigned int nextObjectId;
 
+      /// \brief Scene change generation
+      private: uint64_t changeGeneration = 0u;
+
       IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
       private: NodeStorePtr nodes;
       IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
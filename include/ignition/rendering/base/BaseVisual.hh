@@ -115,6 +115,12 @@ namespace ignition
       public: virtual ignition::math::AxisAlignedBox LocalBoundingBox()
               const override;
 
+      // Documentation inherited.
+      public: virtual void SetStatic(bool _static) override;
+
+      // Documentation inherited.
+      public: virtual bool Static() const override;
+
       protected: virtual void PreRenderChildren() override;
 
       protected: virtual void PreRenderGeometries();
@@ -125,6 +131,16 @@ namespace ignition
 
       protected: virtual bool DetachGeometry(GeometryPtr _geometry) = 0;
 
+      // Documentation inherited
+      protected: virtual void SetLocalScaleImpl(
+                     const math::Vector3d &_scale) override;
+
+      /// \brief Remove the visual from the baked static geometry. This is
+      /// called whenever a baked visual is modified. Render engines that
+      /// support static geometry baking restore the geometries of the visual
+      /// and rebuild the baked geometry without it.
+      protected: virtual void UnbakeStatic();
+
       /// \brief Pointer to material assigned to this visual
       protected: MaterialPtr material;
 
@@ -136,6 +152,13 @@ namespace ignition
 
       /// \brief The bounding box of the visual
       protected: ignition::math::AxisAlignedBox boundingBox;
+
+      /// \brief True if the visual is static
+      protected: bool isStatic = false;
+
+      /// \brief True if the geometries of the visual are merged into baked
+      /// static geometry
+      protected: bool staticBaked = false;
     };
 
     //////////////////////////////////////////////////
@@ -175,9 +198,18 @@ namespace ignition
         return;
       }
 
+      this->UnbakeStatic();
       this->SetRawLocalPose(rawPose);
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVisual<T>::SetLocalScaleImpl(const math::Vector3d &_scale)
+    {
+      this->UnbakeStatic();
+      T::SetLocalScaleImpl(_scale);
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     unsigned int BaseVisual<T>::GeometryCount() const
@@ -203,9 +235,11 @@ namespace ignition
     template <class T>
     void BaseVisual<T>::AddGeometry(GeometryPtr _geometry)
     {
+      this->UnbakeStatic();
       if (this->AttachGeometry(_geometry))
       {
         this->Geometries()->Add(_geometry);
+        this->MarkSceneChanged();
       }
     }
 
@@ -213,9 +247,11 @@ namespace ignition
     template <class T>
     GeometryPtr BaseVisual<T>::RemoveGeometry(GeometryPtr _geometry)
     {
+      this->UnbakeStatic();
       if (this->DetachGeometry(_geometry))
       {
         this->Geometries()->Remove(_geometry);
+        this->MarkSceneChanged();
       }
       return _geometry;
     }
@@ -253,6 +289,7 @@ namespace ignition
       this->SetChildMaterial(_material, false);
       this->SetGeometryMaterial(_material, false);
       this->material = _material;
+      this->MarkSceneChanged();
     }
 
     //////////////////////////////////////////////////
@@ -282,6 +319,7 @@ namespace ignition
     template <class T>
     void BaseVisual<T>::SetGeometryMaterial(MaterialPtr _material, bool _unique)
     {
+      this->UnbakeStatic();
       unsigned int count = this->GeometryCount();
       _material = (_unique && count > 0) ? _material->Clone() : _material;
 
@@ -305,13 +343,17 @@ namespace ignition
     {
       T::PreRender();
       this->PreRenderChildren();
-      this->PreRenderGeometries();
+
+      // baked geometries are not rendered individually
+      if (!this->staticBaked)
+        this->PreRenderGeometries();
     }
 
     //////////////////////////////////////////////////
     template <class T>
     void BaseVisual<T>::Destroy()
     {
+      this->UnbakeStatic();
       this->Geometries()->DestroyAll();
       this->Children()->RemoveAll();
       this->material.reset();
@@ -430,6 +472,11 @@ namespace ignition
     template <class T>
     void BaseVisual<T>::SetVisibilityFlags(uint32_t _flags)
     {
+      if (_flags != this->visibilityFlags)
+      {
+        this->UnbakeStatic();
+        this->MarkSceneChanged();
+      }
       this->visibilityFlags = _flags;
 
       // recursively set child visuals' visibility flags
@@ -457,6 +504,29 @@ namespace ignition
       return this->visibilityFlags;
     }
 
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVisual<T>::SetStatic(bool _static)
+    {
+      if (!_static)
+        this->UnbakeStatic();
+      this->isStatic = _static;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    bool BaseVisual<T>::Static() const
+    {
+      return this->isStatic;
+    }
+
+    //////////////////////////////////////////////////
+    template <class T>
+    void BaseVisual<T>::UnbakeStatic()
+    {
+      this->staticBaked = false;
+    }
+
     //////////////////////////////////////////////////
     template <class T>
     void BaseVisual<T>::SetUserData(const std::string &_key, Variant _value)
@@ -18,6 +18,7 @@
 #define IGNITION_RENDERING_OGRE_OGRECAMERA_HH_
 
 #include <string>
+#include <vector>
 
 #include "ignition/rendering/base/BaseCamera.hh"
 #include "ignition/rendering/ogre/OgreRenderTypes.hh"
@@ -109,6 +110,11 @@ namespace ignition
 
       protected: virtual void Init() override;
 
+      // Documentation inherited.
+      protected: virtual bool RenderIds(unsigned int _width,
+                     unsigned int _height, std::vector<unsigned int> &_ids)
+                     override;
+
       protected: virtual void SetSelectionBuffer();
 
       private: void CreateCamera();
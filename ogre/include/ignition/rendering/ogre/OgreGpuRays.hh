@@ -90,6 +90,10 @@ namespace ignition
                   unsigned int _height, unsigned int _channels,
                   const std::string &_format)> _subscriber) override;
 
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewGpuRaysData(
+                  NewFrameListener _subscriber) override;
+
       // Documentation inherited.
       public: virtual RenderTargetPtr RenderTarget() const override;
 
@@ -134,6 +138,11 @@ namespace ignition
       /// \brief Create the texture which is used to render gpu rays data.
       private: virtual void CreateGpuRaysTextures();
 
+      /// \brief Create the second pass texture in the pixel format of the
+      /// data format. Destroys the previous second pass texture and the
+      /// buffers holding the range data.
+      private: void Create2ndPassTexture();
+
       /// \brief Builds scaled Orthogonal Matrix from parameters.
       /// \param[in] _left Left clip.
       /// \param[in] _right Right clip.
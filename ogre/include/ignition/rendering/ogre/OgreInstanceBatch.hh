@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE_OGREINSTANCEBATCH_HH_
+#define IGNITION_RENDERING_OGRE_OGREINSTANCEBATCH_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseInstanceBatch.hh"
+#include "ignition/rendering/ogre/OgreObject.hh"
+#include "ignition/rendering/ogre/OgreRenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class OgreInstanceBatchPrivate;
+
+    /// \brief Ogre implementation of the instance batch class based on
+    /// Ogre::InstanceManager with hardware instancing. Each sub-mesh is
+    /// drawn with one draw call for all instances. Instance colours and
+    /// custom parameters are passed to the instancing shader as instance
+    /// data. The shader uses the diffuse, ambient and emissive colours and
+    /// the texture of the batch material, or of the mesh materials if the
+    /// batch has none, lights the instances with the four closest lights
+    /// and does not receive shadows.
+    class IGNITION_RENDERING_OGRE_VISIBLE OgreInstanceBatch :
+      public BaseInstanceBatch<OgreObject>
+    {
+      /// \brief Constructor
+      protected: OgreInstanceBatch();
+
+      /// \brief Destructor
+      public: virtual ~OgreInstanceBatch();
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      // Documentation inherited.
+      public: virtual void PreRender() override;
+
+      /// \brief Index of the instance data that holds the instance custom
+      /// parameter. It is stored in the texture coordinate that follows the
+      /// instance colour.
+      public: static constexpr unsigned int kCustomParameterIndex = 1u;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      // Documentation inherited.
+      protected: virtual void UpdateInstances() override;
+
+      /// \brief Copy the colours and texture of the batch or mesh materials
+      /// to the instancing materials
+      private: void UpdateMaterials();
+
+      /// \brief Mesh factory used to load the instanced mesh
+      private: OgreMeshFactoryPtr meshFactory;
+
+      /// \brief Pointer to private data
+      private: std::unique_ptr<OgreInstanceBatchPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create instance batches
+      private: friend class OgreScene;
+    };
+    }
+  }
+}
+#endif
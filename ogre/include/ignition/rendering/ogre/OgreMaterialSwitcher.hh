@@ -62,6 +62,12 @@ namespace ignition
       public: std::string EntityName(
               const ignition::math::Color &_color) const;
 
+      /// \brief Get the id of the visual with a specific color
+      /// \param[in] _color The entity's color.
+      /// \return Visual id, 0 if no visual has the color
+      public: unsigned int VisualId(
+              const ignition::math::Color &_color) const;
+
       /// \brief Reset the color value incrementor
       public: void Reset();
 
@@ -105,6 +111,10 @@ namespace ignition
       /// renderable name
       IGN_COMMON_WARN_IGNORE__DLL_INTERFACE_MISSING
       private: std::map<unsigned int, std::string> colorDict;
+
+      /// \brief Color dictionary that maps the unique color value to the id
+      /// of the visual the renderable belongs to
+      private: std::map<unsigned int, unsigned int> colorIds;
       IGN_COMMON_WARN_RESUME__DLL_INTERFACE_MISSING
 
       /// \brief Increment unique color value that will be assigned to the
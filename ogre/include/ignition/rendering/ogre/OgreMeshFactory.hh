@@ -57,6 +57,9 @@ namespace ignition
       protected: virtual bool Validate(const MeshDescriptor &_desc);
 
       protected: OgreScenePtr scene;
+
+      /// \brief Make instance batch our friend so it can load ogre meshes
+      private: friend class OgreInstanceBatch;
     };
 
     class IGNITION_RENDERING_OGRE_VISIBLE OgreSubMeshStoreFactory
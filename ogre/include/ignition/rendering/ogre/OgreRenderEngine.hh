@@ -100,6 +100,10 @@ namespace ignition
 
       public: void AddResourcePath(const std::string &_uri) override;
 
+      // Documentation Inherited.
+      public: virtual rendering::EngineResourceStats ResourceStats() const
+                  override;
+
       public: virtual Ogre::Root *OgreRoot() const;
 
       public: std::string CreateRenderWindow(const std::string &_handle,
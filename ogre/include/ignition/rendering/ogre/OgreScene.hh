@@ -18,7 +18,9 @@
 #define IGNITION_RENDERING_OGRE_OGRESCENE_HH_
 
 #include <array>
+#include <memory>
 #include <string>
+#include <vector>
 #include "ignition/rendering/base/BaseScene.hh"
 #include "ignition/rendering/ogre/Export.hh"
 #include "ignition/rendering/ogre/OgreRenderTypes.hh"
@@ -28,6 +30,7 @@ namespace Ogre
 {
   class Root;
   class SceneManager;
+  class StaticGeometry;
 }
 
 namespace ignition
@@ -63,8 +66,29 @@ namespace ignition
       // Documentation inherited.
       public: virtual void RemoveGradientBackgroundColor() override;
 
+      // Documentation inherited
+      public: virtual void BakeStaticGeometry() override;
+
+      // Documentation inherited
+      public: virtual void ClearStaticGeometry() override;
+
+      // Documentation inherited
+      public: virtual unsigned int StaticGeometryBatchCount() const override;
+
+      /// \cond PRIVATE
+      /// \internal
+      /// \brief Mark the baked static geometry out of date. This is called
+      /// by baked visuals when they are modified. The static geometry is
+      /// rebuilt without them in the next PreRender call.
+      public: void SetStaticGeometryDirty();
+      /// \endcond
+
       public: virtual void PreRender() override;
 
+      // Documentation inherited.
+      public: virtual rendering::ResourceStats ResourceStats() const
+                  override;
+
       public: virtual void Clear() override;
 
       public: virtual void Destroy() override;
@@ -189,6 +213,12 @@ namespace ignition
       protected: virtual ParticleEmitterPtr CreateParticleEmitterImpl(
                      unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual InstanceBatchPtr CreateInstanceBatchImpl(
+                     unsigned int _id, const std::string &_name,
+                     const MeshDescriptor &_desc, MaterialPtr _material,
+                     unsigned int _count) override;
+
       protected: virtual bool InitObject(OgreObjectPtr _object,
                      unsigned int _id, const std::string &_name);
 
@@ -210,6 +240,25 @@ namespace ignition
 
       private: OgreScenePtr SharedThis();
 
+      /// \brief Destroy all instance batches that are still alive
+      private: void DestroyInstanceBatches();
+
+      /// \brief Add the geometries of a static visual to the static geometry
+      /// \param[in] _visual Static visual
+      /// \return True if the visual was baked, false if any of its
+      /// geometries can not be merged
+      private: bool BakeStaticVisual(OgreVisualPtr _visual);
+
+      /// \brief Create the static geometry and bake the given visuals
+      /// into it
+      /// \param[in] _visuals Static visuals to bake
+      private: void BuildStaticGeometry(
+                   const std::vector<OgreVisualPtr> &_visuals);
+
+      /// \brief Rebuild the static geometry from the visuals that are still
+      /// baked
+      private: void RebuildStaticGeometry();
+
       protected: OgreVisualPtr rootVisual;
 
       protected: OgreMeshFactoryPtr meshFactory;
@@ -226,6 +275,20 @@ namespace ignition
 
       protected: Ogre::SceneManager *ogreSceneManager;
 
+      /// \brief Instance batches created by this scene. The batches are
+      /// owned by the user and are not part of the scene graph.
+      protected: std::vector<std::weak_ptr<OgreInstanceBatch>> instanceBatches;
+
+      /// \brief Ogre static geometry that holds the baked static visuals
+      protected: Ogre::StaticGeometry *staticGeometry = nullptr;
+
+      /// \brief Visuals whose geometries are merged into the static geometry
+      protected: std::vector<std::weak_ptr<OgreVisual>> bakedVisuals;
+
+      /// \brief True if a baked visual was modified and the static geometry
+      /// needs to be rebuilt
+      protected: bool staticGeometryDirty = false;
+
       private: friend class OgreRenderEngine;
     };
     }
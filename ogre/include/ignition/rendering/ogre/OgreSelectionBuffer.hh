@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "ignition/rendering/config.hh"
 #include "ignition/rendering/ogre/Export.hh"
@@ -62,6 +63,17 @@ namespace ignition
       /// \return Returns the Ogre entity at the coordinate.
       public: Ogre::Entity *OnSelectionClick(const int _x, const int _y);
 
+      /// \brief Render the selection buffer over the full view of the
+      /// camera and get the visual at each pixel. The buffer is kept
+      /// between calls of the same size.
+      /// \param[in] _width Width of the buffer in pixels
+      /// \param[in] _height Height of the buffer in pixels
+      /// \param[out] _ids Visual id of each pixel, row by row from the top
+      /// left, 0 where there is no visual
+      /// \return True on success
+      public: bool RenderIds(unsigned int _width, unsigned int _height,
+                  std::vector<unsigned int> &_ids);
+
       /// \brief Debug show overlay
       /// \param[in] _show True to show the selection buffer in an overlay.
       public: void ShowOverlay(const bool _show);
@@ -75,6 +87,15 @@ namespace ignition
       /// \brief Create the render texture
       private: void CreateRTTBuffer();
 
+      /// \brief Create the full view render texture used by RenderIds
+      /// \param[in] _width Width in pixels
+      /// \param[in] _height Height in pixels
+      /// \return True on success
+      private: bool CreateIdBuffer(unsigned int _width, unsigned int _height);
+
+      /// \brief Delete the full view render texture
+      private: void DeleteIdBuffer();
+
       /// \brief Create the selection buffer offscreen render texture.
       private: void CreateRTTOverlays();
 
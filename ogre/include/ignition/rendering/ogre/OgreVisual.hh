@@ -76,9 +76,17 @@ namespace ignition
       // Documentation inherited.
       protected: virtual bool DetachGeometry(GeometryPtr _geometry) override;
 
+      // Documentation inherited.
+      protected: virtual void UnbakeStatic() override;
+
       // Documentation inherited.
       protected: virtual void Init() override;
 
+      /// \brief Hide the geometries of the visual while they are part of
+      /// the baked static geometry, or show them again.
+      /// \param[in] _baked True if the geometries are baked
+      private: void SetGeometriesBaked(bool _baked);
+
       protected: OgreGeometryStorePtr geometries;
 
       private: OgreVisualPtr SharedThis();
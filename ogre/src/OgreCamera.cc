@@ -15,6 +15,8 @@
  *
  */
 
+#include <chrono>
+
 #include "ignition/rendering/ogre/OgreCamera.hh"
 #include "ignition/rendering/ogre/OgreConversions.hh"
 #include "ignition/rendering/ogre/OgreIncludes.hh"
@@ -22,6 +24,7 @@
 #include "ignition/rendering/ogre/OgreRenderTarget.hh"
 #include "ignition/rendering/ogre/OgreScene.hh"
 #include "ignition/rendering/ogre/OgreSelectionBuffer.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/Utils.hh"
 
 using namespace ignition;
@@ -122,7 +125,22 @@ void OgreCamera::SetMaterial(const MaterialPtr &_material)
 //////////////////////////////////////////////////
 void OgreCamera::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreCamera::Render");
+  auto start = std::chrono::steady_clock::now();
   this->renderTexture->Render();
+  this->renderStats.cpuTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  // the statistics of a render target are reset by each update
+  Ogre::RenderTarget *target = this->renderTexture->RenderTarget();
+  if (target)
+  {
+    const Ogre::RenderTarget::FrameStats &frameStats =
+        target->getStatistics();
+    this->renderStats.drawCalls =
+        static_cast<unsigned int>(frameStats.batchCount);
+    this->renderStats.triangles = frameStats.triangleCount;
+  }
 }
 
 //////////////////////////////////////////////////
@@ -206,6 +224,21 @@ void OgreCamera::SetSelectionBuffer()
       this->scene->OgreSceneManager());
 }
 
+//////////////////////////////////////////////////
+bool OgreCamera::RenderIds(unsigned int _width, unsigned int _height,
+    std::vector<unsigned int> &_ids)
+{
+  if (!this->selectionBuffer)
+  {
+    this->SetSelectionBuffer();
+
+    if (!this->selectionBuffer)
+      return false;
+  }
+
+  return this->selectionBuffer->RenderIds(_width, _height, _ids);
+}
+
 //////////////////////////////////////////////////
 VisualPtr OgreCamera::VisualAt(const ignition::math::Vector2i
     &_mousePos)
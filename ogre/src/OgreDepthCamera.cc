@@ -23,6 +23,7 @@
   #include <windows.h>
 #endif
 #include <ignition/math/Helpers.hh>
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre/OgreDepthCamera.hh"
 #include "ignition/rendering/ogre/OgreMaterial.hh"
 
@@ -256,6 +257,7 @@ void OgreDepthCamera::CreateDepthTexture()
 //////////////////////////////////////////////////
 void OgreDepthCamera::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreDepthCamera::PreRender");
   if (!this->depthTexture)
     this->CreateDepthTexture();
   if (!this->dataPtr->pcdTexture || !this->dataPtr->colorTexture)
@@ -265,6 +267,7 @@ void OgreDepthCamera::PreRender()
 //////////////////////////////////////////////////
 void OgreDepthCamera::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreDepthCamera::Render");
   Ogre::SceneManager *sceneMgr = this->scene->OgreSceneManager();
   Ogre::ShadowTechnique shadowTech = sceneMgr->getShadowTechnique();
 
@@ -368,6 +371,7 @@ void OgreDepthCamera::UpdateRenderTarget(OgreRenderTexturePtr _target,
 //////////////////////////////////////////////////
 void OgreDepthCamera::PostRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreDepthCamera::PostRender");
   unsigned int width = this->ImageWidth();
   unsigned int height = this->ImageHeight();
   unsigned int len = width * height;
@@ -479,15 +483,21 @@ void OgreDepthCamera::PostRender()
     }
   }
 
-  this->dataPtr->newDepthFrame(
-      this->dataPtr->depthBuffer, width, height, 1, "FLOAT32");
+  {
+    IGN_RENDERING_TRACE_ZONE("OgreDepthCamera::NewDepthFrame");
+    this->dataPtr->newDepthFrame(
+        this->dataPtr->depthBuffer, width, height, 1, "FLOAT32");
+  }
 
   // point cloud
   if (this->dataPtr->outputPoints)
   {
-    this->dataPtr->newRgbPointCloud(
-        this->dataPtr->pcdBuffer, width, height, channelCount,
-        "PF_FLOAT32_RGBA");
+    {
+      IGN_RENDERING_TRACE_ZONE("OgreDepthCamera::NewRgbPointCloud");
+      this->dataPtr->newRgbPointCloud(
+          this->dataPtr->pcdBuffer, width, height, channelCount,
+          "PF_FLOAT32_RGBA");
+    }
 
     // Uncomment to debug xyz output
     // igndbg << "wxh: " << width << " x " << height << std::endl;
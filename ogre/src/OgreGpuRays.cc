@@ -15,6 +15,8 @@
  *
 */
 
+#include <cstdint>
+
 #include <ignition/common/Mesh.hh>
 #include <ignition/common/MeshManager.hh>
 #include <ignition/common/SubMesh.hh>
@@ -24,6 +26,7 @@
 #include <ignition/math/Vector3.hh>
 
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre/OgreCamera.hh"
 #include "ignition/rendering/ogre/OgreGpuRays.hh"
 
@@ -41,12 +44,27 @@ class ignition::rendering::OgreGpuRaysPrivate
                unsigned int, unsigned int, unsigned int,
                const std::string &)> newGpuRaysFrame;
 
-  /// \brief Raw buffer of gpu rays data.
-  public: float *gpuRaysBuffer = nullptr;
+  /// \brief Event triggered when new gpu rays data are available, in any
+  /// data format.
+  /// \param[in] _data New data in the layout of the data format.
+  /// \param[in] _width Width of frame.
+  /// \param[in] _height Height of frame.
+  /// \param[in] _channels Number of channels
+  /// \param[in] _format Format string of the data format.
+  public: ignition::common::EventT<void(const void *,
+               unsigned int, unsigned int, unsigned int,
+               const std::string &)> newGpuRaysData;
+
+  /// \brief Buffer of gpu rays data for the data formats that do not store
+  /// floats only, used by newGpuRaysData event.
+  public: unsigned char *gpuRaysBuffer = nullptr;
 
   /// \brief Outgoing gpu rays data, used by newGpuRaysFrame event.
   public: float *gpuRaysScan = nullptr;
 
+  /// \brief Data format the second pass texture was created with
+  public: GpuRaysDataFormat secondPassFormat = GRDF_RANGE_RETRO;
+
   /// \brief Pointer to Ogre material for the first rendering pass.
   public: Ogre::Material *matFirstPass = nullptr;
 
@@ -438,32 +456,7 @@ void OgreGpuRays::CreateGpuRaysTextures()
   this->dataPtr->matFirstPass->setCullingMode(Ogre::CULL_NONE);
 
   // Configure second pass texture
-  this->dataPtr->secondPassTexture =
-      Ogre::TextureManager::getSingleton().createManual(
-      this->Name() + "_second_pass",
-      "General",
-      Ogre::TEX_TYPE_2D,
-      this->dataPtr->w2nd, this->dataPtr->h2nd, 0,
-      Ogre::PF_FLOAT32_RGB,
-#if OGRE_VERSION_LT_1_10_1
-      Ogre::TU_RENDERTARGET).getPointer();
-#else
-      Ogre::TU_RENDERTARGET).get();
-#endif
-
-  Ogre::RenderTarget *rt =
-      this->dataPtr->secondPassTexture->getBuffer()->getRenderTarget();
-  rt->setAutoUpdated(false);
-
-  // Setup the viewport to use the texture
-  Ogre::Viewport *vp = rt->addViewport(this->dataPtr->orthoCam);
-  vp->setClearEveryFrame(true);
-  vp->setOverlaysEnabled(false);
-  vp->setShadowsEnabled(false);
-  vp->setSkiesEnabled(false);
-  vp->setBackgroundColour(Ogre::ColourValue(0.0, 1.0, 0.0));
-  vp->setVisibilityMask(
-      IGN_VISIBILITY_ALL & ~(IGN_VISIBILITY_GUI | IGN_VISIBILITY_SELECTABLE));
+  this->Create2ndPassTexture();
 
   Ogre::Matrix4 p = this->BuildScaledOrthoMatrix(
       0, static_cast<float>(this->dataPtr->w2nd / 10.0),
@@ -507,6 +500,76 @@ void OgreGpuRays::CreateGpuRaysTextures()
   this->CreateCanvas();
 }
 
+/////////////////////////////////////////////////
+void OgreGpuRays::Create2ndPassTexture()
+{
+  if (this->dataPtr->gpuRaysBuffer)
+  {
+    delete [] this->dataPtr->gpuRaysBuffer;
+    this->dataPtr->gpuRaysBuffer = nullptr;
+  }
+
+  if (this->dataPtr->gpuRaysScan)
+  {
+    delete [] this->dataPtr->gpuRaysScan;
+    this->dataPtr->gpuRaysScan = nullptr;
+  }
+
+  if (this->dataPtr->secondPassTexture)
+  {
+    Ogre::TextureManager::getSingleton().remove(
+        this->dataPtr->secondPassTexture->getName());
+    this->dataPtr->secondPassTexture = nullptr;
+  }
+
+  // The pixel format matches the layout of the data format so that only the
+  // requested data is copied from the gpu, see PostRender
+  this->dataPtr->secondPassFormat = this->dataFormat;
+  Ogre::PixelFormat format = Ogre::PF_FLOAT32_RGB;
+  switch (this->dataPtr->secondPassFormat)
+  {
+    case GRDF_RANGE:
+    case GRDF_RANGE_U16_MM:
+      // millimeters are converted to uint16 on the cpu, 16 bit integer
+      // render targets are not widely supported by the GL render system
+      format = Ogre::PF_FLOAT32_R;
+      break;
+    case GRDF_RANGE_INTENSITY_U8:
+      format = Ogre::PF_FLOAT32_GR;
+      break;
+    case GRDF_RANGE_RETRO:
+    default:
+      break;
+  }
+
+  this->dataPtr->secondPassTexture =
+      Ogre::TextureManager::getSingleton().createManual(
+      this->Name() + "_second_pass",
+      "General",
+      Ogre::TEX_TYPE_2D,
+      this->dataPtr->w2nd, this->dataPtr->h2nd, 0,
+      format,
+#if OGRE_VERSION_LT_1_10_1
+      Ogre::TU_RENDERTARGET).getPointer();
+#else
+      Ogre::TU_RENDERTARGET).get();
+#endif
+
+  Ogre::RenderTarget *rt =
+      this->dataPtr->secondPassTexture->getBuffer()->getRenderTarget();
+  rt->setAutoUpdated(false);
+
+  // Setup the viewport to use the texture
+  Ogre::Viewport *vp = rt->addViewport(this->dataPtr->orthoCam);
+  vp->setClearEveryFrame(true);
+  vp->setOverlaysEnabled(false);
+  vp->setShadowsEnabled(false);
+  vp->setSkiesEnabled(false);
+  vp->setBackgroundColour(Ogre::ColourValue(0.0, 1.0, 0.0));
+  vp->setVisibilityMask(
+      IGN_VISIBILITY_ALL & ~(IGN_VISIBILITY_GUI | IGN_VISIBILITY_SELECTABLE));
+}
+
 /////////////////////////////////////////////////
 void OgreGpuRays::UpdateRenderTarget(Ogre::RenderTarget *_target,
                    Ogre::Material *_material, Ogre::Camera *_cam,
@@ -553,6 +616,8 @@ void OgreGpuRays::UpdateRenderTarget(Ogre::RenderTarget *_target,
         pass->getFragmentProgramParameters()->setNamedConstant("tex3",
           this->dataPtr->texIdx[2]);
     }
+    pass->getFragmentProgramParameters()->setNamedConstant("dataFormat",
+        static_cast<int>(this->dataPtr->secondPassFormat));
   }
 
   // NOTE: We MUST bind parameters AFTER updating the autos
@@ -580,6 +645,7 @@ void OgreGpuRays::UpdateRenderTarget(Ogre::RenderTarget *_target,
 //////////////////////////////////////////////////
 void OgreGpuRays::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreGpuRays::Render");
   Ogre::SceneManager *sceneMgr = this->scene->OgreSceneManager();
 
   sceneMgr->_suppressRenderStateChanges(true);
@@ -623,13 +689,17 @@ void OgreGpuRays::Render()
 //////////////////////////////////////////////////
 void OgreGpuRays::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreGpuRays::PreRender");
   if (this->dataPtr->textureCount == 0)
     this->CreateGpuRaysTextures();
+  else if (this->dataPtr->secondPassFormat != this->dataFormat)
+    this->Create2ndPassTexture();
 }
 
 //////////////////////////////////////////////////
 void OgreGpuRays::PostRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreGpuRays::PostRender");
   for (unsigned int i = 0; i < this->dataPtr->textureCount; ++i)
   {
     auto rt =
@@ -642,51 +712,105 @@ void OgreGpuRays::PostRender()
   const Ogre::Viewport *secondPassViewport = rt->getViewport(0);
   unsigned int width = secondPassViewport->getActualWidth();
   unsigned int height = secondPassViewport->getActualHeight();
+  unsigned int count = width * height;
 
-  size_t size = Ogre::PixelUtil::getMemorySize(
-    width, height, 1, Ogre::PF_FLOAT32_RGB);
-  int len = width * height * this->Channels();
+  // read back in the requested format, ogre converts the data if the
+  // render system had to pick a different format for the texture
+  Ogre::PixelFormat format = Ogre::PF_FLOAT32_R;
+  if (this->dataPtr->secondPassFormat == GRDF_RANGE_RETRO)
+    format = Ogre::PF_FLOAT32_RGB;
+  else if (this->dataPtr->secondPassFormat == GRDF_RANGE_INTENSITY_U8)
+    format = Ogre::PF_FLOAT32_GR;
 
-  if (!this->dataPtr->gpuRaysBuffer)
+  size_t size = Ogre::PixelUtil::getMemorySize(width, height, 1, format);
+
+  if (!this->dataPtr->gpuRaysScan)
   {
-    this->dataPtr->gpuRaysBuffer = new float[len];
+    this->dataPtr->gpuRaysScan = new float[size / sizeof(float)];
   }
 
   Ogre::PixelBox dstBox(width, height,
-        1, Ogre::PF_FLOAT32_RGB, this->dataPtr->gpuRaysBuffer);
+        1, format, this->dataPtr->gpuRaysScan);
 
   auto pixelBuffer = this->dataPtr->secondPassTexture->getBuffer();
   pixelBuffer->blitToMemory(dstBox);
 
-  if (!this->dataPtr->gpuRaysScan)
+  std::string formatStr = this->DataFormatString();
+  if (this->dataPtr->secondPassFormat == GRDF_RANGE_INTENSITY_U8)
   {
-    this->dataPtr->gpuRaysScan = new float[len];
+    // ranges of all readings followed by the intensities of all readings
+    if (!this->dataPtr->gpuRaysBuffer)
+    {
+      this->dataPtr->gpuRaysBuffer =
+          new unsigned char[count * (sizeof(float) + 1u)];
+    }
+    float *ranges = reinterpret_cast<float *>(this->dataPtr->gpuRaysBuffer);
+    unsigned char *intensities =
+        this->dataPtr->gpuRaysBuffer + count * sizeof(float);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      ranges[i] = this->dataPtr->gpuRaysScan[i * 2];
+      intensities[i] =
+          static_cast<unsigned char>(this->dataPtr->gpuRaysScan[i * 2 + 1]);
+    }
+    IGN_RENDERING_TRACE_ZONE("OgreGpuRays::NewGpuRaysData");
+    this->dataPtr->newGpuRaysData(this->dataPtr->gpuRaysBuffer,
+        width, height, this->Channels(), formatStr);
+  }
+  else if (this->dataPtr->secondPassFormat == GRDF_RANGE_U16_MM)
+  {
+    // the shader already rounded and clamped the millimeters
+    if (!this->dataPtr->gpuRaysBuffer)
+    {
+      this->dataPtr->gpuRaysBuffer =
+          new unsigned char[count * sizeof(uint16_t)];
+    }
+    uint16_t *mm = reinterpret_cast<uint16_t *>(this->dataPtr->gpuRaysBuffer);
+    for (unsigned int i = 0; i < count; ++i)
+      mm[i] = static_cast<uint16_t>(this->dataPtr->gpuRaysScan[i]);
+    IGN_RENDERING_TRACE_ZONE("OgreGpuRays::NewGpuRaysData");
+    this->dataPtr->newGpuRaysData(this->dataPtr->gpuRaysBuffer,
+        width, height, this->Channels(), formatStr);
+  }
+  else
+  {
+    IGN_RENDERING_TRACE_ZONE("OgreGpuRays::NewGpuRaysFrame");
+    this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
+        width, height, this->Channels(), formatStr);
+    this->dataPtr->newGpuRaysData(this->dataPtr->gpuRaysScan,
+        width, height, this->Channels(), formatStr);
   }
-
-  memcpy(this->dataPtr->gpuRaysScan, this->dataPtr->gpuRaysBuffer, size);
-
-  this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
-      width, height, this->Channels(), "PF_FLOAT32_RGB");
 }
 
 //////////////////////////////////////////////////
 const float* OgreGpuRays::Data() const
 {
+  if (this->dataPtr->secondPassFormat != GRDF_RANGE_RETRO &&
+      this->dataPtr->secondPassFormat != GRDF_RANGE)
+  {
+    return nullptr;
+  }
   return this->dataPtr->gpuRaysScan;
 }
 
 //////////////////////////////////////////////////
 void OgreGpuRays::Copy(float *_dataDest)
 {
+  const float *data = this->Data();
+  if (!data)
+    return;
+
   auto rt = this->dataPtr->secondPassTexture->getBuffer()->getRenderTarget();
   const Ogre::Viewport *secondPassViewport = rt->getViewport(0);
   unsigned int width = secondPassViewport->getActualWidth();
   unsigned int height = secondPassViewport->getActualHeight();
 
-  size_t size = Ogre::PixelUtil::getMemorySize(
-    width, height, 1, Ogre::PF_FLOAT32_RGB);
+  // the scan holds the channels of the format it was rendered with
+  unsigned int channels =
+      this->dataPtr->secondPassFormat == GRDF_RANGE_RETRO ? 3u : 1u;
+  size_t size = width * height * channels * sizeof(float);
 
-  memcpy(_dataDest, this->dataPtr->gpuRaysScan, size);
+  memcpy(_dataDest, data, size);
 }
 
 /////////////////////////////////////////////////
@@ -983,6 +1107,13 @@ ignition::common::ConnectionPtr OgreGpuRays::ConnectNewGpuRaysFrame(
   return this->dataPtr->newGpuRaysFrame.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr OgreGpuRays::ConnectNewGpuRaysData(
+    NewFrameListener _subscriber)
+{
+  return this->dataPtr->newGpuRaysData.Connect(_subscriber);
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr OgreGpuRays::RenderTarget() const
 {
@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre/OgreConversions.hh"
+#include "ignition/rendering/ogre/OgreIncludes.hh"
+#include "ignition/rendering/ogre/OgreInstanceBatch.hh"
+#include "ignition/rendering/ogre/OgreMaterial.hh"
+#include "ignition/rendering/ogre/OgreMeshFactory.hh"
+#include "ignition/rendering/ogre/OgreScene.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreInstancedEntity.h>
+#include <OgreInstanceManager.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+/// \brief Private data for the OgreInstanceBatch class
+class ignition::rendering::OgreInstanceBatchPrivate
+{
+  /// \brief Parent node of all instance nodes
+  public: Ogre::SceneNode *rootNode = nullptr;
+
+  /// \brief Scene node of each instance
+  public: std::vector<Ogre::SceneNode *> nodes;
+
+  /// \brief Instance manager of each sub-mesh
+  public: std::vector<Ogre::InstanceManager *> managers;
+
+  /// \brief Instanced entities of each instance, one per sub-mesh
+  public: std::vector<std::vector<Ogre::InstancedEntity *>> entities;
+
+  /// \brief Instancing material of each sub-mesh
+  public: std::vector<Ogre::MaterialPtr> materials;
+
+  /// \brief Material of each sub-mesh of the mesh, used when the batch has
+  /// no material
+  public: std::vector<Ogre::MaterialPtr> meshMaterials;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Name of the material cloned for each sub-mesh of a batch
+static const char kInstancingMaterialName[] = "Ignition/Instancing";
+
+/// \brief Number of texture coordinates the instancing shaders accept in
+/// the mesh, the instance data follows them
+static const unsigned short kMaxMeshTexCoords = 2u;
+
+/// \brief Instance data that selects the colours of the material
+static const Ogre::Vector4 kMaterialColor(-1, -1, -1, -1);
+
+//////////////////////////////////////////////////
+OgreInstanceBatch::OgreInstanceBatch()
+  : dataPtr(std::make_unique<OgreInstanceBatchPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+OgreInstanceBatch::~OgreInstanceBatch()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void OgreInstanceBatch::Destroy()
+{
+  if (!this->dataPtr->rootNode || !this->scene)
+    return;
+
+  // the instanced entities are destroyed with their managers
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  if (sceneManager)
+  {
+    for (auto node : this->dataPtr->nodes)
+    {
+      node->detachAllObjects();
+      sceneManager->destroySceneNode(node);
+    }
+    for (auto manager : this->dataPtr->managers)
+      sceneManager->destroyInstanceManager(manager);
+    sceneManager->destroySceneNode(this->dataPtr->rootNode);
+  }
+  this->dataPtr->entities.clear();
+  this->dataPtr->managers.clear();
+  this->dataPtr->nodes.clear();
+  this->dataPtr->meshMaterials.clear();
+  this->dataPtr->rootNode = nullptr;
+
+  for (auto &mat : this->dataPtr->materials)
+    Ogre::MaterialManager::getSingleton().remove(mat->getName());
+  this->dataPtr->materials.clear();
+}
+
+//////////////////////////////////////////////////
+void OgreInstanceBatch::Init()
+{
+  BaseInstanceBatch::Init();
+
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  this->dataPtr->rootNode =
+      sceneManager->getRootSceneNode()->createChildSceneNode();
+
+  unsigned int count = this->InstanceCount();
+  this->dataPtr->nodes.reserve(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    this->dataPtr->nodes.push_back(
+        this->dataPtr->rootNode->createChildSceneNode());
+  }
+  this->dataPtr->entities.resize(count);
+
+  const Ogre::RenderSystemCapabilities *caps =
+      Ogre::Root::getSingleton().getRenderSystem()->getCapabilities();
+  if (!caps->hasCapability(Ogre::RSC_VERTEX_BUFFER_INSTANCE_DATA))
+  {
+    ignerr << "Unable to create instance batch [" << this->Name()
+           << "]: hardware instancing is not supported" << std::endl;
+    return;
+  }
+
+  if (!this->meshFactory->Load(this->meshDescriptor))
+  {
+    ignerr << "Failed to create instances of mesh ["
+           << this->meshDescriptor.meshName << "]" << std::endl;
+    return;
+  }
+  Ogre::MeshPtr mesh = Ogre::MeshManager::getSingleton().getByName(
+      this->meshFactory->MeshName(this->meshDescriptor));
+
+  Ogre::MaterialPtr instancingMat =
+      Ogre::MaterialManager::getSingleton().getByName(
+      kInstancingMaterialName);
+  if (!instancingMat)
+  {
+    ignerr << "Instancing material not found: '" << kInstancingMaterialName
+           << "'" << std::endl;
+    return;
+  }
+
+  for (unsigned short j = 0; j < mesh->getNumSubMeshes(); ++j)
+  {
+    Ogre::SubMesh *subMesh = mesh->getSubMesh(j);
+    const Ogre::VertexData *vertexData = subMesh->useSharedVertices ?
+        mesh->sharedVertexData : subMesh->vertexData;
+    unsigned short texCoordCount =
+        vertexData->vertexDeclaration->getNextFreeTextureCoordinate();
+    if (texCoordCount > kMaxMeshTexCoords)
+    {
+      ignerr << "Unable to instance sub-mesh [" << j << "] of mesh ["
+             << this->meshDescriptor.meshName << "]: it has "
+             << texCoordCount << " texture coordinate sets, at most "
+             << kMaxMeshTexCoords << " are supported" << std::endl;
+      continue;
+    }
+
+    // instancing material of the sub-mesh, the vertex programs read the
+    // instance data from the texture coordinates that follow the ones of
+    // the mesh
+    const std::string name = this->scene->Name() + "::" + this->Name() +
+        "::" + std::to_string(j);
+    Ogre::MaterialPtr mat = instancingMat->clone(name);
+    Ogre::Technique *technique = mat->getTechnique(0);
+    technique->setShadowCasterMaterial(
+        "Ignition/InstancingShadowCaster" + std::to_string(texCoordCount));
+    technique->getPass(0)->setVertexProgram(
+        "Ignition/InstancingVS" + std::to_string(texCoordCount));
+    this->dataPtr->materials.push_back(mat);
+    this->dataPtr->meshMaterials.push_back(
+        Ogre::MaterialManager::getSingleton().getByName(
+        subMesh->getMaterialName()));
+
+    // a single batch holds all instances, so each sub-mesh is drawn with
+    // one draw call
+    Ogre::InstanceManager *manager = nullptr;
+    try
+    {
+      manager = sceneManager->createInstanceManager(name, mesh->getName(),
+          mesh->getGroup(), Ogre::InstanceManager::HWInstancingBasic,
+          count, Ogre::IM_USEALL, j);
+      // instance colour and custom parameter
+      manager->setNumCustomParams(2);
+    }
+    catch(Ogre::Exception &e)
+    {
+      ignerr << "Unable to create instance manager for sub-mesh [" << j
+             << "] of mesh [" << this->meshDescriptor.meshName << "]: "
+             << e.getDescription() << std::endl;
+      continue;
+    }
+    this->dataPtr->managers.push_back(manager);
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      Ogre::InstancedEntity *entity =
+          sceneManager->createInstancedEntity(name, name);
+      entity->setCustomParam(0, kMaterialColor);
+      this->dataPtr->nodes[i]->attachObject(entity);
+      this->dataPtr->entities[i].push_back(entity);
+    }
+  }
+
+  this->UpdateMaterials();
+}
+
+//////////////////////////////////////////////////
+void OgreInstanceBatch::PreRender()
+{
+  // the batch and mesh materials can be changed after the batch was created
+  this->UpdateMaterials();
+  BaseInstanceBatch::PreRender();
+}
+
+//////////////////////////////////////////////////
+void OgreInstanceBatch::UpdateMaterials()
+{
+  OgreMaterialPtr batchMat =
+      std::dynamic_pointer_cast<OgreMaterial>(this->material);
+  for (unsigned int j = 0; j < this->dataPtr->materials.size(); ++j)
+  {
+    Ogre::MaterialPtr srcMat = batchMat ? batchMat->Material() :
+        this->dataPtr->meshMaterials[j];
+    Ogre::Pass *srcPass = nullptr;
+    if (srcMat && srcMat->getNumTechniques() > 0u &&
+        srcMat->getTechnique(0)->getNumPasses() > 0u)
+    {
+      srcPass = srcMat->getTechnique(0)->getPass(0);
+    }
+
+    Ogre::Pass *pass = this->dataPtr->materials[j]->getTechnique(0)->
+        getPass(0);
+    Ogre::GpuProgramParametersSharedPtr params =
+        pass->getFragmentProgramParameters();
+    if (!srcPass)
+    {
+      params->setNamedConstant("materialDiffuse", Ogre::ColourValue::White);
+      params->setNamedConstant("materialAmbient", Ogre::ColourValue::White);
+      params->setNamedConstant("materialEmissive", Ogre::ColourValue::Black);
+      continue;
+    }
+    params->setNamedConstant("materialDiffuse", srcPass->getDiffuse());
+    params->setNamedConstant("materialAmbient", srcPass->getAmbient());
+    params->setNamedConstant("materialEmissive",
+        srcPass->getSelfIllumination());
+
+    std::string texture;
+    if (srcPass->getNumTextureUnitStates() > 0u)
+      texture = srcPass->getTextureUnitState(0)->getTextureName();
+    if (texture.empty())
+    {
+      if (pass->getNumTextureUnitStates() > 0u)
+        pass->removeAllTextureUnitStates();
+    }
+    else if (pass->getNumTextureUnitStates() == 0u)
+    {
+      pass->createTextureUnitState(texture);
+    }
+    else if (pass->getTextureUnitState(0)->getTextureName() != texture)
+    {
+      pass->getTextureUnitState(0)->setTextureName(texture);
+    }
+    params->setNamedConstant("hasTexture", texture.empty() ? 0 : 1);
+  }
+}
+
+//////////////////////////////////////////////////
+void OgreInstanceBatch::UpdateInstances()
+{
+  unsigned int count =
+      static_cast<unsigned int>(this->dataPtr->nodes.size());
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    uint8_t flags = this->dirtyFlags[i];
+    if (!flags)
+      continue;
+
+    Ogre::SceneNode *node = this->dataPtr->nodes[i];
+
+    if (flags & DIRTY_TRANSFORM)
+    {
+      node->setPosition(OgreConversions::Convert(this->poses[i].Pos()));
+      node->setOrientation(OgreConversions::Convert(this->poses[i].Rot()));
+      node->setScale(OgreConversions::Convert(this->scales[i]));
+    }
+
+    // colours are instance data, instances of any colour stay in one batch
+    if (flags & DIRTY_COLOR)
+    {
+      const math::Color &color = this->colors[i];
+      math::Color defaultColor =
+          this->material ? this->material->Diffuse() : math::Color::White;
+      Ogre::Vector4 value = color == defaultColor ? kMaterialColor :
+          Ogre::Vector4(color.R(), color.G(), color.B(), color.A());
+      for (auto entity : this->dataPtr->entities[i])
+        entity->setCustomParam(0, value);
+    }
+
+    if (flags & DIRTY_CUSTOM_PARAMETER)
+    {
+      const math::Vector4d &param = this->customParameters[i];
+      Ogre::Vector4 value(param.X(), param.Y(), param.Z(), param.W());
+      for (auto entity : this->dataPtr->entities[i])
+        entity->setCustomParam(kCustomParameterIndex, value);
+    }
+
+    if (flags & DIRTY_VISIBILITY)
+      node->setVisible(this->visibility[i]);
+  }
+}
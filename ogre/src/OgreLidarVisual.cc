@@ -509,4 +509,5 @@ void OgreLidarVisual::SetVisible(bool _visible)
 {
   this->dataPtr->visible = _visible;
   this->ogreNode->setVisible(this->dataPtr->visible);
+  this->MarkSceneChanged();
 }
@@ -19,6 +19,7 @@
 #include <ignition/common/Filesystem.hh>
 
 #include "ignition/rendering/ShaderParams.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre/OgreMaterial.hh"
 #include "ignition/rendering/ogre/OgreConversions.hh"
 #include "ignition/rendering/ogre/OgreRenderEngine.hh"
@@ -259,6 +260,7 @@ std::string OgreMaterial::Texture() const
 //////////////////////////////////////////////////
 void OgreMaterial::SetTexture(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("OgreMaterial::SetTexture");
   if (_name.empty())
   {
     this->ClearTexture();
@@ -292,6 +294,7 @@ std::string OgreMaterial::NormalMap() const
 //////////////////////////////////////////////////
 void OgreMaterial::SetNormalMap(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("OgreMaterial::SetNormalMap");
   if (_name.empty())
   {
     this->ClearNormalMap();
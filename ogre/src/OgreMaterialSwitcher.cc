@@ -19,6 +19,7 @@
 #include "ignition/rendering/ogre/OgreIncludes.hh"
 #include "ignition/rendering/ogre/OgreMaterialSwitcher.hh"
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 
 using namespace ignition;
 using namespace rendering;
@@ -42,6 +43,7 @@ Ogre::Technique *OgreMaterialSwitcher::handleSchemeNotFound(
     Ogre::Material *_originalMaterial, uint16_t /*_lodIndex*/,
     const Ogre::Renderable *_rend)
 {
+  IGN_RENDERING_TRACE_ZONE("OgreMaterialSwitcher::handleSchemeNotFound");
   // selection buffer: check scheme name against the one specified in
   // OgreSelectionBuffer::CreateRTTBuffer. Only proceed if this is a callback
   // from the selection camera.
@@ -136,6 +138,14 @@ Ogre::Technique *OgreMaterialSwitcher::handleSchemeNotFound(
 
     this->lastEntity = subEntity->getParent()->getName();
     this->colorDict[this->currentColor.AsRGBA()] = this->lastEntity;
+
+    const Ogre::Any &userAny =
+        subEntity->getParent()->getUserObjectBindings().getUserAny();
+    if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
+    {
+      this->colorIds[this->currentColor.AsRGBA()] =
+          Ogre::any_cast<unsigned int>(userAny);
+    }
   }
 
   return this->lastTechnique;
@@ -145,6 +155,7 @@ Ogre::Technique *OgreMaterialSwitcher::handleSchemeNotFound(
 void OgreMaterialSwitcher::preRenderTargetUpdate(
     const Ogre::RenderTargetEvent &/*_evt*/)
 {
+  IGN_RENDERING_TRACE_ZONE("OgreMaterialSwitcher::preRenderTargetUpdate");
   Ogre::MaterialManager::getSingleton().addListener(this);
 }
 
@@ -152,6 +163,7 @@ void OgreMaterialSwitcher::preRenderTargetUpdate(
 void OgreMaterialSwitcher::postRenderTargetUpdate(
     const Ogre::RenderTargetEvent &/*_evt*/)
 {
+  IGN_RENDERING_TRACE_ZONE("OgreMaterialSwitcher::postRenderTargetUpdate");
   Ogre::MaterialManager::getSingleton().removeListener(this);
 }
 
@@ -167,6 +179,16 @@ std::string OgreMaterialSwitcher::EntityName(
     return std::string();
 }
 
+/////////////////////////////////////////////////
+unsigned int OgreMaterialSwitcher::VisualId(
+    const ignition::math::Color &_color) const
+{
+  auto iter = this->colorIds.find(_color.AsRGBA());
+  if (iter != this->colorIds.end())
+    return iter->second;
+  return 0u;
+}
+
 /////////////////////////////////////////////////
 void OgreMaterialSwitcher::NextColor()
 {
@@ -182,4 +204,5 @@ void OgreMaterialSwitcher::Reset()
   this->lastTechnique = nullptr;
   this->lastEntity.clear();
   this->colorDict.clear();
+  this->colorIds.clear();
 }
@@ -15,6 +15,8 @@
  *
  */
 
+#include <algorithm>
+
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/ogre/OgreConversions.hh"
@@ -28,11 +30,38 @@
 /// brief Private implementation of the OgreMesh class
 class ignition::rendering::OgreMeshPrivate
 {
+  /// \brief Build the bone name to index lookup tables if needed
+  /// \param[in] _skel Skeleton instance of the mesh
+  public: void BuildBoneIndex(Ogre::SkeletonInstance *_skel);
+
+  /// \brief Bone names ordered by bone index
+  public: std::vector<std::string> boneNames;
+
+  /// \brief Bone name to bone index
+  public: std::unordered_map<std::string, unsigned int> boneIndices;
+
+  /// \brief Number of leading bones (by index) set to manual mode by
+  /// SetSkeletonBoneTransforms
+  public: unsigned int manualBoneCount = 0u;
 };
 
 using namespace ignition;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+void OgreMeshPrivate::BuildBoneIndex(Ogre::SkeletonInstance *_skel)
+{
+  if (!this->boneNames.empty())
+    return;
+
+  this->boneNames.reserve(_skel->getNumBones());
+  for (unsigned int i = 0; i < _skel->getNumBones(); ++i)
+  {
+    this->boneNames.push_back(_skel->getBone(i)->getName());
+    this->boneIndices[this->boneNames.back()] = i;
+  }
+}
+
 //////////////////////////////////////////////////
 OgreMesh::OgreMesh()
   : dataPtr(new OgreMeshPrivate)
@@ -118,6 +147,65 @@ void OgreMesh::SetSkeletonLocalTransforms(
   }
 }
 
+//////////////////////////////////////////////////
+unsigned int OgreMesh::SkeletonBoneCount() const
+{
+  if (!this->ogreEntity->hasSkeleton())
+    return 0u;
+
+  return static_cast<unsigned int>(
+      this->ogreEntity->getSkeleton()->getNumBones());
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> OgreMesh::SkeletonBoneNames() const
+{
+  if (!this->ogreEntity->hasSkeleton())
+    return std::vector<std::string>();
+
+  this->dataPtr->BuildBoneIndex(this->ogreEntity->getSkeleton());
+  return this->dataPtr->boneNames;
+}
+
+//////////////////////////////////////////////////
+int OgreMesh::SkeletonBoneIndex(const std::string &_name) const
+{
+  if (!this->ogreEntity->hasSkeleton())
+    return -1;
+
+  this->dataPtr->BuildBoneIndex(this->ogreEntity->getSkeleton());
+  auto it = this->dataPtr->boneIndices.find(_name);
+  if (it == this->dataPtr->boneIndices.end())
+    return -1;
+  return static_cast<int>(it->second);
+}
+
+//////////////////////////////////////////////////
+void OgreMesh::SetSkeletonBoneTransforms(
+    const std::vector<math::Matrix4d> &_tfs)
+{
+  if (!this->ogreEntity->hasSkeleton())
+    return;
+
+  Ogre::SkeletonInstance *skel = this->ogreEntity->getSkeleton();
+  unsigned int count = std::min(static_cast<unsigned int>(_tfs.size()),
+      static_cast<unsigned int>(skel->getNumBones()));
+
+  // switching bones to manual mode is only needed once
+  for (unsigned int i = this->dataPtr->manualBoneCount; i < count; ++i)
+    skel->getBone(i)->setManuallyControlled(true);
+  this->dataPtr->manualBoneCount =
+      std::max(this->dataPtr->manualBoneCount, count);
+
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    Ogre::Bone *bone = skel->getBone(i);
+    const math::Matrix4d &tf = _tfs[i];
+    bone->setPosition(OgreConversions::Convert(tf.Translation()));
+    bone->setOrientation(OgreConversions::Convert(tf.Rotation()));
+  }
+}
+
 //////////////////////////////////////////////////
 void OgreMesh::SetSkeletonAnimationEnabled(const std::string &_name,
     bool _enabled, bool _loop, float _weight)
@@ -138,6 +226,7 @@ void OgreMesh::SetSkeletonAnimationEnabled(const std::string &_name,
       Ogre::Bone* bone = iter.getNext();
       bone->setManuallyControlled(false);
     }
+    this->dataPtr->manualBoneCount = 0u;
   }
 
   // update animation state
@@ -27,6 +27,7 @@
 
 #include <ignition/math/Matrix4.hh>
 
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre/OgreConversions.hh"
 #include "ignition/rendering/ogre/OgreIncludes.hh"
 #include "ignition/rendering/ogre/OgreMesh.hh"
@@ -52,6 +53,7 @@ OgreMeshFactory::~OgreMeshFactory()
 //////////////////////////////////////////////////
 OgreMeshPtr OgreMeshFactory::Create(const MeshDescriptor &_desc)
 {
+  IGN_RENDERING_TRACE_ZONE("OgreMeshFactory::Create");
   // create ogre entity
   OgreMeshPtr mesh(new OgreMesh);
   MeshDescriptor normDesc = _desc;
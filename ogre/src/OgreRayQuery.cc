@@ -137,6 +137,15 @@ RayQueryResult OgreRayQuery::ClosestPoint()
               result.point =
                   OgreConversions::Convert(mouseRay.getPoint(distance));
               result.objectId = Ogre::any_cast<unsigned int>(userAny);
+
+              // face normal, towards the ray origin
+              Ogre::Vector3 normal =
+                  (vertices[indices[i+1]] - vertices[indices[i]]).crossProduct(
+                  vertices[indices[i+2]] - vertices[indices[i]]);
+              normal.normalise();
+              if (normal.dotProduct(mouseRay.getDirection()) > 0)
+                normal = -normal;
+              result.normal = OgreConversions::Convert(normal);
             }
           }
         }
@@ -251,6 +251,36 @@ Ogre::Root *OgreRenderEngine::OgreRoot() const
   return this->ogreRoot;
 }
 
+//////////////////////////////////////////////////
+rendering::EngineResourceStats OgreRenderEngine::ResourceStats() const
+{
+  rendering::EngineResourceStats stats;
+  if (!this->ogreRoot || !Ogre::MaterialManager::getSingletonPtr())
+    return stats;
+
+  auto materials = Ogre::MaterialManager::getSingleton().getResourceIterator();
+  while (materials.hasMoreElements())
+  {
+    materials.getNext();
+    ++stats.materialCount;
+  }
+
+  Ogre::TextureManager &textureManager = Ogre::TextureManager::getSingleton();
+  auto textures = textureManager.getResourceIterator();
+  while (textures.hasMoreElements())
+  {
+    textures.getNext();
+    ++stats.textureCount;
+  }
+  stats.textureBytes = textureManager.getMemoryUsage();
+
+  // ogre 1.x allocates a buffer per mesh, they are accounted for by the
+  // mesh manager
+  stats.bufferBytes = Ogre::MeshManager::getSingleton().getMemoryUsage();
+  stats.bufferCapacityBytes = stats.bufferBytes;
+  return stats;
+}
+
 //////////////////////////////////////////////////
 ScenePtr OgreRenderEngine::CreateSceneImpl(unsigned int _id,
     const std::string &_name)
@@ -34,6 +34,7 @@
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/Material.hh"
+#include "ignition/rendering/Trace.hh"
 
 #include "ignition/rendering/ogre/OgreRenderEngine.hh"
 #include "ignition/rendering/ogre/OgreRenderPass.hh"
@@ -68,6 +69,7 @@ OgreRenderTarget::~OgreRenderTarget()
 //////////////////////////////////////////////////
 void OgreRenderTarget::Copy(Image &_image) const
 {
+  IGN_RENDERING_TRACE_ZONE("OgreRenderTarget::Copy");
   if (nullptr == this->RenderTarget())
     return;
 
@@ -83,6 +85,14 @@ void OgreRenderTarget::Copy(Image &_image) const
   void* data = _image.Data();
   Ogre::PixelFormat imageFormat = OgreConversions::Convert(_image.Format());
   Ogre::PixelBox ogrePixelBox(this->width, this->height, 1, imageFormat, data);
+
+  // the rows of image views are further apart than their width
+  unsigned int bytesPerPixel = PixelUtil::BytesPerPixel(_image.Format());
+  if (bytesPerPixel > 0u && _image.Stride() != this->width * bytesPerPixel)
+  {
+    ogrePixelBox.rowPitch = _image.Stride() / bytesPerPixel;
+    ogrePixelBox.slicePitch = ogrePixelBox.rowPitch * this->height;
+  }
   this->RenderTarget()->copyContentsToMemory(ogrePixelBox);
 }
 
@@ -148,6 +158,7 @@ void OgreRenderTarget::PostRender()
 //////////////////////////////////////////////////
 void OgreRenderTarget::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreRenderTarget::Render");
   if (nullptr == this->RenderTarget())
     return;
 
@@ -17,6 +17,7 @@
 
 #include <ignition/common/Console.hh>
 
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre/OgreArrowVisual.hh"
 #include "ignition/rendering/ogre/OgreAxisVisual.hh"
 #include "ignition/rendering/ogre/OgreCamera.hh"
@@ -29,10 +30,12 @@
 #include "ignition/rendering/ogre/OgreGrid.hh"
 #include "ignition/rendering/ogre/OgreHeightmap.hh"
 #include "ignition/rendering/ogre/OgreIncludes.hh"
+#include "ignition/rendering/ogre/OgreInstanceBatch.hh"
 #include "ignition/rendering/ogre/OgreLidarVisual.hh"
 #include "ignition/rendering/ogre/OgreLightVisual.hh"
 #include "ignition/rendering/ogre/OgreMarker.hh"
 #include "ignition/rendering/ogre/OgreMaterial.hh"
+#include "ignition/rendering/ogre/OgreMesh.hh"
 #include "ignition/rendering/ogre/OgreMeshFactory.hh"
 #include "ignition/rendering/ogre/OgreParticleEmitter.hh"
 #include "ignition/rendering/ogre/OgreRTShaderSystem.hh"
@@ -280,19 +283,59 @@ void OgreScene::RemoveGradientBackgroundColor()
 //////////////////////////////////////////////////
 void OgreScene::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreScene::PreRender");
+  if (this->staticGeometryDirty)
+    this->RebuildStaticGeometry();
+
   BaseScene::PreRender();
+
+  // instance batches are not part of the scene graph
+  for (auto it = this->instanceBatches.begin();
+      it != this->instanceBatches.end();)
+  {
+    auto batch = it->lock();
+    if (!batch)
+    {
+      it = this->instanceBatches.erase(it);
+      continue;
+    }
+    batch->PreRender();
+    ++it;
+  }
+
   OgreRTShaderSystem::Instance()->Update();
 }
 
+//////////////////////////////////////////////////
+rendering::ResourceStats OgreScene::ResourceStats() const
+{
+  rendering::ResourceStats stats;
+  if (!this->ogreSceneManager)
+    return stats;
+
+  auto entities = this->ogreSceneManager->getMovableObjectIterator(
+      Ogre::EntityFactory::FACTORY_TYPE_NAME);
+  while (entities.hasMoreElements())
+  {
+    entities.getNext();
+    ++stats.objectCount;
+  }
+  return stats;
+}
+
 //////////////////////////////////////////////////
 void OgreScene::Clear()
 {
+  this->ClearStaticGeometry();
+  this->DestroyInstanceBatches();
   BaseScene::Clear();
 }
 
 //////////////////////////////////////////////////
 void OgreScene::Destroy()
 {
+  this->ClearStaticGeometry();
+  this->DestroyInstanceBatches();
   BaseScene::Destroy();
 
   // ogre scene manager is destroyed when ogre root is deleted
@@ -622,6 +665,182 @@ ParticleEmitterPtr OgreScene::CreateParticleEmitterImpl(unsigned int _id,
   return (result) ? visual : nullptr;
 }
 
+//////////////////////////////////////////////////
+InstanceBatchPtr OgreScene::CreateInstanceBatchImpl(unsigned int _id,
+    const std::string &_name, const MeshDescriptor &_desc,
+    MaterialPtr _material, unsigned int _count)
+{
+  MeshDescriptor normDesc = _desc;
+  normDesc.Load();
+  if (!normDesc.mesh)
+  {
+    ignerr << "Unable to create instance batch, invalid mesh ["
+           << _desc.meshName << "]" << std::endl;
+    return InstanceBatchPtr();
+  }
+
+  OgreInstanceBatchPtr batch(new OgreInstanceBatch);
+  batch->meshFactory = this->meshFactory;
+  batch->SetInstanceData(normDesc, _material, _count);
+  bool result = this->InitObject(batch, _id, _name);
+  if (!result)
+    return InstanceBatchPtr();
+
+  this->instanceBatches.push_back(batch);
+  return batch;
+}
+
+//////////////////////////////////////////////////
+void OgreScene::DestroyInstanceBatches()
+{
+  for (auto &weakBatch : this->instanceBatches)
+  {
+    auto batch = weakBatch.lock();
+    if (batch)
+      batch->Destroy();
+  }
+  this->instanceBatches.clear();
+}
+
+//////////////////////////////////////////////////
+void OgreScene::BakeStaticGeometry()
+{
+  std::vector<OgreVisualPtr> staticVisuals;
+  for (auto it = this->visuals->Begin(); it != this->visuals->End(); ++it)
+  {
+    OgreVisualPtr visual = std::dynamic_pointer_cast<OgreVisual>(it->second);
+    if (visual && visual->Static())
+      staticVisuals.push_back(visual);
+  }
+
+  this->ClearStaticGeometry();
+  this->BuildStaticGeometry(staticVisuals);
+}
+
+//////////////////////////////////////////////////
+void OgreScene::BuildStaticGeometry(
+    const std::vector<OgreVisualPtr> &_visuals)
+{
+  // static geometry copies the materials of the entities, make sure the
+  // shaders are generated first
+  OgreRTShaderSystem::Instance()->Update();
+
+  this->staticGeometry = this->ogreSceneManager->createStaticGeometry(
+      this->Name() + "::static_geometry");
+  this->staticGeometry->setRegionDimensions(Ogre::Vector3(50, 50, 50));
+  this->staticGeometry->setCastShadows(true);
+
+  for (auto &visual : _visuals)
+  {
+    if (this->BakeStaticVisual(visual))
+      this->bakedVisuals.push_back(visual);
+  }
+
+  this->staticGeometry->build();
+}
+
+//////////////////////////////////////////////////
+bool OgreScene::BakeStaticVisual(OgreVisualPtr _visual)
+{
+  if (_visual->GeometryCount() == 0u ||
+      _visual->VisibilityFlags() != IGN_VISIBILITY_ALL)
+  {
+    return false;
+  }
+
+  // check all geometries first, a visual is either fully baked or not at all
+  std::vector<Ogre::Entity *> entities;
+  for (unsigned int i = 0; i < _visual->GeometryCount(); ++i)
+  {
+    OgreMeshPtr mesh =
+        std::dynamic_pointer_cast<OgreMesh>(_visual->GeometryByIndex(i));
+    if (!mesh || !mesh->ogreEntity || !mesh->ogreEntity->isVisible() ||
+        mesh->ogreEntity->hasSkeleton())
+    {
+      return false;
+    }
+    entities.push_back(mesh->ogreEntity);
+  }
+
+  Ogre::SceneNode *node = _visual->Node();
+  for (auto entity : entities)
+  {
+    this->staticGeometry->addEntity(entity, node->_getDerivedPosition(),
+        node->_getDerivedOrientation(), node->_getDerivedScale());
+  }
+
+  _visual->SetGeometriesBaked(true);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void OgreScene::ClearStaticGeometry()
+{
+  for (auto &weakVisual : this->bakedVisuals)
+  {
+    OgreVisualPtr visual = weakVisual.lock();
+    if (visual && visual->staticBaked)
+      visual->SetGeometriesBaked(false);
+  }
+  this->bakedVisuals.clear();
+  this->staticGeometryDirty = false;
+
+  if (this->staticGeometry && this->ogreSceneManager)
+    this->ogreSceneManager->destroyStaticGeometry(this->staticGeometry);
+  this->staticGeometry = nullptr;
+}
+
+//////////////////////////////////////////////////
+unsigned int OgreScene::StaticGeometryBatchCount() const
+{
+  if (!this->staticGeometry)
+    return 0u;
+
+  // one draw call per geometry bucket of the highest level of detail
+  unsigned int count = 0u;
+  auto regionIt = this->staticGeometry->getRegionIterator();
+  while (regionIt.hasMoreElements())
+  {
+    auto lodIt = regionIt.getNext()->getLODIterator();
+    if (!lodIt.hasMoreElements())
+      continue;
+
+    auto materialIt = lodIt.getNext()->getMaterialIterator();
+    while (materialIt.hasMoreElements())
+    {
+      auto geomIt = materialIt.getNext()->getGeometryIterator();
+      while (geomIt.hasMoreElements())
+      {
+        geomIt.getNext();
+        ++count;
+      }
+    }
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+void OgreScene::SetStaticGeometryDirty()
+{
+  this->staticGeometryDirty = true;
+}
+
+//////////////////////////////////////////////////
+void OgreScene::RebuildStaticGeometry()
+{
+  // visuals that were modified have already restored their geometries
+  std::vector<OgreVisualPtr> staticVisuals;
+  for (auto &weakVisual : this->bakedVisuals)
+  {
+    OgreVisualPtr visual = weakVisual.lock();
+    if (visual && visual->staticBaked)
+      staticVisuals.push_back(visual);
+  }
+
+  this->ClearStaticGeometry();
+  this->BuildStaticGeometry(staticVisuals);
+}
+
 //////////////////////////////////////////////////
 bool OgreScene::InitObject(OgreObjectPtr _object, unsigned int _id,
     const std::string &_name)
@@ -15,7 +15,11 @@
  *
 */
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
+
 #include <ignition/math/Color.hh>
 
 #include "ignition/common/Console.hh"
@@ -60,6 +64,15 @@ class ignition::rendering::OgreSelectionBufferPrivate
   /// \brief A 2D overlay used for debugging the selection buffer. It
   /// is hidden by default.
   public: Ogre::Overlay *selectionDebugOverlay = nullptr;
+
+  /// \brief Full view texture rendered by RenderIds
+  public: Ogre::TexturePtr idTexture;
+
+  /// \brief Full view render texture
+  public: Ogre::RenderTexture *idRenderTexture = nullptr;
+
+  /// \brief Full view texture data read back from the GPU
+  public: std::vector<uint8_t> idData;
 };
 
 /////////////////////////////////////////////////
@@ -81,6 +94,7 @@ OgreSelectionBuffer::OgreSelectionBuffer(const std::string &_cameraName,
 /////////////////////////////////////////////////
 OgreSelectionBuffer::~OgreSelectionBuffer()
 {
+  this->DeleteIdBuffer();
   this->DeleteRTTBuffer();
 
   // remove selection buffer camera
@@ -252,6 +266,125 @@ Ogre::Entity *OgreSelectionBuffer::OnSelectionClick(const int _x, const int _y)
     return this->dataPtr->sceneMgr->getEntity(entName);
 }
 
+/////////////////////////////////////////////////
+bool OgreSelectionBuffer::RenderIds(unsigned int _width,
+    unsigned int _height, std::vector<unsigned int> &_ids)
+{
+  if (!this->dataPtr->camera)
+    return false;
+
+  if (!this->dataPtr->idRenderTexture ||
+      this->dataPtr->idRenderTexture->getWidth() != _width ||
+      this->dataPtr->idRenderTexture->getHeight() != _height)
+  {
+    this->DeleteIdBuffer();
+    if (!this->CreateIdBuffer(_width, _height))
+      return false;
+  }
+
+  // full view of the camera
+  this->dataPtr->selectionCamera->setCustomProjectionMatrix(true,
+      this->dataPtr->camera->getProjectionMatrix());
+  this->dataPtr->selectionCamera->setPosition(
+      this->dataPtr->camera->getDerivedPosition());
+  this->dataPtr->selectionCamera->setOrientation(
+      this->dataPtr->camera->getDerivedOrientation());
+
+  this->dataPtr->materialSwitcher->Reset();
+  try
+  {
+    this->dataPtr->idRenderTexture->update();
+  }
+  catch(...)
+  {
+  }
+
+  Ogre::PixelFormat format = Ogre::PF_R8G8B8;
+  Ogre::PixelBox pixelBox(_width, _height, 1, format,
+      this->dataPtr->idData.data());
+  this->dataPtr->idRenderTexture->copyContentsToMemory(pixelBox,
+      Ogre::RenderTarget::FB_FRONT);
+
+  // visuals cover runs of pixels of the same color, look up the id once
+  // per run. Black is the background.
+  size_t pixelSize = std::min<size_t>(
+      Ogre::PixelUtil::getNumElemBytes(format), 4u);
+  _ids.resize(static_cast<size_t>(_width) * _height);
+  ignition::math::Color::BGRA runColor(0);
+  unsigned int runId = 0u;
+  const uint8_t *pixel = this->dataPtr->idData.data();
+  for (size_t i = 0; i < _ids.size(); ++i, pixel += pixelSize)
+  {
+    ignition::math::Color::BGRA color(0);
+    memcpy(static_cast<void *>(&color), pixel, pixelSize);
+    if (color != runColor)
+    {
+      ignition::math::Color cv;
+      cv.SetFromARGB(color);
+      cv.A(1.0);
+      runColor = color;
+      runId = this->dataPtr->materialSwitcher->VisualId(cv);
+    }
+    _ids[i] = runId;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool OgreSelectionBuffer::CreateIdBuffer(unsigned int _width,
+    unsigned int _height)
+{
+  Ogre::PixelFormat format = Ogre::PF_R8G8B8;
+  try
+  {
+    this->dataPtr->idTexture =
+        Ogre::TextureManager::getSingleton().createManual(
+        this->dataPtr->camera->getName() + "_selection_ids",
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME,
+        Ogre::TEX_TYPE_2D, _width, _height, 0, format,
+        Ogre::TU_RENDERTARGET);
+  }
+  catch(...)
+  {
+    ignerr << "Unable to create selection id buffer.\n";
+    return false;
+  }
+
+  // same viewport setup as the 1x1 buffer
+  this->dataPtr->idRenderTexture =
+      this->dataPtr->idTexture->getBuffer()->getRenderTarget();
+  this->dataPtr->idRenderTexture->setAutoUpdated(false);
+  this->dataPtr->idRenderTexture->setPriority(0);
+  Ogre::Viewport *vp =
+      this->dataPtr->idRenderTexture->addViewport(
+      this->dataPtr->selectionCamera);
+  vp->setOverlaysEnabled(false);
+  vp->setShadowsEnabled(false);
+  vp->setClearEveryFrame(true);
+  vp->setMaterialScheme("selection");
+  vp->setVisibilityMask(IGN_VISIBILITY_SELECTABLE);
+  this->dataPtr->idRenderTexture->addListener(
+      this->dataPtr->materialSwitcher.get());
+
+  this->dataPtr->idData.resize(
+      Ogre::PixelUtil::getMemorySize(_width, _height, 1, format));
+  return true;
+}
+
+/////////////////////////////////////////////////
+void OgreSelectionBuffer::DeleteIdBuffer()
+{
+  if (!this->dataPtr->idRenderTexture)
+    return;
+
+  auto &manager = Ogre::TextureManager::getSingleton();
+  manager.unload(this->dataPtr->idTexture->getName());
+  manager.remove(this->dataPtr->idTexture->getName());
+  this->dataPtr->idTexture = Ogre::TexturePtr();
+  this->dataPtr->idRenderTexture = nullptr;
+  this->dataPtr->idData.clear();
+}
+
 /////////////////////////////////////////////////
 void OgreSelectionBuffer::CreateRTTOverlays()
 {
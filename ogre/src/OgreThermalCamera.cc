@@ -27,6 +27,7 @@
 
 #include <ignition/math/Helpers.hh>
 #include "ignition/rendering/ShaderParams.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre/OgreThermalCamera.hh"
 #include "ignition/rendering/ogre/OgreMaterial.hh"
 #include "ignition/rendering/ogre/OgreVisual.hh"
@@ -492,6 +493,7 @@ void OgreThermalCamera::CreateRenderTexture()
 //////////////////////////////////////////////////
 void OgreThermalCamera::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreThermalCamera::PreRender");
   BaseCamera::PreRender();
   if (!this->dataPtr->ogreThermalTexture)
     this->CreateThermalTexture();
@@ -500,6 +502,7 @@ void OgreThermalCamera::PreRender()
 //////////////////////////////////////////////////
 void OgreThermalCamera::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreThermalCamera::Render");
   // render heat source
   Ogre::RenderTarget *heatRt =
       this->dataPtr->ogreHeatSourceTexture->getBuffer()->getRenderTarget();
@@ -514,6 +517,7 @@ void OgreThermalCamera::Render()
 //////////////////////////////////////////////////
 void OgreThermalCamera::PostRender()
 {
+  IGN_RENDERING_TRACE_ZONE("OgreThermalCamera::PostRender");
   if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
     return;
 
@@ -541,8 +545,11 @@ void OgreThermalCamera::PostRender()
   memcpy(this->dataPtr->thermalImage, this->dataPtr->thermalBuffer,
       height*width*channelCount*bytesPerChannel);
 
-  this->dataPtr->newThermalFrame(
-      this->dataPtr->thermalBuffer, width, height, 1, "L16");
+  {
+    IGN_RENDERING_TRACE_ZONE("OgreThermalCamera::NewThermalFrame");
+    this->dataPtr->newThermalFrame(
+        this->dataPtr->thermalBuffer, width, height, 1, "L16");
+  }
 
   // Uncomment to debug thermal output
   // igndbg << "wxh: " << width << " x " << height << std::endl;
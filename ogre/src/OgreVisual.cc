@@ -20,6 +20,7 @@
 #include "ignition/rendering/ogre/OgreVisual.hh"
 #include "ignition/rendering/ogre/OgreWireBox.hh"
 #include "ignition/rendering/ogre/OgreConversions.hh"
+#include "ignition/rendering/ogre/OgreScene.hh"
 #include "ignition/rendering/ogre/OgreStorage.hh"
 #include "ignition/rendering/Utils.hh"
 
@@ -39,7 +40,9 @@ OgreVisual::~OgreVisual()
 //////////////////////////////////////////////////
 void OgreVisual::SetVisible(bool _visible)
 {
+  this->UnbakeStatic();
   this->ogreNode->setVisible(_visible);
+  this->MarkSceneChanged();
 }
 
 //////////////////////////////////////////////////
@@ -148,7 +151,9 @@ void OgreVisual::BoundsHelper(ignition::math::AxisAlignedBox &_box,
   {
     Ogre::MovableObject *obj = this->ogreNode->getAttachedObject(i);
 
-    if (obj->isVisible() && obj->getVisibilityFlags() != IGN_VISIBILITY_GUI)
+    // baked geometries are hidden but still part of the visual
+    if ((obj->isVisible() || this->staticBaked) &&
+        obj->getVisibilityFlags() != IGN_VISIBILITY_GUI)
     {
       Ogre::AxisAlignedBox bb = obj->getBoundingBox();
 
@@ -209,6 +214,30 @@ void OgreVisual::BoundsHelper(ignition::math::AxisAlignedBox &_box,
   }
 }
 
+//////////////////////////////////////////////////
+void OgreVisual::UnbakeStatic()
+{
+  if (!this->staticBaked)
+    return;
+
+  this->SetGeometriesBaked(false);
+  if (this->scene)
+    this->scene->SetStaticGeometryDirty();
+}
+
+//////////////////////////////////////////////////
+void OgreVisual::SetGeometriesBaked(bool _baked)
+{
+  for (unsigned int i = 0; i < this->GeometryCount(); ++i)
+  {
+    OgreGeometryPtr geometry =
+        std::dynamic_pointer_cast<OgreGeometry>(this->GeometryByIndex(i));
+    if (geometry && geometry->OgreObject())
+      geometry->OgreObject()->setVisible(!_baked);
+  }
+  this->staticBaked = _baked;
+}
+
 //////////////////////////////////////////////////
 void OgreVisual::Init()
 {
@@ -5,23 +5,46 @@ uniform sampler2D tex3;
 uniform vec4 texSize;
 varying float tex;
 
+// layout of the output, see GpuRaysDataFormat
+//   0: range, retro
+//   1: range
+//   2: range, intensity in [0, 255]
+//   3: range in millimeters
+uniform int dataFormat;
+
 void main()
 {
+  vec4 d;
   if ((gl_TexCoord[0].s < 0.0) || (gl_TexCoord[0].s > 1.0) ||
       (gl_TexCoord[0].t < 0.0) || (gl_TexCoord[0].t > 1.0))
-    gl_FragColor = vec4(1,1,1,1);
+    d = vec4(1,1,1,1);
   else
   {
     int int_tex = int(tex * 1000.0);
     if (int_tex == 0)
-      //gl_FragColor=vec4(12,34,56,1);
-      gl_FragColor = texture2D( tex1, gl_TexCoord[0].st);
+      //d=vec4(12,34,56,1);
+      d = texture2D( tex1, gl_TexCoord[0].st);
     else
       if (int_tex == 1)
-        //gl_FragColor=vec4(2,1,0,1);
-        gl_FragColor = texture2D( tex2, gl_TexCoord[0].st);
+        //d=vec4(2,1,0,1);
+        d = texture2D( tex2, gl_TexCoord[0].st);
       else
-        //gl_FragColor=vec4(3,2,1,1);
-        gl_FragColor = texture2D( tex3, gl_TexCoord[0].st);
-   }
+        //d=vec4(3,2,1,1);
+        d = texture2D( tex3, gl_TexCoord[0].st);
+  }
+
+  if (dataFormat == 2)
+  {
+    float intensity = floor(clamp(d.y / 2000.0, 0.0, 1.0) * 255.0 + 0.5);
+    gl_FragColor = vec4(d.x, intensity, 0, 1.0);
+  }
+  else if (dataFormat == 3)
+  {
+    float mm = clamp(floor(d.x * 1000.0 + 0.5), 0.0, 65535.0);
+    gl_FragColor = vec4(mm, 0, 0, 1.0);
+  }
+  else
+  {
+    gl_FragColor = d;
+  }
 }
@@ -0,0 +1,52 @@
+#version 120
+
+// Hardware instancing fragment shader, per pixel lighting by the closest
+// lights without shadows. An instance colour with a negative red channel
+// selects the colours of the material.
+
+#define MAX_LIGHTS 4
+
+uniform vec4 ambientLight;
+uniform vec4 lightPosition[MAX_LIGHTS];
+uniform vec4 lightDiffuse[MAX_LIGHTS];
+uniform vec4 lightAttenuation[MAX_LIGHTS];
+
+uniform vec4 materialDiffuse;
+uniform vec4 materialAmbient;
+uniform vec4 materialEmissive;
+uniform int hasTexture;
+uniform sampler2D diffuseMap;
+
+varying vec3 worldPos;
+varying vec3 worldNormal;
+varying vec2 texCoord;
+varying vec4 instanceColor;
+
+void main()
+{
+  bool useInstanceColor = instanceColor.r >= 0.0;
+  vec4 diffuse = useInstanceColor ? instanceColor : materialDiffuse;
+  vec3 ambient = useInstanceColor ? instanceColor.rgb : materialAmbient.rgb;
+  if (hasTexture != 0)
+    diffuse *= texture2D(diffuseMap, texCoord);
+
+  vec3 normal = normalize(worldNormal);
+  vec3 color = ambientLight.rgb * ambient + materialEmissive.rgb;
+  for (int i = 0; i < MAX_LIGHTS; ++i)
+  {
+    // directional lights have w = 0 and xyz = direction to the light
+    vec3 toLight = lightPosition[i].xyz - worldPos * lightPosition[i].w;
+    float dist = length(toLight);
+    float attenuation = 1.0;
+    if (lightPosition[i].w > 0.0)
+    {
+      attenuation = dist > lightAttenuation[i].x ? 0.0 :
+          1.0 / (lightAttenuation[i].y + lightAttenuation[i].z * dist +
+          lightAttenuation[i].w * dist * dist);
+    }
+    float lambert = max(dot(normal, toLight / max(dist, 1e-6)), 0.0);
+    color += lightDiffuse[i].rgb * diffuse.rgb * lambert * attenuation;
+  }
+
+  gl_FragColor = vec4(color, diffuse.a);
+}
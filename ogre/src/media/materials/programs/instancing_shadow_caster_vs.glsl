@@ -0,0 +1,46 @@
+#version 120
+
+// Shadow caster of hardware instances, see instancing_vs.glsl
+
+attribute vec4 vertex;
+
+#if INSTANCE_UV == 0
+attribute vec4 uv0;
+attribute vec4 uv1;
+attribute vec4 uv2;
+#define WORLD_ROW_0 uv0
+#define WORLD_ROW_1 uv1
+#define WORLD_ROW_2 uv2
+#elif INSTANCE_UV == 1
+attribute vec4 uv1;
+attribute vec4 uv2;
+attribute vec4 uv3;
+#define WORLD_ROW_0 uv1
+#define WORLD_ROW_1 uv2
+#define WORLD_ROW_2 uv3
+#else
+attribute vec4 uv2;
+attribute vec4 uv3;
+attribute vec4 uv4;
+#define WORLD_ROW_0 uv2
+#define WORLD_ROW_1 uv3
+#define WORLD_ROW_2 uv4
+#endif
+
+uniform mat4 viewProjMatrix;
+uniform vec4 texelOffsets;
+
+varying vec4 vertex_depth;
+
+void main()
+{
+  mat4 worldMatrix;
+  worldMatrix[0] = WORLD_ROW_0;
+  worldMatrix[1] = WORLD_ROW_1;
+  worldMatrix[2] = WORLD_ROW_2;
+  worldMatrix[3] = vec4(0.0, 0.0, 0.0, 1.0);
+
+  vertex_depth = viewProjMatrix * (vertex * worldMatrix);
+  gl_Position = vertex_depth;
+  gl_Position.xy += texelOffsets.zw * gl_Position.w;
+}
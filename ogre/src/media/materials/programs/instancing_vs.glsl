@@ -0,0 +1,67 @@
+#version 120
+
+// Hardware instancing vertex shader. The rows of the world matrix and the
+// custom parameters of each instance are stored in the texture coordinates
+// that follow the ones of the mesh, INSTANCE_UV is the first of them.
+
+attribute vec4 vertex;
+attribute vec3 normal;
+
+#if INSTANCE_UV == 0
+attribute vec4 uv0;
+attribute vec4 uv1;
+attribute vec4 uv2;
+attribute vec4 uv3;
+#define WORLD_ROW_0 uv0
+#define WORLD_ROW_1 uv1
+#define WORLD_ROW_2 uv2
+#define INSTANCE_COLOR uv3
+#elif INSTANCE_UV == 1
+attribute vec4 uv0;
+attribute vec4 uv1;
+attribute vec4 uv2;
+attribute vec4 uv3;
+attribute vec4 uv4;
+#define WORLD_ROW_0 uv1
+#define WORLD_ROW_1 uv2
+#define WORLD_ROW_2 uv3
+#define INSTANCE_COLOR uv4
+#else
+attribute vec4 uv0;
+attribute vec4 uv2;
+attribute vec4 uv3;
+attribute vec4 uv4;
+attribute vec4 uv5;
+#define WORLD_ROW_0 uv2
+#define WORLD_ROW_1 uv3
+#define WORLD_ROW_2 uv4
+#define INSTANCE_COLOR uv5
+#endif
+
+uniform mat4 viewProjMatrix;
+
+varying vec3 worldPos;
+varying vec3 worldNormal;
+varying vec2 texCoord;
+varying vec4 instanceColor;
+
+void main()
+{
+  mat4 worldMatrix;
+  worldMatrix[0] = WORLD_ROW_0;
+  worldMatrix[1] = WORLD_ROW_1;
+  worldMatrix[2] = WORLD_ROW_2;
+  worldMatrix[3] = vec4(0.0, 0.0, 0.0, 1.0);
+
+  vec4 pos = vertex * worldMatrix;
+  worldPos = pos.xyz;
+  worldNormal = normal * mat3(worldMatrix);
+#if INSTANCE_UV == 0
+  texCoord = vec2(0.0, 0.0);
+#else
+  texCoord = uv0.xy;
+#endif
+  instanceColor = INSTANCE_COLOR;
+
+  gl_Position = viewProjMatrix * pos;
+}
@@ -18,6 +18,7 @@
 #define IGNITION_RENDERING_OGRE2_OGRE2CAMERA_HH_
 
 #include <memory>
+#include <vector>
 
 #include "ignition/rendering/base/BaseCamera.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
@@ -84,6 +85,9 @@ namespace ignition
       // Documentation inherited.
       public: virtual void Render() override;
 
+      // Documentation inherited.
+      public: virtual rendering::RenderStats RenderStats() const override;
+
       // Documentation inherited.
       public: virtual RenderWindowPtr CreateRenderWindow() override;
 
@@ -97,6 +101,10 @@ namespace ignition
       public: virtual VisualPtr VisualAt(const ignition::math::Vector2i
                   &_mousePos) override;
 
+      // Documentation inherited
+      public: virtual RayQueryResult PickAt(
+                  const ignition::math::Vector2i &_pos) override;
+
       // Documentation Inherited.
       // \sa Camera::SetMaterial(const MaterialPtr &)
       public: virtual void SetMaterial(
@@ -126,6 +134,11 @@ namespace ignition
       // Documentation inherited.
       protected: virtual void Init() override;
 
+      // Documentation inherited.
+      protected: virtual bool RenderIds(unsigned int _width,
+                     unsigned int _height, std::vector<unsigned int> &_ids)
+                     override;
+
       /// \brief Create a render texture for the camera for offscreen rendering
       protected: virtual void CreateRenderTexture();
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2CAMERAARRAY_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2CAMERAARRAY_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseCameraArray.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+#include "ignition/rendering/ogre2/Ogre2Sensor.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // Forward declaration
+    class Ogre2CameraArrayPrivate;
+
+    /// \brief Ogre2.x implementation of the camera array. Each view has its
+    /// own ogre camera. A single compositor node renders every view into its
+    /// viewport of the atlas texture, one scene pass per view.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2CameraArray :
+      public BaseCameraArray<Ogre2Sensor>
+    {
+      /// \brief Constructor
+      protected: Ogre2CameraArray();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2CameraArray();
+
+      // Documentation inherited
+      public: virtual void Init() override;
+
+      // Documentation inherited
+      public: virtual void Destroy() override;
+
+      // Documentation inherited
+      public: virtual void PreRender() override;
+
+      // Documentation inherited
+      public: virtual void Render() override;
+
+      // Documentation inherited
+      public: virtual void PostRender() override;
+
+      // Documentation inherited
+      public: virtual const unsigned char *Data() const override;
+
+      // Documentation inherited
+      public: virtual common::ConnectionPtr ConnectNewImageFrame(
+                  NewViewFrameListener _listener) override;
+
+      /// \brief Create the view cameras, the atlas texture and the
+      /// compositor workspace
+      private: void CreateAtlas();
+
+      /// \brief Destroy the resources created by CreateAtlas
+      private: void DestroyAtlas();
+
+      /// \brief Update pose, field of view and clip planes of the view
+      /// cameras
+      private: void UpdateViews();
+
+      /// \internal
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<Ogre2CameraArrayPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create a camera array
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
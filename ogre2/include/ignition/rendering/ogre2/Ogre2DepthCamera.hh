@@ -77,6 +77,19 @@ namespace ignition
       /// already and the depth texture have already been created
       private: void CreateWorkspaceInstance();
 
+      /// \brief Destroy the depth textures, materials and compositor
+      /// created by CreateDepthTexture. They are recreated when switching
+      /// between depth only and point cloud output.
+      private: void DestroyDepthTexture();
+
+      /// \brief Notify subscribers of the depth frame that was just
+      /// rendered and queue it to be saved if saving frames is enabled
+      private: void PublishDepthFrame();
+
+      /// \brief Copy the depth data of the last frame into an image
+      /// \return Image holding a copy of the depth data
+      private: Image DepthFrameImage() const;
+
       // Documentation inherited
       public: virtual void PreRender() override;
 
@@ -84,9 +97,15 @@ namespace ignition
       public: virtual void PostRender() override;
 
       /// \brief All things needed to get back z buffer for depth data
-      /// \return The z-buffer as a float array
+      /// \return The z-buffer as a float array, one value per pixel
       public: virtual const float *DepthData() const override;
 
+      /// \brief Writes the last depth frame to a file. Depth is saved as
+      /// floats, use a pfm or raw file name.
+      /// \param[in] _name Name of the output file
+      /// \return True if the frame was queued for writing
+      public: virtual bool SaveFrame(const std::string &_name) override;
+
       /// \brief Connect a to the new depth image signal
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
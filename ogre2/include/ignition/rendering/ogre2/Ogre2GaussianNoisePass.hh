@@ -18,6 +18,7 @@
 #define IGNITION_RENDERING_OGRE2_OGRE2GAUSSIANNOISEPASS_HH_
 
 #include <memory>
+#include <string>
 
 #include "ignition/rendering/base/BaseGaussianNoisePass.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderPass.hh"
@@ -51,6 +52,15 @@ namespace ignition
       // Documentation inherited
       public: void CreateRenderPass() override;
 
+      // Documentation inherited
+      public: std::string FusedShaderSource(const std::string &_prefix) const
+                  override;
+
+      // Documentation inherited
+      public: void UpdateFusedShaderParams(
+                  Ogre::GpuProgramParameters *_params,
+                  const std::string &_prefix) override;
+
       /// \brief Pointer to private data class
       private: std::unique_ptr<Ogre2GaussianNoisePassPrivate> dataPtr;
     };
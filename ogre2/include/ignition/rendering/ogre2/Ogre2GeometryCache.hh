@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2GEOMETRYCACHE_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2GEOMETRYCACHE_HH_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2GeometryCachePrivate;
+
+    /// \brief Reference counted cache of procedurally generated meshes, e.g.
+    /// capsules, grids and wire boxes. Geometries are identified by a key
+    /// built from their quantized parameters so that geometries with
+    /// (almost) identical parameters share the same ogre mesh. The ogre
+    /// mesh is removed once the last geometry using it releases it.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2GeometryCache
+    {
+      /// \brief Constructor
+      /// \param[in] _meshFactory Mesh factory used to load the ogre meshes
+      public: explicit Ogre2GeometryCache(Ogre2MeshFactoryPtr _meshFactory);
+
+      /// \brief Destructor
+      public: virtual ~Ogre2GeometryCache();
+
+      /// \brief Acquire a reference to a shared mesh. The mesh is created
+      /// with the given function the first time the key is requested.
+      /// \param[in] _key Unique key describing the geometry
+      /// \param[in] _create Function that creates the mesh with the given
+      /// name and adds it to the common::MeshManager
+      /// \return Name of the mesh or empty string if it could not be created
+      public: std::string Acquire(const std::string &_key,
+          const std::function<bool(const std::string &)> &_create);
+
+      /// \brief Acquire a reference to a shared capsule mesh. Radius and
+      /// length are quantized and the tessellation level is chosen from the
+      /// size of the capsule.
+      /// \param[in] _radius Radius of the capsule
+      /// \param[in] _length Length of the capsule
+      /// \return Name of the capsule mesh
+      /// \sa CapsuleSegments
+      public: std::string AcquireCapsule(double _radius, double _length);
+
+      /// \brief Acquire a reference to a shared line list mesh.
+      /// \param[in] _key Unique key describing the geometry
+      /// \param[in] _points Function returning the line list end points. It
+      /// is only called if the mesh does not exist yet.
+      /// \return Name of the line list mesh
+      public: std::string AcquireLineList(const std::string &_key,
+          const std::function<std::vector<math::Vector3d>()> &_points);
+
+      /// \brief Release a reference to a shared mesh. The ogre mesh is
+      /// removed when there are no more references to it. All ogre items
+      /// created from the mesh must have been destroyed beforehand.
+      /// \param[in] _meshName Name of mesh returned by one of the Acquire
+      /// functions
+      public: void Release(const std::string &_meshName);
+
+      /// \brief Get the number of references to a shared mesh
+      /// \param[in] _meshName Name of mesh
+      /// \return Number of geometries using the mesh
+      public: unsigned int UseCount(const std::string &_meshName) const;
+
+      /// \brief Get the number of distinct meshes in the cache
+      /// \return Number of meshes
+      public: unsigned int MeshCount() const;
+
+      /// \brief Forget about all the cached meshes. This is called when the
+      /// mesh factory is cleared.
+      public: void Clear();
+
+      /// \brief Quantize a geometry parameter so that values which differ by
+      /// less than the quantization step map to the same key.
+      /// \param[in] _value Value to quantize
+      /// \return Quantized value, in multiples of the quantization step
+      public: static int64_t Quantize(double _value);
+
+      /// \brief Get the number of segments (and rings) used to tessellate a
+      /// capsule. Small capsules cover few pixels and use a coarser mesh.
+      /// \param[in] _radius Radius of the capsule
+      /// \param[in] _length Length of the capsule
+      /// \return Number of segments
+      public: static unsigned int CapsuleSegments(double _radius,
+          double _length);
+
+      /// \brief Quantization step in meters
+      public: static constexpr double kQuantizationStep = 1e-4;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<Ogre2GeometryCachePrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
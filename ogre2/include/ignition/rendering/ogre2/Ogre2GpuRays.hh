@@ -34,6 +34,9 @@
 
 namespace Ogre
 {
+  class Camera;
+  class CompositorNodeDef;
+  class CompositorWorkspace;
   class Material;
   class RenderTarget;
   class Texture;
@@ -98,9 +101,31 @@ namespace ignition
                   unsigned int _height, unsigned int _channels,
                   const std::string &_format)> _subscriber) override;
 
+      // Documentation inherited.
+      public: virtual common::ConnectionPtr ConnectNewGpuRaysData(
+                  NewFrameListener _subscriber) override;
+
       // Documentation inherited.
       public: virtual RenderTargetPtr RenderTarget() const override;
 
+      /// \brief Add a render pass to the gpu rays. Only Gaussian noise
+      /// passes are supported, range noise passes also quantize ranges and
+      /// drop rays. The noise is applied to the ranges by the 2nd pass
+      /// shader, before they are copied from the gpu.
+      /// \param[in] _pass Render pass to add
+      public: virtual void AddRenderPass(const RenderPassPtr &_pass) override;
+
+      // Documentation inherited.
+      public: virtual void RemoveRenderPass(const RenderPassPtr &_pass)
+          override;
+
+      // Documentation inherited.
+      public: virtual unsigned int RenderPassCount() const override;
+
+      // Documentation inherited.
+      public: virtual RenderPassPtr RenderPassByIndex(unsigned int _index)
+          const override;
+
       /// \brief Set the number of samples in the width and height for the
       /// first pass texture.
       /// \param[in] _w Number of samples in the horizontal sweep
@@ -137,19 +162,56 @@ namespace ignition
       /// cubemap face index data
       private: void CreateSampleTexture();
 
+      /// \brief Create texture that stores the uv coordinates of each ray on
+      /// the perspective texture of the direct pass. Also points the camera
+      /// at the field of view.
+      private: void CreateDirectSampleTexture();
+
+      /// \brief Create the 1st pass material
+      private: void Create1stPassMaterial();
+
+      /// \brief Add the 1st pass textures and target passes to a compositor
+      /// node definition
+      /// \param[in] _nodeDef Node definition to add to
+      /// \param[in] _rangeTarget Name of the texture receiving the range data
+      /// \param[in] _width Width of the 1st pass textures, 0 to use the size
+      /// of the node output
+      /// \param[in] _height Height of the 1st pass textures, 0 to use the
+      /// size of the node output
+      private: void Add1stPassTargets(Ogre::CompositorNodeDef *_nodeDef,
+          const std::string &_rangeTarget, unsigned int _width,
+          unsigned int _height);
+
+      /// \brief Add the laser retro and particle listeners to the color
+      /// target of a 1st pass workspace
+      /// \param[in] _index Index of the listeners
+      /// \param[in] _workspace 1st pass workspace
+      /// \param[in] _camera Camera rendering the workspace
+      private: void Attach1stPassListeners(unsigned int _index,
+          Ogre::CompositorWorkspace *_workspace, Ogre::Camera *_camera);
+
       /// \brief Set up 1st pass material, texture, and compositor
       private: void Setup1stPass();
 
+      /// \brief Set up the 1st pass material and texture of the direct
+      /// pass, used when the field of view is below 90 degrees in both
+      /// directions
+      private: void SetupDirectPass();
+
+      /// \brief Create the workspace that renders both passes of the direct
+      /// pass with a single camera
+      private: void CreateDirectWorkspace();
+
       /// \brief Set up 2nd pass material, texture, and compositor
       private: void Setup2ndPass();
 
-      /// \brief Helper function to convert a direction vector to the
-      /// index number of a cubemap face and texture uv coordinates on that face
-      /// \param[in] _v Direction vector
-      /// \param[out] _faceIndex Index of face to sample
-      /// \return Texture UV coordinates on the face indicated by _faceIndex
-      private: math::Vector2d SampleCubemap(const math::Vector3d &_v,
-          unsigned int &_faceIndex);
+      /// \brief Destroy 2nd pass material, texture, compositor and the
+      /// buffers holding the range data
+      private: void Destroy2ndPass();
+
+      /// \brief Set the noise parameters of the 2nd pass material from the
+      /// enabled render passes
+      private: void UpdateNoise();
 
       /// \internal
       /// \brief Pointer to private data.
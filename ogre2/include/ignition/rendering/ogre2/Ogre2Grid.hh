@@ -19,6 +19,10 @@
 #define IGNITION_RENDERING_OGRE2_OGRE2GRID_HH_
 
 #include <memory>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
 #include "ignition/rendering/base/BaseGrid.hh"
 #include "ignition/rendering/ogre2/Ogre2Geometry.hh"
 
@@ -49,6 +53,9 @@ namespace ignition
       // Documentation inherited.
       public: virtual void Init();
 
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
       // Documentation inherited.
       public: virtual Ogre::MovableObject *OgreObject() const;
 
@@ -68,6 +75,10 @@ namespace ignition
       /// \brief Create the grid geometry in ogre
       private: void Create();
 
+      /// \brief Get the end points of the grid lines
+      /// \return List of points, two per line
+      private: std::vector<math::Vector3d> Points() const;
+
       /// \brief Grid should only be created by scene.
       private: friend class Ogre2Scene;
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2INSTANCEBATCH_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2INSTANCEBATCH_HH_
+
+#include <memory>
+
+#include "ignition/rendering/base/BaseInstanceBatch.hh"
+#include "ignition/rendering/ogre2/Ogre2Object.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2InstanceBatchPrivate;
+
+    /// \brief Ogre2.x implementation of the instance batch class. Each
+    /// instance is an ogre item that shares the mesh and hlms datablock with
+    /// the other instances, which allows the hlms to render all of them in
+    /// a single instanced draw call.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2InstanceBatch :
+      public BaseInstanceBatch<Ogre2Object>
+    {
+      /// \brief Constructor
+      protected: Ogre2InstanceBatch();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2InstanceBatch();
+
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
+      /// \brief Index of the renderable custom parameter that holds the
+      /// instance custom parameter
+      public: static constexpr unsigned int kCustomParameterIndex = 2u;
+
+      // Documentation inherited.
+      protected: virtual void Init() override;
+
+      // Documentation inherited.
+      protected: virtual void UpdateInstances() override;
+
+      /// \brief Mesh factory used to create the ogre items
+      private: Ogre2MeshFactoryPtr meshFactory;
+
+      /// \brief Pointer to private data
+      private: std::unique_ptr<Ogre2InstanceBatchPrivate> dataPtr;
+
+      /// \brief Make scene our friend so it can create instance batches
+      private: friend class Ogre2Scene;
+    };
+    }
+  }
+}
+#endif
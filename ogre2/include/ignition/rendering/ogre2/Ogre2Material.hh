@@ -222,6 +222,13 @@ namespace ignition
       // \sa BaseMaterial::PreRender()
       public: virtual void PreRender() override;
 
+      /// \internal
+      /// \brief Set the textures decoded by the texture streamer since the
+      /// last call on the datablock. Called by
+      /// Ogre2RenderEngine::UpdateTextureStreaming.
+      /// \return True while the material has streamed textures
+      public: bool UpdateStreamedTextures();
+
       // Documentation inherited.
       public: virtual enum MaterialType Type() const override;
 
@@ -244,6 +251,15 @@ namespace ignition
       protected: virtual void SetTextureMapImpl(const std::string &_texture,
           Ogre::PbsTextureTypes _type);
 
+      /// \brief Load the texture map synchronously and set it on the
+      /// datablock. Used when texture streaming is disabled or the texture
+      /// could not be streamed.
+      /// \param[in] _texture Name of the texture.
+      /// \param[in] _type Type of texture, i.e. diffuse, normal, roughness,
+      /// metalness
+      protected: void LoadTextureMapImpl(const std::string &_texture,
+          Ogre::PbsTextureTypes _type);
+
       /// \brief Get a pointer to the ogre texture by name
       /// \return Ogre texture
       protected: virtual Ogre::TexturePtr Texture(const std::string &_name);
@@ -49,7 +49,12 @@ namespace ignition
       public Ogre::RenderTargetListener
     {
       /// \brief Constructor
-      public: explicit Ogre2MaterialSwitcher(Ogre2ScenePtr _scene);
+      /// \param[in] _scene Scene whose items are switched
+      /// \param[in] _materialName Material writing the unique color of an
+      /// item, from its custom parameter 1
+      public: explicit Ogre2MaterialSwitcher(Ogre2ScenePtr _scene,
+                  const std::string &_materialName =
+                  "ign-rendering/plain_color");
 
       /// \brief Destructor
       public: ~Ogre2MaterialSwitcher();
@@ -59,6 +64,12 @@ namespace ignition
       public: std::string EntityName(
               const ignition::math::Color &_color) const;
 
+      /// \brief Get the id of the visual with a specific color
+      /// \param[in] _color The item's color.
+      /// \return Visual id, 0 if no visual has the color
+      public: unsigned int VisualId(
+              const ignition::math::Color &_color) const;
+
       /// \brief Reset the color value incrementor
       public: void Reset();
 
@@ -81,6 +92,10 @@ namespace ignition
       /// renderable name
       private: std::map<unsigned int, std::string> colorDict;
 
+      /// \brief Color dictionary that maps the unique color value to the id
+      /// of the visual the renderable belongs to
+      private: std::map<unsigned int, unsigned int> colorIds;
+
       /// \brief A map of ogre sub item pointer to their original hlms material
       private: std::map<Ogre::SubItem *, Ogre::HlmsDatablock *> datablockMap;
 
@@ -22,6 +22,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include "ignition/rendering/MeshDescriptor.hh"
 #include "ignition/rendering/base/BaseMesh.hh"
 #include "ignition/rendering/ogre2/Ogre2Geometry.hh"
 #include "ignition/rendering/ogre2/Ogre2Object.hh"
@@ -86,6 +87,21 @@ namespace ignition
       public: virtual void UpdateSkeletonAnimation(
             std::chrono::steady_clock::duration _time) override;
 
+      // Documentation inherited.
+      public: virtual unsigned int SkeletonBoneCount() const override;
+
+      // Documentation inherited.
+      public: virtual std::vector<std::string> SkeletonBoneNames() const
+            override;
+
+      // Documentation inherited.
+      public: virtual int SkeletonBoneIndex(const std::string &_name) const
+            override;
+
+      // Documentation inherited.
+      public: virtual void SetSkeletonBoneTransforms(
+            const std::vector<math::Matrix4d> &_tfs) override;
+
       // Documentation inherited
       public: virtual Ogre::MovableObject *OgreObject() const override;
 
@@ -98,6 +114,10 @@ namespace ignition
       /// \brief Pointer to the ogre item object
       protected: Ogre::Item *ogreItem = nullptr;
 
+      /// \brief Descriptor the mesh was loaded from. It is used to merge
+      /// the mesh into baked static geometry.
+      protected: MeshDescriptor meshDescriptor;
+
       /// \brief Make scene our friend so it can create an ogre2 mesh
       private: friend class Ogre2Scene;
 
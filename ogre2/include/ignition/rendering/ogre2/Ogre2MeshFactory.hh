@@ -61,6 +61,12 @@ namespace ignition
       /// factory
       public: virtual void Clear();
 
+      /// \brief Remove the ogre v1 and v2 meshes created by this factory
+      /// from the given mesh descriptor. All ogre items using the mesh must
+      /// have been destroyed beforehand.
+      /// \param[in] _desc Descriptor of the mesh to remove
+      public: virtual void ClearMesh(const MeshDescriptor &_desc);
+
       /// \brief Get the ogre item based on the mesh descriptor
       /// \param[in] _desc Descriptor describing the target mesh
       protected: virtual Ogre::Item *OgreItem(
@@ -88,7 +94,8 @@ namespace ignition
       /// \param[in] _desc Mesh descriptor to be validated
       protected: virtual bool Validate(const MeshDescriptor &_desc);
 
-      /// \brief A list of ogre meshes created by this factory
+      /// \brief A list of ogre meshes used by this factory. The meshes are
+      /// shared by all scenes.
       protected: std::vector<std::string> ogreMeshes;
 
       /// \brief Pointer to the scene object
@@ -96,6 +103,12 @@ namespace ignition
 
       /// \brief Pointer to private data class
       private: std::unique_ptr<Ogre2MeshFactoryPrivate> dataPtr;
+
+      /// \brief Make instance batch our friend so it can create ogre items
+      private: friend class Ogre2InstanceBatch;
+
+      /// \brief Make static geometry our friend so it can create ogre items
+      private: friend class Ogre2StaticGeometry;
     };
 
     /// \brief Ogre2.x implementation of a submesh store factory class
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2RANGENOISEPASS_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2RANGENOISEPASS_HH_
+
+#include "ignition/rendering/base/BaseRangeNoisePass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderPass.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /* \class Ogre2RangeNoisePass Ogre2RangeNoisePass.hh \
+     * ignition/rendering/ogre2/Ogre2RangeNoisePass.hh
+     */
+    /// \brief Ogre2 Implementation of a range noise render pass. It has no
+    /// compositor node of its own: gpu rays apply the noise in the shader
+    /// that samples the ranges, and cameras ignore the pass.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2RangeNoisePass :
+      public BaseRangeNoisePass<Ogre2RenderPass>
+    {
+      /// \brief Constructor
+      public: Ogre2RangeNoisePass();
+
+      /// \brief Destructor
+      public: virtual ~Ogre2RangeNoisePass();
+    };
+    }
+  }
+}
+#endif
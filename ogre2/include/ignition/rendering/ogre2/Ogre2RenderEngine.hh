@@ -32,8 +32,10 @@
 
 namespace Ogre
 {
+  class CompositorWorkspace;
   class LogManager;
   class Root;
+  class SceneManager;
   namespace v1
   {
     class OverlaySystem;
@@ -48,6 +50,7 @@ namespace ignition
     //
     // forward declaration
     class Ogre2RenderEnginePrivate;
+    class TextureStreamer;
 
     /// \brief Plugin for loading ogre render engine
     class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2RenderEnginePlugin :
@@ -94,6 +97,10 @@ namespace ignition
       /// \param[in] _uri Resource path in the form of an uri
       public: void AddResourcePath(const std::string &_uri) override;
 
+      // Documentation Inherited.
+      public: virtual rendering::EngineResourceStats ResourceStats() const
+                  override;
+
       /// \brief Get the ogre2 root object
       /// \return ogre2 root object
       public: virtual Ogre::Root *OgreRoot() const;
@@ -121,7 +128,17 @@ namespace ignition
       /// \return list of scenes
       protected: virtual SceneStorePtr Scenes() const override;
 
-      // Documentation Inherited.
+      /// \brief Engine implementation of Load function.
+      /// \param[in] _params Parameters to be passed to the render engine.
+      /// Currently accepts the following parameters and values:
+      /// "useCurrentGLContext" : "1" or "0". Use current OpenGL context for
+      ///                                     rendering
+      /// "headless" : "1" or "0". Render through EGL without a display
+      ///                          server. Requires ogre-next 2.2 or later
+      ///                          built with EGL support, on Linux.
+      /// "textureStreaming" : "1" or "0". Decode material textures in the
+      ///                                  background
+      /// "textureMemoryBudget" : Memory budget of streamed textures in MB
       protected: virtual bool LoadImpl(
           const std::map<std::string, std::string> &_params) override;
 
@@ -168,6 +185,82 @@ namespace ignition
       /// \return Pointer to the ogre overlay system.
       public: Ogre::v1::OverlaySystem *OverlaySystem() const;
 
+      /// \internal
+      /// \brief Get the streamer used to decode material textures in the
+      /// background. Streaming is enabled by passing the "textureStreaming"
+      /// parameter to the render engine when it is loaded. The optional
+      /// "textureMemoryBudget" parameter sets the memory budget in MB.
+      /// \return Texture streamer or null if streaming is disabled
+      public: TextureStreamer *TextureStreaming() const;
+
+      /// \internal
+      /// \brief Publish newly decoded textures, free the ogre textures
+      /// evicted by the texture streamer and set the new textures on the
+      /// registered materials. Called once per frame by the scenes before
+      /// rendering.
+      public: void UpdateTextureStreaming();
+
+      /// \internal
+      /// \brief Register a material with textures decoded by the texture
+      /// streamer. Its textures are updated by UpdateTextureStreaming, also
+      /// when no visual using it is traversed, e.g. once the visual is
+      /// baked into static geometry.
+      /// \param[in] _material Material with streamed textures
+      public: void RegisterStreamingMaterial(Ogre2Material *_material);
+
+      /// \internal
+      /// \brief Stop updating the textures of a material. Call before
+      /// destroying it.
+      /// \param[in] _material Material registered with
+      /// RegisterStreamingMaterial
+      public: void UnregisterStreamingMaterial(Ogre2Material *_material);
+
+      /// \internal
+      /// \brief Render compositor workspaces of a sensor. The workspaces are
+      /// rendered right away, unless scenes are being rendered by
+      /// RenderScenes. In that case they are queued and rendered together
+      /// with the workspaces of all other sensors, one frame per stage.
+      /// \param[in] _workspaces Workspaces to render
+      /// \param[in] _stage Workspaces reading the output of other
+      /// workspaces must be in a later stage than these
+      public: void RenderWorkspaces(
+                  const std::vector<Ogre::CompositorWorkspace *> &_workspaces,
+                  unsigned int _stage = 0u);
+
+      /// \internal
+      /// \brief Get whether scenes are being rendered by RenderScenes, in
+      /// which case RenderWorkspaces queues workspaces instead of rendering
+      /// them right away
+      /// \return True while workspaces are queued
+      public: bool RenderBatchActive() const;
+
+      /// \internal
+      /// \brief Count a compositor workspace in the resources of its
+      /// scene. Call after creating it with
+      /// Ogre::CompositorManager2::addWorkspace.
+      /// \param[in] _workspace Workspace created
+      public: void RegisterWorkspace(Ogre::CompositorWorkspace *_workspace);
+
+      /// \internal
+      /// \brief Stop counting a compositor workspace. Call before removing
+      /// it with Ogre::CompositorManager2::removeWorkspace.
+      /// \param[in] _workspace Workspace about to be removed
+      public: void UnregisterWorkspace(
+                  Ogre::CompositorWorkspace *_workspace);
+
+      /// \internal
+      /// \brief Get the number of registered workspaces rendering a scene
+      /// \param[in] _sceneManager Scene manager of the scene
+      /// \return Number of workspaces
+      public: unsigned int WorkspaceCount(
+                  Ogre::SceneManager *_sceneManager) const;
+
+      // Documentation inherited
+      protected: virtual void BeginRenderBatch() override;
+
+      // Documentation inherited
+      protected: virtual void EndRenderBatch() override;
+
       /// \brief Pointer to the ogre's overlay system
       private: Ogre::v1::OverlaySystem *ogreOverlaySystem = nullptr;
 
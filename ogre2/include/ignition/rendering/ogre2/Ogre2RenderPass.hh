@@ -24,6 +24,11 @@
 #include "ignition/rendering/ogre2/Export.hh"
 #include "ignition/rendering/ogre2/Ogre2Object.hh"
 
+namespace Ogre
+{
+  class GpuProgramParameters;
+}
+
 namespace ignition
 {
   namespace rendering
@@ -49,6 +54,12 @@ namespace ignition
     /// the next RenderPass. Note that the Ogre2RenderPass class provides the
     /// node definition only and the actual node creation work is done in the
     /// Ogre2RenderTarget class when the whole workspace is constructed.
+    ///
+    /// Render passes that only modify the color of each pixel can also be
+    /// fused: a pass returning glsl code from FusedShaderSource is combined
+    /// with the neighbouring fusable passes of the chain into a single
+    /// shader, so that the whole run costs one read and one write of the
+    /// render target instead of one per pass.
     class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2RenderPass :
       public BaseRenderPass<Ogre2Object>
     {
@@ -68,6 +79,26 @@ namespace ignition
       /// \brief Create the render pass using ogre compositor
       public: virtual void CreateRenderPass();
 
+      /// \brief Get the glsl code applying this pass when it is fused with
+      /// other per-pixel passes into a single shader. The code must declare
+      /// its uniforms and helper functions with names starting with
+      /// _prefix, and define the function
+      /// `vec4 <_prefix>apply(vec4 color, vec2 uv)` returning the color of
+      /// the pixel at the texture coordinates uv.
+      /// \param[in] _prefix Prefix of the names declared by the code
+      /// \return Glsl code, or an empty string if the pass can not be fused
+      public: virtual std::string FusedShaderSource(
+                  const std::string &_prefix) const;
+
+      /// \brief Set the uniforms declared by FusedShaderSource. This is
+      /// called before each frame in place of PreRender when the pass is
+      /// fused.
+      /// \param[in] _params Parameters of the fused fragment program
+      /// \param[in] _prefix Prefix the code of the pass was declared with
+      public: virtual void UpdateFusedShaderParams(
+                  Ogre::GpuProgramParameters *_params,
+                  const std::string &_prefix);
+
       /// \brief Name of the ogre compositor node definition
       protected: std::string ogreCompositorNodeDefName;
 
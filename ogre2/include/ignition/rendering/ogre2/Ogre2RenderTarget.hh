@@ -150,6 +150,11 @@ namespace ignition
       /// \param[in] _mask Visibility mask
       public: virtual void SetVisibilityMask(uint32_t _mask);
 
+      /// \brief Get the number of compositor passes executed the last time
+      /// the workspace of this render target was rendered
+      /// \return Number of passes
+      public: unsigned int PassCount() const;
+
       /// \brief Deprecated. Use other overloads.
       public: static IGN_DEPRECATED(5) void UpdateRenderPassChain(
           Ogre::CompositorWorkspace *_workspace,
@@ -31,13 +31,16 @@ namespace ignition
     class Ogre2ArrowVisual;
     class Ogre2AxisVisual;
     class Ogre2Camera;
+    class Ogre2CameraArray;
     class Ogre2Capsule;
     class Ogre2DepthCamera;
     class Ogre2DirectionalLight;
     class Ogre2Geometry;
+    class Ogre2GeometryCache;
     class Ogre2GizmoVisual;
     class Ogre2GpuRays;
     class Ogre2Grid;
+    class Ogre2InstanceBatch;
     class Ogre2Light;
     class Ogre2LightVisual;
     class Ogre2LidarVisual;
@@ -58,6 +61,7 @@ namespace ignition
     class Ogre2Scene;
     class Ogre2Sensor;
     class Ogre2SpotLight;
+    class Ogre2StaticGeometry;
     class Ogre2SubMesh;
     class Ogre2ThermalCamera;
     class Ogre2Visual;
@@ -76,13 +80,16 @@ namespace ignition
     typedef shared_ptr<Ogre2ArrowVisual>          Ogre2ArrowVisualPtr;
     typedef shared_ptr<Ogre2AxisVisual>           Ogre2AxisVisualPtr;
     typedef shared_ptr<Ogre2Camera>               Ogre2CameraPtr;
+    typedef shared_ptr<Ogre2CameraArray>          Ogre2CameraArrayPtr;
     typedef shared_ptr<Ogre2Capsule>              Ogre2CapsulePtr;
     typedef shared_ptr<Ogre2DepthCamera>          Ogre2DepthCameraPtr;
     typedef shared_ptr<Ogre2DirectionalLight>     Ogre2DirectionalLightPtr;
     typedef shared_ptr<Ogre2Geometry>             Ogre2GeometryPtr;
+    typedef shared_ptr<Ogre2GeometryCache>        Ogre2GeometryCachePtr;
     typedef shared_ptr<Ogre2GizmoVisual>          Ogre2GizmoVisualPtr;
     typedef shared_ptr<Ogre2GpuRays>              Ogre2GpuRaysPtr;
     typedef shared_ptr<Ogre2Grid>                 Ogre2GridPtr;
+    typedef shared_ptr<Ogre2InstanceBatch>        Ogre2InstanceBatchPtr;
     typedef shared_ptr<Ogre2Light>                Ogre2LightPtr;
     typedef shared_ptr<Ogre2LightVisual>          Ogre2LightVisualPtr;
     typedef shared_ptr<Ogre2LidarVisual>          Ogre2LidarVisualPtr;
@@ -102,6 +109,7 @@ namespace ignition
     typedef shared_ptr<Ogre2Scene>                Ogre2ScenePtr;
     typedef shared_ptr<Ogre2Sensor>               Ogre2SensorPtr;
     typedef shared_ptr<Ogre2SpotLight>            Ogre2SpotLightPtr;
+    typedef shared_ptr<Ogre2StaticGeometry>       Ogre2StaticGeometryPtr;
     typedef shared_ptr<Ogre2SubMesh>              Ogre2SubMeshPtr;
     typedef shared_ptr<Ogre2ThermalCamera>        Ogre2ThermalCameraPtr;
     typedef shared_ptr<Ogre2Visual>               Ogre2VisualPtr;
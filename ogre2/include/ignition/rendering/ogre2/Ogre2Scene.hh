@@ -82,6 +82,10 @@ namespace ignition
       // Documentation inherited
       public: virtual void PreRender() override;
 
+      // Documentation inherited
+      public: virtual rendering::ResourceStats ResourceStats() const
+                  override;
+
       // Documentation inherited
       public: virtual void Clear() override;
 
@@ -94,6 +98,15 @@ namespace ignition
       // Documentation inherited
       public: virtual bool SkyEnabled() const override;
 
+      // Documentation inherited
+      public: virtual void BakeStaticGeometry() override;
+
+      // Documentation inherited
+      public: virtual void ClearStaticGeometry() override;
+
+      // Documentation inherited
+      public: virtual unsigned int StaticGeometryBatchCount() const override;
+
       /// \brief Get a pointer to the ogre scene manager
       /// \return Pointer to the ogre scene manager
       public: virtual Ogre::SceneManager *OgreSceneManager() const;
@@ -111,6 +124,25 @@ namespace ignition
       /// \return True if the number of shadow casting lights changed
       /// \sa ShadowsDirty
       public: bool ShadowsDirty() const;
+
+      /// \internal
+      /// \brief Get the name of the compositor shadow node definition of
+      /// this scene. Each scene has its own since the number of shadow
+      /// casting lights differs between scenes.
+      /// \return Name of the shadow node definition
+      public: std::string ShadowNodeName() const;
+
+      /// \internal
+      /// \brief Get the cache of procedural meshes shared by geometries such
+      /// as capsules, grids and wire boxes
+      /// \return Pointer to the geometry cache
+      public: Ogre2GeometryCachePtr GeometryCache() const;
+
+      /// \internal
+      /// \brief Mark the baked static geometry out of date. This is called
+      /// by baked visuals when they are modified. The static geometry is
+      /// rebuilt without them in the next PreRender call.
+      public: void SetStaticGeometryDirty();
       /// \endcond
 
       // Documentation inherited
@@ -151,6 +183,10 @@ namespace ignition
       protected: virtual GpuRaysPtr CreateGpuRaysImpl(unsigned int _id,
                      const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual CameraArrayPtr CreateCameraArrayImpl(
+                     unsigned int _id, const std::string &_name) override;
+
       // Documentation inherited
       protected: virtual VisualPtr CreateVisualImpl(unsigned int _id,
                      const std::string &_name) override;
@@ -245,6 +281,12 @@ namespace ignition
       protected: virtual ParticleEmitterPtr CreateParticleEmitterImpl(
                      unsigned int _id, const std::string &_name) override;
 
+      // Documentation inherited
+      protected: virtual InstanceBatchPtr CreateInstanceBatchImpl(
+                     unsigned int _id, const std::string &_name,
+                     const MeshDescriptor &_desc, MaterialPtr _material,
+                     unsigned int _count) override;
+
       /// \brief Helper function to initialize an ogre2 object
       /// \param[in] _object Ogre2 object that will be initialized
       /// \param[in] _id Unique Id to assign to the object
@@ -298,6 +340,16 @@ namespace ignition
       /// \brief Create the vaiours storage objects
       private: void CreateStores();
 
+      /// \brief Add the geometries of a static visual to the static geometry
+      /// \param[in] _visual Static visual
+      /// \return True if the visual was baked, false if any of its
+      /// geometries can not be merged
+      private: bool BakeStaticVisual(Ogre2VisualPtr _visual);
+
+      /// \brief Rebuild the static geometry from the visuals that are still
+      /// baked
+      private: void RebuildStaticGeometry();
+
       /// \brief Create a shared pointer to self
       private: Ogre2ScenePtr SharedThis();
 
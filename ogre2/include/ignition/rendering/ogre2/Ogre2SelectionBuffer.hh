@@ -19,8 +19,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "ignition/rendering/config.hh"
+#include "ignition/rendering/RayQueryResult.hh"
 #include "ignition/rendering/ogre2/Export.hh"
 
 namespace Ogre
@@ -62,6 +64,26 @@ namespace ignition
       /// \return Returns the Ogre item at the coordinate.
       public: Ogre::Item *OnSelectionClick(const int _x, const int _y);
 
+      /// \brief Render the selection buffer over the full view of the
+      /// camera and get the visual at each pixel. The buffer is kept
+      /// between calls of the same size.
+      /// \param[in] _width Width of the buffer in pixels
+      /// \param[in] _height Height of the buffer in pixels
+      /// \param[out] _ids Visual id of each pixel, row by row from the top
+      /// left, 0 where there is no visual
+      /// \return True on success
+      public: bool RenderIds(unsigned int _width, unsigned int _height,
+                  std::vector<unsigned int> &_ids);
+
+      /// \brief Get the closest surface at a pixel. Renders a single
+      /// pixel holding the item color along with the distance and normal of
+      /// the surface.
+      /// \param[in] _x X coordinate in pixels.
+      /// \param[in] _y Y coordinate in pixels.
+      /// \return Visual id, distance, point and normal in world frame of
+      /// the surface, false if there is none
+      public: RayQueryResult Pick(const int _x, const int _y);
+
       /// \brief Debug show overlay
       /// \param[in] _show True to show the selection buffer in an overlay.
       // public: void ShowOverlay(const bool _show);
@@ -75,6 +97,34 @@ namespace ignition
       /// \brief Create the render texture
       private: void CreateRTTBuffer();
 
+      /// \brief Create the full view render texture used by RenderIds
+      /// \param[in] _width Width in pixels
+      /// \param[in] _height Height in pixels
+      /// \return True on success
+      private: bool CreateIdBuffer(unsigned int _width, unsigned int _height);
+
+      /// \brief Delete the full view render texture
+      private: void DeleteIdBuffer();
+
+      /// \brief Create the render texture used by Pick
+      /// \return True on success
+      private: bool CreatePickBuffer();
+
+      /// \brief Delete the render texture used by Pick
+      private: void DeletePickBuffer();
+
+      /// \brief Set up the selection camera to render a single pixel of
+      /// the camera image
+      /// \param[in] _x X coordinate in pixels.
+      /// \param[in] _y Y coordinate in pixels.
+      /// \param[out] _u Horizontal position of the center of the pixel in
+      /// the viewport, in [0, 1]
+      /// \param[out] _v Vertical position of the center of the pixel in
+      /// the viewport, in [0, 1]
+      /// \return False if the pixel is outside of the image
+      private: bool SetPixelProjection(const int _x, const int _y,
+                   float &_u, float &_v);
+
       /// \brief Create the selection buffer offscreen render texture.
       // private: void CreateRTTOverlays();
 
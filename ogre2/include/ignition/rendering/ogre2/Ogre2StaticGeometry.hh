@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2STATICGEOMETRY_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2STATICGEOMETRY_HH_
+
+#include <memory>
+#include <vector>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "ignition/rendering/config.hh"
+#include "ignition/rendering/MeshDescriptor.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "ignition/rendering/ogre2/Export.hh"
+
+namespace Ogre
+{
+  class SceneManager;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    // forward declaration
+    class Ogre2StaticGeometryPrivate;
+
+    /// \brief Merges static meshes that share a material into large v2
+    /// meshes. The meshes are grouped into cubic regions so that the merged
+    /// meshes can still be frustum culled. The merged meshes are attached to
+    /// static scene nodes, ogre does not update their transforms and bounds
+    /// every frame.
+    class IGNITION_RENDERING_OGRE2_VISIBLE Ogre2StaticGeometry
+    {
+      /// \brief Constructor
+      /// \param[in] _meshFactory Mesh factory used to load the merged meshes
+      /// \param[in] _sceneManager Scene manager the merged meshes are added to
+      public: Ogre2StaticGeometry(Ogre2MeshFactoryPtr _meshFactory,
+          Ogre::SceneManager *_sceneManager);
+
+      /// \brief Destructor
+      public: virtual ~Ogre2StaticGeometry();
+
+      /// \brief Check whether a mesh can be merged. Only meshes without
+      /// skeleton made of triangle lists with a material for every sub-mesh
+      /// can be merged.
+      /// \param[in] _desc Loaded descriptor of the mesh
+      /// \param[in] _materials Material of each loaded sub-mesh
+      /// \return True if the mesh can be merged
+      public: bool CanMerge(const MeshDescriptor &_desc,
+          const std::vector<Ogre2MaterialPtr> &_materials) const;
+
+      /// \brief Add a mesh to the static geometry. The mesh is merged when
+      /// Build is called.
+      /// \param[in] _desc Loaded descriptor of the mesh
+      /// \param[in] _pose World pose of the mesh
+      /// \param[in] _scale World scale of the mesh
+      /// \param[in] _materials Material of each loaded sub-mesh
+      /// \return False if the mesh can not be merged
+      /// \sa CanMerge
+      public: bool AddMesh(const MeshDescriptor &_desc,
+          const math::Pose3d &_pose, const math::Vector3d &_scale,
+          const std::vector<Ogre2MaterialPtr> &_materials);
+
+      /// \brief Create the merged meshes from the meshes added since the
+      /// last call to Clear.
+      public: void Build();
+
+      /// \brief Destroy the merged meshes and forget about all added meshes
+      public: void Clear();
+
+      /// \brief Get the number of merged meshes. Each merged mesh is drawn
+      /// with one draw call.
+      /// \return Number of merged meshes
+      public: unsigned int BatchCount() const;
+
+      /// \brief Set the edge length of the cubic regions meshes are grouped
+      /// into. Only affects meshes added afterwards.
+      /// \param[in] _size Region size in meters
+      public: void SetRegionSize(double _size);
+
+      /// \brief Get the edge length of the cubic regions
+      /// \return Region size in meters
+      public: double RegionSize() const;
+
+      /// \brief Default region size in meters
+      public: static constexpr double kDefaultRegionSize = 50.0;
+
+      /// \brief Pointer to private data class
+      private: std::unique_ptr<Ogre2StaticGeometryPrivate> dataPtr;
+    };
+    }
+  }
+}
+#endif
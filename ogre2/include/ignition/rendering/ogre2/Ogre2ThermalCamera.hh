@@ -80,6 +80,13 @@ namespace ignition
           std::function<void(const uint16_t *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber) override;
 
+      /// \brief Writes the last thermal frame to a file. The frame is only
+      /// read back from the GPU while new thermal frames are connected to or
+      /// saving frames is enabled.
+      /// \param[in] _name Name of the output file
+      /// \return True if the frame was queued for writing
+      public: virtual bool SaveFrame(const std::string &_name) override;
+
       /// \brief Implementation of the render call
       public: virtual void Render() override;
 
@@ -49,6 +49,9 @@ namespace ignition
       // Documentation inherited.
       public: virtual void Init() override;
 
+      // Documentation inherited.
+      public: virtual void Destroy() override;
+
       // Documentation inherited.
       public: virtual Ogre::MovableObject *OgreObject() const override;
 
@@ -15,11 +15,15 @@
  *
  */
 
+#include <chrono>
+
 #include "ignition/rendering/ogre2/Ogre2Camera.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/ogre2/Ogre2SelectionBuffer.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/Utils.hh"
 
 #ifdef _MSC_VER
@@ -32,9 +36,13 @@
   #pragma warning(pop)
 #endif
 
+#include "Ogre2GpuTimer.hh"
+
 /// \brief Private data for the Ogre2Camera class
 class ignition::rendering::Ogre2CameraPrivate
 {
+  /// \brief Measures the GPU time of the frames
+  public: Ogre2GpuTimer gpuTimer;
 };
 
 using namespace ignition;
@@ -58,6 +66,19 @@ void Ogre2Camera::Destroy()
   if (!this->ogreCamera || !this->Scene()->IsInitialized())
     return;
 
+  // the selection buffer and render texture hold workspaces and textures
+  // rendering through the ogre camera
+  if (this->selectionBuffer)
+  {
+    delete this->selectionBuffer;
+    this->selectionBuffer = nullptr;
+  }
+  if (this->renderTexture)
+  {
+    this->renderTexture->Destroy();
+    this->renderTexture.reset();
+  }
+
   Ogre::SceneManager *ogreSceneManager;
   ogreSceneManager = this->scene->OgreSceneManager();
   if (ogreSceneManager == nullptr)
@@ -139,7 +160,34 @@ void Ogre2Camera::SetMaterial(const MaterialPtr &_material)
 //////////////////////////////////////////////////
 void Ogre2Camera::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Camera::Render");
+  // workspaces rendered together by RenderScenes are not timed on the GPU
+  bool timed = !Ogre2RenderEngine::Instance()->RenderBatchActive();
+  auto start = std::chrono::steady_clock::now();
+  if (timed)
+    this->dataPtr->gpuTimer.Begin();
   this->renderTexture->Render();
+  if (timed)
+    this->dataPtr->gpuTimer.End();
+  this->renderStats.cpuTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+//////////////////////////////////////////////////
+rendering::RenderStats Ogre2Camera::RenderStats() const
+{
+  // the ogre camera keeps the counts of the scene pass that rendered it
+  // last, read here so that batched frames are reported too
+  rendering::RenderStats stats = this->renderStats;
+  if (this->ogreCamera)
+  {
+    stats.drawCalls = this->ogreCamera->_getNumRenderedBatches();
+    stats.triangles = this->ogreCamera->_getNumRenderedFaces();
+  }
+  if (this->renderTexture)
+    stats.passCount = this->renderTexture->PassCount();
+  stats.gpuTime = this->dataPtr->gpuTimer.Elapsed();
+  return stats;
 }
 
 //////////////////////////////////////////////////
@@ -226,6 +274,21 @@ void Ogre2Camera::SetSelectionBuffer()
   this->selectionBuffer = new Ogre2SelectionBuffer(this->name, this->scene);
 }
 
+//////////////////////////////////////////////////
+bool Ogre2Camera::RenderIds(unsigned int _width, unsigned int _height,
+    std::vector<unsigned int> &_ids)
+{
+  if (!this->selectionBuffer)
+  {
+    this->SetSelectionBuffer();
+
+    if (!this->selectionBuffer)
+      return false;
+  }
+
+  return this->selectionBuffer->RenderIds(_width, _height, _ids);
+}
+
 //////////////////////////////////////////////////
 VisualPtr Ogre2Camera::VisualAt(const ignition::math::Vector2i &_mousePos)
 {
@@ -270,6 +333,23 @@ VisualPtr Ogre2Camera::VisualAt(const ignition::math::Vector2i &_mousePos)
   return result;
 }
 
+//////////////////////////////////////////////////
+RayQueryResult Ogre2Camera::PickAt(const ignition::math::Vector2i &_pos)
+{
+  if (!this->selectionBuffer)
+  {
+    this->SetSelectionBuffer();
+
+    if (!this->selectionBuffer)
+      return RayQueryResult();
+  }
+
+  float ratio = screenScalingFactor();
+  return this->selectionBuffer->Pick(
+      static_cast<int>(std::rint(ratio * _pos.X())),
+      static_cast<int>(std::rint(ratio * _pos.Y())));
+}
+
 //////////////////////////////////////////////////
 RenderWindowPtr Ogre2Camera::CreateRenderWindow()
 {
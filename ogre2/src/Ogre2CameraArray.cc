@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/ogre2/Ogre2CameraArray.hh"
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+/// \brief Private data for the Ogre2CameraArray class
+class ignition::rendering::Ogre2CameraArrayPrivate
+{
+  /// \brief Largest atlas edge in pixels. Most GL 4 drivers support 16k
+  /// textures.
+  public: static constexpr unsigned int kMaxAtlasSize = 16384u;
+
+  /// \brief Scene node of each view, children of the camera array node
+  public: std::vector<Ogre::SceneNode *> viewNodes;
+
+  /// \brief Ogre camera of each view
+  public: std::vector<Ogre::Camera *> viewCameras;
+
+  /// \brief Texture all views are rendered into
+  public: Ogre::TexturePtr atlasTexture;
+
+  /// \brief Compositor workspace rendering all views
+  public: Ogre::CompositorWorkspace *workspace = nullptr;
+
+  /// \brief Name of the compositor workspace definition
+  public: std::string workspaceDefName;
+
+  /// \brief Name of the compositor node definition
+  public: std::string nodeDefName;
+
+  /// \brief Atlas read back from the gpu
+  public: std::vector<unsigned char> atlasData;
+
+  /// \brief Visibility mask the compositor was built with
+  public: uint32_t visibilityMask = 0u;
+
+  /// \brief Background colour the compositor was built with
+  public: math::Color backgroundColor;
+
+  /// \brief Event used to deliver the views of new frames
+  public: common::EventT<void(const unsigned char *, unsigned int,
+              unsigned int, unsigned int, unsigned int, PixelFormat)>
+              newViewFrame;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2CameraArray::Ogre2CameraArray()
+  : dataPtr(std::make_unique<Ogre2CameraArrayPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2CameraArray::~Ogre2CameraArray()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::Init()
+{
+  BaseCameraArray::Init();
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::Destroy()
+{
+  this->DestroyAtlas();
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::PreRender()
+{
+  IGN_RENDERING_TRACE_ZONE("Ogre2CameraArray::PreRender");
+  // the compositor has to be rebuilt when anything baked into its passes
+  // changes
+  if (this->visibilityMask != this->dataPtr->visibilityMask ||
+      this->scene->BackgroundColor() != this->dataPtr->backgroundColor)
+  {
+    this->layoutDirty = true;
+  }
+
+  if (this->layoutDirty)
+  {
+    this->DestroyAtlas();
+    this->CreateAtlas();
+    this->layoutDirty = false;
+    this->viewsDirty = true;
+  }
+
+  if (this->viewsDirty)
+  {
+    this->UpdateViews();
+    this->viewsDirty = false;
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::Render()
+{
+  IGN_RENDERING_TRACE_ZONE("Ogre2CameraArray::Render");
+  if (!this->dataPtr->workspace)
+    return;
+
+  // all views are rendered by the passes of a single workspace
+  auto engine = Ogre2RenderEngine::Instance();
+  engine->RenderWorkspaces({this->dataPtr->workspace});
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::PostRender()
+{
+  IGN_RENDERING_TRACE_ZONE("Ogre2CameraArray::PostRender");
+  if (!this->dataPtr->workspace)
+    return;
+
+  unsigned int width = this->ImageWidth();
+  unsigned int height = this->ImageHeight();
+  unsigned int columns = this->ColumnCount();
+  unsigned int atlasWidth = columns * width;
+  unsigned int atlasHeight = this->RowCount() * height;
+  PixelFormat format = this->ImageFormat();
+  unsigned int bytesPerPixel = PixelUtil::BytesPerPixel(format);
+
+  this->dataPtr->atlasData.resize(
+      static_cast<size_t>(atlasWidth) * atlasHeight * bytesPerPixel);
+
+  // one read back for all views
+  Ogre::PixelBox dstBox(atlasWidth, atlasHeight, 1,
+      Ogre2Conversions::Convert(format), this->dataPtr->atlasData.data());
+  Ogre::RenderTarget *rt =
+      this->dataPtr->atlasTexture->getBuffer()->getRenderTarget();
+  rt->copyContentsToMemory(dstBox, Ogre::RenderTarget::FB_FRONT);
+
+  if (this->dataPtr->newViewFrame.ConnectionCount() <= 0u)
+    return;
+
+  // views are handed out in place, the stride skips the other views of the
+  // same atlas row
+  unsigned int stride = atlasWidth * bytesPerPixel;
+  for (unsigned int i = 0; i < this->ViewCount(); ++i)
+  {
+    size_t row = i / columns;
+    size_t column = i % columns;
+    const unsigned char *data = this->dataPtr->atlasData.data() +
+        row * height * stride + column * width * bytesPerPixel;
+    {
+      IGN_RENDERING_TRACE_ZONE("Ogre2CameraArray::NewViewFrame");
+      this->dataPtr->newViewFrame(data, i, width, height, stride, format);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+const unsigned char *Ogre2CameraArray::Data() const
+{
+  if (this->dataPtr->atlasData.empty())
+    return nullptr;
+  return this->dataPtr->atlasData.data();
+}
+
+//////////////////////////////////////////////////
+common::ConnectionPtr Ogre2CameraArray::ConnectNewImageFrame(
+    NewViewFrameListener _listener)
+{
+  return this->dataPtr->newViewFrame.Connect(_listener);
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::CreateAtlas()
+{
+  unsigned int count = this->ViewCount();
+  if (count == 0u)
+    return;
+
+  unsigned int columns = this->ColumnCount();
+  unsigned int rows = this->RowCount();
+  unsigned int atlasWidth = columns * this->ImageWidth();
+  unsigned int atlasHeight = rows * this->ImageHeight();
+  if (atlasWidth > Ogre2CameraArrayPrivate::kMaxAtlasSize ||
+      atlasHeight > Ogre2CameraArrayPrivate::kMaxAtlasSize)
+  {
+    ignerr << "Camera array [" << this->Name() << "] atlas of "
+           << atlasWidth << "x" << atlasHeight << " exceeds the maximum "
+           << "texture size of " << Ogre2CameraArrayPrivate::kMaxAtlasSize
+           << ". Reduce the number or size of the views." << std::endl;
+    return;
+  }
+
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  if (sceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+    return;
+  }
+
+  // one ogre camera per view, each on its own child node so that the view
+  // poses are relative to the camera array
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    Ogre::SceneNode *node = this->ogreNode->createChildSceneNode();
+    Ogre::Camera *camera = sceneManager->createCamera(
+        this->Name() + "_view_" + std::to_string(i));
+    camera->detachFromParent();
+    node->attachObject(camera);
+
+    // rotate to Gazebo coordinate system
+    camera->yaw(Ogre::Degree(-90.0));
+    camera->roll(Ogre::Degree(-90.0));
+    camera->setFixedYawAxis(false);
+
+    // the viewport of a view is a tile of the atlas, the aspect ratio is
+    // that of the view and not that of the atlas
+    camera->setAutoAspectRatio(false);
+    camera->setProjectionType(Ogre::PT_PERSPECTIVE);
+    camera->setCustomProjectionMatrix(false);
+
+    this->dataPtr->viewNodes.push_back(node);
+    this->dataPtr->viewCameras.push_back(camera);
+  }
+
+  this->dataPtr->atlasTexture =
+      Ogre::TextureManager::getSingleton().createManual(
+      this->Name() + "_atlas", "General", Ogre::TEX_TYPE_2D,
+      atlasWidth, atlasHeight, 1, 0,
+      Ogre2Conversions::Convert(this->ImageFormat()), Ogre::TU_RENDERTARGET,
+      0, false, 0, Ogre::BLANKSTRING, false, true);
+
+  this->dataPtr->visibilityMask = this->visibilityMask;
+  this->dataPtr->backgroundColor = this->scene->BackgroundColor();
+
+  // The compositor workspace definition is equivalent to the following
+  // ogre compositor script, with one render_scene pass per view:
+  // compositor_node CameraArray
+  // {
+  //   in 0 rt_input
+  //   target rt_input
+  //   {
+  //     pass clear
+  //     {
+  //       colour_value <background colour>
+  //     }
+  //     pass render_scene
+  //     {
+  //       camera <view camera>
+  //       viewport <view tile>
+  //     }
+  //     ...
+  //   }
+  //   out 0 rt_input
+  // }
+  // Views are rendered without shadows, the shadow maps would have to be
+  // updated once per view which defeats the purpose of the atlas.
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::CompositorManager2 *ogreCompMgr =
+      engine->OgreRoot()->getCompositorManager2();
+
+  this->dataPtr->workspaceDefName = "CameraArrayWorkspace_" + this->Name();
+  this->dataPtr->nodeDefName = this->dataPtr->workspaceDefName + "/Node";
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(this->dataPtr->nodeDefName);
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->setNumTargetPass(1);
+
+  Ogre::CompositorTargetDef *targetDef = nodeDef->addTargetPass("rt_input");
+  targetDef->setNumPasses(1 + count);
+  {
+    // clear pass
+    Ogre::CompositorPassClearDef *passClear =
+        static_cast<Ogre::CompositorPassClearDef *>(
+        targetDef->addPass(Ogre::PASS_CLEAR));
+    passClear->mColourValue =
+        Ogre2Conversions::Convert(this->dataPtr->backgroundColor);
+
+    // scene pass of each view, restricted to its tile
+    float tileWidth = 1.0f / static_cast<float>(columns);
+    float tileHeight = 1.0f / static_cast<float>(rows);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      Ogre::CompositorPassSceneDef *passScene =
+          static_cast<Ogre::CompositorPassSceneDef *>(
+          targetDef->addPass(Ogre::PASS_SCENE));
+      passScene->mCameraName = this->dataPtr->viewCameras[i]->getName();
+      passScene->mVisibilityMask = this->visibilityMask;
+      passScene->mIncludeOverlays = false;
+      passScene->mVpLeft = (i % columns) * tileWidth;
+      passScene->mVpTop = (i / columns) * tileHeight;
+      passScene->mVpWidth = tileWidth;
+      passScene->mVpHeight = tileHeight;
+      passScene->mVpScissorLeft = passScene->mVpLeft;
+      passScene->mVpScissorTop = passScene->mVpTop;
+      passScene->mVpScissorWidth = tileWidth;
+      passScene->mVpScissorHeight = tileHeight;
+    }
+  }
+  nodeDef->mapOutputChannel(0, "rt_input");
+
+  Ogre::CompositorWorkspaceDef *workspaceDef =
+      ogreCompMgr->addWorkspaceDefinition(this->dataPtr->workspaceDefName);
+  workspaceDef->connectExternal(0, nodeDef->getName(), 0);
+
+  Ogre::RenderTarget *rt =
+      this->dataPtr->atlasTexture->getBuffer()->getRenderTarget();
+  this->dataPtr->workspace = ogreCompMgr->addWorkspace(sceneManager, rt,
+      this->dataPtr->viewCameras[0], this->dataPtr->workspaceDefName, false);
+  engine->RegisterWorkspace(this->dataPtr->workspace);
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::DestroyAtlas()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::CompositorManager2 *ogreCompMgr =
+      engine->OgreRoot()->getCompositorManager2();
+
+  if (this->dataPtr->workspace)
+  {
+    engine->UnregisterWorkspace(this->dataPtr->workspace);
+    ogreCompMgr->removeWorkspace(this->dataPtr->workspace);
+    this->dataPtr->workspace = nullptr;
+  }
+
+  if (!this->dataPtr->workspaceDefName.empty())
+  {
+    ogreCompMgr->removeWorkspaceDefinition(this->dataPtr->workspaceDefName);
+    ogreCompMgr->removeNodeDefinition(this->dataPtr->nodeDefName);
+    this->dataPtr->workspaceDefName.clear();
+    this->dataPtr->nodeDefName.clear();
+  }
+
+  if (this->dataPtr->atlasTexture)
+  {
+    Ogre::TextureManager::getSingleton().remove(
+        this->dataPtr->atlasTexture->getName());
+    this->dataPtr->atlasTexture.reset();
+  }
+
+  Ogre::SceneManager *sceneManager =
+      this->scene ? this->scene->OgreSceneManager() : nullptr;
+  if (sceneManager)
+  {
+    for (auto camera : this->dataPtr->viewCameras)
+      sceneManager->destroyCamera(camera);
+    for (auto node : this->dataPtr->viewNodes)
+      sceneManager->destroySceneNode(node);
+  }
+  this->dataPtr->viewCameras.clear();
+  this->dataPtr->viewNodes.clear();
+  this->dataPtr->atlasData.clear();
+}
+
+//////////////////////////////////////////////////
+void Ogre2CameraArray::UpdateViews()
+{
+  double aspect = static_cast<double>(this->ImageWidth()) /
+      static_cast<double>(this->ImageHeight());
+  double vfov = 2.0 * std::atan(std::tan(this->HFOV().Radian() / 2.0) /
+      aspect);
+
+  for (unsigned int i = 0; i < this->dataPtr->viewCameras.size(); ++i)
+  {
+    const math::Pose3d &pose = this->viewPoses[i];
+    Ogre::SceneNode *node = this->dataPtr->viewNodes[i];
+    node->setPosition(Ogre2Conversions::Convert(pose.Pos()));
+    node->setOrientation(Ogre2Conversions::Convert(pose.Rot()));
+
+    Ogre::Camera *camera = this->dataPtr->viewCameras[i];
+    camera->setAspectRatio(aspect);
+    camera->setFOVy(Ogre::Radian(vfov));
+    camera->setNearClipDistance(this->NearClipPlane());
+    camera->setFarClipDistance(this->FarClipPlane());
+  }
+}
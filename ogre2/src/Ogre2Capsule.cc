@@ -21,6 +21,7 @@
 #include <ignition/common/MeshManager.hh>
 
 #include "ignition/rendering/ogre2/Ogre2Capsule.hh"
+#include "ignition/rendering/ogre2/Ogre2GeometryCache.hh"
 #include "ignition/rendering/ogre2/Ogre2Material.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/ogre2/Ogre2Mesh.hh"
@@ -33,6 +34,9 @@ class ignition::rendering::Ogre2CapsulePrivate
 
   /// \brief Mesh Object for capsule shape
   public: Ogre2MeshPtr ogreMesh{nullptr};
+
+  /// \brief Name of the shared capsule mesh in the geometry cache
+  public: std::string meshName;
 };
 
 using namespace ignition;
@@ -81,6 +85,13 @@ void Ogre2Capsule::Destroy()
     this->dataPtr->ogreMesh.reset();
   }
 
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  if (!this->dataPtr->meshName.empty() && ogreScene)
+  {
+    ogreScene->GeometryCache()->Release(this->dataPtr->meshName);
+    this->dataPtr->meshName.clear();
+  }
+
   if (this->dataPtr->material && this->Scene())
   {
     this->Scene()->DestroyMaterial(this->dataPtr->material);
@@ -91,22 +102,30 @@ void Ogre2Capsule::Destroy()
 //////////////////////////////////////////////////
 void Ogre2Capsule::Update()
 {
-  common::MeshManager *meshMgr = common::MeshManager::Instance();
-  std::string capsuleMeshName = "capsule_mesh";
-  capsuleMeshName += "_" + std::to_string(this->radius)
-      + "_" + std::to_string(this->length);
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  Ogre2GeometryCachePtr cache = ogreScene->GeometryCache();
+
+  // Capsules with the same quantized radius, length and tessellation level
+  // share the same mesh
+  std::string capsuleMeshName =
+      cache->AcquireCapsule(this->radius, this->length);
+  if (capsuleMeshName.empty())
+    return;
 
-  // Create new mesh if needed
-  if (!meshMgr->HasMesh(capsuleMeshName))
+  // nothing to do if the change does not affect the shared mesh
+  if (this->dataPtr->ogreMesh && capsuleMeshName == this->dataPtr->meshName)
   {
-    meshMgr->CreateCapsule(capsuleMeshName, this->radius, this->length, 32, 32);
+    cache->Release(capsuleMeshName);
+    return;
   }
 
+  common::MeshManager *meshMgr = common::MeshManager::Instance();
   MeshDescriptor meshDescriptor;
   meshDescriptor.mesh = meshMgr->MeshByName(capsuleMeshName);
   if (meshDescriptor.mesh == nullptr)
   {
     ignerr << "Capsule mesh is unavailable in the Mesh Manager" << std::endl;
+    cache->Release(capsuleMeshName);
     return;
   }
 
@@ -122,6 +141,12 @@ void Ogre2Capsule::Update()
     }
     this->dataPtr->ogreMesh->Destroy();
   }
+
+  // the old mesh can only be released once its ogre item is destroyed
+  if (!this->dataPtr->meshName.empty())
+    cache->Release(this->dataPtr->meshName);
+  this->dataPtr->meshName = capsuleMeshName;
+
   this->dataPtr->ogreMesh = std::dynamic_pointer_cast<Ogre2Mesh>(
       this->Scene()->CreateMesh(meshDescriptor));
   if (this->dataPtr->material != nullptr)
@@ -26,7 +26,9 @@
 #include <math.h>
 #include <ignition/math/Helpers.hh>
 
+#include "ignition/rendering/FrameSaver.hh"
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2DepthCamera.hh"
 #include "ignition/rendering/ogre2/Ogre2GaussianNoisePass.hh"
@@ -85,6 +87,10 @@ class ignition::rendering::Ogre2DepthCameraPrivate
   /// \brief Outgoing point cloud data, used by newRgbPointCloud event.
   public: float *pointCloudImage = nullptr;
 
+  /// \brief True if the compositor only renders and reads back the depth
+  /// channel. This is the case when there are no point cloud subscribers.
+  public: bool depthOnly = false;
+
   /// \brief maximum value used for data outside sensor range
   public: float dataMaxVal = ignition::math::INF_D;
 
@@ -292,6 +298,27 @@ void Ogre2DepthCamera::Destroy()
   if (!this->ogreCamera)
     return;
 
+  this->DestroyDepthTexture();
+
+  Ogre::SceneManager *ogreSceneManager;
+  ogreSceneManager = this->scene->OgreSceneManager();
+  if (ogreSceneManager == nullptr)
+  {
+    ignerr << "Scene manager cannot be obtained" << std::endl;
+  }
+  else
+  {
+    if (ogreSceneManager->findCameraNoThrow(this->name) != nullptr)
+    {
+      ogreSceneManager->destroyCamera(this->ogreCamera);
+      this->ogreCamera = nullptr;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::DestroyDepthTexture()
+{
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
@@ -303,19 +330,31 @@ void Ogre2DepthCamera::Destroy()
     {
       Ogre::TextureManager::getSingleton().remove(
             this->dataPtr->ogreDepthTexture[i]->getName());
+      this->dataPtr->ogreDepthTexture[i].reset();
     }
   }
   if (this->dataPtr->ogreCompositorWorkspace)
   {
     this->RemoveWorkspaceCrashWorkaround();
+    engine->UnregisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
     ogreCompMgr->removeWorkspace(
         this->dataPtr->ogreCompositorWorkspace);
+    this->dataPtr->ogreCompositorWorkspace = nullptr;
   }
+  this->dataPtr->particleNoiseListener.reset();
 
   if (this->dataPtr->depthMaterial)
   {
     Ogre::MaterialManager::getSingleton().remove(
         this->dataPtr->depthMaterial->getName());
+    this->dataPtr->depthMaterial.reset();
+  }
+
+  if (this->dataPtr->depthFinalMaterial)
+  {
+    Ogre::MaterialManager::getSingleton().remove(
+        this->dataPtr->depthFinalMaterial->getName());
+    this->dataPtr->depthFinalMaterial.reset();
   }
 
   if (!this->dataPtr->ogreCompositorWorkspaceDef.empty())
@@ -326,22 +365,13 @@ void Ogre2DepthCamera::Destroy()
         this->dataPtr->ogreCompositorBaseNodeDef);
     ogreCompMgr->removeNodeDefinition(
         this->dataPtr->ogreCompositorFinalNodeDef);
+    this->dataPtr->ogreCompositorWorkspaceDef.clear();
+    this->dataPtr->ogreCompositorBaseNodeDef.clear();
+    this->dataPtr->ogreCompositorFinalNodeDef.clear();
   }
 
-  Ogre::SceneManager *ogreSceneManager;
-  ogreSceneManager = this->scene->OgreSceneManager();
-  if (ogreSceneManager == nullptr)
-  {
-    ignerr << "Scene manager cannot be obtained" << std::endl;
-  }
-  else
-  {
-    if (ogreSceneManager->findCameraNoThrow(this->name) != nullptr)
-    {
-      ogreSceneManager->destroyCamera(this->ogreCamera);
-      this->ogreCamera = nullptr;
-    }
-  }
+  // render passes need to be chained again in the new workspace
+  this->dataPtr->renderPassDirty = !this->dataPtr->renderPasses.empty();
 }
 
 //////////////////////////////////////////////////
@@ -397,10 +427,17 @@ void Ogre2DepthCamera::CreateDepthTexture()
   this->ogreCamera->setAspectRatio(this->aspect);
   this->ogreCamera->setFOVy(Ogre::Radian(this->LimitFOV(vfov)));
 
+  // Color and point cloud data are only generated when there are point cloud
+  // subscribers. Otherwise only the range is rendered and read back, which
+  // is a quarter of the data.
+  this->dataPtr->depthOnly =
+      this->dataPtr->newRgbPointCloud.ConnectionCount() == 0u;
+
   // Load depth material
   // The DepthCamera material is defined in script (depth_camera.material).
   // We need to clone it since we are going to modify its uniform variables
-  std::string matDepthName = "DepthCamera";
+  std::string matDepthName = this->dataPtr->depthOnly ?
+      "DepthCameraDepthOnly" : "DepthCamera";
   Ogre::MaterialPtr matDepth =
       Ogre::MaterialManager::getSingleton().getByName(matDepthName);
   this->dataPtr->depthMaterial = matDepth->clone(
@@ -437,10 +474,13 @@ void Ogre2DepthCamera::CreateDepthTexture()
       static_cast<float>(this->dataPtr->dataMaxVal));
   psParams->setNamedConstant("min",
       static_cast<float>(this->dataPtr->dataMinVal));
-  Ogre::Vector3 bg(this->Scene()->BackgroundColor().R(),
-    this->Scene()->BackgroundColor().G(),
-    this->Scene()->BackgroundColor().B());
-  psParams->setNamedConstant("backgroundColor", bg);
+  if (!this->dataPtr->depthOnly)
+  {
+    Ogre::Vector3 bg(this->Scene()->BackgroundColor().R(),
+      this->Scene()->BackgroundColor().G(),
+      this->Scene()->BackgroundColor().B());
+    psParams->setNamedConstant("backgroundColor", bg);
+  }
   psParams->setNamedConstant("particleStddev",
     static_cast<float>(this->dataPtr->particleStddev));
 
@@ -463,9 +503,10 @@ void Ogre2DepthCamera::CreateDepthTexture()
   psParamsFinal->setNamedConstant("min",
       static_cast<float>(this->dataPtr->dataMinVal));
 
-  // create background material is specified
+  // create background material is specified. The background is only
+  // visible in the color data.
   MaterialPtr backgroundMaterial = this->Scene()->BackgroundMaterial();
-  bool validBackground = backgroundMaterial &&
+  bool validBackground = !this->dataPtr->depthOnly && backgroundMaterial &&
       !backgroundMaterial->EnvironmentMap().empty();
 
   if (validBackground)
@@ -514,6 +555,9 @@ void Ogre2DepthCamera::CreateDepthTexture()
     //     else
     //       set depth data to d1
     //   set color data to c1
+    //
+    // In depth only mode the color pass is skipped, rt0 and rt1 are
+    // PF_FLOAT32_R textures and only the depth data is written.
 
     // We need to programmatically create the compositor because we need to
     // configure it to use the cloned depth material created earlier.
@@ -615,27 +659,31 @@ void Ogre2DepthCamera::CreateDepthTexture()
     depthTexDef->depthBufferFormat = Ogre::PF_UNKNOWN;
     depthTexDef->fsaaExplicitResolve = false;
 
-    Ogre::TextureDefinitionBase::TextureDefinition *colorTexDef =
-        baseNodeDef->addTextureDefinition("colorTexture");
-    colorTexDef->textureType = Ogre::TEX_TYPE_2D;
-    colorTexDef->width = 0;
-    colorTexDef->height = 0;
-    colorTexDef->depth = 1;
-    colorTexDef->numMipmaps = 0;
-    colorTexDef->widthFactor = 1;
-    colorTexDef->heightFactor = 1;
-    colorTexDef->formatList = {Ogre::PF_R8G8B8};
-    colorTexDef->fsaa = 0;
-    colorTexDef->uav = false;
-    colorTexDef->automipmaps = false;
-    // Enable gamma write to avoid discretization in the color values
-    // Note we are using low level materials in quad pass so also had to perform
-    // gamma correction in the fragment shaders (depth_camera_fs.glsl)
-    colorTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolTrue;
-    colorTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
-    colorTexDef->depthBufferFormat = Ogre::PF_D32_FLOAT;
-    colorTexDef->preferDepthTexture = true;
-    colorTexDef->fsaaExplicitResolve = false;
+    if (!this->dataPtr->depthOnly)
+    {
+      Ogre::TextureDefinitionBase::TextureDefinition *colorTexDef =
+          baseNodeDef->addTextureDefinition("colorTexture");
+      colorTexDef->textureType = Ogre::TEX_TYPE_2D;
+      colorTexDef->width = 0;
+      colorTexDef->height = 0;
+      colorTexDef->depth = 1;
+      colorTexDef->numMipmaps = 0;
+      colorTexDef->widthFactor = 1;
+      colorTexDef->heightFactor = 1;
+      colorTexDef->formatList = {Ogre::PF_R8G8B8};
+      colorTexDef->fsaa = 0;
+      colorTexDef->uav = false;
+      colorTexDef->automipmaps = false;
+      // Enable gamma write to avoid discretization in the color values
+      // Note we are using low level materials in quad pass so also had to
+      // perform gamma correction in the fragment shaders
+      // (depth_camera_fs.glsl)
+      colorTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolTrue;
+      colorTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+      colorTexDef->depthBufferFormat = Ogre::PF_D32_FLOAT;
+      colorTexDef->preferDepthTexture = true;
+      colorTexDef->fsaaExplicitResolve = false;
+    }
 
     Ogre::TextureDefinitionBase::TextureDefinition *particleTexDef =
         baseNodeDef->addTextureDefinition("particleTexture");
@@ -674,44 +722,45 @@ void Ogre2DepthCamera::CreateDepthTexture()
     particleDepthTexDef->depthBufferFormat = Ogre::PF_UNKNOWN;
     particleDepthTexDef->fsaaExplicitResolve = false;
 
-    baseNodeDef->setNumTargetPass(5);
-
-    Ogre::CompositorTargetDef *colorTargetDef =
-        baseNodeDef->addTargetPass("colorTexture");
+    baseNodeDef->setNumTargetPass(this->dataPtr->depthOnly ? 4 : 5);
 
-    if (validBackground)
-      colorTargetDef->setNumPasses(3);
-    else
-      colorTargetDef->setNumPasses(2);
+    if (!this->dataPtr->depthOnly)
     {
-      // clear pass
-      Ogre::CompositorPassClearDef *passClear =
-          static_cast<Ogre::CompositorPassClearDef *>(
-          colorTargetDef->addPass(Ogre::PASS_CLEAR));
-      passClear->mColourValue = Ogre::ColourValue(
-          Ogre2Conversions::Convert(this->Scene()->BackgroundColor()));
+      Ogre::CompositorTargetDef *colorTargetDef =
+          baseNodeDef->addTargetPass("colorTexture");
 
       if (validBackground)
+        colorTargetDef->setNumPasses(3);
+      else
+        colorTargetDef->setNumPasses(2);
       {
-        // quad pass
-        Ogre::CompositorPassQuadDef *passQuad =
-            static_cast<Ogre::CompositorPassQuadDef *>(
-            colorTargetDef->addPass(Ogre::PASS_QUAD));
-        passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
-            + this->Name();
-        passQuad->mFrustumCorners =
-            Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
+        // clear pass
+        Ogre::CompositorPassClearDef *passClear =
+            static_cast<Ogre::CompositorPassClearDef *>(
+            colorTargetDef->addPass(Ogre::PASS_CLEAR));
+        passClear->mColourValue = Ogre::ColourValue(
+            Ogre2Conversions::Convert(this->Scene()->BackgroundColor()));
+
+        if (validBackground)
+        {
+          // quad pass
+          Ogre::CompositorPassQuadDef *passQuad =
+              static_cast<Ogre::CompositorPassQuadDef *>(
+              colorTargetDef->addPass(Ogre::PASS_QUAD));
+          passQuad->mMaterialName = this->dataPtr->kSkyboxMaterialName + "_"
+              + this->Name();
+          passQuad->mFrustumCorners =
+              Ogre::CompositorPassQuadDef::CAMERA_DIRECTION;
+        }
+
+        // scene pass
+        Ogre::CompositorPassSceneDef *passScene =
+            static_cast<Ogre::CompositorPassSceneDef *>(
+            colorTargetDef->addPass(Ogre::PASS_SCENE));
+        passScene->mVisibilityMask = IGN_VISIBILITY_ALL;
+
+        passScene->mShadowNode = this->scene->ShadowNodeName();
       }
-
-      // scene pass
-      Ogre::CompositorPassSceneDef *passScene =
-          static_cast<Ogre::CompositorPassSceneDef *>(
-          colorTargetDef->addPass(Ogre::PASS_SCENE));
-      passScene->mVisibilityMask = IGN_VISIBILITY_ALL;
-
-      // todo(anyone) PbsMaterialsShadowNode is hardcoded.
-      // Although this may be just fine
-      passScene->mShadowNode = "PbsMaterialsShadowNode";
     }
 
     Ogre::CompositorTargetDef *depthTargetDef =
@@ -788,10 +837,12 @@ void Ogre2DepthCamera::CreateDepthTexture()
           static_cast<Ogre::CompositorPassQuadDef *>(
           inTargetDef->addPass(Ogre::PASS_QUAD));
       passQuad->mMaterialName = this->dataPtr->depthMaterial->getName();
-      passQuad->addQuadTextureSource(0, "depthTexture", 0);
-      passQuad->addQuadTextureSource(1, "colorTexture", 0);
-      passQuad->addQuadTextureSource(2, "particleTexture", 0);
-      passQuad->addQuadTextureSource(3, "particleDepthTexture", 0);
+      size_t texIdx = 0u;
+      passQuad->addQuadTextureSource(texIdx++, "depthTexture", 0);
+      if (!this->dataPtr->depthOnly)
+        passQuad->addQuadTextureSource(texIdx++, "colorTexture", 0);
+      passQuad->addQuadTextureSource(texIdx++, "particleTexture", 0);
+      passQuad->addQuadTextureSource(texIdx++, "particleDepthTexture", 0);
       passQuad->mFrustumCorners =
           Ogre::CompositorPassQuadDef::VIEW_SPACE_CORNERS;
     }
@@ -879,13 +930,15 @@ void Ogre2DepthCamera::CreateDepthTexture()
   }
 
   // create render texture - these textures pack the range data
+  Ogre::PixelFormat textureFormat = this->dataPtr->depthOnly ?
+      Ogre::PF_FLOAT32_R : Ogre::PF_FLOAT32_RGBA;
   for( size_t i = 0u; i < 2u; ++i )
   {
     this->dataPtr->ogreDepthTexture[i] =
       Ogre::TextureManager::getSingleton().createManual(
       this->Name() + "_depth" + std::to_string(i), "General",
       Ogre::TEX_TYPE_2D, this->ImageWidth(), this->ImageHeight(), 1, 0,
-      Ogre::PF_FLOAT32_RGBA, Ogre::TU_RENDERTARGET,
+      textureFormat, Ogre::TU_RENDERTARGET,
       0, false, 0, Ogre::BLANKSTRING, false, true);
 
     Ogre::RenderTarget *rt =
@@ -916,6 +969,7 @@ void Ogre2DepthCamera::CreateWorkspaceInstance()
       ogreCompMgr->addWorkspace(this->scene->OgreSceneManager(),
       externalTargets, this->ogreCamera,
       this->dataPtr->ogreCompositorWorkspaceDef, false);
+  engine->RegisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
 
   // add the listener
   Ogre::CompositorNode *node =
@@ -940,16 +994,25 @@ void Ogre2DepthCamera::CreateWorkspaceInstance()
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2DepthCamera::Render");
   // update the compositors
-  this->dataPtr->ogreCompositorWorkspace->setEnabled(true);
   auto engine = Ogre2RenderEngine::Instance();
-  engine->OgreRoot()->renderOneFrame();
-  this->dataPtr->ogreCompositorWorkspace->setEnabled(false);
+  engine->RenderWorkspaces({this->dataPtr->ogreCompositorWorkspace});
 }
 
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2DepthCamera::PreRender");
+  // switch between depth only and point cloud output when point cloud
+  // subscribers connect or disconnect
+  bool depthOnly = this->dataPtr->newRgbPointCloud.ConnectionCount() == 0u;
+  if (this->dataPtr->ogreDepthTexture[0] &&
+      depthOnly != this->dataPtr->depthOnly)
+  {
+    this->DestroyDepthTexture();
+  }
+
   if (!this->dataPtr->ogreDepthTexture[0])
     this->CreateDepthTexture();
 
@@ -1012,14 +1075,33 @@ void Ogre2DepthCamera::PreRender()
 //////////////////////////////////////////////////
 void Ogre2DepthCamera::PostRender()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2DepthCamera::PostRender");
   unsigned int width = this->ImageWidth();
   unsigned int height = this->ImageHeight();
+  int len = width * height;
+
+  if (!this->dataPtr->depthImage)
+  {
+    this->dataPtr->depthImage = new float[len];
+  }
+
+  auto rt = this->dataPtr->ogreDepthTexture[1]->getBuffer()->getRenderTarget();
+
+  if (this->dataPtr->depthOnly)
+  {
+    // blit depth data from gpu to cpu, no need to extract the depth channel
+    Ogre::PixelBox dstBox(width, height,
+          1, Ogre::PF_FLOAT32_R, this->dataPtr->depthImage);
+    rt->copyContentsToMemory(dstBox, Ogre::RenderTarget::FB_AUTO);
+
+    this->PublishDepthFrame();
+    return;
+  }
 
   PixelFormat format = PF_FLOAT32_RGBA;
   Ogre::PixelFormat imageFormat = Ogre2Conversions::Convert(format);
 
   size_t size = Ogre::PixelUtil::getMemorySize(width, height, 1, imageFormat);
-  int len = width * height;
   unsigned int channelCount = PixelUtil::ChannelCount(format);
 
   if (!this->dataPtr->depthBuffer)
@@ -1030,13 +1112,8 @@ void Ogre2DepthCamera::PostRender()
         1, imageFormat, this->dataPtr->depthBuffer);
 
   // blit data from gpu to cpu
-  auto rt = this->dataPtr->ogreDepthTexture[1]->getBuffer()->getRenderTarget();
   rt->copyContentsToMemory(dstBox, Ogre::RenderTarget::FB_AUTO);
 
-  if (!this->dataPtr->depthImage)
-  {
-    this->dataPtr->depthImage = new float[len];
-  }
   if (!this->dataPtr->pointCloudImage)
   {
     this->dataPtr->pointCloudImage = new float[len * channelCount];
@@ -1052,16 +1129,18 @@ void Ogre2DepthCamera::PostRender()
       this->dataPtr->depthImage[i*width + j] = x;
     }
   }
-  this->dataPtr->newDepthFrame(
-        this->dataPtr->depthImage, width, height, 1, "FLOAT32");
+  this->PublishDepthFrame();
 
   // point cloud data
   if (this->dataPtr->newRgbPointCloud.ConnectionCount() > 0u)
   {
     memcpy(this->dataPtr->pointCloudImage, this->dataPtr->depthBuffer, size);
-    this->dataPtr->newRgbPointCloud(
-        this->dataPtr->pointCloudImage, width, height, channelCount,
-        "PF_FLOAT32_RGBA");
+    {
+      IGN_RENDERING_TRACE_ZONE("Ogre2DepthCamera::NewRgbPointCloud");
+      this->dataPtr->newRgbPointCloud(
+          this->dataPtr->pointCloudImage, width, height, channelCount,
+          "PF_FLOAT32_RGBA");
+    }
 
     // Uncomment to debug color output
     // for (unsigned int i = 0; i < height; ++i)
@@ -1110,7 +1189,39 @@ void Ogre2DepthCamera::PostRender()
 //////////////////////////////////////////////////
 const float *Ogre2DepthCamera::DepthData() const
 {
-  return this->dataPtr->depthBuffer;
+  return this->dataPtr->depthImage;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2DepthCamera::SaveFrame(const std::string &_name)
+{
+  if (!this->dataPtr->depthImage)
+  {
+    ignerr << "Unable to save frame of depth camera [" << this->Name()
+           << "]: no frame rendered yet" << std::endl;
+    return false;
+  }
+
+  return FrameSaver::Default().Save(this->DepthFrameImage(), _name);
+}
+
+//////////////////////////////////////////////////
+void Ogre2DepthCamera::PublishDepthFrame()
+{
+  {
+    IGN_RENDERING_TRACE_ZONE("Ogre2DepthCamera::NewDepthFrame");
+    this->dataPtr->newDepthFrame(this->dataPtr->depthImage,
+        this->ImageWidth(), this->ImageHeight(), 1, "FLOAT32");
+  }
+  if (this->saveFrameEnabled)
+    this->SaveNextFrame(this->DepthFrameImage());
+}
+
+//////////////////////////////////////////////////
+Image Ogre2DepthCamera::DepthFrameImage() const
+{
+  return this->FrameImage(this->dataPtr->depthImage, this->ImageWidth(),
+      this->ImageHeight(), PF_FLOAT32_R);
 }
 
 //////////////////////////////////////////////////
@@ -1178,6 +1289,7 @@ void Ogre2DepthCamera::SetShadowsNodeDefDirty()
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
 
   this->RemoveWorkspaceCrashWorkaround();
+  engine->UnregisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
   ogreCompMgr->removeWorkspace( this->dataPtr->ogreCompositorWorkspace );
   this->dataPtr->ogreCompositorWorkspace = nullptr;
 }
@@ -1191,10 +1303,10 @@ void Ogre2DepthCamera::RemoveWorkspaceCrashWorkaround()
 
   if (!material.isNull())
   {
-    for (size_t i = 0; i < 4; ++i)
+    Ogre::Pass *pass = material->getBestTechnique()->getPass(0);
+    for (size_t i = 0; i < pass->getNumTextureUnitStates(); ++i)
     {
-      material->getBestTechnique()->getPass(0)->
-          getTextureUnitState(i)->setBlank();
+      pass->getTextureUnitState(i)->setBlank();
     }
   }
 }
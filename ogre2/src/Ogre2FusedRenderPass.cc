@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <ignition/common/Console.hh>
+
+#include "Ogre2FusedRenderPass.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <Compositor/OgreCompositorManager2.h>
+#include <Compositor/OgreCompositorNodeDef.h>
+#include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreGpuProgramParams.h>
+#include <OgreHighLevelGpuProgram.h>
+#include <OgreHighLevelGpuProgramManager.h>
+#include <OgreMaterial.h>
+#include <OgreMaterialManager.h>
+#include <OgrePass.h>
+#include <OgreRoot.h>
+#include <OgreTechnique.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2FusedRenderPass::Ogre2FusedRenderPass(
+    const std::vector<RenderPassPtr> &_passes)
+  : passes(_passes)
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2FusedRenderPass::~Ogre2FusedRenderPass()
+{
+  if (this->ogreName.empty())
+    return;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  if (!ogreRoot)
+    return;
+
+  if (!this->ogreCompositorNodeDefName.empty())
+  {
+    Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+    if (ogreCompMgr->hasNodeDefinition(this->ogreCompositorNodeDefName))
+      ogreCompMgr->removeNodeDefinition(this->ogreCompositorNodeDefName);
+  }
+
+  if (this->material)
+  {
+    Ogre::MaterialManager::getSingleton().remove(this->ogreName);
+    this->material = nullptr;
+  }
+
+  Ogre::HighLevelGpuProgramManager::getSingleton().remove(
+      this->ogreName + "_FS");
+}
+
+//////////////////////////////////////////////////
+bool Ogre2FusedRenderPass::IsFusable(const RenderPassPtr &_pass)
+{
+  Ogre2RenderPass *ogre2RenderPass =
+      dynamic_cast<Ogre2RenderPass *>(_pass.get());
+  return ogre2RenderPass &&
+      !ogre2RenderPass->FusedShaderSource(Prefix(0u)).empty();
+}
+
+//////////////////////////////////////////////////
+const std::vector<RenderPassPtr> &Ogre2FusedRenderPass::Passes() const
+{
+  return this->passes;
+}
+
+//////////////////////////////////////////////////
+bool Ogre2FusedRenderPass::IsEnabled() const
+{
+  for (const auto &pass : this->passes)
+  {
+    if (pass->IsEnabled())
+      return true;
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+void Ogre2FusedRenderPass::PreRender()
+{
+  if (!this->material)
+    return;
+
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      this->material->getTechnique(0)->getPass(0)->
+      getFragmentProgramParameters();
+  for (unsigned int i = 0; i < this->passes.size(); ++i)
+  {
+    Ogre2RenderPass *ogre2RenderPass =
+        dynamic_cast<Ogre2RenderPass *>(this->passes[i].get());
+    const std::string prefix = Prefix(i);
+    const bool enabled = ogre2RenderPass->IsEnabled();
+    psParams->setNamedConstant(prefix + "enabled", enabled ? 1 : 0);
+    if (enabled)
+      ogre2RenderPass->UpdateFusedShaderParams(psParams.get(), prefix);
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2FusedRenderPass::CreateRenderPass()
+{
+  // the passes can not change, the node is only created once. Nothing is
+  // retried if that failed, the errors were reported already
+  if (!this->ogreName.empty())
+    return;
+
+  static int fusedNodeCounter = 0;
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  const std::string name = "FusedRenderPass_" +
+      std::to_string(fusedNodeCounter++);
+  const std::string nodeDefName = name + "_Node";
+  this->ogreName = name;
+
+  // generate the fragment shader, the code of each pass is followed by a
+  // call to its apply function in main
+  std::string source =
+      "#version 330\n"
+      "\n"
+      "uniform sampler2D RT;\n"
+      "\n"
+      "in block\n"
+      "{\n"
+      "  vec2 uv0;\n"
+      "} inPs;\n"
+      "\n"
+      "out vec4 fragColor;\n";
+  std::string main =
+      "\n"
+      "void main()\n"
+      "{\n"
+      "  vec2 uv = inPs.uv0.xy;\n"
+      "  vec4 color = texture(RT, uv);\n";
+  for (unsigned int i = 0; i < this->passes.size(); ++i)
+  {
+    Ogre2RenderPass *ogre2RenderPass =
+        dynamic_cast<Ogre2RenderPass *>(this->passes[i].get());
+    const std::string prefix = Prefix(i);
+    source += "\nuniform int " + prefix + "enabled;\n" +
+        ogre2RenderPass->FusedShaderSource(prefix);
+    main += "  if (" + prefix + "enabled != 0)\n"
+        "    color = " + prefix + "apply(color, uv);\n";
+  }
+  source += main +
+      "  fragColor = color;\n"
+      "}\n";
+
+  Ogre::HighLevelGpuProgramPtr program =
+      Ogre::HighLevelGpuProgramManager::getSingleton().createProgram(
+      name + "_FS",
+      Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME,
+      "glsl", Ogre::GPT_FRAGMENT_PROGRAM);
+  program->setSource(source);
+  program->load();
+  if (program->hasCompileError())
+  {
+    ignerr << "Failed to compile the fused render pass shader:\n"
+           << source << std::endl;
+    return;
+  }
+
+  // The FusedRenderPass material is defined in script
+  // (fused_render_pass.material) without fragment program, so it is only
+  // loaded once the generated program is set on a copy of it
+  const std::string matName = "FusedRenderPass";
+  Ogre::MaterialPtr ogreMat =
+      Ogre::MaterialManager::getSingleton().getByName(matName);
+  if (!ogreMat)
+  {
+    ignerr << "Fused render pass material not found: '" << matName << "'"
+           << std::endl;
+    return;
+  }
+  Ogre::MaterialPtr fusedMat = ogreMat->clone(name);
+  Ogre::Pass *pass = fusedMat->getTechnique(0)->getPass(0);
+  pass->setFragmentProgram(program->getName());
+  pass->getFragmentProgramParameters()->setNamedConstant("RT", 0);
+  fusedMat->load();
+  this->material = fusedMat.get();
+
+  this->ogreCompositorNodeDefName = nodeDefName;
+
+  // same node as the one of Ogre2GaussianNoisePass: a single quad pass
+  // reading rt_input and writing rt_output, which are swapped for the next
+  // render pass
+  Ogre::CompositorNodeDef *nodeDef =
+      ogreCompMgr->addNodeDefinition(nodeDefName);
+  nodeDef->addTextureSourceName("rt_input", 0,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+  nodeDef->addTextureSourceName("rt_output", 1,
+      Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+
+  nodeDef->setNumTargetPass(1);
+  Ogre::CompositorTargetDef *targetDef = nodeDef->addTargetPass("rt_output");
+  targetDef->setNumPasses(1);
+  {
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        targetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = name;
+    passQuad->addQuadTextureSource(0, "rt_input", 0);
+  }
+  nodeDef->mapOutputChannel(0, "rt_output");
+  nodeDef->mapOutputChannel(1, "rt_input");
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2FusedRenderPass::Prefix(unsigned int _index)
+{
+  return "pass" + std::to_string(_index) + "_";
+}
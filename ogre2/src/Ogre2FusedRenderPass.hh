@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2FUSEDRENDERPASS_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2FUSEDRENDERPASS_HH_
+
+#include <string>
+#include <vector>
+
+#include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/ogre2/Ogre2RenderPass.hh"
+
+namespace Ogre
+{
+  class Material;
+}
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Consecutive per-pixel render passes of a render target fused
+    /// into a single compositor node. The glsl code of every pass is
+    /// compiled into one fragment shader that reads the input texture once,
+    /// applies the passes in order and writes the output texture once.
+    /// The passes keep their own settings and can still be enabled or
+    /// disabled one by one, which only changes a uniform of the shader.
+    /// Created by Ogre2RenderTarget, it is not available from the render
+    /// pass system.
+    class Ogre2FusedRenderPass : public Ogre2RenderPass
+    {
+      /// \brief Constructor
+      /// \param[in] _passes Passes to fuse, in order. They must all return
+      /// glsl code from Ogre2RenderPass::FusedShaderSource.
+      public: explicit Ogre2FusedRenderPass(
+                  const std::vector<RenderPassPtr> &_passes);
+
+      /// \brief Destructor. Removes the generated shader, material and
+      /// compositor node definition, so the pass must only be destroyed
+      /// once no workspace uses its node anymore.
+      public: virtual ~Ogre2FusedRenderPass();
+
+      /// \brief Check if a render pass can be fused with other passes
+      /// \param[in] _pass Render pass to check
+      /// \return True if the pass is an ogre2 pass providing glsl code
+      public: static bool IsFusable(const RenderPassPtr &_pass);
+
+      /// \brief Get the fused passes
+      /// \return Passes in the order they are applied
+      public: const std::vector<RenderPassPtr> &Passes() const;
+
+      /// \brief The fused pass is enabled if any of its passes is
+      /// \return True if at least one of the passes is enabled
+      public: bool IsEnabled() const override;
+
+      // Documentation inherited
+      public: void PreRender() override;
+
+      // Documentation inherited
+      public: void CreateRenderPass() override;
+
+      /// \brief Get the prefix of the glsl names of a pass
+      /// \param[in] _index Index of the pass
+      /// \return Prefix given to the pass
+      private: static std::string Prefix(unsigned int _index);
+
+      /// \brief Fused passes
+      private: std::vector<RenderPassPtr> passes;
+
+      /// \brief Name of the generated shader program and material, empty
+      /// until the node is created
+      private: std::string ogreName;
+
+      /// \brief Material of the fused shader
+      private: Ogre::Material *material = nullptr;
+    };
+    }
+  }
+}
+
+#endif
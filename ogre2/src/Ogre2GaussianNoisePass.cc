@@ -16,6 +16,8 @@
  */
 
 
+#include <string>
+
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/RenderPassSystem.hh"
@@ -28,6 +30,7 @@
 #include <Compositor/OgreCompositorManager2.h>
 #include <Compositor/OgreCompositorNodeDef.h>
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
+#include <OgreGpuProgramParams.h>
 #include <OgreMaterial.h>
 #include <OgreMaterialManager.h>
 #include <OgrePass.h>
@@ -48,6 +51,36 @@ class ignition::rendering::Ogre2GaussianNoisePassPrivate
 using namespace ignition;
 using namespace rendering;
 
+/// \brief Glsl code of the noise when the pass is fused with other passes.
+/// Same as gaussian_noise_fs.glsl, with every name starting with '@' that
+/// is replaced by the prefix given by the fused pass.
+static const char kFusedShaderSource[] = R"(
+uniform vec3 @offsets;
+uniform float @mean;
+uniform float @stddev;
+
+float @rand(vec2 co)
+{
+  float r = fract(sin(dot(co.xy, vec2(12.9898, 78.233))) * 43758.5453);
+  return (r == 0.0) ? 0.000000000001 : r;
+}
+
+vec4 @apply(vec4 color, vec2 uv)
+{
+  // Box-Muller method, a 3rd random value selects one of its two outputs
+  float u = @rand(uv + vec2(@offsets.x, @offsets.x));
+  float v = @rand(uv + vec2(@offsets.y, @offsets.y));
+  float r = @rand(uv + vec2(@offsets.z, @offsets.z));
+  float z = sqrt(-2.0 * log(u)) *
+      ((r < 0.5) ? sin(6.28318530718 * v) : cos(6.28318530718 * v));
+  z = z * @stddev + @mean;
+  float n = pow(abs(z), 2.1);
+  if (z < 0.0)
+    n = -n;
+  return clamp(color + vec4(n, n, n, 0.0), 0.0, 1.0);
+}
+)";
+
 //////////////////////////////////////////////////
 Ogre2GaussianNoisePass::Ogre2GaussianNoisePass()
   : dataPtr(std::make_unique<Ogre2GaussianNoisePassPrivate>())
@@ -183,4 +216,34 @@ void Ogre2GaussianNoisePass::CreateRenderPass()
   nodeDef->mapOutputChannel(1, "rt_input");
 }
 
+//////////////////////////////////////////////////
+std::string Ogre2GaussianNoisePass::FusedShaderSource(
+    const std::string &_prefix) const
+{
+  std::string source;
+  for (const char *c = kFusedShaderSource; *c != '\0'; ++c)
+  {
+    if (*c == '@')
+      source += _prefix;
+    else
+      source += *c;
+  }
+  return source;
+}
+
+//////////////////////////////////////////////////
+void Ogre2GaussianNoisePass::UpdateFusedShaderParams(
+    Ogre::GpuProgramParameters *_params, const std::string &_prefix)
+{
+  // see PreRender
+  Ogre::Vector3 offsets(ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0),
+                        ignition::math::Rand::DblUniform(0.0, 1.0));
+  _params->setNamedConstant(_prefix + "offsets", offsets);
+  _params->setNamedConstant(_prefix + "mean",
+      static_cast<Ogre::Real>(this->mean));
+  _params->setNamedConstant(_prefix + "stddev",
+      static_cast<Ogre::Real>(this->stdDev));
+}
+
 IGN_RENDERING_REGISTER_RENDER_PASS(Ogre2GaussianNoisePass, GaussianNoisePass)
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Mesh.hh>
+#include <ignition/common/MeshManager.hh>
+#include <ignition/common/SubMesh.hh>
+
+#include "ignition/rendering/MeshDescriptor.hh"
+#include "ignition/rendering/ogre2/Ogre2GeometryCache.hh"
+#include "ignition/rendering/ogre2/Ogre2MeshFactory.hh"
+
+/// \brief Private data for the Ogre2GeometryCache class
+class ignition::rendering::Ogre2GeometryCachePrivate
+{
+  /// \brief Mesh factory used to load and remove ogre meshes
+  public: Ogre2MeshFactoryPtr meshFactory;
+
+  /// \brief Map of mesh name to number of geometries using the mesh
+  public: std::map<std::string, unsigned int> useCounts;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2GeometryCache::Ogre2GeometryCache(Ogre2MeshFactoryPtr _meshFactory)
+  : dataPtr(std::make_unique<Ogre2GeometryCachePrivate>())
+{
+  this->dataPtr->meshFactory = _meshFactory;
+}
+
+//////////////////////////////////////////////////
+Ogre2GeometryCache::~Ogre2GeometryCache()
+{
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2GeometryCache::Acquire(const std::string &_key,
+    const std::function<bool(const std::string &)> &_create)
+{
+  auto it = this->dataPtr->useCounts.find(_key);
+  if (it != this->dataPtr->useCounts.end())
+  {
+    it->second++;
+    return _key;
+  }
+
+  // the mesh may still be in the mesh manager if it was released earlier
+  common::MeshManager *meshMgr = common::MeshManager::Instance();
+  if (!meshMgr->HasMesh(_key) && !_create(_key))
+  {
+    ignerr << "Unable to create shared mesh [" << _key << "]" << std::endl;
+    return std::string();
+  }
+
+  this->dataPtr->useCounts[_key] = 1u;
+  return _key;
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2GeometryCache::AcquireCapsule(double _radius, double _length)
+{
+  unsigned int segments = CapsuleSegments(_radius, _length);
+  int64_t radius = Quantize(_radius);
+  int64_t length = Quantize(_length);
+
+  std::string key = "capsule_mesh_" + std::to_string(radius) + "_" +
+      std::to_string(length) + "_" + std::to_string(segments);
+
+  return this->Acquire(key, [&](const std::string &_name)
+  {
+    common::MeshManager::Instance()->CreateCapsule(_name,
+        radius * kQuantizationStep, length * kQuantizationStep,
+        segments, segments);
+    return common::MeshManager::Instance()->HasMesh(_name);
+  });
+}
+
+//////////////////////////////////////////////////
+std::string Ogre2GeometryCache::AcquireLineList(const std::string &_key,
+    const std::function<std::vector<math::Vector3d>()> &_points)
+{
+  return this->Acquire(_key, [&](const std::string &_name)
+  {
+    std::vector<math::Vector3d> points = _points();
+    if (points.empty())
+      return false;
+
+    common::SubMesh subMesh;
+    subMesh.SetName(_name);
+    subMesh.SetPrimitiveType(common::SubMesh::LINES);
+    for (unsigned int i = 0; i < points.size(); ++i)
+    {
+      subMesh.AddVertex(points[i]);
+      // lines are not lit but hlms pbs expects normals
+      subMesh.AddNormal(math::Vector3d::UnitZ);
+      subMesh.AddIndex(i);
+    }
+
+    common::Mesh *mesh = new common::Mesh();
+    mesh->SetName(_name);
+    mesh->AddSubMesh(subMesh);
+    common::MeshManager::Instance()->AddMesh(mesh);
+    return true;
+  });
+}
+
+//////////////////////////////////////////////////
+void Ogre2GeometryCache::Release(const std::string &_meshName)
+{
+  auto it = this->dataPtr->useCounts.find(_meshName);
+  if (it == this->dataPtr->useCounts.end())
+    return;
+
+  if (--it->second > 0u)
+    return;
+
+  this->dataPtr->useCounts.erase(it);
+
+  // the common::Mesh is cheap to keep around and is reused if the same
+  // geometry is requested again, only free the ogre (gpu) resources
+  if (this->dataPtr->meshFactory)
+    this->dataPtr->meshFactory->ClearMesh(MeshDescriptor(_meshName));
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2GeometryCache::UseCount(const std::string &_meshName) const
+{
+  auto it = this->dataPtr->useCounts.find(_meshName);
+  if (it == this->dataPtr->useCounts.end())
+    return 0u;
+  return it->second;
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2GeometryCache::MeshCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->useCounts.size());
+}
+
+//////////////////////////////////////////////////
+void Ogre2GeometryCache::Clear()
+{
+  this->dataPtr->useCounts.clear();
+}
+
+//////////////////////////////////////////////////
+int64_t Ogre2GeometryCache::Quantize(double _value)
+{
+  return static_cast<int64_t>(std::llround(_value / kQuantizationStep));
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2GeometryCache::CapsuleSegments(double _radius,
+    double _length)
+{
+  // Pick the tessellation level from the extent of the capsule. With the
+  // default camera fov a 5 cm capsule covers only a few pixels at typical
+  // viewing distances, so the full 32x32 tessellation is wasted on it.
+  double extent = std::max(2.0 * _radius, _length + 2.0 * _radius);
+  if (extent < 0.05)
+    return 8u;
+  if (extent < 0.5)
+    return 16u;
+  return 32u;
+}
@@ -15,16 +15,32 @@
  *
 */
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <ignition/math/Matrix3.hh>
 #include <ignition/math/Vector2.hh>
 #include <ignition/math/Vector3.hh>
 
 #include <ignition/common/Console.hh>
 #include <ignition/math/Helpers.hh>
+#include <ignition/math/Rand.hh>
 
+#include "ignition/rendering/GaussianNoisePass.hh"
+#include "ignition/rendering/RangeNoisePass.hh"
 #include "ignition/rendering/ogre2/Ogre2Camera.hh"
 #include "ignition/rendering/ogre2/Ogre2GpuRays.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2ParticleEmitter.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
@@ -38,6 +54,7 @@
 #ifdef _MSC_VER
   #pragma warning(push, 0)
 #endif
+#include <Compositor/OgreCompositorChannel.h>
 #include <Compositor/OgreCompositorManager2.h>
 #include <Compositor/OgreCompositorWorkspace.h>
 #include <Compositor/Pass/PassClear/OgreCompositorPassClearDef.h>
@@ -107,6 +124,61 @@ class Ogre2LaserRetroMaterialSwitcher : public Ogre::RenderTargetListener
 /// \brief Private data for the Ogre2GpuRays class
 class ignition::rendering::Ogre2GpuRaysPrivate
 {
+  /// \brief Texture that tells the 2nd pass where to sample the range of
+  /// each ray. Sensors with the same configuration share the texture.
+  public: struct SampleTexture
+  {
+    /// \brief Destructor, removes the texture
+    ~SampleTexture()
+    {
+      if (this->texture && Ogre::TextureManager::getSingletonPtr())
+        Ogre::TextureManager::getSingleton().remove(this->texture->getName());
+    }
+
+    /// \brief RGB texture with the uv coordinates and the index of the 1st
+    /// pass texture to sample for each ray
+    Ogre::TexturePtr texture;
+
+    /// \brief Indices of the 1st pass textures sampled by the rays
+    std::set<unsigned int> faces;
+
+    /// \brief Tangent of the half horizontal field of view of the direct
+    /// pass camera
+    double tanX = 0.0;
+
+    /// \brief Tangent of the half vertical field of view of the direct
+    /// pass camera
+    double tanY = 0.0;
+
+    /// \brief Rays per 90 degrees along the u axis of each cubemap face,
+    /// 0 if no two rays of a row sample the face
+    double densityU[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+    /// \brief Rays per 90 degrees along the v axis of each cubemap face,
+    /// 0 if no two rays of a column sample the face
+    double densityV[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  };
+
+  /// \brief Configuration a sample texture is computed from: direct pass,
+  /// horizontal and vertical angle range, ray counts and 1st pass size
+  public: using SampleTextureKey = std::tuple<bool, double, double, double,
+      double, unsigned int, unsigned int, unsigned int, unsigned int>;
+
+  /// \brief Get the sample texture of a configuration, creating it if no
+  /// other sensor uses it
+  /// \param[in] _key Configuration of the sensor
+  /// \param[in] _width Width of the texture
+  /// \param[in] _height Height of the texture
+  /// \param[in] _fill Function filling a new texture with 3 floats per ray
+  /// \return Shared sample texture
+  public: static std::shared_ptr<SampleTexture> SharedSampleTexture(
+      const SampleTextureKey &_key, unsigned int _width,
+      unsigned int _height,
+      const std::function<void(SampleTexture &, float *)> &_fill);
+
+  /// \brief Sample texture of the sensor, shared with other sensors
+  public: std::shared_ptr<SampleTexture> sampleTexture;
+
   /// \brief Event triggered when new gpu rays range data are available.
   /// \param[in] _frame New frame containing raw gpu rays data.
   /// \param[in] _width Width of frame.
@@ -117,12 +189,35 @@ class ignition::rendering::Ogre2GpuRaysPrivate
                unsigned int, unsigned int, unsigned int,
                const std::string &)> newGpuRaysFrame;
 
-  /// \brief Raw buffer of gpu rays data.
-  public: float *gpuRaysBuffer = nullptr;
+  /// \brief Event triggered when new gpu rays data are available, in any
+  /// data format.
+  /// \param[in] _data New data in the layout of the data format.
+  /// \param[in] _width Width of frame.
+  /// \param[in] _height Height of frame.
+  /// \param[in] _channel Number of channels
+  /// \param[in] _format Format string of the data format.
+  public: ignition::common::EventT<void(const void *,
+               unsigned int, unsigned int, unsigned int,
+               const std::string &)> newGpuRaysData;
+
+  /// \brief Buffer of gpu rays data for the data formats that do not store
+  /// floats only, used by newGpuRaysData event.
+  public: unsigned char *gpuRaysBuffer = nullptr;
 
   /// \brief Outgoing gpu rays data, used by newGpuRaysFrame event.
   public: float *gpuRaysScan = nullptr;
 
+  /// \brief Data format the second pass was set up with
+  public: GpuRaysDataFormat secondPassFormat = GRDF_RANGE_RETRO;
+
+  /// \brief Clear colour of the second pass texture
+  public: Ogre::ColourValue secondPassClearColour;
+
+  /// \brief True if the field of view fits in a single perspective
+  /// camera. The range data is then rendered by one workspace with one
+  /// camera instead of the cubemap cameras and the second pass workspace.
+  public: bool directPass = false;
+
   /// \brief Pointer to Ogre material for the first rendering pass.
   public: Ogre::MaterialPtr matFirstPass;
 
@@ -191,11 +286,198 @@ class ignition::rendering::Ogre2GpuRaysPrivate
   /// \brief Listener for setting particle noise value based on particle
   /// emitter region
   public: std::unique_ptr<Ogre2ParticleNoiseListener> particleNoiseListener[6];
+
+  /// \brief Noise passes applied to the ranges by the 2nd pass material
+  public: std::vector<RenderPassPtr> renderPasses;
 };
 
 using namespace ignition;
 using namespace rendering;
 
+/// \brief Sample textures by configuration. The sensors hold the textures,
+/// a texture is removed when the last sensor using it is destroyed.
+static std::map<Ogre2GpuRaysPrivate::SampleTextureKey,
+    std::weak_ptr<Ogre2GpuRaysPrivate::SampleTexture>> sampleTextures;
+
+/// \brief Mutex protecting the sample textures
+static std::mutex sampleTexturesMutex;
+
+//////////////////////////////////////////////////
+/// \brief Run a function over the rows of a texture, split across threads
+/// for large textures
+/// \param[in] _width Width of the texture
+/// \param[in] _height Height of the texture
+/// \param[in] _func Function called with the first and the one past last
+/// row to process, returns a bit mask that is or'ed over all calls
+/// \return Bit mask returned by the calls
+static unsigned int ParallelRows(unsigned int _width, unsigned int _height,
+    const std::function<unsigned int(unsigned int, unsigned int)> &_func)
+{
+  // starting threads is not worth it for small textures
+  unsigned int numThreads = 1u;
+  if (static_cast<uint64_t>(_width) * _height >= 65536u)
+  {
+    numThreads = std::clamp(std::thread::hardware_concurrency(), 1u,
+        _height);
+  }
+
+  unsigned int rows = (_height + numThreads - 1u) / numThreads;
+  std::vector<unsigned int> masks(numThreads, 0u);
+  std::vector<std::thread> threads;
+  for (unsigned int t = 1u; t < numThreads; ++t)
+  {
+    unsigned int begin = std::min(t * rows, _height);
+    unsigned int end = std::min(begin + rows, _height);
+    threads.emplace_back([&_func, &masks, t, begin, end]()
+    {
+      masks[t] = _func(begin, end);
+    });
+  }
+  masks[0] = _func(0u, std::min(rows, _height));
+  for (auto &thread : threads)
+    thread.join();
+
+  unsigned int mask = 0u;
+  for (auto m : masks)
+    mask |= m;
+  return mask;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the size of a 1st pass texture along one axis
+/// \param[in] _samples Number of samples needed along the axis
+/// \return Next power of two, limited to [2, 1024]
+static unsigned int FirstPassSize(double _samples)
+{
+  unsigned int v = static_cast<unsigned int>(
+      std::clamp(std::ceil(_samples), 1.0, 1024.0));
+  // round to next highest power of 2
+  // https://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2
+  v--;
+  v |= v >> 1;
+  v |= v >> 2;
+  v |= v >> 4;
+  v |= v >> 8;
+  v |= v >> 16;
+  v++;
+  // limit max texture size to 1024
+  unsigned int min1stPassSamples = 2u;
+  unsigned int max1stPassSamples = 1024u;
+  return std::clamp(v, min1stPassSamples, max1stPassSamples);
+}
+
+//////////////////////////////////////////////////
+/// \brief Compute the density of the rays sampling each cubemap face from
+/// the rays of a row or column that fall on the same face
+/// \param[in] _samples Cubemap sample texture data, u, v and face per ray
+/// \param[in] _width Number of horizontal rays
+/// \param[in] _height Number of vertical rays
+/// \param[out] _densityU Rays per 90 degrees along u of each face
+/// \param[out] _densityV Rays per 90 degrees along v of each face
+static void FaceRayDensity(const float *_samples, unsigned int _width,
+    unsigned int _height, double _densityU[6], double _densityV[6])
+{
+  // angle spanned by a line of rays on each face
+  struct Extent
+  {
+    unsigned int count = 0u;
+    double min = 0.0;
+    double max = 0.0;
+  };
+  auto add = [](Extent &_extent, double _uv)
+  {
+    // angle from the face center along the axis
+    double angle = std::atan(2.0 * _uv - 1.0);
+    if (_extent.count == 0u || angle < _extent.min)
+      _extent.min = angle;
+    if (_extent.count == 0u || angle > _extent.max)
+      _extent.max = angle;
+    ++_extent.count;
+  };
+  auto update = [](const Extent &_extent, double &_density)
+  {
+    if (_extent.count < 2u || _extent.max <= _extent.min)
+      return;
+    _density = std::max(_density,
+        (_extent.count - 1u) / (_extent.max - _extent.min) * IGN_PI * 0.5);
+  };
+
+  for (unsigned int f = 0u; f < 6u; ++f)
+  {
+    _densityU[f] = 0.0;
+    _densityV[f] = 0.0;
+  }
+
+  for (unsigned int i = 0; i < _height; ++i)
+  {
+    Extent extents[6];
+    for (unsigned int j = 0; j < _width; ++j)
+    {
+      const float *p = _samples + (static_cast<size_t>(i) * _width + j) * 3u;
+      add(extents[static_cast<unsigned int>(p[2])], p[0]);
+    }
+    for (unsigned int f = 0u; f < 6u; ++f)
+      update(extents[f], _densityU[f]);
+  }
+
+  for (unsigned int j = 0; j < _width; ++j)
+  {
+    Extent extents[6];
+    for (unsigned int i = 0; i < _height; ++i)
+    {
+      const float *p = _samples + (static_cast<size_t>(i) * _width + j) * 3u;
+      add(extents[static_cast<unsigned int>(p[2])], p[1]);
+    }
+    for (unsigned int f = 0u; f < 6u; ++f)
+      update(extents[f], _densityV[f]);
+  }
+}
+
+//////////////////////////////////////////////////
+std::shared_ptr<Ogre2GpuRaysPrivate::SampleTexture>
+    Ogre2GpuRaysPrivate::SharedSampleTexture(const SampleTextureKey &_key,
+    unsigned int _width, unsigned int _height,
+    const std::function<void(SampleTexture &, float *)> &_fill)
+{
+  std::lock_guard<std::mutex> lock(sampleTexturesMutex);
+  auto it = sampleTextures.find(_key);
+  if (it != sampleTextures.end())
+  {
+    auto shared = it->second.lock();
+    if (shared)
+      return shared;
+  }
+
+  // forget about textures that are no longer used
+  for (auto t = sampleTextures.begin(); t != sampleTextures.end();)
+  {
+    if (t->second.expired())
+      t = sampleTextures.erase(t);
+    else
+      ++t;
+  }
+
+  static unsigned int textureCounter = 0u;
+  auto shared = std::make_shared<SampleTexture>();
+  shared->texture = Ogre::TextureManager::getSingleton().createManual(
+      "GpuRaysSampleTex_" + std::to_string(textureCounter++),
+      "General",
+      Ogre::TEX_TYPE_2D,
+      _width,
+      _height,
+      0,
+      Ogre::PF_FLOAT32_RGB);
+  Ogre::v1::HardwarePixelBufferSharedPtr pixelBuffer =
+      shared->texture->getBuffer();
+  pixelBuffer->lock(Ogre::v1::HardwareBuffer::HBL_NORMAL);
+  const Ogre::PixelBox &pixelBox = pixelBuffer->getCurrentLock();
+  _fill(*shared, static_cast<float *>(pixelBox.data));
+  pixelBuffer->unlock();
+
+  sampleTextures[_key] = shared;
+  return shared;
+}
+
 
 //////////////////////////////////////////////////
 Ogre2LaserRetroMaterialSwitcher::Ogre2LaserRetroMaterialSwitcher(
@@ -350,24 +632,11 @@ void Ogre2GpuRays::Init()
 //////////////////////////////////////////////////
 void Ogre2GpuRays::Destroy()
 {
-  if (this->dataPtr->gpuRaysBuffer)
-  {
-    delete [] this->dataPtr->gpuRaysBuffer;
-    this->dataPtr->gpuRaysBuffer = nullptr;
-  }
+  this->Destroy2ndPass();
 
-  if (this->dataPtr->gpuRaysScan)
-  {
-    delete [] this->dataPtr->gpuRaysScan;
-    this->dataPtr->gpuRaysScan = nullptr;
-  }
-
-  if (this->dataPtr->cubeUVTexture)
-  {
-    Ogre::TextureManager::getSingleton().remove(
-        this->dataPtr->cubeUVTexture->getName());
-    this->dataPtr->cubeUVTexture.reset();
-  }
+  // the sample texture is removed with the last sensor using it
+  this->dataPtr->cubeUVTexture.reset();
+  this->dataPtr->sampleTexture.reset();
 
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
@@ -384,6 +653,8 @@ void Ogre2GpuRays::Destroy()
     }
     if (this->dataPtr->ogreCompositorWorkspace1st[i])
     {
+      engine->UnregisterWorkspace(
+          this->dataPtr->ogreCompositorWorkspace1st[i]);
       ogreCompMgr->removeWorkspace(
           this->dataPtr->ogreCompositorWorkspace1st[i]);
       this->dataPtr->ogreCompositorWorkspace1st[i] = nullptr;
@@ -404,6 +675,47 @@ void Ogre2GpuRays::Destroy()
         this->dataPtr->ogreCompositorNodeDef1st);
     this->dataPtr->ogreCompositorWorkspaceDef1st.clear();
   }
+}
+
+/////////////////////////////////////////////////
+void Ogre2GpuRays::Destroy2ndPass()
+{
+  if (this->dataPtr->gpuRaysBuffer)
+  {
+    delete [] this->dataPtr->gpuRaysBuffer;
+    this->dataPtr->gpuRaysBuffer = nullptr;
+  }
+
+  if (this->dataPtr->gpuRaysScan)
+  {
+    delete [] this->dataPtr->gpuRaysScan;
+    this->dataPtr->gpuRaysScan = nullptr;
+  }
+
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  // the direct pass workspace renders to the 2nd pass texture
+  if (this->dataPtr->directPass)
+  {
+    if (this->dataPtr->ogreCompositorWorkspace1st[0])
+    {
+      engine->UnregisterWorkspace(
+          this->dataPtr->ogreCompositorWorkspace1st[0]);
+      ogreCompMgr->removeWorkspace(
+          this->dataPtr->ogreCompositorWorkspace1st[0]);
+      this->dataPtr->ogreCompositorWorkspace1st[0] = nullptr;
+    }
+    if (!this->dataPtr->ogreCompositorWorkspaceDef1st.empty())
+    {
+      ogreCompMgr->removeWorkspaceDefinition(
+          this->dataPtr->ogreCompositorWorkspaceDef1st);
+      ogreCompMgr->removeNodeDefinition(
+          this->dataPtr->ogreCompositorNodeDef1st);
+      this->dataPtr->ogreCompositorWorkspaceDef1st.clear();
+    }
+  }
 
   // remove 2nd pass texture, material, compositor
   if (this->dataPtr->secondPassTexture)
@@ -422,7 +734,9 @@ void Ogre2GpuRays::Destroy()
 
   if (!this->dataPtr->ogreCompositorWorkspaceDef2nd.empty())
   {
+    engine->UnregisterWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
     ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
+    this->dataPtr->ogreCompositorWorkspace2nd = nullptr;
     ogreCompMgr->removeWorkspaceDefinition(
         this->dataPtr->ogreCompositorWorkspaceDef2nd);
     ogreCompMgr->removeNodeDefinition(
@@ -496,6 +810,32 @@ void Ogre2GpuRays::ConfigureCamera()
   }
   this->SetVFOV(vfovAngle);
 
+  // Configure second pass texture size
+  this->SetRangeCount(this->RangeCount(), this->VerticalRangeCount());
+
+  // Set ogre cam properties
+  this->dataPtr->ogreCamera->setNearClipDistance(this->NearClipPlane());
+  this->dataPtr->ogreCamera->setFarClipDistance(this->FarClipPlane());
+
+  // Narrow field of views are rendered by a single perspective camera
+  this->dataPtr->directPass = hfovAngle.Radian() < IGN_PI * 0.5 &&
+      vfovAngle < IGN_PI * 0.5;
+  if (this->dataPtr->directPass)
+  {
+    // Twice the number of rays in each direction, the rays are sampled
+    // from the closest pixel
+    double minSamples = 2.0;
+    double maxSamples = 2048.0;
+    double samples = 2.0 * this->resolutionScale;
+    this->Set1stTextureSize(
+        static_cast<unsigned int>(std::clamp(
+        std::ceil(samples * this->RangeCount()), minSamples, maxSamples)),
+        static_cast<unsigned int>(std::clamp(
+        std::ceil(samples * this->VerticalRangeCount()), minSamples,
+        maxSamples)));
+    return;
+  }
+
   // Configure first pass texture size
   // Each cubemap texture covers 90 deg FOV so determine number of samples
   // within the view for both horizontal and vertical FOV
@@ -505,58 +845,8 @@ void Ogre2GpuRays::ConfigureCamera()
       IGN_PI * 0.5 / vfovAngle * this->VerticalRangeCount());
 
   // get the max number from the two
-  unsigned int v = std::max(hs, vs);
-  // round to next highest power of 2
-  // https://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2
-  v--;
-  v |= v >> 1;
-  v |= v >> 2;
-  v |= v >> 4;
-  v |= v >> 8;
-  v |= v >> 16;
-  v++;
-  // limit max texture size to 1024
-  unsigned int min1stPassSamples = 2u;
-  unsigned int max1stPassSamples = 1024u;
-  unsigned int samples1stPass =
-      std::clamp(v, min1stPassSamples, max1stPassSamples);
-
+  unsigned int samples1stPass = FirstPassSize(std::max(hs, vs));
   this->Set1stTextureSize(samples1stPass, samples1stPass);
-
-  // Configure second pass texture size
-  this->SetRangeCount(this->RangeCount(), this->VerticalRangeCount());
-
-  // Set ogre cam properties
-  this->dataPtr->ogreCamera->setNearClipDistance(this->NearClipPlane());
-  this->dataPtr->ogreCamera->setFarClipDistance(this->FarClipPlane());
-}
-
-/////////////////////////////////////////////////////////
-math::Vector2d Ogre2GpuRays::SampleCubemap(const math::Vector3d &_v,
-    unsigned int &_faceIndex)
-{
-  math::Vector3d vAbs = _v.Abs();
-  double ma;
-  math::Vector2d uv;
-  if (vAbs.Z() >= vAbs.X() && vAbs.Z() >= vAbs.Y())
-  {
-    _faceIndex = _v.Z() < 0.0 ? 5.0 : 4.0;
-    ma = 0.5 / vAbs.Z();
-    uv = math::Vector2d(_v.Z() < 0.0 ? -_v.X() : _v.X(), -_v.Y());
-  }
-  else if (vAbs.Y() >= vAbs.X())
-  {
-    _faceIndex = _v.Y() < 0.0 ? 3.0 : 2.0;
-    ma = 0.5 / vAbs.Y();
-    uv = math::Vector2d(_v.X(), _v.Y() < 0.0 ? -_v.Z() : _v.Z());
-  }
-  else
-  {
-    _faceIndex = _v.X() < 0.0 ? 1.0 : 0.0;
-    ma = 0.5 / vAbs.X();
-    uv = math::Vector2d(_v.X() < 0.0 ? _v.Z() : -_v.Z(), -_v.Y());
-  }
-  return uv * ma + 0.5;
 }
 
 /////////////////////////////////////////////////////////
@@ -572,6 +862,9 @@ void Ogre2GpuRays::CreateSampleTexture()
   if (this->dataPtr->h2nd > 1)
     vStep = (vmax-vmin) / static_cast<double>(this->dataPtr->h2nd-1);
 
+  unsigned int width = this->dataPtr->w2nd;
+  unsigned int height = this->dataPtr->h2nd;
+
   // create an RGB texture (cubeUVTex) to pack info that tells the shaders how
   // to sample from the cubemap textures.
   // Each pixel packs the follow data:
@@ -579,57 +872,185 @@ void Ogre2GpuRays::CreateSampleTexture()
   //   G: v coordinate on the cubemap face
   //   B: cubemap face index
   // this texture is passed to the 2nd pass fragment shader
-  std::string texName = this->Name() + "_samplerTex";
-  this->dataPtr->cubeUVTexture =
-      Ogre::TextureManager::getSingleton().createManual(
-          texName,
-          "General",
-          Ogre::TEX_TYPE_2D,
-          this->dataPtr->w2nd,
-          this->dataPtr->h2nd,
-          0,
-          Ogre::PF_FLOAT32_RGB);
-  Ogre::v1::HardwarePixelBufferSharedPtr pixelBuffer =
-      this->dataPtr->cubeUVTexture->getBuffer();
-  // fill the texture
-  pixelBuffer->lock(Ogre::v1::HardwareBuffer::HBL_NORMAL);
-  const Ogre::PixelBox &pixelBox = pixelBuffer->getCurrentLock();
-  float *pDest = static_cast<float *>(pixelBox.data);
+  auto fill = [&](Ogre2GpuRaysPrivate::SampleTexture &_tex, float *_dest)
+  {
+    // ray directions are separable in the horizontal and vertical angles
+    std::vector<double> sinH(width);
+    std::vector<double> cosH(width);
+    for (unsigned int j = 0; j < width; ++j)
+    {
+      sinH[j] = std::sin(min + j * hStep);
+      cosH[j] = std::cos(min + j * hStep);
+    }
+    std::vector<double> sinV(height);
+    std::vector<double> cosV(height);
+    for (unsigned int i = 0; i < height; ++i)
+    {
+      sinV[i] = std::sin(vmin + i * vStep);
+      cosV[i] = std::cos(vmin + i * vStep);
+    }
+
+    unsigned int faces = ParallelRows(width, height,
+        [&](unsigned int _begin, unsigned int _end)
+    {
+      unsigned int mask = 0u;
+      for (unsigned int i = _begin; i < _end; ++i)
+      {
+        float *pDest = _dest + static_cast<size_t>(i) * width * 3u;
+        for (unsigned int j = 0; j < width; ++j)
+        {
+          // dir vector to sample from a standard Y up cubemap: the ray
+          // (0, 0, 1) pitched by -v around X, then yawed by -h around Y
+          double x = -cosV[i] * sinH[j];
+          double y = sinV[i];
+          double z = cosV[i] * cosH[j];
+          double ax = std::abs(x);
+          double ay = std::abs(y);
+          double az = std::abs(z);
+
+          unsigned int faceIdx;
+          double ma;
+          double u;
+          double v;
+          if (az >= ax && az >= ay)
+          {
+            faceIdx = z < 0.0 ? 5u : 4u;
+            ma = 0.5 / az;
+            u = z < 0.0 ? -x : x;
+            v = -y;
+          }
+          else if (ay >= ax)
+          {
+            faceIdx = y < 0.0 ? 3u : 2u;
+            ma = 0.5 / ay;
+            u = x;
+            v = y < 0.0 ? -z : z;
+          }
+          else
+          {
+            faceIdx = x < 0.0 ? 1u : 0u;
+            ma = 0.5 / ax;
+            u = x < 0.0 ? z : -z;
+            v = -y;
+          }
+          mask |= 1u << faceIdx;
+
+          // u
+          *pDest++ = static_cast<float>(u * ma + 0.5);
+          // v
+          *pDest++ = static_cast<float>(v * ma + 0.5);
+          // face
+          *pDest++ = static_cast<float>(faceIdx);
+        }
+      }
+      return mask;
+    });
+
+    for (unsigned int f = 0u; f < 6u; ++f)
+    {
+      if (faces & (1u << f))
+        _tex.faces.insert(f);
+    }
+
+    FaceRayDensity(_dest, width, height, _tex.densityU, _tex.densityV);
+  };
+
+  this->dataPtr->sampleTexture = Ogre2GpuRaysPrivate::SharedSampleTexture(
+      std::make_tuple(false, min, max, vmin, vmax, width, height,
+      this->dataPtr->w1st, this->dataPtr->h1st), width, height, fill);
+  this->dataPtr->cubeUVTexture = this->dataPtr->sampleTexture->texture;
+  this->dataPtr->cubeFaceIdx = this->dataPtr->sampleTexture->faces;
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::CreateDirectSampleTexture()
+{
+  double min = this->AngleMin().Radian();
+  double max = this->AngleMax().Radian();
+  double vmin = this->VerticalAngleMin().Radian();
+  double vmax = this->VerticalAngleMax().Radian();
+  double hStep = (max-min) / static_cast<double>(this->dataPtr->w2nd-1);
+  double vStep = 1.0;
+  // non-planar case
+  if (this->dataPtr->h2nd > 1)
+    vStep = (vmax-vmin) / static_cast<double>(this->dataPtr->h2nd-1);
+
+  unsigned int width = this->dataPtr->w2nd;
+  unsigned int height = this->dataPtr->h2nd;
 
-  double v = vmin;
-  for (unsigned int i = 0; i < this->dataPtr->h2nd; ++i)
+  // point the camera at the center of the field of view. Rays are given in
+  // the sensor frame, x forward and z up.
+  math::Quaterniond center(0, -(vmin + vmax) * 0.5, (min + max) * 0.5);
+  math::Matrix3d toCamera(center.Inverse());
+
+  // create the same RGB texture as the cubemap path, with every ray sampling
+  // from the single perspective texture (face 0)
+  //   R: u coordinate on the perspective texture
+  //   G: v coordinate on the perspective texture
+  //   B: 0
+  auto fill = [&](Ogre2GpuRaysPrivate::SampleTexture &_tex, float *_dest)
   {
-    double h = min;
-    for (unsigned int j = 0; j < this->dataPtr->w2nd; ++j)
+    // ray directions in the camera frame
+    std::vector<math::Vector3d> dirs(static_cast<size_t>(width) * height);
+    for (unsigned int i = 0; i < height; ++i)
+    {
+      double v = vmin + i * vStep;
+      for (unsigned int j = 0; j < width; ++j)
+      {
+        double h = min + j * hStep;
+        dirs[i * width + j] = toCamera * math::Vector3d(
+            std::cos(v) * std::cos(h), std::cos(v) * std::sin(h),
+            std::sin(v));
+      }
+    }
+
+    // find the extent of the image plane that covers all rays
+    double tanX = 0.0;
+    double tanY = 0.0;
+    for (const auto &dir : dirs)
     {
-      // set up dir vector to sample from a standard Y up cubemap
-      math::Vector3d ray(0, 0, 1);
-      ray.Normalize();
-      math::Quaterniond pitch(math::Vector3d(1, 0, 0), -v);
-      math::Quaterniond yaw(math::Vector3d(0, 1, 0), -h);
-      math::Vector3d dir = yaw * pitch * ray;
-      unsigned int faceIdx;
-      math::Vector2d uv = this->SampleCubemap(dir, faceIdx);
-      this->dataPtr->cubeFaceIdx.insert(faceIdx);
-      // igndbg << "p(" << pitch << ") y(" << yaw << "): " << dir << " | "
-      //       << uv << " | " << faceIdx << std::endl;
-      // u
-      *pDest++ = uv.X();
-      // v
-      *pDest++ = uv.Y();
-      // face
-      *pDest++ = faceIdx;
-
-       h += hStep;
+      tanX = std::max(tanX, std::abs(dir.Y() / dir.X()));
+      tanY = std::max(tanY, std::abs(dir.Z() / dir.X()));
     }
-    v += vStep;
-  }
+    // keep rays on the edge inside the image and avoid a degenerate frustum
+    tanX = std::max(tanX * (1.0 + 2.0 / this->dataPtr->w1st), 1e-3);
+    tanY = std::max(tanY * (1.0 + 2.0 / this->dataPtr->h1st), 1e-3);
 
-  pixelBuffer->unlock();
+    float *pDest = _dest;
+    for (const auto &dir : dirs)
+    {
+      // image u grows to the right (-y), image v grows down (-z)
+      *pDest++ = static_cast<float>(0.5 - dir.Y() / dir.X() / (2.0 * tanX));
+      *pDest++ = static_cast<float>(0.5 - dir.Z() / dir.X() / (2.0 * tanY));
+      *pDest++ = 0.0f;
+    }
+
+    _tex.faces.insert(0u);
+    _tex.tanX = tanX;
+    _tex.tanY = tanY;
+  };
+
+  this->dataPtr->sampleTexture = Ogre2GpuRaysPrivate::SharedSampleTexture(
+      std::make_tuple(true, min, max, vmin, vmax, width, height,
+      this->dataPtr->w1st, this->dataPtr->h1st), width, height, fill);
+  this->dataPtr->cubeUVTexture = this->dataPtr->sampleTexture->texture;
+  this->dataPtr->cubeFaceIdx = this->dataPtr->sampleTexture->faces;
+
+  double tanX = this->dataPtr->sampleTexture->tanX;
+  double tanY = this->dataPtr->sampleTexture->tanY;
+  Ogre::Camera *cam = this->dataPtr->ogreCamera;
+  cam->setOrientation(Ogre::Quaternion::IDENTITY);
+  cam->yaw(Ogre::Degree(-90));
+  cam->roll(Ogre::Degree(-90));
+  cam->setOrientation(
+      Ogre2Conversions::Convert(center) * cam->getOrientation());
+  cam->setAutoAspectRatio(false);
+  cam->setFOVy(Ogre::Radian(2.0 * std::atan(tanY)));
+  cam->setAspectRatio(tanX / tanY);
 }
 
 /////////////////////////////////////////////////////////
-void Ogre2GpuRays::Setup1stPass()
+void Ogre2GpuRays::Create1stPassMaterial()
 {
   // Load 1st pass material
   // The GpuRaysScan1st material is defined in script (gpu_rays.material).
@@ -663,6 +1084,181 @@ void Ogre2GpuRays::Setup1stPass()
       static_cast<float>(this->dataMinVal));
   psParams->setNamedConstant("particleStddev",
     static_cast<float>(this->dataPtr->particleStddev));
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::Add1stPassTargets(Ogre::CompositorNodeDef *_nodeDef,
+    const std::string &_rangeTarget, unsigned int _width,
+    unsigned int _height)
+{
+  Ogre::TextureDefinitionBase::TextureDefinition *depthTexDef =
+      _nodeDef->addTextureDefinition("depthTexture");
+  depthTexDef->textureType = Ogre::TEX_TYPE_2D;
+  depthTexDef->width = _width;
+  depthTexDef->height = _height;
+  depthTexDef->depth = 1;
+  depthTexDef->numMipmaps = 0;
+  depthTexDef->widthFactor = 1;
+  depthTexDef->heightFactor = 1;
+  depthTexDef->formatList = {Ogre::PF_D32_FLOAT};
+  depthTexDef->fsaa = 0;
+  depthTexDef->uav = false;
+  depthTexDef->automipmaps = false;
+  depthTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
+  depthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+
+  depthTexDef->depthBufferFormat = Ogre::PF_UNKNOWN;
+  depthTexDef->fsaaExplicitResolve = false;
+
+  Ogre::TextureDefinitionBase::TextureDefinition *colorTexDef =
+      _nodeDef->addTextureDefinition("colorTexture");
+  colorTexDef->textureType = Ogre::TEX_TYPE_2D;
+  colorTexDef->width = _width;
+  colorTexDef->height = _height;
+  colorTexDef->depth = 1;
+  colorTexDef->numMipmaps = 0;
+  colorTexDef->widthFactor = 1;
+  colorTexDef->heightFactor = 1;
+  colorTexDef->formatList = {Ogre::PF_R8G8B8};
+  colorTexDef->fsaa = 0;
+  colorTexDef->uav = false;
+  colorTexDef->automipmaps = false;
+  colorTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
+  colorTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+  colorTexDef->depthBufferFormat = Ogre::PF_D32_FLOAT;
+  colorTexDef->preferDepthTexture = true;
+  colorTexDef->fsaaExplicitResolve = false;
+
+  Ogre::TextureDefinitionBase::TextureDefinition *particleDepthTexDef =
+      _nodeDef->addTextureDefinition("particleDepthTexture");
+  particleDepthTexDef->textureType = Ogre::TEX_TYPE_2D;
+  particleDepthTexDef->width = _width / 2u;
+  particleDepthTexDef->height = _height / 2u;
+  particleDepthTexDef->depth = 1;
+  particleDepthTexDef->numMipmaps = 0;
+  particleDepthTexDef->widthFactor = 0.5;
+  particleDepthTexDef->heightFactor = 0.5;
+  particleDepthTexDef->formatList = {Ogre::PF_D32_FLOAT};
+  particleDepthTexDef->fsaa = 0;
+  particleDepthTexDef->uav = false;
+  particleDepthTexDef->automipmaps = false;
+  particleDepthTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
+  particleDepthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+
+  Ogre::TextureDefinitionBase::TextureDefinition *particleTexDef =
+      _nodeDef->addTextureDefinition("particleTexture");
+  particleTexDef->textureType = Ogre::TEX_TYPE_2D;
+  particleTexDef->width = _width / 2u;
+  particleTexDef->height = _height / 2u;
+  particleTexDef->depth = 1;
+  particleTexDef->numMipmaps = 0;
+  particleTexDef->widthFactor = 0.5;
+  particleTexDef->heightFactor = 0.5;
+  particleTexDef->formatList = {Ogre::PF_R8G8B8};
+  particleTexDef->fsaa = 0;
+  particleTexDef->uav = false;
+  particleTexDef->automipmaps = false;
+  particleTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
+  particleTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
+  particleTexDef->depthBufferFormat = Ogre::PF_D32_FLOAT;
+  particleTexDef->preferDepthTexture = true;
+  particleTexDef->fsaaExplicitResolve = false;
+
+  Ogre::CompositorTargetDef *colorTargetDef =
+      _nodeDef->addTargetPass("colorTexture");
+  colorTargetDef->setNumPasses(2);
+  {
+    // clear pass
+    Ogre::CompositorPassClearDef *passClear =
+        static_cast<Ogre::CompositorPassClearDef *>(
+        colorTargetDef->addPass(Ogre::PASS_CLEAR));
+    passClear->mColourValue = Ogre::ColourValue(0, 0, 0);
+    // scene pass
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        colorTargetDef->addPass(Ogre::PASS_SCENE));
+    // set camera custom visibility mask when rendering laser retro
+    passScene->mVisibilityMask = 0x01000000 &
+        ~Ogre2ParticleEmitter::kParticleVisibilityFlags;
+  }
+
+  Ogre::CompositorTargetDef *particleTargetDef =
+      _nodeDef->addTargetPass("particleTexture");
+  particleTargetDef->setNumPasses(2);
+  {
+    // clear pass
+    Ogre::CompositorPassClearDef *passClear =
+        static_cast<Ogre::CompositorPassClearDef *>(
+        particleTargetDef->addPass(Ogre::PASS_CLEAR));
+    passClear->mColourValue = Ogre::ColourValue::Black;
+    // scene pass
+    Ogre::CompositorPassSceneDef *passScene =
+        static_cast<Ogre::CompositorPassSceneDef *>(
+        particleTargetDef->addPass(Ogre::PASS_SCENE));
+    // set camera custom visibility mask when rendering laser retro
+    passScene->mVisibilityMask =
+        Ogre2ParticleEmitter::kParticleVisibilityFlags;
+  }
+
+  // range target - converts depth to range
+  Ogre::CompositorTargetDef *inputTargetDef =
+      _nodeDef->addTargetPass(_rangeTarget);
+  inputTargetDef->setNumPasses(2);
+  {
+    // clear pass
+    Ogre::CompositorPassClearDef *passClear =
+        static_cast<Ogre::CompositorPassClearDef *>(
+        inputTargetDef->addPass(Ogre::PASS_CLEAR));
+    passClear->mColourValue = Ogre::ColourValue(this->dataMaxVal, 0, 1.0);
+    // quad pass
+    Ogre::CompositorPassQuadDef *passQuad =
+        static_cast<Ogre::CompositorPassQuadDef *>(
+        inputTargetDef->addPass(Ogre::PASS_QUAD));
+    passQuad->mMaterialName = this->dataPtr->matFirstPass->getName();
+    passQuad->addQuadTextureSource(0, "depthTexture", 0);
+    passQuad->addQuadTextureSource(1, "colorTexture", 0);
+    passQuad->addQuadTextureSource(2, "particleDepthTexture", 0);
+    passQuad->addQuadTextureSource(3, "particleTexture", 0);
+    passQuad->mFrustumCorners =
+        Ogre::CompositorPassQuadDef::VIEW_SPACE_CORNERS;
+  }
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::Attach1stPassListeners(unsigned int _index,
+    Ogre::CompositorWorkspace *_workspace, Ogre::Camera *_camera)
+{
+  Ogre::CompositorNode *node = _workspace->getNodeSequence()[0];
+  auto channelsTex = node->getLocalTextures();
+
+  for (auto c : channelsTex)
+  {
+    if (c.textures[0]->getSrcFormat() == Ogre::PF_R8G8B8)
+    {
+      // add laser retro material switcher to render target listener
+      // so we can switch to use laser retro material when the camera is
+      // being updated
+      this->dataPtr->laserRetroMaterialSwitcher[_index].reset(
+          new Ogre2LaserRetroMaterialSwitcher(this->scene));
+      c.target->addListener(
+          this->dataPtr->laserRetroMaterialSwitcher[_index].get());
+
+      // add particle noise / scatter effects listener so we can set the
+      // amount of noise based on size of emitter
+      this->dataPtr->particleNoiseListener[_index].reset(
+          new Ogre2ParticleNoiseListener(this->scene,
+          _camera, this->dataPtr->matFirstPass));
+      c.target->addListener(
+          this->dataPtr->particleNoiseListener[_index].get());
+      break;
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::Setup1stPass()
+{
+  this->Create1stPassMaterial();
 
   // Create 1st pass compositor
   auto engine = Ogre2RenderEngine::Instance();
@@ -729,139 +1325,8 @@ void Ogre2GpuRays::Setup1stPass()
     // Input texture
     nodeDef->addTextureSourceName("rt_input", 0,
         Ogre::TextureDefinitionBase::TEXTURE_INPUT);
-    Ogre::TextureDefinitionBase::TextureDefinition *depthTexDef =
-        nodeDef->addTextureDefinition("depthTexture");
-    depthTexDef->textureType = Ogre::TEX_TYPE_2D;
-    depthTexDef->width = 0;
-    depthTexDef->height = 0;
-    depthTexDef->depth = 1;
-    depthTexDef->numMipmaps = 0;
-    depthTexDef->widthFactor = 1;
-    depthTexDef->heightFactor = 1;
-    depthTexDef->formatList = {Ogre::PF_D32_FLOAT};
-    depthTexDef->fsaa = 0;
-    depthTexDef->uav = false;
-    depthTexDef->automipmaps = false;
-    depthTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
-    depthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
-
-    depthTexDef->depthBufferFormat = Ogre::PF_UNKNOWN;
-    depthTexDef->fsaaExplicitResolve = false;
-
-    Ogre::TextureDefinitionBase::TextureDefinition *colorTexDef =
-        nodeDef->addTextureDefinition("colorTexture");
-    colorTexDef->textureType = Ogre::TEX_TYPE_2D;
-    colorTexDef->width = 0;
-    colorTexDef->height = 0;
-    colorTexDef->depth = 1;
-    colorTexDef->numMipmaps = 0;
-    colorTexDef->widthFactor = 1;
-    colorTexDef->heightFactor = 1;
-    colorTexDef->formatList = {Ogre::PF_R8G8B8};
-    colorTexDef->fsaa = 0;
-    colorTexDef->uav = false;
-    colorTexDef->automipmaps = false;
-    colorTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
-    colorTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
-    colorTexDef->depthBufferFormat = Ogre::PF_D32_FLOAT;
-    colorTexDef->preferDepthTexture = true;
-    colorTexDef->fsaaExplicitResolve = false;
-
-    Ogre::TextureDefinitionBase::TextureDefinition *particleDepthTexDef =
-        nodeDef->addTextureDefinition("particleDepthTexture");
-    particleDepthTexDef->textureType = Ogre::TEX_TYPE_2D;
-    particleDepthTexDef->width = 0;
-    particleDepthTexDef->height = 0;
-    particleDepthTexDef->depth = 1;
-    particleDepthTexDef->numMipmaps = 0;
-    particleDepthTexDef->widthFactor = 0.5;
-    particleDepthTexDef->heightFactor = 0.5;
-    particleDepthTexDef->formatList = {Ogre::PF_D32_FLOAT};
-    particleDepthTexDef->fsaa = 0;
-    particleDepthTexDef->uav = false;
-    particleDepthTexDef->automipmaps = false;
-    particleDepthTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
-    particleDepthTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
-
-    Ogre::TextureDefinitionBase::TextureDefinition *particleTexDef =
-        nodeDef->addTextureDefinition("particleTexture");
-    particleTexDef->textureType = Ogre::TEX_TYPE_2D;
-    particleTexDef->width = 0;
-    particleTexDef->height = 0;
-    particleTexDef->depth = 1;
-    particleTexDef->numMipmaps = 0;
-    particleTexDef->widthFactor = 0.5;
-    particleTexDef->heightFactor = 0.5;
-    particleTexDef->formatList = {Ogre::PF_R8G8B8};
-    particleTexDef->fsaa = 0;
-    particleTexDef->uav = false;
-    particleTexDef->automipmaps = false;
-    particleTexDef->hwGammaWrite = Ogre::TextureDefinitionBase::BoolFalse;
-    particleTexDef->depthBufferId = Ogre::DepthBuffer::POOL_DEFAULT;
-    particleTexDef->depthBufferFormat = Ogre::PF_D32_FLOAT;
-    particleTexDef->preferDepthTexture = true;
-    particleTexDef->fsaaExplicitResolve = false;
-
     nodeDef->setNumTargetPass(3);
-
-    Ogre::CompositorTargetDef *colorTargetDef =
-        nodeDef->addTargetPass("colorTexture");
-    colorTargetDef->setNumPasses(2);
-    {
-      // clear pass
-      Ogre::CompositorPassClearDef *passClear =
-          static_cast<Ogre::CompositorPassClearDef *>(
-          colorTargetDef->addPass(Ogre::PASS_CLEAR));
-      passClear->mColourValue = Ogre::ColourValue(0, 0, 0);
-      // scene pass
-      Ogre::CompositorPassSceneDef *passScene =
-          static_cast<Ogre::CompositorPassSceneDef *>(
-          colorTargetDef->addPass(Ogre::PASS_SCENE));
-      // set camera custom visibility mask when rendering laser retro
-      passScene->mVisibilityMask = 0x01000000 &
-          ~Ogre2ParticleEmitter::kParticleVisibilityFlags;
-    }
-
-    Ogre::CompositorTargetDef *particleTargetDef =
-        nodeDef->addTargetPass("particleTexture");
-    particleTargetDef->setNumPasses(2);
-    {
-      // clear pass
-      Ogre::CompositorPassClearDef *passClear =
-          static_cast<Ogre::CompositorPassClearDef *>(
-          particleTargetDef->addPass(Ogre::PASS_CLEAR));
-      passClear->mColourValue = Ogre::ColourValue::Black;
-      // scene pass
-      Ogre::CompositorPassSceneDef *passScene =
-          static_cast<Ogre::CompositorPassSceneDef *>(
-          particleTargetDef->addPass(Ogre::PASS_SCENE));
-      // set camera custom visibility mask when rendering laser retro
-      passScene->mVisibilityMask =
-          Ogre2ParticleEmitter::kParticleVisibilityFlags;
-    }
-
-    // rt_input target - converts depth to range
-    Ogre::CompositorTargetDef *inputTargetDef =
-        nodeDef->addTargetPass("rt_input");
-    inputTargetDef->setNumPasses(2);
-    {
-      // clear pass
-      Ogre::CompositorPassClearDef *passClear =
-          static_cast<Ogre::CompositorPassClearDef *>(
-          inputTargetDef->addPass(Ogre::PASS_CLEAR));
-      passClear->mColourValue = Ogre::ColourValue(this->dataMaxVal, 0, 1.0);
-      // quad pass
-      Ogre::CompositorPassQuadDef *passQuad =
-          static_cast<Ogre::CompositorPassQuadDef *>(
-          inputTargetDef->addPass(Ogre::PASS_QUAD));
-      passQuad->mMaterialName = this->dataPtr->matFirstPass->getName();
-      passQuad->addQuadTextureSource(0, "depthTexture", 0);
-      passQuad->addQuadTextureSource(1, "colorTexture", 0);
-      passQuad->addQuadTextureSource(2, "particleDepthTexture", 0);
-      passQuad->addQuadTextureSource(3, "particleTexture", 0);
-      passQuad->mFrustumCorners =
-          Ogre::CompositorPassQuadDef::VIEW_SPACE_CORNERS;
-    }
+    this->Add1stPassTargets(nodeDef, "rt_input", 0u, 0u);
     nodeDef->mapOutputChannel(0, "rt_input");
     Ogre::CompositorWorkspaceDef *workDef =
         ogreCompMgr->addWorkspaceDefinition(wsDefName);
@@ -904,6 +1369,22 @@ void Ogre2GpuRays::Setup1stPass()
     else if (i == 5)
       this->dataPtr->cubeCam[i]->yaw(Ogre::Degree(180));
 
+    // size the face from the density of the rays sampling it. Faces
+    // sampled by a single row or column of rays stay square.
+    double densityU = this->dataPtr->sampleTexture->densityU[i];
+    double densityV = this->dataPtr->sampleTexture->densityV[i];
+    if (densityU <= 0.0)
+      densityU = densityV;
+    if (densityV <= 0.0)
+      densityV = densityU;
+    unsigned int width = this->dataPtr->w1st;
+    unsigned int height = this->dataPtr->h1st;
+    if (densityU > 0.0)
+    {
+      width = FirstPassSize(densityU * this->resolutionScale);
+      height = FirstPassSize(densityV * this->resolutionScale);
+    }
+
     // create render texture - these textures pack the range data
     // that will be used in the 2nd pass
     std::stringstream texName;
@@ -911,7 +1392,7 @@ void Ogre2GpuRays::Setup1stPass()
     this->dataPtr->firstPassTextures[i] =
       Ogre::TextureManager::getSingleton().createManual(
       texName.str(), "General", Ogre::TEX_TYPE_2D,
-      this->dataPtr->w1st, this->dataPtr->h1st, 1, 0,
+      width, height, 1, 0,
       Ogre::PF_FLOAT32_RGB, Ogre::TU_RENDERTARGET,
       0, false, 0, Ogre::BLANKSTRING, false, true);
 
@@ -921,38 +1402,146 @@ void Ogre2GpuRays::Setup1stPass()
     this->dataPtr->ogreCompositorWorkspace1st[i] =
         ogreCompMgr->addWorkspace(this->scene->OgreSceneManager(),
         rt, this->dataPtr->cubeCam[i], wsDefName, false);
+    engine->RegisterWorkspace(this->dataPtr->ogreCompositorWorkspace1st[i]);
+
+    this->Attach1stPassListeners(i,
+        this->dataPtr->ogreCompositorWorkspace1st[i],
+        this->dataPtr->cubeCam[i]);
+  }
+}
 
-    Ogre::CompositorNode *node =
-        this->dataPtr->ogreCompositorWorkspace1st[i]->getNodeSequence()[0];
-    auto channelsTex = node->getLocalTextures();
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::SetupDirectPass()
+{
+  this->Create1stPassMaterial();
+
+  // the range texture is sampled by the second pass material like a
+  // cubemap face
+  this->dataPtr->firstPassTextures[0] =
+    Ogre::TextureManager::getSingleton().createManual(
+    this->Name() + "_first_pass_0", "General", Ogre::TEX_TYPE_2D,
+    this->dataPtr->w1st, this->dataPtr->h1st, 1, 0,
+    Ogre::PF_FLOAT32_RGB, Ogre::TU_RENDERTARGET,
+    0, false, 0, Ogre::BLANKSTRING, false, true);
+}
+
+/////////////////////////////////////////////////////////
+void Ogre2GpuRays::CreateDirectWorkspace()
+{
+  auto engine = Ogre2RenderEngine::Instance();
+  auto ogreRoot = engine->OgreRoot();
+  Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
+
+  // The 1st pass targets render into the range texture with the perspective
+  // camera, followed by the 2nd pass quad in the same node:
+  //
+  // compositor_node GpuRaysDirect
+  // {
+  //   in 0 rt_input
+  //   in 1 rangeTexture
+  //   // targets of GpuRays1stPass, rendering to rangeTexture
+  //   ...
+  //   target rt_input
+  //   {
+  //     pass clear
+  //     {
+  //       colour_value 0.0 0.0 0.0 1.0
+  //     }
+  //     pass render_quad
+  //     {
+  //       material GpuRaysScan2nd // Use copy instead of original
+  //     }
+  //   }
+  //   out 0 rt_input
+  // }
+  std::string wsDefName = "GpuRaysDirectWorkspace_" + this->Name();
+  this->dataPtr->ogreCompositorWorkspaceDef1st = wsDefName;
+  if (!ogreCompMgr->hasWorkspaceDefinition(wsDefName))
+  {
+    std::string nodeDefName = wsDefName + "/Node";
+    this->dataPtr->ogreCompositorNodeDef1st = nodeDefName;
+    Ogre::CompositorNodeDef *nodeDef =
+        ogreCompMgr->addNodeDefinition(nodeDefName);
+    nodeDef->addTextureSourceName("rt_input", 0,
+        Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+    nodeDef->addTextureSourceName("rangeTexture", 1,
+        Ogre::TextureDefinitionBase::TEXTURE_INPUT);
+    nodeDef->setNumTargetPass(4);
+    this->Add1stPassTargets(nodeDef, "rangeTexture",
+        this->dataPtr->w1st, this->dataPtr->h1st);
 
-    for (auto c : channelsTex)
+    Ogre::CompositorTargetDef *inputTargetDef =
+        nodeDef->addTargetPass("rt_input");
+    inputTargetDef->setNumPasses(2);
     {
-      if (c.textures[0]->getSrcFormat() == Ogre::PF_R8G8B8)
-      {
-        // add laser retro material switcher to render target listener
-        // so we can switch to use laser retro material when the camera is being
-        // updated
-        this->dataPtr->laserRetroMaterialSwitcher[i].reset(
-            new Ogre2LaserRetroMaterialSwitcher(this->scene));
-        c.target->addListener(
-            this->dataPtr->laserRetroMaterialSwitcher[i].get());
-
-        // add particle noise / scatter effects listener so we can set the
-        // amount of noise based on size of emitter
-        this->dataPtr->particleNoiseListener[i].reset(
-            new Ogre2ParticleNoiseListener(this->scene,
-            this->dataPtr->cubeCam[i], this->dataPtr->matFirstPass));
-        c.target->addListener(this->dataPtr->particleNoiseListener[i].get());
-        break;
-      }
+      // clear pass
+      Ogre::CompositorPassClearDef *passClear =
+          static_cast<Ogre::CompositorPassClearDef *>(
+          inputTargetDef->addPass(Ogre::PASS_CLEAR));
+      passClear->mColourValue = this->dataPtr->secondPassClearColour;
+      // quad pass - sample from the range texture
+      Ogre::CompositorPassQuadDef *passQuad =
+          static_cast<Ogre::CompositorPassQuadDef *>(
+          inputTargetDef->addPass(Ogre::PASS_QUAD));
+      passQuad->mMaterialName = this->dataPtr->matSecondPass->getName();
     }
+    nodeDef->mapOutputChannel(0, "rt_input");
+
+    Ogre::CompositorWorkspaceDef *workDef =
+        ogreCompMgr->addWorkspaceDefinition(wsDefName);
+    workDef->connectExternal(0, nodeDef->getName(), 0);
+    workDef->connectExternal(1, nodeDef->getName(), 1);
   }
+
+  Ogre::CompositorChannelVec externalTargets(2);
+  externalTargets[0].target =
+      this->dataPtr->secondPassTexture->getBuffer()->getRenderTarget();
+  externalTargets[0].textures.push_back(this->dataPtr->secondPassTexture);
+  externalTargets[1].target =
+      this->dataPtr->firstPassTextures[0]->getBuffer()->getRenderTarget();
+  externalTargets[1].textures.push_back(this->dataPtr->firstPassTextures[0]);
+
+  this->dataPtr->ogreCompositorWorkspace1st[0] =
+      ogreCompMgr->addWorkspace(this->scene->OgreSceneManager(),
+      externalTargets, this->dataPtr->ogreCamera, wsDefName, false);
+  engine->RegisterWorkspace(this->dataPtr->ogreCompositorWorkspace1st[0]);
+
+  this->Attach1stPassListeners(0u,
+      this->dataPtr->ogreCompositorWorkspace1st[0],
+      this->dataPtr->ogreCamera);
 }
 
 /////////////////////////////////////////////////////////
 void Ogre2GpuRays::Setup2ndPass()
 {
+  // The pixel format matches the layout of the data format so that only the
+  // requested data is copied from the gpu, see PostRender
+  this->dataPtr->secondPassFormat = this->dataFormat;
+  Ogre::PixelFormat format = Ogre::PF_FLOAT32_RGB;
+  Ogre::ColourValue clearColour(this->dataMaxVal, 0, 1.0);
+  switch (this->dataPtr->secondPassFormat)
+  {
+    case GRDF_RANGE:
+      format = Ogre::PF_FLOAT32_R;
+      break;
+    case GRDF_RANGE_INTENSITY_U8:
+      // range and intensity, the intensity is moved to a separate uint8
+      // array on the cpu
+      format = Ogre::PF_FLOAT32_GR;
+      break;
+    case GRDF_RANGE_U16_MM:
+      // unsigned normalized 16 bit texture, the shader writes the range in
+      // millimeters divided by 65535
+      format = Ogre::PF_L16;
+      clearColour = Ogre::ColourValue(std::min(
+          std::round(this->dataMaxVal * 1000.0f), 65535.0f) / 65535.0f,
+          0, 0);
+      break;
+    case GRDF_RANGE_RETRO:
+    default:
+      break;
+  }
+
   // Create second pass RTT, which stores the final range data output
   // see PostRender on how we retrieve data from this texture
   this->dataPtr->secondPassTexture =
@@ -961,7 +1550,7 @@ void Ogre2GpuRays::Setup2ndPass()
       "General",
       Ogre::TEX_TYPE_2D,
       this->dataPtr->w2nd, this->dataPtr->h2nd, 0,
-      Ogre::PF_FLOAT32_RGB,
+      format,
       Ogre::TU_RENDERTARGET);
 
   // Create second pass material
@@ -974,6 +1563,8 @@ void Ogre2GpuRays::Setup2ndPass()
       this->Name() + "_" + mat2ndName);
   this->dataPtr->matSecondPass->load();
   Ogre::Pass *pass = this->dataPtr->matSecondPass->getTechnique(0)->getPass(0);
+  pass->getFragmentProgramParameters()->setNamedConstant("dataFormat",
+      static_cast<int>(this->dataPtr->secondPassFormat));
 
   // Connect cubeUVTexture to the GpuRaysScan2nd material's texture unit state
   // The texture unit index (0) must match the one specified in the script
@@ -992,6 +1583,15 @@ void Ogre2GpuRays::Setup2ndPass()
     texUnit->setTexture(this->dataPtr->firstPassTextures[i]);
   }
 
+  // the direct pass renders the 2nd pass in the same workspace as the
+  // 1st pass
+  this->dataPtr->secondPassClearColour = clearColour;
+  if (this->dataPtr->directPass)
+  {
+    this->CreateDirectWorkspace();
+    return;
+  }
+
   // create 2nd pass compositor
   auto engine = Ogre2RenderEngine::Instance();
   auto ogreRoot = engine->OgreRoot();
@@ -1038,7 +1638,7 @@ void Ogre2GpuRays::Setup2ndPass()
       Ogre::CompositorPassClearDef *passClear =
           static_cast<Ogre::CompositorPassClearDef *>(
           inputTargetDef->addPass(Ogre::PASS_CLEAR));
-      passClear->mColourValue = Ogre::ColourValue(this->dataMaxVal, 0, 1.0);
+      passClear->mColourValue = clearColour;
       // quad pass - sample from cubemap textures
       Ogre::CompositorPassQuadDef *passQuad =
           static_cast<Ogre::CompositorPassQuadDef *>(
@@ -1065,14 +1665,23 @@ void Ogre2GpuRays::Setup2ndPass()
   this->dataPtr->ogreCompositorWorkspace2nd =
       ogreCompMgr->addWorkspace(this->scene->OgreSceneManager(),
       rt, this->dataPtr->ogreCamera, wsDefName, false);
+  engine->RegisterWorkspace(this->dataPtr->ogreCompositorWorkspace2nd);
 }
 
 /////////////////////////////////////////////////////////
 void Ogre2GpuRays::CreateGpuRaysTextures()
 {
   this->ConfigureCamera();
-  this->CreateSampleTexture();
-  this->Setup1stPass();
+  if (this->dataPtr->directPass)
+  {
+    this->CreateDirectSampleTexture();
+    this->SetupDirectPass();
+  }
+  else
+  {
+    this->CreateSampleTexture();
+    this->Setup1stPass();
+  }
   this->Setup2ndPass();
 }
 
@@ -1080,67 +1689,178 @@ void Ogre2GpuRays::CreateGpuRaysTextures()
 void Ogre2GpuRays::UpdateRenderTarget1stPass()
 {
   // update the compositors
+  std::vector<Ogre::CompositorWorkspace *> workspaces;
   for (auto i : this->dataPtr->cubeFaceIdx)
-    this->dataPtr->ogreCompositorWorkspace1st[i]->setEnabled(true);
+    workspaces.push_back(this->dataPtr->ogreCompositorWorkspace1st[i]);
   auto engine = Ogre2RenderEngine::Instance();
-  engine->OgreRoot()->renderOneFrame();
-  for (auto i : this->dataPtr->cubeFaceIdx)
-    this->dataPtr->ogreCompositorWorkspace1st[i]->setEnabled(false);
+  engine->RenderWorkspaces(workspaces);
 }
 
 /////////////////////////////////////////////////
 void Ogre2GpuRays::UpdateRenderTarget2ndPass()
 {
-  this->dataPtr->ogreCompositorWorkspace2nd->setEnabled(true);
+  // the 2nd pass samples the cubemap rendered by the 1st pass
   auto engine = Ogre2RenderEngine::Instance();
-  engine->OgreRoot()->renderOneFrame();
-  this->dataPtr->ogreCompositorWorkspace2nd->setEnabled(false);
+  engine->RenderWorkspaces({this->dataPtr->ogreCompositorWorkspace2nd}, 1u);
 }
 
 //////////////////////////////////////////////////
 void Ogre2GpuRays::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2GpuRays::Render");
   this->UpdateRenderTarget1stPass();
-  this->UpdateRenderTarget2ndPass();
+  if (!this->dataPtr->directPass)
+    this->UpdateRenderTarget2ndPass();
 }
 
 //////////////////////////////////////////////////
 void Ogre2GpuRays::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2GpuRays::PreRender");
   if (!this->dataPtr->cubeUVTexture)
+  {
     this->CreateGpuRaysTextures();
+  }
+  else if (this->dataPtr->secondPassFormat != this->dataFormat)
+  {
+    // only the second pass depends on the data format
+    this->Destroy2ndPass();
+    this->Setup2ndPass();
+  }
+
+  this->UpdateNoise();
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::UpdateNoise()
+{
+  if (!this->dataPtr->matSecondPass)
+    return;
+
+  // The enabled passes are combined into a single noise: the means and
+  // variances add up, the coarsest quantization wins and a ray is kept only
+  // if no pass drops it
+  bool noise = false;
+  double mean = 0.0;
+  double variance = 0.0;
+  double quantization = 0.0;
+  double keep = 1.0;
+  for (const auto &pass : this->dataPtr->renderPasses)
+  {
+    if (!pass->IsEnabled())
+      continue;
+
+    noise = true;
+    auto noisePass = std::dynamic_pointer_cast<GaussianNoisePass>(pass);
+    mean += noisePass->Mean() + noisePass->Bias();
+    variance += noisePass->StdDev() * noisePass->StdDev();
+    auto rangePass = std::dynamic_pointer_cast<RangeNoisePass>(pass);
+    if (rangePass)
+    {
+      quantization = std::max(quantization, rangePass->Quantization());
+      keep *= 1.0 - rangePass->DropoutProbability();
+    }
+  }
+
+  // These parameters are declared in gpu_rays.material and
+  // gpu_rays_2nd_pass_fs.glsl
+  Ogre::Pass *pass = this->dataPtr->matSecondPass->getTechnique(0)->getPass(0);
+  Ogre::GpuProgramParametersSharedPtr psParams =
+      pass->getFragmentProgramParameters();
+  psParams->setNamedConstant("noiseEnabled", static_cast<int>(noise));
+  if (!noise)
+    return;
+
+  psParams->setNamedConstant("noiseSeed",
+      ignition::math::Rand::IntUniform(0, std::numeric_limits<int>::max()));
+  psParams->setNamedConstant("noiseMean", static_cast<Ogre::Real>(mean));
+  psParams->setNamedConstant("noiseStdDev",
+      static_cast<Ogre::Real>(std::sqrt(variance)));
+  psParams->setNamedConstant("quantization",
+      static_cast<Ogre::Real>(quantization));
+  psParams->setNamedConstant("dropout",
+      static_cast<Ogre::Real>(1.0 - keep));
+  psParams->setNamedConstant("rangeMin",
+      static_cast<Ogre::Real>(this->NearClipPlane()));
+  psParams->setNamedConstant("rangeMax",
+      static_cast<Ogre::Real>(this->FarClipPlane()));
+  psParams->setNamedConstant("outOfRange",
+      static_cast<Ogre::Real>(this->dataMaxVal));
 }
 
 //////////////////////////////////////////////////
 void Ogre2GpuRays::PostRender()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2GpuRays::PostRender");
   unsigned int width = this->dataPtr->w2nd;
   unsigned int height = this->dataPtr->h2nd;
+  unsigned int count = width * height;
 
-  size_t size = Ogre::PixelUtil::getMemorySize(
-    width, height, 1, Ogre::PF_FLOAT32_RGB);
-  int len = width * height * this->Channels();
+  Ogre::PixelFormat format = this->dataPtr->secondPassTexture->getFormat();
+  size_t size = Ogre::PixelUtil::getMemorySize(width, height, 1, format);
 
-  if (!this->dataPtr->gpuRaysBuffer)
+  // u16 data is copied straight into the outgoing buffer and float data
+  // into the outgoing scan
+  void *dst = nullptr;
+  if (this->dataPtr->secondPassFormat == GRDF_RANGE_U16_MM)
+  {
+    if (!this->dataPtr->gpuRaysBuffer)
+      this->dataPtr->gpuRaysBuffer = new unsigned char[size];
+    dst = this->dataPtr->gpuRaysBuffer;
+  }
+  else
   {
-    this->dataPtr->gpuRaysBuffer = new float[len];
+    if (!this->dataPtr->gpuRaysScan)
+      this->dataPtr->gpuRaysScan = new float[size / sizeof(float)];
+    dst = this->dataPtr->gpuRaysScan;
   }
-  Ogre::PixelBox dstBox(width, height,
-        1, Ogre::PF_FLOAT32_RGB, this->dataPtr->gpuRaysBuffer);
+
+  Ogre::PixelBox dstBox(width, height, 1, format, dst);
 
   // blit data from gpu to cpu
   auto rt = this->dataPtr->secondPassTexture->getBuffer()->getRenderTarget();
   rt->copyContentsToMemory(dstBox, Ogre::RenderTarget::FB_FRONT);
 
-  if (!this->dataPtr->gpuRaysScan)
+  std::string formatStr = this->DataFormatString();
+  if (this->dataPtr->secondPassFormat == GRDF_RANGE_INTENSITY_U8)
   {
-    this->dataPtr->gpuRaysScan = new float[len];
+    // ranges of all readings followed by the intensities of all readings
+    if (!this->dataPtr->gpuRaysBuffer)
+    {
+      this->dataPtr->gpuRaysBuffer =
+          new unsigned char[count * (sizeof(float) + 1u)];
+    }
+    float *ranges = reinterpret_cast<float *>(this->dataPtr->gpuRaysBuffer);
+    unsigned char *intensities =
+        this->dataPtr->gpuRaysBuffer + count * sizeof(float);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      ranges[i] = this->dataPtr->gpuRaysScan[i * 2];
+      // the shader already scales the intensity, clamp it anyway since
+      // converting a float out of the range of unsigned char is undefined
+      float intensity = std::min(255.0f,
+          std::max(0.0f, this->dataPtr->gpuRaysScan[i * 2 + 1]));
+      intensities[i] =
+          static_cast<unsigned char>(std::floor(intensity + 0.5f));
+    }
+    IGN_RENDERING_TRACE_ZONE("Ogre2GpuRays::NewGpuRaysData");
+    this->dataPtr->newGpuRaysData(this->dataPtr->gpuRaysBuffer,
+        width, height, this->Channels(), formatStr);
+  }
+  else if (this->dataPtr->secondPassFormat == GRDF_RANGE_U16_MM)
+  {
+    IGN_RENDERING_TRACE_ZONE("Ogre2GpuRays::NewGpuRaysData");
+    this->dataPtr->newGpuRaysData(this->dataPtr->gpuRaysBuffer,
+        width, height, this->Channels(), formatStr);
+  }
+  else
+  {
+    IGN_RENDERING_TRACE_ZONE("Ogre2GpuRays::NewGpuRaysFrame");
+    this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
+        width, height, this->Channels(), formatStr);
+    this->dataPtr->newGpuRaysData(this->dataPtr->gpuRaysScan,
+        width, height, this->Channels(), formatStr);
   }
-
-  memcpy(this->dataPtr->gpuRaysScan, this->dataPtr->gpuRaysBuffer, size);
-
-  this->dataPtr->newGpuRaysFrame(this->dataPtr->gpuRaysScan,
-      width, height, this->Channels(), "PF_FLOAT32_RGB");
 
   // Uncomment to debug output
   // igndbg << "wxh: " << width << " x " << height << std::endl;
@@ -1148,9 +1868,9 @@ void Ogre2GpuRays::PostRender()
   // {
   //   for (unsigned int j = 0; j < width; ++j)
   //   {
-  //     igndbg << "[" << this->dataPtr->gpuRaysBuffer[i*width*3 + j*3] <<  " ";
-  //     igndbg << this->dataPtr->gpuRaysBuffer[i*width*3 + j*3 + 1] <<  " ";
-  //     igndbg << this->dataPtr->gpuRaysBuffer[i*width*3 + j*3 + 2] <<  "] ";
+  //     igndbg << "[" << this->dataPtr->gpuRaysScan[i*width*3 + j*3] <<  " ";
+  //     igndbg << this->dataPtr->gpuRaysScan[i*width*3 + j*3 + 1] <<  " ";
+  //     igndbg << this->dataPtr->gpuRaysScan[i*width*3 + j*3 + 2] <<  "] ";
   //   }
   //   igndbg << std::endl;
   // }
@@ -1159,19 +1879,28 @@ void Ogre2GpuRays::PostRender()
 //////////////////////////////////////////////////
 const float* Ogre2GpuRays::Data() const
 {
+  if (this->dataPtr->secondPassFormat != GRDF_RANGE_RETRO &&
+      this->dataPtr->secondPassFormat != GRDF_RANGE)
+  {
+    return nullptr;
+  }
   return this->dataPtr->gpuRaysScan;
 }
 
 //////////////////////////////////////////////////
 void Ogre2GpuRays::Copy(float *_dataDest)
 {
-  unsigned int width = this->dataPtr->w2nd;
-  unsigned int height = this->dataPtr->h2nd;
+  const float *data = this->Data();
+  if (!data)
+    return;
 
-  size_t size = Ogre::PixelUtil::getMemorySize(
-    width, height, 1, Ogre::PF_FLOAT32_RGB);
+  // the scan holds the channels of the format it was rendered with
+  unsigned int channels =
+      this->dataPtr->secondPassFormat == GRDF_RANGE_RETRO ? 3u : 1u;
+  size_t size = this->dataPtr->w2nd * this->dataPtr->h2nd * channels *
+      sizeof(float);
 
-  memcpy(_dataDest, this->dataPtr->gpuRaysScan, size);
+  memcpy(_dataDest, data, size);
 }
 
 /////////////////////////////////////////////////
@@ -1199,8 +1928,59 @@ ignition::common::ConnectionPtr Ogre2GpuRays::ConnectNewGpuRaysFrame(
   return this->dataPtr->newGpuRaysFrame.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+ignition::common::ConnectionPtr Ogre2GpuRays::ConnectNewGpuRaysData(
+    NewFrameListener _subscriber)
+{
+  return this->dataPtr->newGpuRaysData.Connect(_subscriber);
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr Ogre2GpuRays::RenderTarget() const
 {
   return this->dataPtr->renderTexture;
 }
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::AddRenderPass(const RenderPassPtr &_pass)
+{
+  if (!std::dynamic_pointer_cast<GaussianNoisePass>(_pass))
+  {
+    ignerr << "Gpu rays currently only support gaussian noise passes"
+           << std::endl;
+    return;
+  }
+
+  if (std::find(this->dataPtr->renderPasses.begin(),
+      this->dataPtr->renderPasses.end(), _pass) ==
+      this->dataPtr->renderPasses.end())
+  {
+    this->dataPtr->renderPasses.push_back(_pass);
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuRays::RemoveRenderPass(const RenderPassPtr &_pass)
+{
+  auto it = std::find(this->dataPtr->renderPasses.begin(),
+      this->dataPtr->renderPasses.end(), _pass);
+  if (it != this->dataPtr->renderPasses.end())
+    this->dataPtr->renderPasses.erase(it);
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2GpuRays::RenderPassCount() const
+{
+  return static_cast<unsigned int>(this->dataPtr->renderPasses.size());
+}
+
+//////////////////////////////////////////////////
+RenderPassPtr Ogre2GpuRays::RenderPassByIndex(unsigned int _index) const
+{
+  if (_index >= this->dataPtr->renderPasses.size())
+  {
+    ignerr << "RenderPass index out of range: " << _index << std::endl;
+    return RenderPassPtr();
+  }
+  return this->dataPtr->renderPasses[_index];
+}
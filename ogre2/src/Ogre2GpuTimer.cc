@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+
+#if !defined(__APPLE__) && !defined(_WIN32)
+# ifndef GL_GLEXT_PROTOTYPES
+#  define GL_GLEXT_PROTOTYPES
+# endif
+# include <GL/gl.h>
+# include <GL/glext.h>
+# define IGN_RENDERING_OGRE2_TIMER_QUERY
+#endif
+
+#ifdef _MSC_VER
+  #pragma warning(push, 0)
+#endif
+#include <OgreRenderSystem.h>
+#include <OgreRoot.h>
+#ifdef _MSC_VER
+  #pragma warning(pop)
+#endif
+
+#include "Ogre2GpuTimer.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2GpuTimer::~Ogre2GpuTimer()
+{
+#ifdef IGN_RENDERING_OGRE2_TIMER_QUERY
+  if (this->initialized)
+    glDeleteQueries(kQueryCount, this->queries);
+#endif
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuTimer::Begin()
+{
+#ifdef IGN_RENDERING_OGRE2_TIMER_QUERY
+  if (!this->initialized)
+  {
+    this->initialized = true;
+    Ogre::RenderSystem *renderSystem =
+        Ogre::Root::getSingleton().getRenderSystem();
+    // the GL3+ render system requires OpenGL 3.3, which has timer queries
+    this->supported = renderSystem &&
+        renderSystem->getName().find("OpenGL 3+") != std::string::npos;
+    if (this->supported)
+      glGenQueries(kQueryCount, this->queries);
+  }
+  if (!this->supported)
+    return;
+
+  this->Poll();
+  if (this->pending[this->next])
+    return;
+
+  glBeginQuery(GL_TIME_ELAPSED, this->queries[this->next]);
+  this->active = true;
+#endif
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuTimer::End()
+{
+#ifdef IGN_RENDERING_OGRE2_TIMER_QUERY
+  if (!this->active)
+    return;
+
+  glEndQuery(GL_TIME_ELAPSED);
+  this->pending[this->next] = true;
+  this->next = (this->next + 1u) % kQueryCount;
+  this->active = false;
+#endif
+}
+
+//////////////////////////////////////////////////
+double Ogre2GpuTimer::Elapsed() const
+{
+  return this->elapsed;
+}
+
+//////////////////////////////////////////////////
+void Ogre2GpuTimer::Poll()
+{
+#ifdef IGN_RENDERING_OGRE2_TIMER_QUERY
+  // oldest query first so that the latest result wins
+  for (unsigned int i = 0u; i < kQueryCount; ++i)
+  {
+    unsigned int index = (this->next + i) % kQueryCount;
+    if (!this->pending[index])
+      continue;
+
+    GLint available = 0;
+    glGetQueryObjectiv(this->queries[index], GL_QUERY_RESULT_AVAILABLE,
+        &available);
+    if (!available)
+      break;
+
+    // 32 bits hold up to 4 seconds
+    GLuint ns = 0u;
+    glGetQueryObjectuiv(this->queries[index], GL_QUERY_RESULT, &ns);
+    this->elapsed = ns * 1e-9;
+    this->pending[index] = false;
+  }
+#endif
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef IGNITION_RENDERING_OGRE2_OGRE2GPUTIMER_HH_
+#define IGNITION_RENDERING_OGRE2_OGRE2GPUTIMER_HH_
+
+#include "ignition/rendering/config.hh"
+
+namespace ignition
+{
+  namespace rendering
+  {
+    inline namespace IGNITION_RENDERING_VERSION_NAMESPACE {
+    //
+    /// \brief Measures the GPU time of the commands issued between Begin and
+    /// End with OpenGL timer queries. Results are read back once the GPU
+    /// made them available so the render thread never stalls, they lag a
+    /// frame or two behind. Must be used on the render thread while the
+    /// context of the render engine is current. Does nothing on render
+    /// systems other than OpenGL and on platforms without timer queries.
+    class Ogre2GpuTimer
+    {
+      /// \brief Constructor
+      public: Ogre2GpuTimer() = default;
+
+      /// \brief Destructor, releases the queries
+      public: ~Ogre2GpuTimer();
+
+      /// \brief Start timing. Skipped if all queries are still in flight.
+      public: void Begin();
+
+      /// \brief Stop timing
+      public: void End();
+
+      /// \brief Get the last measured time. Results are read back by Begin.
+      /// \return GPU time in seconds, negative if nothing was measured yet
+      public: double Elapsed() const;
+
+      /// \brief Read back the queries the GPU completed
+      private: void Poll();
+
+      /// \brief Number of queries in flight at most
+      private: static const unsigned int kQueryCount = 3u;
+
+      /// \brief OpenGL query names
+      private: unsigned int queries[kQueryCount] = {0u, 0u, 0u};
+
+      /// \brief True for queries whose result was not read yet
+      private: bool pending[kQueryCount] = {false, false, false};
+
+      /// \brief Query used by the next Begin
+      private: unsigned int next = 0u;
+
+      /// \brief True between Begin and End of a timed frame
+      private: bool active = false;
+
+      /// \brief True once queries were created
+      private: bool initialized = false;
+
+      /// \brief True if timer queries can be used
+      private: bool supported = false;
+
+      /// \brief Last measured time in seconds
+      private: double elapsed = -1.0;
+    };
+    }
+  }
+}
+
+#endif
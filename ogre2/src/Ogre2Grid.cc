@@ -15,12 +15,18 @@
  *
 */
 
+#include <string>
+#include <vector>
+
 #include <ignition/common/Console.hh>
+#include <ignition/common/MeshManager.hh>
 
+#include "ignition/rendering/ogre2/Ogre2GeometryCache.hh"
 #include "ignition/rendering/ogre2/Ogre2Grid.hh"
 #include "ignition/rendering/ogre2/Ogre2Material.hh"
+#include "ignition/rendering/ogre2/Ogre2Mesh.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
-#include "ignition/rendering/ogre2/Ogre2DynamicRenderable.hh"
+#include "ignition/rendering/ogre2/Ogre2Visual.hh"
 
 using namespace ignition;
 using namespace rendering;
@@ -30,8 +36,12 @@ class ignition::rendering::Ogre2GridPrivate
   /// \brief Grid materal
   public: Ogre2MaterialPtr material;
 
-  /// \brief Ogre renderable used to render the grid.
-  public: std::shared_ptr<Ogre2DynamicRenderable> grid = nullptr;
+  /// \brief Mesh used to render the grid. The underlying ogre mesh is
+  /// shared by all grids with the same parameters.
+  public: Ogre2MeshPtr grid = nullptr;
+
+  /// \brief Name of the shared grid mesh in the geometry cache
+  public: std::string meshName;
 };
 
 //////////////////////////////////////////////////
@@ -58,7 +68,9 @@ void Ogre2Grid::PreRender()
 //////////////////////////////////////////////////
 Ogre::MovableObject *Ogre2Grid::OgreObject() const
 {
-  return this->dataPtr->grid->OgreObject();
+  if (this->dataPtr->grid)
+    return this->dataPtr->grid->OgreObject();
+  return nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -67,19 +79,86 @@ void Ogre2Grid::Init()
   this->Create();
 }
 
+//////////////////////////////////////////////////
+void Ogre2Grid::Destroy()
+{
+  if (this->dataPtr->grid)
+  {
+    this->dataPtr->grid->Destroy();
+    this->dataPtr->grid.reset();
+  }
+
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  if (!this->dataPtr->meshName.empty() && ogreScene)
+  {
+    ogreScene->GeometryCache()->Release(this->dataPtr->meshName);
+    this->dataPtr->meshName.clear();
+  }
+}
+
 //////////////////////////////////////////////////
 void Ogre2Grid::Create()
 {
-  if (!this->dataPtr->grid)
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  Ogre2GeometryCachePtr cache = ogreScene->GeometryCache();
+
+  std::string key = "grid_mesh_" + std::to_string(this->cellCount) + "_" +
+      std::to_string(this->verticalCellCount) + "_" +
+      std::to_string(Ogre2GeometryCache::Quantize(this->cellLength)) + "_" +
+      std::to_string(Ogre2GeometryCache::Quantize(this->heightOffset));
+
+  std::string gridMeshName = cache->AcquireLineList(key, [this]()
+  {
+    return this->Points();
+  });
+  if (gridMeshName.empty())
+    return;
+
+  // nothing to do if the change does not affect the shared mesh
+  if (this->dataPtr->grid && gridMeshName == this->dataPtr->meshName)
   {
-    this->dataPtr->grid.reset(new Ogre2DynamicRenderable(this->scene));
+    cache->Release(gridMeshName);
+    return;
+  }
+
+  MeshDescriptor meshDescriptor;
+  meshDescriptor.mesh =
+      common::MeshManager::Instance()->MeshByName(gridMeshName);
+
+  auto visual = std::dynamic_pointer_cast<Ogre2Visual>(this->Parent());
+
+  // clear geom if needed
+  if (this->dataPtr->grid)
+  {
+    if (visual)
+    {
+      visual->RemoveGeometry(
+          std::dynamic_pointer_cast<Geometry>(shared_from_this()));
+    }
+    this->dataPtr->grid->Destroy();
   }
 
-  // Clear any previous data from the grid and update
-  this->dataPtr->grid->Clear();
-  this->dataPtr->grid->Update();
+  // the old mesh can only be released once its ogre item is destroyed
+  if (!this->dataPtr->meshName.empty())
+    cache->Release(this->dataPtr->meshName);
+  this->dataPtr->meshName = gridMeshName;
 
-  this->dataPtr->grid->SetOperationType(MarkerType::MT_LINE_LIST);
+  this->dataPtr->grid = std::dynamic_pointer_cast<Ogre2Mesh>(
+      this->Scene()->CreateMesh(meshDescriptor));
+  if (this->dataPtr->material)
+    this->dataPtr->grid->SetMaterial(this->dataPtr->material, false);
+
+  if (visual)
+  {
+    visual->AddGeometry(
+        std::dynamic_pointer_cast<Geometry>(shared_from_this()));
+  }
+}
+
+//////////////////////////////////////////////////
+std::vector<math::Vector3d> Ogre2Grid::Points() const
+{
+  std::vector<math::Vector3d> points;
   double baseExtent = (this->cellLength *
      static_cast<double>(this->cellCount - this->cellCount % 2))/2;
   for (unsigned int h = 0; h <= this->verticalCellCount; ++h)
@@ -107,10 +186,10 @@ void Ogre2Grid::Create()
       math::Vector3d p3{-baseExtent, inc, hReal};
       math::Vector3d p4{extent, inc, hReal};
 
-      this->dataPtr->grid->AddPoint(p1);
-      this->dataPtr->grid->AddPoint(p2);
-      this->dataPtr->grid->AddPoint(p3);
-      this->dataPtr->grid->AddPoint(p4);
+      points.push_back(p1);
+      points.push_back(p2);
+      points.push_back(p3);
+      points.push_back(p4);
     }
   }
   if (this->verticalCellCount > 0)
@@ -141,12 +220,12 @@ void Ogre2Grid::Create()
           yReal += this->cellLength;
         }
 
-        this->dataPtr->grid->AddPoint(xReal, yReal, zBottom);
-        this->dataPtr->grid->AddPoint(xReal, yReal, zTop);
+        points.push_back({xReal, yReal, zBottom});
+        points.push_back({xReal, yReal, zTop});
       }
     }
   }
-  this->dataPtr->grid->Update();
+  return points;
 }
 
 //////////////////////////////////////////////////
@@ -165,8 +244,9 @@ void Ogre2Grid::SetMaterial(MaterialPtr _material, bool _unique)
     return;
   }
 
-  // Set material for the underlying dynamic renderable
-  this->dataPtr->grid->SetMaterial(_material, false);
+  // Set material for the underlying mesh
+  if (this->dataPtr->grid)
+    this->dataPtr->grid->SetMaterial(_material, false);
   this->SetMaterialImpl(derived);
 }
 
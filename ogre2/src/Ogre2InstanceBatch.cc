@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+#include <Hlms/Pbs/OgreHlmsPbsDatablock.h>
+#include <OgreItem.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <map>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
+#include "ignition/rendering/ogre2/Ogre2InstanceBatch.hh"
+#include "ignition/rendering/ogre2/Ogre2Material.hh"
+#include "ignition/rendering/ogre2/Ogre2MeshFactory.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
+
+/// \brief Private data for the Ogre2InstanceBatch class
+class ignition::rendering::Ogre2InstanceBatchPrivate
+{
+  /// \brief Parent node of all instance nodes
+  public: Ogre::SceneNode *rootNode = nullptr;
+
+  /// \brief Scene node of each instance
+  public: std::vector<Ogre::SceneNode *> nodes;
+
+  /// \brief Ogre item of each instance
+  public: std::vector<Ogre::Item *> items;
+
+  /// \brief Datablocks of the mesh sub-items, used when the batch has no
+  /// material
+  public: std::vector<Ogre::HlmsDatablock *> meshDatablocks;
+
+  /// \brief Materials of coloured instances by packed RGBA colour. All
+  /// instances with the same colour share the material so they can still
+  /// be drawn in one batch.
+  public: std::map<uint32_t, Ogre2MaterialPtr> colorMaterials;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2InstanceBatch::Ogre2InstanceBatch()
+  : dataPtr(std::make_unique<Ogre2InstanceBatchPrivate>())
+{
+}
+
+//////////////////////////////////////////////////
+Ogre2InstanceBatch::~Ogre2InstanceBatch()
+{
+  this->Destroy();
+}
+
+//////////////////////////////////////////////////
+void Ogre2InstanceBatch::Destroy()
+{
+  if (!this->dataPtr->rootNode || !this->scene)
+    return;
+
+  // items must be destroyed before the materials of coloured instances
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  if (sceneManager)
+  {
+    for (auto item : this->dataPtr->items)
+      sceneManager->destroyItem(item);
+    for (auto node : this->dataPtr->nodes)
+      sceneManager->destroySceneNode(node);
+    sceneManager->destroySceneNode(this->dataPtr->rootNode);
+  }
+  this->dataPtr->items.clear();
+  this->dataPtr->nodes.clear();
+  this->dataPtr->rootNode = nullptr;
+
+  for (auto &colorMat : this->dataPtr->colorMaterials)
+    this->scene->DestroyMaterial(colorMat.second);
+  this->dataPtr->colorMaterials.clear();
+}
+
+//////////////////////////////////////////////////
+void Ogre2InstanceBatch::Init()
+{
+  BaseInstanceBatch::Init();
+
+  Ogre::SceneManager *sceneManager = this->scene->OgreSceneManager();
+  this->dataPtr->rootNode =
+      sceneManager->getRootSceneNode()->createChildSceneNode();
+
+  Ogre2MaterialPtr mat =
+      std::dynamic_pointer_cast<Ogre2Material>(this->material);
+
+  unsigned int count = this->InstanceCount();
+  this->dataPtr->items.reserve(count);
+  this->dataPtr->nodes.reserve(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    // all items reference the same v2 mesh, the mesh is only loaded once
+    Ogre::Item *item = this->meshFactory->OgreItem(this->meshDescriptor);
+    if (!item)
+    {
+      ignerr << "Failed to create instances of mesh ["
+             << this->meshDescriptor.meshName << "]" << std::endl;
+      break;
+    }
+
+    if (this->dataPtr->meshDatablocks.empty())
+    {
+      for (unsigned int j = 0; j < item->getNumSubItems(); ++j)
+      {
+        this->dataPtr->meshDatablocks.push_back(
+            item->getSubItem(j)->getDatablock());
+      }
+    }
+
+    if (mat)
+      item->setDatablock(mat->Datablock());
+
+    Ogre::SceneNode *node = this->dataPtr->rootNode->createChildSceneNode();
+    node->attachObject(item);
+
+    this->dataPtr->items.push_back(item);
+    this->dataPtr->nodes.push_back(node);
+  }
+}
+
+//////////////////////////////////////////////////
+void Ogre2InstanceBatch::UpdateInstances()
+{
+  unsigned int count =
+      static_cast<unsigned int>(this->dataPtr->items.size());
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    uint8_t flags = this->dirtyFlags[i];
+    if (!flags)
+      continue;
+
+    Ogre::SceneNode *node = this->dataPtr->nodes[i];
+    Ogre::Item *item = this->dataPtr->items[i];
+
+    if (flags & DIRTY_TRANSFORM)
+    {
+      node->setPosition(Ogre2Conversions::Convert(this->poses[i].Pos()));
+      node->setOrientation(Ogre2Conversions::Convert(this->poses[i].Rot()));
+      node->setScale(Ogre2Conversions::Convert(this->scales[i]));
+    }
+
+    if (flags & DIRTY_COLOR)
+    {
+      const math::Color &color = this->colors[i];
+      math::Color defaultColor =
+          this->material ? this->material->Diffuse() : math::Color::White;
+      if (color == defaultColor)
+      {
+        Ogre2MaterialPtr mat =
+            std::dynamic_pointer_cast<Ogre2Material>(this->material);
+        if (mat)
+        {
+          item->setDatablock(mat->Datablock());
+        }
+        else
+        {
+          for (unsigned int j = 0; j < item->getNumSubItems() &&
+              j < this->dataPtr->meshDatablocks.size(); ++j)
+          {
+            item->getSubItem(j)->setDatablock(
+                this->dataPtr->meshDatablocks[j]);
+          }
+        }
+      }
+      else
+      {
+        Ogre2MaterialPtr &colorMat =
+            this->dataPtr->colorMaterials[color.AsRGBA()];
+        if (!colorMat)
+        {
+          MaterialPtr newMat = this->material ? this->material->Clone() :
+              this->scene->CreateMaterial();
+          newMat->SetDiffuse(color);
+          newMat->SetAmbient(color);
+          colorMat = std::dynamic_pointer_cast<Ogre2Material>(newMat);
+        }
+        item->setDatablock(colorMat->Datablock());
+      }
+    }
+
+    if (flags & DIRTY_CUSTOM_PARAMETER)
+    {
+      const math::Vector4d &param = this->customParameters[i];
+      Ogre::Vector4 value(param.X(), param.Y(), param.Z(), param.W());
+      for (unsigned int j = 0; j < item->getNumSubItems(); ++j)
+        item->getSubItem(j)->setCustomParameter(kCustomParameterIndex, value);
+    }
+
+    if (flags & DIRTY_VISIBILITY)
+      node->setVisible(this->visibility[i]);
+  }
+}
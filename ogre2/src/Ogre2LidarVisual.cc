@@ -464,4 +464,5 @@ void Ogre2LidarVisual::SetVisible(bool _visible)
 {
   this->dataPtr->visible = _visible;
   this->ogreNode->setVisible(this->dataPtr->visible);
+  this->MarkSceneChanged();
 }
@@ -25,16 +25,22 @@
 #include <Hlms/Unlit/OgreHlmsUnlit.h>
 #include <Hlms/Unlit/OgreHlmsUnlitDatablock.h>
 #include <OgreHlmsManager.h>
+#include <OgreHlmsTextureManager.h>
+#include <OgreImage.h>
 #include <OgreMaterialManager.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
 
+#include <map>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 
 #include "ignition/rendering/ShaderParams.hh"
 #include "ignition/rendering/ShaderType.hh"
+#include "ignition/rendering/TextureStreamer.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2Material.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
@@ -44,11 +50,40 @@
 /// \brief Private data for the Ogre2Material class
 class ignition::rendering::Ogre2MaterialPrivate
 {
+  /// \brief Texture map that is decoded by the texture streamer
+  public: struct StreamedTexture
+  {
+    /// \brief Full path to the texture file
+    std::string filename;
+
+    /// \brief Streaming state of the texture set on the datablock
+    TextureStreamer::State applied = TextureStreamer::State::UNLOADED;
+  };
+
+  /// \brief Stop streaming a texture map and release it in the streamer
+  /// \param[in] _type Texture map type
+  public: void Release(Ogre::PbsTextureTypes _type);
+
+  /// \brief Streamed texture maps by type
+  public: std::map<Ogre::PbsTextureTypes, StreamedTexture> streamedTextures;
 };
 
 using namespace ignition;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+void Ogre2MaterialPrivate::Release(Ogre::PbsTextureTypes _type)
+{
+  auto it = this->streamedTextures.find(_type);
+  if (it == this->streamedTextures.end())
+    return;
+
+  TextureStreamer *streamer = Ogre2RenderEngine::Instance()->TextureStreaming();
+  if (streamer)
+    streamer->Release(it->second.filename);
+  this->streamedTextures.erase(it);
+}
+
 //////////////////////////////////////////////////
 Ogre2Material::Ogre2Material()
   : dataPtr(std::make_unique<Ogre2MaterialPrivate>())
@@ -64,6 +99,10 @@ Ogre2Material::~Ogre2Material()
 //////////////////////////////////////////////////
 void Ogre2Material::Destroy()
 {
+  while (!this->dataPtr->streamedTextures.empty())
+    this->dataPtr->Release(this->dataPtr->streamedTextures.begin()->first);
+  Ogre2RenderEngine::Instance()->UnregisterStreamingMaterial(this);
+
   if (!this->Scene()->IsInitialized())
     return;
 
@@ -220,6 +259,7 @@ std::string Ogre2Material::Texture() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetTexture(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetTexture");
   if (_name.empty())
   {
     this->ClearTexture();
@@ -234,6 +274,7 @@ void Ogre2Material::SetTexture(const std::string &_name)
 void Ogre2Material::ClearTexture()
 {
   this->textureName = "";
+  this->dataPtr->Release(Ogre::PBSM_DIFFUSE);
   this->ogreDatablock->setTexture(Ogre::PBSM_DIFFUSE, 0, Ogre::TexturePtr());
 }
 
@@ -252,6 +293,7 @@ std::string Ogre2Material::NormalMap() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetNormalMap(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetNormalMap");
   if (_name.empty())
   {
     this->ClearNormalMap();
@@ -266,6 +308,7 @@ void Ogre2Material::SetNormalMap(const std::string &_name)
 void Ogre2Material::ClearNormalMap()
 {
   this->normalMapName = "";
+  this->dataPtr->Release(Ogre::PBSM_NORMAL);
   this->ogreDatablock->setTexture(Ogre::PBSM_NORMAL, 0, Ogre::TexturePtr());
 }
 
@@ -284,6 +327,7 @@ std::string Ogre2Material::RoughnessMap() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetRoughnessMap(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetRoughnessMap");
   if (_name.empty())
   {
     this->ClearRoughnessMap();
@@ -298,6 +342,7 @@ void Ogre2Material::SetRoughnessMap(const std::string &_name)
 void Ogre2Material::ClearRoughnessMap()
 {
   this->roughnessMapName = "";
+  this->dataPtr->Release(Ogre::PBSM_ROUGHNESS);
   this->ogreDatablock->setTexture(Ogre::PBSM_ROUGHNESS, 0, Ogre::TexturePtr());
 }
 
@@ -316,6 +361,7 @@ std::string Ogre2Material::MetalnessMap() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetMetalnessMap(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetMetalnessMap");
   if (_name.empty())
   {
     this->ClearMetalnessMap();
@@ -330,6 +376,7 @@ void Ogre2Material::SetMetalnessMap(const std::string &_name)
 void Ogre2Material::ClearMetalnessMap()
 {
   this->metalnessMapName = "";
+  this->dataPtr->Release(Ogre::PBSM_METALLIC);
   this->ogreDatablock->setTexture(Ogre::PBSM_METALLIC, 0, Ogre::TexturePtr());
 }
 
@@ -348,6 +395,7 @@ std::string Ogre2Material::EnvironmentMap() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetEnvironmentMap(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetEnvironmentMap");
   if (_name.empty())
   {
     this->ClearEnvironmentMap();
@@ -362,6 +410,7 @@ void Ogre2Material::SetEnvironmentMap(const std::string &_name)
 void Ogre2Material::ClearEnvironmentMap()
 {
   this->environmentMapName = "";
+  this->dataPtr->Release(Ogre::PBSM_REFLECTION);
   this->ogreDatablock->setTexture(Ogre::PBSM_REFLECTION, 0, Ogre::TexturePtr());
 }
 
@@ -380,6 +429,7 @@ std::string Ogre2Material::EmissiveMap() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetEmissiveMap(const std::string &_name)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetEmissiveMap");
   if (_name.empty())
   {
     this->ClearEmissiveMap();
@@ -394,6 +444,7 @@ void Ogre2Material::SetEmissiveMap(const std::string &_name)
 void Ogre2Material::ClearEmissiveMap()
 {
   this->emissiveMapName = "";
+  this->dataPtr->Release(Ogre::PBSM_EMISSIVE);
   this->ogreDatablock->setTexture(Ogre::PBSM_EMISSIVE, 0, Ogre::TexturePtr());
 }
 
@@ -418,6 +469,7 @@ unsigned int Ogre2Material::LightMapTexCoordSet() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetLightMap(const std::string &_name, unsigned int _uvSet)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Material::SetLightMap");
   if (_name.empty())
   {
     this->ClearLightMap();
@@ -444,6 +496,7 @@ void Ogre2Material::ClearLightMap()
 {
   this->lightMapName = "";
   this->lightMapUvSet = 0u;
+  this->dataPtr->Release(Ogre::PBSM_DETAIL0);
   this->ogreDatablock->setTexture(Ogre::PBSM_DETAIL0, 0, Ogre::TexturePtr());
 }
 
@@ -476,6 +529,97 @@ void Ogre2Material::PreRender()
 {
 }
 
+//////////////////////////////////////////////////
+bool Ogre2Material::UpdateStreamedTextures()
+{
+  if (this->dataPtr->streamedTextures.empty())
+    return false;
+
+  TextureStreamer *streamer = Ogre2RenderEngine::Instance()->TextureStreaming();
+  if (!streamer)
+    return false;
+
+  Ogre::HlmsTextureManager *hlmsTextureManager =
+      this->ogreHlmsPbs->getHlmsManager()->getTextureManager();
+
+  for (auto it = this->dataPtr->streamedTextures.begin();
+      it != this->dataPtr->streamedTextures.end();)
+  {
+    Ogre::PbsTextureTypes type = it->first;
+    Ogre2MaterialPrivate::StreamedTexture &streamed = it->second;
+    TextureStreamer::State state = streamer->TextureState(streamed.filename);
+    if (state == streamed.applied || state == TextureStreamer::State::UNLOADED)
+    {
+      ++it;
+      continue;
+    }
+
+    // the streamer can not decode this texture, let ogre load it instead
+    if (state == TextureStreamer::State::FAILED)
+    {
+      std::string filename = streamed.filename;
+      streamer->Release(filename);
+      it = this->dataPtr->streamedTextures.erase(it);
+      this->LoadTextureMapImpl(filename, type);
+      continue;
+    }
+
+    TextureStreamer::Data data = streamer->TextureData(streamed.filename);
+    Ogre::PixelFormat format = Ogre::PF_UNKNOWN;
+    switch (data.format)
+    {
+      case common::Image::L_INT8:
+        format = Ogre::PF_L8;
+        break;
+      case common::Image::RGB_INT8:
+        format = Ogre::PF_BYTE_RGB;
+        break;
+      case common::Image::RGBA_INT8:
+        format = Ogre::PF_BYTE_RGBA;
+        break;
+      default:
+        break;
+    }
+    if (!data.bytes || format == Ogre::PF_UNKNOWN)
+    {
+      ++it;
+      continue;
+    }
+
+    std::string alias = streamed.filename;
+    if (state == TextureStreamer::State::PLACEHOLDER)
+      alias += "::placeholder";
+
+    // the texture manager copies the pixels to the gpu, the image does not
+    // take ownership of or modify the data
+    Ogre::Image image;
+    image.loadDynamicImage(const_cast<unsigned char *>(data.bytes->data()),
+        data.width, data.height, 1u, format);
+
+    Ogre::HlmsTextureManager::TextureLocation texLocation =
+        hlmsTextureManager->createOrRetrieveTexture(alias, alias,
+        this->ogreDatablock->suggestMapTypeBasedOnTextureType(type), &image);
+
+    Ogre::HlmsSamplerblock samplerBlockRef;
+    samplerBlockRef.mU = Ogre::TAM_WRAP;
+    samplerBlockRef.mV = Ogre::TAM_WRAP;
+    samplerBlockRef.mW = Ogre::TAM_WRAP;
+    this->ogreDatablock->setTexture(type, texLocation.xIdx,
+        texLocation.texture, &samplerBlockRef);
+
+    if (type == Ogre::PBSM_DIFFUSE && this->TextureAlphaEnabled() &&
+        data.format != common::Image::RGBA_INT8)
+    {
+      this->SetAlphaFromTexture(false, this->AlphaThreshold(),
+          this->TwoSidedEnabled());
+    }
+
+    streamed.applied = state;
+    ++it;
+  }
+  return !this->dataPtr->streamedTextures.empty();
+}
+
 //////////////////////////////////////////////////
 Ogre::MaterialPtr Ogre2Material::Material()
 {
@@ -499,6 +643,29 @@ Ogre::HlmsPbsDatablock *Ogre2Material::Datablock() const
 //////////////////////////////////////////////////
 void Ogre2Material::SetTextureMapImpl(const std::string &_texture,
   Ogre::PbsTextureTypes _type)
+{
+  this->dataPtr->Release(_type);
+
+  // Decode the texture in the background if streaming is enabled. The map is
+  // set on the datablock by UpdateStreamedTextures once the placeholder is
+  // available.
+  // Environment maps are cubemaps and are always loaded by ogre.
+  TextureStreamer *streamer = Ogre2RenderEngine::Instance()->TextureStreaming();
+  if (streamer && _type != Ogre::PBSM_REFLECTION && common::isFile(_texture))
+  {
+    this->ogreDatablock->setTexture(_type, 0, Ogre::TexturePtr());
+    streamer->Request(_texture);
+    this->dataPtr->streamedTextures[_type].filename = _texture;
+    Ogre2RenderEngine::Instance()->RegisterStreamingMaterial(this);
+    return;
+  }
+
+  this->LoadTextureMapImpl(_texture, _type);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Material::LoadTextureMapImpl(const std::string &_texture,
+  Ogre::PbsTextureTypes _type)
 {
   // FIXME(anyone) need to keep baseName = _texture for all meshes. Refer to
   // https://github.com/ignitionrobotics/ign-rendering/issues/139
@@ -19,6 +19,7 @@
 #include "ignition/rendering/ogre2/Ogre2MaterialSwitcher.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 
 #ifdef _MSC_VER
   #pragma warning(push, 0)
@@ -37,22 +38,30 @@ using namespace rendering;
 
 
 /////////////////////////////////////////////////
-Ogre2MaterialSwitcher::Ogre2MaterialSwitcher(Ogre2ScenePtr _scene)
+Ogre2MaterialSwitcher::Ogre2MaterialSwitcher(Ogre2ScenePtr _scene,
+    const std::string &_materialName)
 {
   this->currentColor = ignition::math::Color(0.0, 0.0, 0.1);
   this->scene = _scene;
 
   // plain opaque material
   Ogre::ResourcePtr res =
-    Ogre::MaterialManager::getSingleton().load("ign-rendering/plain_color",
+    Ogre::MaterialManager::getSingleton().load(_materialName,
         Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
 
   this->plainMaterial = res.staticCast<Ogre::Material>();
   this->plainMaterial->load();
 
-  // plain overlay material
+  // plain overlay material, shared by the switchers of all cameras
+  const std::string overlayName =
+      _materialName.substr(_materialName.find('/') + 1) + "_overlay";
   this->plainOverlayMaterial =
-      this->plainMaterial->clone("plain_color_overlay");
+      Ogre::MaterialManager::getSingleton().getByName(overlayName);
+  if (this->plainOverlayMaterial.isNull())
+  {
+    this->plainOverlayMaterial =
+        this->plainMaterial->clone(overlayName);
+  }
   if (!this->plainOverlayMaterial->getTechnique(0) ||
       !this->plainOverlayMaterial->getTechnique(0)->getPass(0))
   {
@@ -77,6 +86,7 @@ Ogre2MaterialSwitcher::~Ogre2MaterialSwitcher()
 void Ogre2MaterialSwitcher::preRenderTargetUpdate(
     const Ogre::RenderTargetEvent &/*_evt*/)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2MaterialSwitcher::preRenderTargetUpdate");
   // swap item to use v1 shader material
   // Note: keep an eye out for performance impact on switching materials
   // on the fly. We are not doing this often so should be ok.
@@ -92,6 +102,13 @@ void Ogre2MaterialSwitcher::preRenderTargetUpdate(
 
     this->colorDict[this->currentColor.AsRGBA()] = item->getName();
 
+    const Ogre::Any &userAny = item->getUserObjectBindings().getUserAny();
+    if (!userAny.isEmpty() && userAny.getType() == typeid(unsigned int))
+    {
+      this->colorIds[this->currentColor.AsRGBA()] =
+          Ogre::any_cast<unsigned int>(userAny);
+    }
+
     for (unsigned int i = 0; i < item->getNumSubItems(); ++i)
     {
       Ogre::SubItem *subItem = item->getSubItem(i);
@@ -118,6 +135,7 @@ void Ogre2MaterialSwitcher::preRenderTargetUpdate(
 void Ogre2MaterialSwitcher::postRenderTargetUpdate(
     const Ogre::RenderTargetEvent &/*_evt*/)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2MaterialSwitcher::postRenderTargetUpdate");
   // restore item to use hlms material
   auto itor = this->scene->OgreSceneManager()->getMovableObjectIterator(
       Ogre::ItemFactory::FACTORY_TYPE_NAME);
@@ -148,6 +166,16 @@ std::string Ogre2MaterialSwitcher::EntityName(
     return std::string();
 }
 
+/////////////////////////////////////////////////
+unsigned int Ogre2MaterialSwitcher::VisualId(
+    const ignition::math::Color &_color) const
+{
+  auto iter = this->colorIds.find(_color.AsRGBA());
+  if (iter != this->colorIds.end())
+    return iter->second;
+  return 0u;
+}
+
 /////////////////////////////////////////////////
 void Ogre2MaterialSwitcher::NextColor()
 {
@@ -162,4 +190,5 @@ void Ogre2MaterialSwitcher::Reset()
   this->currentColor = ignition::math::Color(
       0.0, 0.0, 0.0);
   this->colorDict.clear();
+  this->colorIds.clear();
 }
@@ -28,6 +28,8 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
+
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
@@ -38,11 +40,41 @@
 /// brief Private implementation of the Ogre2Mesh class
 class ignition::rendering::Ogre2MeshPrivate
 {
+  /// \brief Build the bone name to index lookup tables if needed
+  /// \param[in] _skel Skeleton instance of the mesh
+  public: void BuildBoneIndex(Ogre::SkeletonInstance *_skel);
+
+  /// \brief Bone names ordered by bone index
+  public: std::vector<std::string> boneNames;
+
+  /// \brief Bone name to bone index
+  public: std::unordered_map<std::string, unsigned int> boneIndices;
+
+  /// \brief Number of leading bones (by index) set to manual mode by
+  /// SetSkeletonBoneTransforms
+  public: unsigned int manualBoneCount = 0u;
+
+  /// \brief Skeleton animations that are currently enabled
+  public: std::vector<Ogre::SkeletonAnimation *> enabledAnimations;
 };
 
 using namespace ignition;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+void Ogre2MeshPrivate::BuildBoneIndex(Ogre::SkeletonInstance *_skel)
+{
+  if (!this->boneNames.empty())
+    return;
+
+  this->boneNames.reserve(_skel->getNumBones());
+  for (unsigned int i = 0; i < _skel->getNumBones(); ++i)
+  {
+    this->boneNames.push_back(_skel->getBone(i)->getName());
+    this->boneIndices[this->boneNames.back()] = i;
+  }
+}
+
 //////////////////////////////////////////////////
 Ogre2Mesh::Ogre2Mesh()
   : dataPtr(new Ogre2MeshPrivate)
@@ -166,17 +198,18 @@ void Ogre2Mesh::SetSkeletonWeights(
 
   auto skel = this->ogreItem->getSkeletonInstance();
 
+  this->dataPtr->BuildBoneIndex(skel);
+
   // set bone weights for all animations
-  auto &animations = skel->getAnimations();
-  for (auto &anim : animations)
+  Ogre::SkeletonAnimationVec &animations = skel->getAnimationsNonConst();
+  for (Ogre::SkeletonAnimation &anim : animations)
   {
     for (auto const &[boneName, weight] : _weights)
     {
-      if (skel->getBone(boneName))
+      if (this->dataPtr->boneIndices.find(boneName) !=
+          this->dataPtr->boneIndices.end())
       {
-        Ogre::SkeletonAnimation *animPtr = skel->getAnimation(anim.getName());
-        if (animPtr)
-          animPtr->setBoneWeight(boneName, weight);
+        anim.setBoneWeight(boneName, weight);
       }
     }
   }
@@ -206,12 +239,22 @@ void Ogre2Mesh::SetSkeletonAnimationEnabled(const std::string &_name,
       auto bone = skel->getBone(i);
       skel->setManualBone(bone, false);
     }
+    this->dataPtr->manualBoneCount = 0u;
   }
 
   Ogre::SkeletonAnimation *anim = skel->getAnimation(_name);
   anim->setEnabled(_enabled);
   anim->setLoop(_loop);
   anim->mWeight = _weight;
+
+  // keep track of enabled animations so they can be updated without name
+  // lookups
+  auto &enabled = this->dataPtr->enabledAnimations;
+  auto it = std::find(enabled.begin(), enabled.end(), anim);
+  if (_enabled && it == enabled.end())
+    enabled.push_back(anim);
+  else if (!_enabled && it != enabled.end())
+    enabled.erase(it);
 }
 
 //////////////////////////////////////////////////
@@ -223,18 +266,69 @@ void Ogre2Mesh::UpdateSkeletonAnimation(
     return;
   }
 
+  auto seconds =
+      std::chrono::duration_cast<std::chrono::milliseconds>(_time).count() /
+      1000.0;
+  for (auto anim : this->dataPtr->enabledAnimations)
+    anim->setTime(seconds);
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2Mesh::SkeletonBoneCount() const
+{
+  if (!this->ogreItem->hasSkeleton())
+    return 0u;
+
+  return static_cast<unsigned int>(
+      this->ogreItem->getSkeletonInstance()->getNumBones());
+}
+
+//////////////////////////////////////////////////
+std::vector<std::string> Ogre2Mesh::SkeletonBoneNames() const
+{
+  if (!this->ogreItem->hasSkeleton())
+    return std::vector<std::string>();
+
+  this->dataPtr->BuildBoneIndex(this->ogreItem->getSkeletonInstance());
+  return this->dataPtr->boneNames;
+}
+
+//////////////////////////////////////////////////
+int Ogre2Mesh::SkeletonBoneIndex(const std::string &_name) const
+{
+  if (!this->ogreItem->hasSkeleton())
+    return -1;
+
+  this->dataPtr->BuildBoneIndex(this->ogreItem->getSkeletonInstance());
+  auto it = this->dataPtr->boneIndices.find(_name);
+  if (it == this->dataPtr->boneIndices.end())
+    return -1;
+  return static_cast<int>(it->second);
+}
+
+//////////////////////////////////////////////////
+void Ogre2Mesh::SetSkeletonBoneTransforms(
+    const std::vector<math::Matrix4d> &_tfs)
+{
+  if (!this->ogreItem->hasSkeleton())
+    return;
+
   Ogre::SkeletonInstance *skel = this->ogreItem->getSkeletonInstance();
-  auto animations = skel->getAnimations();
-  for (auto &anim : animations)
+  unsigned int count = std::min(static_cast<unsigned int>(_tfs.size()),
+      static_cast<unsigned int>(skel->getNumBones()));
+
+  // switching bones to manual mode is only needed once
+  for (unsigned int i = this->dataPtr->manualBoneCount; i < count; ++i)
+    skel->setManualBone(skel->getBone(i), true);
+  this->dataPtr->manualBoneCount =
+      std::max(this->dataPtr->manualBoneCount, count);
+
+  for (unsigned int i = 0; i < count; ++i)
   {
-    Ogre::SkeletonAnimation *sa = skel->getAnimation(anim.getName());
-    if (sa->getEnabled())
-    {
-      auto seconds =
-          std::chrono::duration_cast<std::chrono::milliseconds>(_time).count() /
-          1000.0;
-      sa->setTime(seconds);
-    }
+    Ogre::Bone *bone = skel->getBone(i);
+    const math::Matrix4d &tf = _tfs[i];
+    bone->setPosition(Ogre2Conversions::Convert(tf.Translation()));
+    bone->setOrientation(Ogre2Conversions::Convert(tf.Rotation()));
   }
 }
 
@@ -15,7 +15,9 @@
  *
  */
 
-
+#include <algorithm>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include <ignition/common/Console.hh>
@@ -27,6 +29,7 @@
 
 #include <ignition/math/Matrix4.hh>
 
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2Mesh.hh"
 #include "ignition/rendering/ogre2/Ogre2MeshFactory.hh"
@@ -68,6 +71,49 @@ class ignition::rendering::Ogre2SubMeshStoreFactoryPrivate
 using namespace ignition;
 using namespace rendering;
 
+/// \brief Number of mesh factories using each ogre mesh. Ogre meshes are
+/// engine wide and shared by all scenes, a mesh is only removed when the
+/// last factory using it releases it.
+static std::map<std::string, unsigned int> ogreMeshUseCount;
+
+/// \brief Mutex protecting the ogre mesh use count
+static std::mutex ogreMeshUseCountMutex;
+
+//////////////////////////////////////////////////
+/// \brief Add a user to an ogre mesh
+/// \param[in] _name Name of the ogre mesh
+static void AcquireOgreMesh(const std::string &_name)
+{
+  std::lock_guard<std::mutex> lock(ogreMeshUseCountMutex);
+  ++ogreMeshUseCount[_name];
+}
+
+//////////////////////////////////////////////////
+/// \brief Check if an ogre mesh is used by a mesh factory
+/// \param[in] _name Name of the ogre mesh
+/// \return True if the mesh is used
+static bool OgreMeshInUse(const std::string &_name)
+{
+  std::lock_guard<std::mutex> lock(ogreMeshUseCountMutex);
+  return ogreMeshUseCount.find(_name) != ogreMeshUseCount.end();
+}
+
+//////////////////////////////////////////////////
+/// \brief Remove a user from an ogre mesh
+/// \param[in] _name Name of the ogre mesh
+/// \return True if the mesh is no longer used and can be removed
+static bool ReleaseOgreMesh(const std::string &_name)
+{
+  std::lock_guard<std::mutex> lock(ogreMeshUseCountMutex);
+  auto it = ogreMeshUseCount.find(_name);
+  if (it == ogreMeshUseCount.end())
+    return true;
+  if (--it->second > 0u)
+    return false;
+  ogreMeshUseCount.erase(it);
+  return true;
+}
+
 //////////////////////////////////////////////////
 Ogre2MeshFactory::Ogre2MeshFactory(Ogre2ScenePtr _scene) :
   scene(_scene), dataPtr(std::make_unique<Ogre2MeshFactoryPrivate>())
@@ -83,19 +129,49 @@ Ogre2MeshFactory::~Ogre2MeshFactory()
 void Ogre2MeshFactory::Clear()
 {
   for (auto &m : this->ogreMeshes)
-    Ogre::MeshManager::getSingleton().remove(m);
+  {
+    if (ReleaseOgreMesh(m))
+      Ogre::MeshManager::getSingleton().remove(m);
+  }
 
   this->ogreMeshes.clear();
 }
 
+//////////////////////////////////////////////////
+void Ogre2MeshFactory::ClearMesh(const MeshDescriptor &_desc)
+{
+  MeshDescriptor normDesc = _desc;
+  normDesc.Load();
+  std::string name = this->MeshName(normDesc);
+
+  auto it = std::find(this->ogreMeshes.begin(), this->ogreMeshes.end(), name);
+  if (it != this->ogreMeshes.end())
+  {
+    this->ogreMeshes.erase(it);
+
+    // other scenes may still use the mesh
+    if (!ReleaseOgreMesh(name))
+      return;
+  }
+  else if (OgreMeshInUse(name))
+  {
+    return;
+  }
+
+  Ogre::MeshManager::getSingleton().remove(name);
+  Ogre::v1::MeshManager::getSingleton().remove(name);
+}
+
 //////////////////////////////////////////////////
 Ogre2MeshPtr Ogre2MeshFactory::Create(const MeshDescriptor &_desc)
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2MeshFactory::Create");
   // create ogre entity
   Ogre2MeshPtr mesh(new Ogre2Mesh);
   MeshDescriptor normDesc = _desc;
   normDesc.Load();
   mesh->ogreItem = this->OgreItem(normDesc);
+  mesh->meshDescriptor = normDesc;
 
   // check if invalid mesh
   if (!mesh->ogreItem)
@@ -138,6 +214,14 @@ Ogre::Item *Ogre2MeshFactory::OgreItem(const MeshDescriptor &_desc)
     mesh = Ogre::MeshManager::getSingleton().createManual(
         name, Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME);
     mesh->importV1(v1Mesh.get(), false, true, true);
+  }
+
+  // meshes are shared with the other scenes, keep track of the scenes
+  // using them
+  if (std::find(this->ogreMeshes.begin(), this->ogreMeshes.end(), name) ==
+      this->ogreMeshes.end())
+  {
+    AcquireOgreMesh(name);
     this->ogreMeshes.push_back(name);
   }
 
@@ -170,6 +170,14 @@ RayQueryResult Ogre2RayQuery::ClosestPoint()
             result.point =
                 Ogre2Conversions::Convert(mouseRay.getPoint(distance));
             result.objectId = Ogre::any_cast<unsigned int>(userAny);
+
+            // face normal, towards the ray origin
+            Ogre::Vector3 normal = (worldVertexB - worldVertexA).crossProduct(
+                worldVertexC - worldVertexA);
+            normal.normalise();
+            if (normal.dotProduct(mouseRay.getDirection()) > 0)
+              normal = -normal;
+            result.normal = Ogre2Conversions::Convert(normal);
           }
         }
       }
@@ -28,6 +28,8 @@
   // pulled in by anybody (e.g., Boost).
   #include <Winsock2.h>
 #endif
+#include <set>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 #include <ignition/common/Util.hh>
@@ -35,7 +37,10 @@
 #include <ignition/plugin/Register.hh>
 
 #include "ignition/rendering/RenderEngineManager.hh"
+#include "ignition/rendering/TextureStreamer.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2Includes.hh"
+#include "ignition/rendering/ogre2/Ogre2Material.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
@@ -50,6 +55,26 @@ class ignition::rendering::Ogre2RenderEnginePrivate
 
   /// \brief A list of supported fsaa levels
   public: std::vector<unsigned int> fsaaLevels;
+
+  /// \brief True to render without a display server through EGL
+  public: bool headless = false;
+
+  /// \brief Background texture decoder, null if texture streaming is
+  /// disabled
+  public: std::unique_ptr<TextureStreamer> textureStreamer;
+
+  /// \brief True while RenderScenes collects the workspaces of the sensors
+  public: bool batching = false;
+
+  /// \brief Workspaces queued by RenderWorkspaces while batching, by stage
+  public: std::vector<std::vector<Ogre::CompositorWorkspace *>>
+      batchedWorkspaces;
+
+  /// \brief Workspaces created by the sensors, to account for them
+  public: std::set<Ogre::CompositorWorkspace *> workspaces;
+
+  /// \brief Materials with textures decoded by the texture streamer
+  public: std::set<Ogre2Material *> streamingMaterials;
 };
 
 using namespace ignition;
@@ -109,6 +134,9 @@ void Ogre2RenderEngine::Destroy()
     this->scenes->RemoveAll();
   }
 
+  this->dataPtr->streamingMaterials.clear();
+  this->dataPtr->textureStreamer.reset();
+
   delete this->ogreOverlaySystem;
   this->ogreOverlaySystem = nullptr;
 
@@ -243,6 +271,46 @@ Ogre::Root *Ogre2RenderEngine::OgreRoot() const
   return this->ogreRoot;
 }
 
+//////////////////////////////////////////////////
+rendering::EngineResourceStats Ogre2RenderEngine::ResourceStats() const
+{
+  rendering::EngineResourceStats stats;
+  if (!this->ogreRoot || !this->ogreRoot->getRenderSystem())
+    return stats;
+
+  Ogre::HlmsManager *hlmsManager = this->ogreRoot->getHlmsManager();
+  for (unsigned int i = 0u; i < Ogre::HLMS_MAX; ++i)
+  {
+    Ogre::Hlms *hlms = hlmsManager->getHlms(static_cast<Ogre::HlmsTypes>(i));
+    if (hlms)
+    {
+      stats.materialCount +=
+          static_cast<unsigned int>(hlms->getDatablockMap().size());
+    }
+  }
+
+  Ogre::TextureManager &textureManager = Ogre::TextureManager::getSingleton();
+  auto textures = textureManager.getResourceIterator();
+  while (textures.hasMoreElements())
+  {
+    textures.getNext();
+    ++stats.textureCount;
+  }
+  stats.textureBytes = textureManager.getMemoryUsage();
+
+  // vertex and index buffers are sub-allocated from pools, free pool space
+  // is reserved but not used
+  Ogre::VaoManager *vaoManager =
+      this->ogreRoot->getRenderSystem()->getVaoManager();
+  Ogre::VaoManager::MemoryStatsEntryVec pools;
+  size_t capacity = 0u;
+  size_t freeBytes = 0u;
+  vaoManager->getMemoryStats(pools, capacity, freeBytes, nullptr);
+  stats.bufferCapacityBytes = capacity;
+  stats.bufferBytes = capacity - freeBytes;
+  return stats;
+}
+
 //////////////////////////////////////////////////
 ScenePtr Ogre2RenderEngine::CreateSceneImpl(unsigned int _id,
     const std::string &_name)
@@ -267,6 +335,43 @@ bool Ogre2RenderEngine::LoadImpl(
   if (it != _params.end())
     std::istringstream(it->second) >> this->useCurrentGLContext;
 
+  it = _params.find("headless");
+  if (it != _params.end())
+    std::istringstream(it->second) >> this->dataPtr->headless;
+
+  // The EGL interface of the GL3+ render system was added in ogre-next 2.2
+#if (OGRE_VERSION_MAJOR == 2 && OGRE_VERSION_MINOR < 2) || \
+    defined(__APPLE__) || defined(_WIN32)
+  if (this->dataPtr->headless)
+  {
+    ignerr << "Headless rendering requires ogre-next 2.2 or later on Linux, "
+           << "this engine was built against ogre " << OGRE_VERSION_MAJOR
+           << "." << OGRE_VERSION_MINOR << std::endl;
+    return false;
+  }
+#endif
+
+  bool textureStreaming = false;
+  it = _params.find("textureStreaming");
+  if (it != _params.end())
+    std::istringstream(it->second) >> textureStreaming;
+
+  if (textureStreaming)
+  {
+    this->dataPtr->textureStreamer = std::make_unique<TextureStreamer>();
+    it = _params.find("textureMemoryBudget");
+    if (it != _params.end())
+    {
+      uint64_t budgetMb = 0u;
+      std::istringstream(it->second) >> budgetMb;
+      if (budgetMb > 0u)
+      {
+        this->dataPtr->textureStreamer->SetMemoryBudget(
+            budgetMb * 1024u * 1024u);
+      }
+    }
+  }
+
   try
   {
     this->LoadAttempt();
@@ -304,7 +409,7 @@ bool Ogre2RenderEngine::InitImpl()
 void Ogre2RenderEngine::LoadAttempt()
 {
   this->CreateLogger();
-  if (!this->useCurrentGLContext)
+  if (!this->useCurrentGLContext && !this->dataPtr->headless)
     this->CreateContext();
   this->CreateRoot();
   this->CreateOverlay();
@@ -527,6 +632,27 @@ void Ogre2RenderEngine::CreateRenderSystem()
   // We operate in windowed mode
   renderSys->setConfigOption("Full Screen", "No");
 
+  // Headless rendering needs ogre built with EGL support. Ogre then creates
+  // its own context, on a pbuffer or surfaceless, on the first EGL device,
+  // which is the software rasterizer of Mesa on machines without a gpu.
+  if (this->dataPtr->headless)
+  {
+    const std::string eglInterface = "Headless EGL / PBuffer";
+    Ogre::ConfigOptionMap options = renderSys->getConfigOptions();
+    auto interfaceOption = options.find("Interface");
+    if (interfaceOption == options.end() ||
+        std::find(interfaceOption->second.possibleValues.begin(),
+        interfaceOption->second.possibleValues.end(), eglInterface) ==
+        interfaceOption->second.possibleValues.end())
+    {
+      OGRE_EXCEPT(Ogre::Exception::ERR_NOT_IMPLEMENTED,
+          "Headless rendering requires ogre to be built with EGL support. "
+          "Disable the headless parameter to render through GLX.",
+          "Ogre2RenderEngine::CreateRenderSystem");
+    }
+    renderSys->setConfigOption("Interface", eglInterface);
+  }
+
   /// We used to allow the user to set the RTT mode to PBuffer, FBO, or Copy.
   ///   Copy is slow, and there doesn't seem to be a good reason to use it
   ///   PBuffer limits the size of the renderable area of the RTT to the
@@ -724,8 +850,9 @@ std::string Ogre2RenderEngine::CreateRenderWindow(const std::string &_handle,
   Ogre::NameValuePairList params;
   Ogre::RenderWindow *window = nullptr;
 
-  // if use current gl then don't include window handle params
-  if (!this->useCurrentGLContext)
+  // if use current gl then don't include window handle params, there are no
+  // windows to parent to when rendering headless either
+  if (!this->useCurrentGLContext && !this->dataPtr->headless)
   {
     // Mac and Windows *must* use externalWindow handle.
 #if defined(__APPLE__) || defined(_MSC_VER)
@@ -821,6 +948,143 @@ Ogre::v1::OverlaySystem *Ogre2RenderEngine::OverlaySystem() const
   return this->ogreOverlaySystem;
 }
 
+/////////////////////////////////////////////////
+TextureStreamer *Ogre2RenderEngine::TextureStreaming() const
+{
+  return this->dataPtr->textureStreamer.get();
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::UpdateTextureStreaming()
+{
+  if (!this->dataPtr->textureStreamer || !this->ogreRoot)
+    return;
+
+  std::vector<TextureStreamer::Transition> transitions =
+      this->dataPtr->textureStreamer->Update();
+
+  Ogre::HlmsTextureManager *hlmsTextureManager =
+      this->ogreRoot->getHlmsManager()->getTextureManager();
+  for (const auto &t : transitions)
+  {
+    // textures are only evicted once no material uses them, so the ogre
+    // textures uploaded for the dropped levels can be freed
+    if (t.previous == TextureStreamer::State::FINAL &&
+        t.current != TextureStreamer::State::FINAL)
+    {
+      hlmsTextureManager->destroyTexture(t.filename);
+    }
+    if (t.current == TextureStreamer::State::UNLOADED)
+      hlmsTextureManager->destroyTexture(t.filename + "::placeholder");
+  }
+
+  // materials are updated here rather than when their visuals are
+  // traversed, the visuals of static geometry are not
+  auto &materials = this->dataPtr->streamingMaterials;
+  for (auto it = materials.begin(); it != materials.end();)
+  {
+    if ((*it)->UpdateStreamedTextures())
+      ++it;
+    else
+      it = materials.erase(it);
+  }
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::RegisterStreamingMaterial(Ogre2Material *_material)
+{
+  if (_material)
+    this->dataPtr->streamingMaterials.insert(_material);
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::UnregisterStreamingMaterial(
+    Ogre2Material *_material)
+{
+  this->dataPtr->streamingMaterials.erase(_material);
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::RenderWorkspaces(
+    const std::vector<Ogre::CompositorWorkspace *> &_workspaces,
+    unsigned int _stage)
+{
+  IGN_RENDERING_TRACE_ZONE("Ogre2RenderEngine::RenderWorkspaces");
+  if (this->dataPtr->batching)
+  {
+    auto &stages = this->dataPtr->batchedWorkspaces;
+    if (_stage >= stages.size())
+      stages.resize(_stage + 1u);
+    stages[_stage].insert(stages[_stage].end(), _workspaces.begin(),
+        _workspaces.end());
+    return;
+  }
+
+  // workspaces are disabled by default, only the given ones are updated
+  // when ogre renders a frame
+  for (auto ws : _workspaces)
+    ws->setEnabled(true);
+  this->ogreRoot->renderOneFrame();
+  for (auto ws : _workspaces)
+    ws->setEnabled(false);
+}
+
+/////////////////////////////////////////////////
+bool Ogre2RenderEngine::RenderBatchActive() const
+{
+  return this->dataPtr->batching;
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::RegisterWorkspace(
+    Ogre::CompositorWorkspace *_workspace)
+{
+  if (_workspace)
+    this->dataPtr->workspaces.insert(_workspace);
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::UnregisterWorkspace(
+    Ogre::CompositorWorkspace *_workspace)
+{
+  this->dataPtr->workspaces.erase(_workspace);
+}
+
+/////////////////////////////////////////////////
+unsigned int Ogre2RenderEngine::WorkspaceCount(
+    Ogre::SceneManager *_sceneManager) const
+{
+  unsigned int count = 0u;
+  for (auto ws : this->dataPtr->workspaces)
+  {
+    if (ws->getSceneManager() == _sceneManager)
+      ++count;
+  }
+  return count;
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::BeginRenderBatch()
+{
+  this->dataPtr->batching = true;
+  this->dataPtr->batchedWorkspaces.clear();
+}
+
+/////////////////////////////////////////////////
+void Ogre2RenderEngine::EndRenderBatch()
+{
+  this->dataPtr->batching = false;
+
+  // one frame renders the workspaces of all sensors, later stages need the
+  // output of earlier ones and get a frame of their own
+  for (auto &stage : this->dataPtr->batchedWorkspaces)
+  {
+    if (!stage.empty())
+      this->RenderWorkspaces(stage);
+  }
+  this->dataPtr->batchedWorkspaces.clear();
+}
+
 // Register this plugin
 IGNITION_ADD_PLUGIN(ignition::rendering::Ogre2RenderEnginePlugin,
                     ignition::rendering::RenderEnginePlugin)
@@ -51,3 +51,19 @@ std::string Ogre2RenderPass::OgreCompositorNodeDefinitionName() const
 {
   return this->ogreCompositorNodeDefName;
 }
+
+//////////////////////////////////////////////////
+std::string Ogre2RenderPass::FusedShaderSource(
+    const std::string &/*_prefix*/) const
+{
+  // To be overriden by derived render pass classes that can be fused
+  return std::string();
+}
+
+//////////////////////////////////////////////////
+void Ogre2RenderPass::UpdateFusedShaderParams(
+    Ogre::GpuProgramParameters * /*_params*/,
+    const std::string &/*_prefix*/)
+{
+  // To be overriden by derived render pass classes that can be fused
+}
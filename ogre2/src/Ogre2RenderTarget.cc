@@ -15,6 +15,8 @@
  *
  */
 
+#include <algorithm>
+
 // leave this out of OgreIncludes as it conflicts with other files requiring
 // gl.h
 #ifdef _MSC_VER
@@ -28,6 +30,7 @@
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/Material.hh"
+#include "ignition/rendering/Trace.hh"
 
 #include "ignition/rendering/ogre2/Ogre2Includes.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
@@ -37,6 +40,8 @@
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
 
+#include "Ogre2FusedRenderPass.hh"
+
 namespace ignition
 {
 namespace rendering
@@ -58,9 +63,16 @@ class Ogre2RenderTargetCompositorListener :
   /// \brief Destructor
   public: virtual ~Ogre2RenderTargetCompositorListener() = default;
 
+  // Documentation inherited.
+  public: virtual void workspacePreUpdate(Ogre::CompositorWorkspace *)
+  {
+    this->passCount = 0u;
+  }
+
   // Documentation inherited.
   public: virtual void passPreExecute(Ogre::CompositorPass *_pass)
   {
+    ++this->passCount;
     if (_pass->getType() == Ogre::PASS_SCENE)
     {
       Ogre::CompositorPassScene *scenePass =
@@ -76,6 +88,10 @@ class Ogre2RenderTargetCompositorListener :
     }
   }
 
+  /// \brief Number of passes executed since the workspace started its
+  /// last update
+  public: unsigned int passCount = 0u;
+
   /// \brief Pointer to render target that added this listener
   private: Ogre2RenderTarget *ogreRenderTarget = nullptr;
 };
@@ -98,9 +114,6 @@ class ignition::rendering::Ogre2RenderTargetPrivate
   /// \brief Name of final rendering compositor node
   public: const std::string kFinalNodeName = "FinalComposition";
 
-  /// \brief Name of shadow compositor node
-  public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
-
   /// \brief Helper class that applies the material to the render target
   Ogre2RenderTargetMaterialPtr materialApplicator[2];
 
@@ -111,11 +124,74 @@ class ignition::rendering::Ogre2RenderTargetPrivate
   /// actual window
   ///
   Ogre::Texture *ogreTexture[2] = {nullptr, nullptr};
+
+  /// \brief Render passes as they are chained in the compositor workspace,
+  /// where consecutive passes that can be fused are replaced by a single
+  /// Ogre2FusedRenderPass
+  public: std::vector<RenderPassPtr> chainPasses;
+
+  /// \brief Fused passes dropped from the chain whose compositor nodes are
+  /// still in the workspace. Released once the workspace is removed.
+  public: std::vector<RenderPassPtr> retiredPasses;
 };
 
 using namespace ignition;
 using namespace rendering;
 
+//////////////////////////////////////////////////
+/// \brief Replace the runs of consecutive render passes that can be fused
+/// by a single fused pass
+/// \param[in] _passes Render passes of the render target
+/// \param[in] _previous Passes returned by the last call, whose fused passes
+/// are reused when they fuse the same passes
+/// \return Passes to chain in the compositor workspace
+static std::vector<RenderPassPtr> FuseRenderPasses(
+    const std::vector<RenderPassPtr> &_passes,
+    const std::vector<RenderPassPtr> &_previous)
+{
+  std::vector<RenderPassPtr> result;
+  std::vector<RenderPassPtr> run;
+  auto addRun = [&]()
+  {
+    if (run.size() < 2u)
+    {
+      result.insert(result.end(), run.begin(), run.end());
+      run.clear();
+      return;
+    }
+
+    RenderPassPtr fused;
+    for (const auto &pass : _previous)
+    {
+      auto previous = std::dynamic_pointer_cast<Ogre2FusedRenderPass>(pass);
+      if (previous && previous->Passes() == run)
+      {
+        fused = previous;
+        break;
+      }
+    }
+    if (!fused)
+      fused = std::make_shared<Ogre2FusedRenderPass>(run);
+    result.push_back(fused);
+    run.clear();
+  };
+
+  for (const auto &pass : _passes)
+  {
+    if (Ogre2FusedRenderPass::IsFusable(pass))
+    {
+      run.push_back(pass);
+    }
+    else
+    {
+      addRun();
+      result.push_back(pass);
+    }
+  }
+  addRun();
+  return result;
+}
+
 //////////////////////////////////////////////////
 // Ogre2RenderTarget
 //////////////////////////////////////////////////
@@ -200,7 +276,7 @@ void Ogre2RenderTarget::BuildCompositor()
       Ogre::CompositorPassSceneDef *passScene =
           static_cast<Ogre::CompositorPassSceneDef *>(
           rt0TargetDef->addPass(Ogre::PASS_SCENE));
-      passScene->mShadowNode = this->dataPtr->kShadowNodeName;
+      passScene->mShadowNode = this->scene->ShadowNodeName();
       passScene->mIncludeOverlays = true;
     }
 
@@ -279,6 +355,7 @@ void Ogre2RenderTarget::BuildCompositor()
 
   this->dataPtr->rtListener = new Ogre2RenderTargetCompositorListener(this);
   this->ogreCompositorWorkspace->setListener(this->dataPtr->rtListener);
+  engine->RegisterWorkspace(this->ogreCompositorWorkspace);
 }
 
 //////////////////////////////////////////////////
@@ -312,6 +389,7 @@ void Ogre2RenderTarget::DestroyCompositor()
   auto ogreRoot = engine->OgreRoot();
   Ogre::CompositorManager2 *ogreCompMgr = ogreRoot->getCompositorManager2();
   this->ogreCompositorWorkspace->setListener(nullptr);
+  engine->UnregisterWorkspace(this->ogreCompositorWorkspace);
   ogreCompMgr->removeWorkspace(this->ogreCompositorWorkspace);
   ogreCompMgr->removeWorkspaceDefinition(this->ogreCompositorWorkspaceDefName);
   ogreCompMgr->removeNodeDefinition(this->ogreCompositorWorkspaceDefName +
@@ -322,6 +400,7 @@ void Ogre2RenderTarget::DestroyCompositor()
   this->ogreCompositorWorkspace = nullptr;
   delete this->dataPtr->rtListener;
   this->dataPtr->rtListener = nullptr;
+  this->dataPtr->retiredPasses.clear();
 }
 
 //////////////////////////////////////////////////
@@ -334,6 +413,7 @@ void Ogre2RenderTarget::RebuildCompositor()
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::Copy(Image &_image) const
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2RenderTarget::Copy");
   // TODO(anyone) handle Bayer conversions
   // TODO(anyone) handle ogre version differences
 
@@ -346,6 +426,14 @@ void Ogre2RenderTarget::Copy(Image &_image) const
   void *data = _image.Data();
   Ogre::PixelFormat imageFormat = Ogre2Conversions::Convert(_image.Format());
   Ogre::PixelBox ogrePixelBox(this->width, this->height, 1, imageFormat, data);
+
+  // the rows of image views are further apart than their width
+  unsigned int bytesPerPixel = PixelUtil::BytesPerPixel(_image.Format());
+  if (bytesPerPixel > 0u && _image.Stride() != this->width * bytesPerPixel)
+  {
+    ogrePixelBox.rowPitch = _image.Stride() / bytesPerPixel;
+    ogrePixelBox.slicePitch = ogrePixelBox.rowPitch * this->height;
+  }
   this->RenderTarget()->copyContentsToMemory(ogrePixelBox);
 }
 
@@ -425,14 +513,13 @@ void Ogre2RenderTarget::PostRender()
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2RenderTarget::Render");
   // TODO(anyone)
   // There is current not an easy solution to manually updating
   // render textures:
   // https://forums.ogre3d.org/viewtopic.php?t=84687
-  this->ogreCompositorWorkspace->setEnabled(true);
   auto engine = Ogre2RenderEngine::Instance();
-  engine->OgreRoot()->renderOneFrame();
-  this->ogreCompositorWorkspace->setEnabled(false);
+  engine->RenderWorkspaces({this->ogreCompositorWorkspace});
 
   // The code below for manual updating render textures was suggested in ogre
   // forum but it does not seem to work
@@ -454,6 +541,14 @@ void Ogre2RenderTarget::Render()
   // engine->OgreRoot()->getRenderSystem()->_update();
 }
 
+//////////////////////////////////////////////////
+unsigned int Ogre2RenderTarget::PassCount() const
+{
+  if (!this->dataPtr->rtListener)
+    return 0u;
+  return this->dataPtr->rtListener->passCount;
+}
+
 //////////////////////////////////////////////////
 bool Ogre2RenderTarget::IsRenderWindow() const
 {
@@ -619,17 +714,52 @@ void Ogre2RenderTarget::UpdateBackgroundMaterial()
 //////////////////////////////////////////////////
 void Ogre2RenderTarget::UpdateRenderPassChain()
 {
+  // fused passes dropped from the chain remove their compositor node
+  // definition when destroyed, keep them until the workspace nodes have been
+  // recreated without them
+  std::vector<RenderPassPtr> previousChainPasses;
+  if (this->renderPassDirty)
+  {
+    previousChainPasses = this->dataPtr->chainPasses;
+    this->dataPtr->chainPasses =
+        FuseRenderPasses(this->renderPasses, previousChainPasses);
+  }
+
   UpdateRenderPassChain(this->ogreCompositorWorkspace,
       this->ogreCompositorWorkspaceDefName,
       this->ogreCompositorWorkspaceDefName + "/" +
       this->dataPtr->kBaseNodeName,
       this->ogreCompositorWorkspaceDefName + "/" +
       this->dataPtr->kFinalNodeName,
-      this->renderPasses,
+      this->dataPtr->chainPasses,
       this->renderPassDirty,
       &this->dataPtr->ogreTexture,
       this->IsRenderWindow());
 
+  // a workspace left without render passes keeps its nodes, fused passes
+  // it still uses are kept until the workspace is removed
+  for (const auto &pass : previousChainPasses)
+  {
+    auto fused = std::dynamic_pointer_cast<Ogre2FusedRenderPass>(pass);
+    if (fused && this->ogreCompositorWorkspace &&
+        std::find(this->dataPtr->chainPasses.begin(),
+        this->dataPtr->chainPasses.end(), pass) ==
+        this->dataPtr->chainPasses.end() &&
+        this->ogreCompositorWorkspace->findNodeNoThrow(
+        fused->OgreCompositorNodeDefinitionName()))
+    {
+      this->dataPtr->retiredPasses.push_back(fused);
+    }
+  }
+
+  // the passes fused in a fused pass are not in the chain, they are updated
+  // through the fused pass once its material was created by the chain
+  for (const auto &pass : this->dataPtr->chainPasses)
+  {
+    if (std::dynamic_pointer_cast<Ogre2FusedRenderPass>(pass))
+      pass->PreRender();
+  }
+
   // this->dataPtr->ogreTexture[0] may have changed
   if (this->dataPtr->materialApplicator[0] &&
       this->dataPtr->materialApplicator[0]->IsSameRenderTarget(
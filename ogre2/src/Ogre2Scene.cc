@@ -18,15 +18,19 @@
 #include <ignition/common/Console.hh>
 
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2ArrowVisual.hh"
 #include "ignition/rendering/ogre2/Ogre2AxisVisual.hh"
 #include "ignition/rendering/ogre2/Ogre2Camera.hh"
+#include "ignition/rendering/ogre2/Ogre2CameraArray.hh"
 #include "ignition/rendering/ogre2/Ogre2Capsule.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2DepthCamera.hh"
+#include "ignition/rendering/ogre2/Ogre2GeometryCache.hh"
 #include "ignition/rendering/ogre2/Ogre2GizmoVisual.hh"
 #include "ignition/rendering/ogre2/Ogre2GpuRays.hh"
 #include "ignition/rendering/ogre2/Ogre2Grid.hh"
+#include "ignition/rendering/ogre2/Ogre2InstanceBatch.hh"
 #include "ignition/rendering/ogre2/Ogre2Light.hh"
 #include "ignition/rendering/ogre2/Ogre2LightVisual.hh"
 #include "ignition/rendering/ogre2/Ogre2LidarVisual.hh"
@@ -40,6 +44,7 @@
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
+#include "ignition/rendering/ogre2/Ogre2StaticGeometry.hh"
 #include "ignition/rendering/ogre2/Ogre2ThermalCamera.hh"
 #include "ignition/rendering/ogre2/Ogre2Visual.hh"
 #include "ignition/rendering/ogre2/Ogre2WireBox.hh"
@@ -53,9 +58,16 @@
 #include <Compositor/Pass/PassQuad/OgreCompositorPassQuadDef.h>
 #include <Compositor/Pass/PassScene/OgreCompositorPassSceneDef.h>
 #include <OgreDepthBuffer.h>
+#include <OgreHlms.h>
+#include <OgreHlmsManager.h>
+#include <OgreItem.h>
+#include <OgreRenderSystem.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#include <OgreTextureManager.h>
 #include <Overlay/OgreOverlayManager.h>
+#include <Vao/OgreVaoManager.h>
 #include <Overlay/OgreOverlaySystem.h>
 #ifdef _MSC_VER
   #pragma warning(pop)
@@ -70,8 +82,38 @@ class ignition::rendering::Ogre2ScenePrivate
   /// \brief Flag to indicate if sky is enabled or not
   public: bool skyEnabled = false;
 
-  /// \brief Name of shadow compositor node
+  /// \brief Prefix of the name of the shadow compositor node. The scene
+  /// name is appended since compositor definitions are shared by all scenes.
   public: const std::string kShadowNodeName = "PbsMaterialsShadowNode";
+
+  /// \brief Cache of procedural meshes shared between geometries
+  public: Ogre2GeometryCachePtr geometryCache;
+
+  /// \brief Merged meshes of static visuals
+  public: Ogre2StaticGeometryPtr staticGeometry;
+
+  /// \brief Visuals whose geometries are merged into the static geometry
+  public: std::vector<std::weak_ptr<Ogre2Visual>> bakedVisuals;
+
+  /// \brief True if a baked visual was modified and the static geometry
+  /// needs to be rebuilt
+  public: bool staticGeometryDirty = false;
+
+  /// \brief Instance batches created by this scene. The batches are owned
+  /// by the user and are not part of the scene graph.
+  public: std::vector<std::weak_ptr<Ogre2InstanceBatch>> instanceBatches;
+
+  /// \brief Destroy all instance batches that are still alive
+  public: void DestroyInstanceBatches()
+  {
+    for (auto &weakBatch : this->instanceBatches)
+    {
+      auto batch = weakBatch.lock();
+      if (batch)
+        batch->Destroy();
+    }
+    this->instanceBatches.clear();
+  }
 };
 
 using namespace ignition;
@@ -134,6 +176,7 @@ void Ogre2Scene::SetAmbientLight(const math::Color &_color)
 //////////////////////////////////////////////////
 void Ogre2Scene::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2Scene::PreRender");
   if (this->ShadowsDirty())
   {
     // notify all render targets
@@ -165,13 +208,58 @@ void Ogre2Scene::PreRender()
     UpdateShadowNode();
   }
 
+  // publish textures decoded in the background and set them on the
+  // materials using them
+  Ogre2RenderEngine::Instance()->UpdateTextureStreaming();
+
+  if (this->dataPtr->staticGeometryDirty)
+    this->RebuildStaticGeometry();
+
   BaseScene::PreRender();
+
+  // instance batches are not part of the scene graph
+  auto &batches = this->dataPtr->instanceBatches;
+  for (auto it = batches.begin(); it != batches.end();)
+  {
+    auto batch = it->lock();
+    if (!batch)
+    {
+      it = batches.erase(it);
+      continue;
+    }
+    batch->PreRender();
+    ++it;
+  }
+}
+
+//////////////////////////////////////////////////
+rendering::ResourceStats Ogre2Scene::ResourceStats() const
+{
+  rendering::ResourceStats stats;
+  if (!this->ogreSceneManager)
+    return stats;
+
+  auto items = this->ogreSceneManager->getMovableObjectIterator(
+      Ogre::ItemFactory::FACTORY_TYPE_NAME);
+  while (items.hasMoreElements())
+  {
+    items.getNext();
+    ++stats.objectCount;
+  }
+
+  stats.workspaceCount =
+      Ogre2RenderEngine::Instance()->WorkspaceCount(this->ogreSceneManager);
+  stats.sharedMeshCount = this->dataPtr->geometryCache->MeshCount();
+  return stats;
 }
 
 //////////////////////////////////////////////////
 void Ogre2Scene::Clear()
 {
+  this->ClearStaticGeometry();
+  this->dataPtr->DestroyInstanceBatches();
   this->meshFactory->Clear();
+  this->dataPtr->geometryCache->Clear();
 
   BaseScene::Clear();
 }
@@ -179,6 +267,8 @@ void Ogre2Scene::Clear()
 //////////////////////////////////////////////////
 void Ogre2Scene::Destroy()
 {
+  this->ClearStaticGeometry();
+  this->dataPtr->DestroyInstanceBatches();
   this->DestroyNodes();
 
   // cleanup any items that were not attached to nodes
@@ -194,6 +284,19 @@ void Ogre2Scene::Destroy()
     this->ogreSceneManager->removeRenderQueueListener(
         Ogre2RenderEngine::Instance()->OverlaySystem());
   }
+
+  // the workspaces using the shadow node were destroyed with the sensors
+  auto engine = Ogre2RenderEngine::Instance();
+  if (engine->OgreRoot())
+  {
+    Ogre::CompositorManager2 *compositorManager =
+        engine->OgreRoot()->getCompositorManager2();
+    if (compositorManager &&
+        compositorManager->hasShadowNodeDefinition(this->ShadowNodeName()))
+    {
+      compositorManager->removeShadowNodeDefinition(this->ShadowNodeName());
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -329,7 +432,7 @@ void Ogre2Scene::UpdateShadowNode()
     }
   }
 
-  std::string shadowNodeDefName = this->dataPtr->kShadowNodeName;
+  std::string shadowNodeDefName = this->ShadowNodeName();
   if (compositorManager->hasShadowNodeDefinition(shadowNodeDefName))
     compositorManager->removeShadowNodeDefinition(shadowNodeDefName);
 
@@ -706,6 +809,15 @@ GpuRaysPtr Ogre2Scene::CreateGpuRaysImpl(unsigned int _id,
   return (result) ? gpuRays : nullptr;
 }
 
+//////////////////////////////////////////////////
+CameraArrayPtr Ogre2Scene::CreateCameraArrayImpl(unsigned int _id,
+    const std::string &_name)
+{
+  Ogre2CameraArrayPtr cameraArray(new Ogre2CameraArray);
+  bool result = this->InitObject(cameraArray, _id, _name);
+  return (result) ? cameraArray : nullptr;
+}
+
 //////////////////////////////////////////////////
 VisualPtr Ogre2Scene::CreateVisualImpl(unsigned int _id,
     const std::string &_name)
@@ -914,6 +1026,31 @@ ParticleEmitterPtr Ogre2Scene::CreateParticleEmitterImpl(unsigned int _id,
   return (result) ? visual : nullptr;
 }
 
+//////////////////////////////////////////////////
+InstanceBatchPtr Ogre2Scene::CreateInstanceBatchImpl(unsigned int _id,
+    const std::string &_name, const MeshDescriptor &_desc,
+    MaterialPtr _material, unsigned int _count)
+{
+  MeshDescriptor normDesc = _desc;
+  normDesc.Load();
+  if (!normDesc.mesh)
+  {
+    ignerr << "Unable to create instance batch, invalid mesh ["
+           << _desc.meshName << "]" << std::endl;
+    return InstanceBatchPtr();
+  }
+
+  Ogre2InstanceBatchPtr batch(new Ogre2InstanceBatch);
+  batch->meshFactory = this->meshFactory;
+  batch->SetInstanceData(normDesc, _material, _count);
+  bool result = this->InitObject(batch, _id, _name);
+  if (!result)
+    return InstanceBatchPtr();
+
+  this->dataPtr->instanceBatches.push_back(batch);
+  return batch;
+}
+
 //////////////////////////////////////////////////
 bool Ogre2Scene::InitObject(Ogre2ObjectPtr _object, unsigned int _id,
     const std::string &_name)
@@ -996,6 +1133,16 @@ void Ogre2Scene::CreateMeshFactory()
 {
   Ogre2ScenePtr sharedThis = this->SharedThis();
   this->meshFactory = Ogre2MeshFactoryPtr(new Ogre2MeshFactory(sharedThis));
+  this->dataPtr->geometryCache =
+      Ogre2GeometryCachePtr(new Ogre2GeometryCache(this->meshFactory));
+  this->dataPtr->staticGeometry = Ogre2StaticGeometryPtr(
+      new Ogre2StaticGeometry(this->meshFactory, this->ogreSceneManager));
+}
+
+//////////////////////////////////////////////////
+Ogre2GeometryCachePtr Ogre2Scene::GeometryCache() const
+{
+  return this->dataPtr->geometryCache;
 }
 
 //////////////////////////////////////////////////
@@ -1026,6 +1173,12 @@ bool Ogre2Scene::ShadowsDirty() const
   return this->dataPtr->shadowsDirty;
 }
 
+//////////////////////////////////////////////////
+std::string Ogre2Scene::ShadowNodeName() const
+{
+  return this->dataPtr->kShadowNodeName + "_" + this->Name();
+}
+
 //////////////////////////////////////////////////
 void Ogre2Scene::SetSkyEnabled(bool _enabled)
 {
@@ -1062,3 +1215,124 @@ bool Ogre2Scene::SkyEnabled() const
 {
   return this->dataPtr->skyEnabled;
 }
+
+//////////////////////////////////////////////////
+void Ogre2Scene::BakeStaticGeometry()
+{
+  this->ClearStaticGeometry();
+
+  for (auto it = this->visuals->Begin(); it != this->visuals->End(); ++it)
+  {
+    Ogre2VisualPtr visual = std::dynamic_pointer_cast<Ogre2Visual>(it->second);
+    if (visual && visual->Static() && this->BakeStaticVisual(visual))
+      this->dataPtr->bakedVisuals.push_back(visual);
+  }
+
+  this->dataPtr->staticGeometry->Build();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2Scene::BakeStaticVisual(Ogre2VisualPtr _visual)
+{
+  if (_visual->GeometryCount() == 0u ||
+      _visual->VisibilityFlags() != IGN_VISIBILITY_ALL)
+  {
+    return false;
+  }
+
+  // check all geometries first, a visual is either fully baked or not at all
+  std::vector<Ogre2MeshPtr> meshes;
+  std::vector<std::vector<Ogre2MaterialPtr>> materials;
+  for (unsigned int i = 0; i < _visual->GeometryCount(); ++i)
+  {
+    Ogre2MeshPtr mesh =
+        std::dynamic_pointer_cast<Ogre2Mesh>(_visual->GeometryByIndex(i));
+    if (!mesh || !mesh->ogreItem || !mesh->ogreItem->isVisible())
+      return false;
+
+    std::vector<Ogre2MaterialPtr> meshMaterials;
+    for (unsigned int j = 0; j < mesh->SubMeshCount(); ++j)
+    {
+      meshMaterials.push_back(std::dynamic_pointer_cast<Ogre2Material>(
+          mesh->SubMeshByIndex(j)->Material()));
+    }
+    if (!this->dataPtr->staticGeometry->CanMerge(mesh->meshDescriptor,
+        meshMaterials))
+    {
+      return false;
+    }
+
+    meshes.push_back(mesh);
+    materials.push_back(meshMaterials);
+  }
+
+  // use the transform ogre renders the geometries with
+  Ogre::SceneNode *node = _visual->Node();
+  math::Pose3d pose(
+      Ogre2Conversions::Convert(node->_getDerivedPositionUpdated()),
+      Ogre2Conversions::Convert(node->_getDerivedOrientationUpdated()));
+  math::Vector3d scale =
+      Ogre2Conversions::Convert(node->_getDerivedScaleUpdated());
+
+  for (unsigned int i = 0; i < meshes.size(); ++i)
+  {
+    this->dataPtr->staticGeometry->AddMesh(meshes[i]->meshDescriptor, pose,
+        scale, materials[i]);
+  }
+
+  _visual->SetGeometriesBaked(true);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::ClearStaticGeometry()
+{
+  for (auto &weakVisual : this->dataPtr->bakedVisuals)
+  {
+    Ogre2VisualPtr visual = weakVisual.lock();
+    if (visual && visual->staticBaked)
+      visual->SetGeometriesBaked(false);
+  }
+  this->dataPtr->bakedVisuals.clear();
+  this->dataPtr->staticGeometryDirty = false;
+
+  if (this->dataPtr->staticGeometry)
+    this->dataPtr->staticGeometry->Clear();
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2Scene::StaticGeometryBatchCount() const
+{
+  if (!this->dataPtr->staticGeometry)
+    return 0u;
+  return this->dataPtr->staticGeometry->BatchCount();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::SetStaticGeometryDirty()
+{
+  this->dataPtr->staticGeometryDirty = true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2Scene::RebuildStaticGeometry()
+{
+  this->dataPtr->staticGeometryDirty = false;
+  this->dataPtr->staticGeometry->Clear();
+
+  // visuals that were modified have already restored their geometries
+  std::vector<std::weak_ptr<Ogre2Visual>> visuals;
+  std::swap(visuals, this->dataPtr->bakedVisuals);
+  for (auto &weakVisual : visuals)
+  {
+    Ogre2VisualPtr visual = weakVisual.lock();
+    if (!visual || !visual->staticBaked)
+      continue;
+
+    visual->SetGeometriesBaked(false);
+    if (this->BakeStaticVisual(visual))
+      this->dataPtr->bakedVisuals.push_back(visual);
+  }
+
+  this->dataPtr->staticGeometry->Build();
+}
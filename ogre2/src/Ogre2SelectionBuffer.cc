@@ -15,11 +15,17 @@
  *
 */
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <string>
+#include <vector>
+
 #include <ignition/math/Color.hh>
 
 #include "ignition/common/Console.hh"
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2MaterialSwitcher.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderEngine.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTarget.hh"
@@ -35,6 +41,7 @@
 #include <OgreCamera.h>
 #include <OgreHardwarePixelBuffer.h>
 #include <OgreItem.h>
+#include <OgreRay.h>
 #include <OgreRenderTexture.h>
 #include <OgreRoot.h>
 #include <OgreSceneManager.h>
@@ -79,11 +86,39 @@ class ignition::rendering::Ogre2SelectionBufferPrivate
   /// into a render target or render texture.
   public: Ogre::CompositorWorkspace *ogreCompositorWorkspace = nullptr;
 
+  /// \brief Name of the compositor workspace definition
+  public: std::string workspaceDefName;
+
   /// \brief Render texture data buffer
   public: uint8_t *buffer = nullptr;
 
   /// \brief Ogre pixel box that contains description of the data buffer
   public: Ogre::PixelBox *pixelBox = nullptr;
+
+  /// \brief Full view texture rendered by RenderIds
+  public: Ogre::TexturePtr idTexture;
+
+  /// \brief Full view render texture
+  public: Ogre::RenderTexture *idRenderTexture = nullptr;
+
+  /// \brief Compositor workspace rendering into the full view texture
+  public: Ogre::CompositorWorkspace *idWorkspace = nullptr;
+
+  /// \brief Full view texture data read back from the GPU
+  public: std::vector<uint8_t> idData;
+
+  /// \brief Switches items to a material that writes their color along
+  /// with the distance and normal of the surface
+  public: std::unique_ptr<Ogre2MaterialSwitcher> pickSwitcher;
+
+  /// \brief Single pixel float texture rendered by Pick
+  public: Ogre::TexturePtr pickTexture;
+
+  /// \brief Pick render texture
+  public: Ogre::RenderTexture *pickRenderTexture = nullptr;
+
+  /// \brief Compositor workspace rendering into the pick texture
+  public: Ogre::CompositorWorkspace *pickWorkspace = nullptr;
 };
 
 /////////////////////////////////////////////////
@@ -113,6 +148,8 @@ Ogre2SelectionBuffer::Ogre2SelectionBuffer(const std::string &_cameraName,
 /////////////////////////////////////////////////
 Ogre2SelectionBuffer::~Ogre2SelectionBuffer()
 {
+  this->DeletePickBuffer();
+  this->DeleteIdBuffer();
   this->DeleteRTTBuffer();
 
   // remove selection buffer camera
@@ -140,6 +177,18 @@ void Ogre2SelectionBuffer::Update()
 /////////////////////////////////////////////////
 void Ogre2SelectionBuffer::DeleteRTTBuffer()
 {
+  // the workspace renders to the texture, remove it first
+  if (this->dataPtr->ogreCompositorWorkspace)
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    Ogre::CompositorManager2 *ogreCompMgr =
+        engine->OgreRoot()->getCompositorManager2();
+    engine->UnregisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
+    ogreCompMgr->removeWorkspace(this->dataPtr->ogreCompositorWorkspace);
+    this->dataPtr->ogreCompositorWorkspace = nullptr;
+    ogreCompMgr->removeWorkspaceDefinition(this->dataPtr->workspaceDefName);
+  }
+
   auto &manager = Ogre::TextureManager::getSingleton();
   manager.unload(this->dataPtr->texture->getName());
   manager.remove(this->dataPtr->texture->getName());
@@ -178,12 +227,14 @@ void Ogre2SelectionBuffer::CreateRTTBuffer()
 
   const Ogre::String workspaceName = "SelectionBufferWorkspace" +
       this->dataPtr->camera->getName();
+  this->dataPtr->workspaceDefName = workspaceName;
   ogreCompMgr->createBasicWorkspaceDef(workspaceName,
       Ogre::ColourValue(0.0f, 0.0f, 0.0f, 1.0f));
   this->dataPtr->ogreCompositorWorkspace =
       ogreCompMgr->addWorkspace(this->dataPtr->scene->OgreSceneManager(),
       this->dataPtr->renderTexture,
       this->dataPtr->selectionCamera, workspaceName, false);
+  engine->RegisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
 
   // set visibility mask to see only items that are selectable
   auto nodeSeq = this->dataPtr->ogreCompositorWorkspace->getNodeSequence();
@@ -203,30 +254,31 @@ void Ogre2SelectionBuffer::CreateRTTBuffer()
 }
 
 /////////////////////////////////////////////////
-Ogre::Item *Ogre2SelectionBuffer::OnSelectionClick(const int _x, const int _y)
+bool Ogre2SelectionBuffer::SetPixelProjection(const int _x, const int _y,
+    float &_u, float &_v)
 {
   if (!this->dataPtr->renderTexture)
-    return nullptr;
+    return false;
 
   if (!this->dataPtr->camera)
-    return nullptr;
+    return false;
 
   Ogre::Viewport *vp = this->dataPtr->camera->getLastViewport();
 
   if (!vp)
-    return nullptr;
+    return false;
 
   Ogre::RenderTarget *rt = vp->getTarget();
 
   if (!rt)
-    return nullptr;
+    return false;
 
   const unsigned int targetWidth = rt->getWidth();
   const unsigned int targetHeight = rt->getHeight();
 
   if (_x < 0 || _y < 0 || _x >= static_cast<int>(targetWidth)
       || _y >= static_cast<int>(targetHeight))
-    return nullptr;
+    return false;
 
   // 1x1 selection buffer, adapted from rviz
   // http://docs.ros.org/indigo/api/rviz/html/c++/selection__manager_8cpp.html
@@ -256,6 +308,20 @@ Ogre::Item *Ogre2SelectionBuffer::OnSelectionClick(const int _x, const int _y)
       this->dataPtr->renderTexture->getViewport(0);
   renderViewport->setDimensions(0, 0, width, height);
 
+  // the rendered pixel is centered between the two corners
+  _u = (x1 + x2) * 0.5f + 0.5f;
+  _v = (y1 + y2) * 0.5f + 0.5f;
+  return true;
+}
+
+/////////////////////////////////////////////////
+Ogre::Item *Ogre2SelectionBuffer::OnSelectionClick(const int _x, const int _y)
+{
+  float u;
+  float v;
+  if (!this->SetPixelProjection(_x, _y, u, v))
+    return nullptr;
+
   // update render texture
   this->Update();
 
@@ -287,3 +353,247 @@ Ogre::Item *Ogre2SelectionBuffer::OnSelectionClick(const int _x, const int _y)
       return dynamic_cast<Ogre::Item *>(collection[0]);
   }
 }
+
+/////////////////////////////////////////////////
+bool Ogre2SelectionBuffer::RenderIds(unsigned int _width,
+    unsigned int _height, std::vector<unsigned int> &_ids)
+{
+  if (!this->dataPtr->camera || !this->dataPtr->selectionCamera)
+    return false;
+
+  if (!this->dataPtr->idRenderTexture ||
+      this->dataPtr->idRenderTexture->getWidth() != _width ||
+      this->dataPtr->idRenderTexture->getHeight() != _height)
+  {
+    this->DeleteIdBuffer();
+    if (!this->CreateIdBuffer(_width, _height))
+      return false;
+  }
+
+  // full view of the camera
+  this->dataPtr->selectionCamera->setCustomProjectionMatrix(true,
+      this->dataPtr->camera->getProjectionMatrix());
+  this->dataPtr->selectionCamera->setPosition(
+      this->dataPtr->camera->getDerivedPosition());
+  this->dataPtr->selectionCamera->setOrientation(
+      this->dataPtr->camera->getDerivedOrientation());
+
+  this->dataPtr->materialSwitcher->Reset();
+  this->dataPtr->idWorkspace->setEnabled(true);
+  auto engine = Ogre2RenderEngine::Instance();
+  engine->OgreRoot()->renderOneFrame();
+  this->dataPtr->idWorkspace->setEnabled(false);
+
+  Ogre::PixelFormat format = Ogre::PF_R8G8B8;
+  Ogre::PixelBox pixelBox(_width, _height, 1, format,
+      this->dataPtr->idData.data());
+  this->dataPtr->idRenderTexture->copyContentsToMemory(pixelBox,
+      Ogre::RenderTarget::FB_FRONT);
+
+  // visuals cover runs of pixels of the same color, look up the id once
+  // per run. Black is the background.
+  size_t pixelSize = std::min<size_t>(
+      Ogre::PixelUtil::getNumElemBytes(format), 4u);
+  _ids.resize(static_cast<size_t>(_width) * _height);
+  ignition::math::Color::BGRA runColor(0);
+  unsigned int runId = 0u;
+  const uint8_t *pixel = this->dataPtr->idData.data();
+  for (size_t i = 0; i < _ids.size(); ++i, pixel += pixelSize)
+  {
+    ignition::math::Color::BGRA color(0);
+    memcpy(static_cast<void *>(&color), pixel, pixelSize);
+    if (color != runColor)
+    {
+      ignition::math::Color cv;
+      cv.SetFromARGB(color);
+      cv.A(1.0);
+      runColor = color;
+      runId = this->dataPtr->materialSwitcher->VisualId(cv);
+    }
+    _ids[i] = runId;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool Ogre2SelectionBuffer::CreateIdBuffer(unsigned int _width,
+    unsigned int _height)
+{
+  Ogre::PixelFormat format = Ogre::PF_R8G8B8;
+  try
+  {
+    this->dataPtr->idTexture =
+        Ogre::TextureManager::getSingleton().createManual(
+        this->dataPtr->camera->getName() + "_selection_ids",
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME,
+        Ogre::TEX_TYPE_2D, _width, _height, 0, format,
+        Ogre::TU_RENDERTARGET);
+  }
+  catch(Ogre::Exception &e)
+  {
+    ignerr << "Unable to create selection id buffer: "
+           << e.getFullDescription() << std::endl;
+    return false;
+  }
+
+  this->dataPtr->idRenderTexture =
+      this->dataPtr->idTexture->getBuffer()->getRenderTarget();
+  this->dataPtr->idRenderTexture->addListener(
+      this->dataPtr->materialSwitcher.get());
+
+  // same workspace definition as the 1x1 buffer, which only sees
+  // selectable items
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::CompositorManager2 *ogreCompMgr =
+      engine->OgreRoot()->getCompositorManager2();
+  this->dataPtr->idWorkspace =
+      ogreCompMgr->addWorkspace(this->dataPtr->sceneMgr,
+      this->dataPtr->idRenderTexture, this->dataPtr->selectionCamera,
+      this->dataPtr->workspaceDefName, false);
+  engine->RegisterWorkspace(this->dataPtr->idWorkspace);
+
+  this->dataPtr->idData.resize(
+      Ogre::PixelUtil::getMemorySize(_width, _height, 1, format));
+  return true;
+}
+
+/////////////////////////////////////////////////
+void Ogre2SelectionBuffer::DeleteIdBuffer()
+{
+  if (this->dataPtr->idWorkspace)
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    engine->UnregisterWorkspace(this->dataPtr->idWorkspace);
+    engine->OgreRoot()->getCompositorManager2()->removeWorkspace(
+        this->dataPtr->idWorkspace);
+    this->dataPtr->idWorkspace = nullptr;
+  }
+
+  if (!this->dataPtr->idTexture.isNull())
+  {
+    auto &manager = Ogre::TextureManager::getSingleton();
+    manager.unload(this->dataPtr->idTexture->getName());
+    manager.remove(this->dataPtr->idTexture->getName());
+    this->dataPtr->idTexture.setNull();
+  }
+  this->dataPtr->idRenderTexture = nullptr;
+  this->dataPtr->idData.clear();
+}
+
+/////////////////////////////////////////////////
+RayQueryResult Ogre2SelectionBuffer::Pick(const int _x, const int _y)
+{
+  RayQueryResult result;
+  if (!this->dataPtr->pickRenderTexture && !this->CreatePickBuffer())
+    return result;
+
+  float u;
+  float v;
+  if (!this->SetPixelProjection(_x, _y, u, v))
+    return result;
+
+  this->dataPtr->pickSwitcher->Reset();
+  this->dataPtr->pickWorkspace->setEnabled(true);
+  auto engine = Ogre2RenderEngine::Instance();
+  engine->OgreRoot()->renderOneFrame();
+  this->dataPtr->pickWorkspace->setEnabled(false);
+
+  // item color as an integer, distance and octahedral encoded normal in
+  // view space
+  float data[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  Ogre::PixelBox pixelBox(1, 1, 1, Ogre::PF_FLOAT32_RGBA, data);
+  this->dataPtr->pickRenderTexture->copyContentsToMemory(pixelBox,
+      Ogre::RenderTarget::FB_FRONT);
+
+  if (data[0] < 0.5f || data[1] <= 0.0f)
+    return result;
+
+  ignition::math::Color cv;
+  cv.SetFromARGB(static_cast<ignition::math::Color::ARGB>(data[0] + 0.5f));
+  cv.A(1.0);
+  result.objectId = this->dataPtr->pickSwitcher->VisualId(cv);
+  if (!result.objectId)
+    return result;
+
+  Ogre::Ray ray = this->dataPtr->camera->getCameraToViewportRay(u, v);
+  result.distance = data[1];
+  result.point = Ogre2Conversions::Convert(ray.getPoint(data[1]));
+
+  Ogre::Vector3 normal(data[2], data[3],
+      1.0f - std::abs(data[2]) - std::abs(data[3]));
+  if (normal.z < 0.0f)
+  {
+    float x = normal.x;
+    normal.x = (1.0f - std::abs(normal.y)) * (x >= 0.0f ? 1.0f : -1.0f);
+    normal.y = (1.0f - std::abs(x)) * (normal.y >= 0.0f ? 1.0f : -1.0f);
+  }
+  normal.normalise();
+  result.normal = Ogre2Conversions::Convert(
+      this->dataPtr->camera->getDerivedOrientation() * normal);
+  return result;
+}
+
+/////////////////////////////////////////////////
+bool Ogre2SelectionBuffer::CreatePickBuffer()
+{
+  if (!this->dataPtr->camera || !this->dataPtr->renderTexture)
+    return false;
+
+  try
+  {
+    this->dataPtr->pickTexture =
+        Ogre::TextureManager::getSingleton().createManual(
+        this->dataPtr->camera->getName() + "_selection_pick",
+        Ogre::ResourceGroupManager::DEFAULT_RESOURCE_GROUP_NAME,
+        Ogre::TEX_TYPE_2D, 1, 1, 0, Ogre::PF_FLOAT32_RGBA,
+        Ogre::TU_RENDERTARGET);
+  }
+  catch(Ogre::Exception &e)
+  {
+    ignerr << "Unable to create selection pick buffer: "
+           << e.getFullDescription() << std::endl;
+    return false;
+  }
+
+  this->dataPtr->pickSwitcher.reset(new Ogre2MaterialSwitcher(
+      this->dataPtr->scene, "ign-rendering/selection_pick"));
+  this->dataPtr->pickRenderTexture =
+      this->dataPtr->pickTexture->getBuffer()->getRenderTarget();
+  this->dataPtr->pickRenderTexture->addListener(
+      this->dataPtr->pickSwitcher.get());
+
+  // same workspace definition as the 1x1 buffer, which only sees
+  // selectable items
+  auto engine = Ogre2RenderEngine::Instance();
+  Ogre::CompositorManager2 *ogreCompMgr =
+      engine->OgreRoot()->getCompositorManager2();
+  this->dataPtr->pickWorkspace =
+      ogreCompMgr->addWorkspace(this->dataPtr->sceneMgr,
+      this->dataPtr->pickRenderTexture, this->dataPtr->selectionCamera,
+      this->dataPtr->workspaceDefName, false);
+  engine->RegisterWorkspace(this->dataPtr->pickWorkspace);
+  return true;
+}
+
+/////////////////////////////////////////////////
+void Ogre2SelectionBuffer::DeletePickBuffer()
+{
+  if (this->dataPtr->pickWorkspace)
+  {
+    auto engine = Ogre2RenderEngine::Instance();
+    engine->UnregisterWorkspace(this->dataPtr->pickWorkspace);
+    engine->OgreRoot()->getCompositorManager2()->removeWorkspace(
+        this->dataPtr->pickWorkspace);
+    this->dataPtr->pickWorkspace = nullptr;
+  }
+
+  if (!this->dataPtr->pickTexture.isNull())
+  {
+    auto &manager = Ogre::TextureManager::getSingleton();
+    manager.unload(this->dataPtr->pickTexture->getName());
+    manager.remove(this->dataPtr->pickTexture->getName());
+    this->dataPtr->pickTexture.setNull();
+  }
+  this->dataPtr->pickRenderTexture = nullptr;
+  this->dataPtr->pickSwitcher.reset();
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+#include <OgreItem.h>
+#include <OgreSceneManager.h>
+#include <OgreSceneNode.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <tuple>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Mesh.hh>
+#include <ignition/common/SubMesh.hh>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Vector2.hh>
+
+#include "ignition/rendering/ogre2/Ogre2Material.hh"
+#include "ignition/rendering/ogre2/Ogre2MeshFactory.hh"
+#include "ignition/rendering/ogre2/Ogre2StaticGeometry.hh"
+
+/// \brief Private data for the Ogre2StaticGeometry class
+class ignition::rendering::Ogre2StaticGeometryPrivate
+{
+  /// \brief A merged mesh made of all static meshes of a region that share
+  /// the same material
+  public: struct Batch
+  {
+    /// \brief Material of the batch
+    Ogre2MaterialPtr material;
+
+    /// \brief Merged vertices and indices in world frame
+    common::SubMesh subMesh;
+
+    /// \brief Merged mesh, created by Build
+    std::unique_ptr<common::Mesh> mesh;
+
+    /// \brief Ogre item of the merged mesh, created by Build
+    Ogre::Item *item = nullptr;
+
+    /// \brief Static scene node the item is attached to
+    Ogre::SceneNode *node = nullptr;
+  };
+
+  /// \brief Batch key: material name and region index
+  public: using BatchKey = std::tuple<std::string, int64_t, int64_t, int64_t>;
+
+  /// \brief Mesh factory used to load the merged meshes
+  public: Ogre2MeshFactoryPtr meshFactory;
+
+  /// \brief Scene manager the merged meshes are added to
+  public: Ogre::SceneManager *sceneManager = nullptr;
+
+  /// \brief Edge length of the cubic regions
+  public: double regionSize = Ogre2StaticGeometry::kDefaultRegionSize;
+
+  /// \brief Batches by material and region
+  public: std::map<BatchKey, Batch> batches;
+
+  /// \brief Counter used to give merged meshes unique names. Ogre keeps
+  /// the name of removed meshes around for a while, names are never reused.
+  public: unsigned int meshCounter = 0u;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+Ogre2StaticGeometry::Ogre2StaticGeometry(Ogre2MeshFactoryPtr _meshFactory,
+    Ogre::SceneManager *_sceneManager)
+  : dataPtr(std::make_unique<Ogre2StaticGeometryPrivate>())
+{
+  this->dataPtr->meshFactory = _meshFactory;
+  this->dataPtr->sceneManager = _sceneManager;
+}
+
+//////////////////////////////////////////////////
+Ogre2StaticGeometry::~Ogre2StaticGeometry()
+{
+  this->Clear();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2StaticGeometry::CanMerge(const MeshDescriptor &_desc,
+    const std::vector<Ogre2MaterialPtr> &_materials) const
+{
+  if (!_desc.mesh || _desc.mesh->HasSkeleton())
+    return false;
+
+  unsigned int loaded = 0u;
+  for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); ++i)
+  {
+    auto s = _desc.mesh->SubMeshByIndex(i).lock();
+    if (!s)
+      return false;
+
+    // same sub-mesh selection as the mesh factory
+    if (!_desc.subMeshName.empty() && s->Name() != _desc.subMeshName)
+      continue;
+
+    if (s->SubMeshPrimitiveType() != common::SubMesh::TRIANGLES)
+      return false;
+
+    if (loaded >= _materials.size() || !_materials[loaded])
+      return false;
+    ++loaded;
+  }
+
+  return loaded > 0u && loaded == _materials.size();
+}
+
+//////////////////////////////////////////////////
+bool Ogre2StaticGeometry::AddMesh(const MeshDescriptor &_desc,
+    const math::Pose3d &_pose, const math::Vector3d &_scale,
+    const std::vector<Ogre2MaterialPtr> &_materials)
+{
+  if (!this->CanMerge(_desc, _materials))
+    return false;
+
+  // normals are transformed by the inverse scale
+  if (math::equal(_scale.X(), 0.0) || math::equal(_scale.Y(), 0.0) ||
+      math::equal(_scale.Z(), 0.0))
+  {
+    return false;
+  }
+  math::Vector3d invScale(1.0 / _scale.X(), 1.0 / _scale.Y(),
+      1.0 / _scale.Z());
+
+  double size = this->dataPtr->regionSize;
+  int64_t rx = static_cast<int64_t>(std::floor(_pose.Pos().X() / size));
+  int64_t ry = static_cast<int64_t>(std::floor(_pose.Pos().Y() / size));
+  int64_t rz = static_cast<int64_t>(std::floor(_pose.Pos().Z() / size));
+
+  unsigned int loaded = 0u;
+  for (unsigned int i = 0; i < _desc.mesh->SubMeshCount(); ++i)
+  {
+    auto s = _desc.mesh->SubMeshByIndex(i).lock();
+    if (!_desc.subMeshName.empty() && s->Name() != _desc.subMeshName)
+      continue;
+
+    Ogre2MaterialPtr material = _materials[loaded++];
+    Ogre2StaticGeometryPrivate::Batch &batch = this->dataPtr->batches[
+        std::make_tuple(material->Name(), rx, ry, rz)];
+    batch.material = material;
+
+    common::SubMesh subMesh(*s.get());
+    if (_desc.centerSubMesh)
+      subMesh.Center(math::Vector3d::Zero);
+
+    unsigned int offset = batch.subMesh.VertexCount();
+    bool hasNormals = subMesh.NormalCount() == subMesh.VertexCount();
+    bool hasTexCoords = subMesh.TexCoordCount() == subMesh.VertexCount();
+    for (unsigned int j = 0; j < subMesh.VertexCount(); ++j)
+    {
+      batch.subMesh.AddVertex(
+          _pose.Rot() * (_scale * subMesh.Vertex(j)) + _pose.Pos());
+
+      math::Vector3d normal = math::Vector3d::UnitZ;
+      if (hasNormals)
+        normal = (_pose.Rot() * (invScale * subMesh.Normal(j))).Normalize();
+      batch.subMesh.AddNormal(normal);
+
+      // the merged mesh always has one texture coordinate set
+      batch.subMesh.AddTexCoord(
+          hasTexCoords ? subMesh.TexCoord(j) : math::Vector2d::Zero);
+    }
+
+    for (unsigned int j = 0; j < subMesh.IndexCount(); ++j)
+      batch.subMesh.AddIndex(offset + subMesh.Index(j));
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Ogre2StaticGeometry::Build()
+{
+  Ogre::SceneNode *root =
+      this->dataPtr->sceneManager->getRootSceneNode(Ogre::SCENE_STATIC);
+
+  for (auto &it : this->dataPtr->batches)
+  {
+    Ogre2StaticGeometryPrivate::Batch &batch = it.second;
+    if (batch.item || batch.subMesh.IndexCount() == 0u)
+      continue;
+
+    // ogre meshes are shared by all scenes, make the name unique
+    std::string name = this->dataPtr->sceneManager->getName() +
+        "::__ign_static_geometry_" +
+        std::to_string(this->dataPtr->meshCounter++);
+    batch.subMesh.SetName(name);
+    batch.mesh = std::make_unique<common::Mesh>();
+    batch.mesh->SetName(name);
+    batch.mesh->AddSubMesh(batch.subMesh);
+
+    // the vertices are in the merged mesh now
+    batch.subMesh = common::SubMesh();
+
+    MeshDescriptor desc(batch.mesh.get());
+    desc.Load();
+    batch.item = this->dataPtr->meshFactory->OgreItem(desc);
+    if (!batch.item)
+    {
+      ignerr << "Unable to create static geometry batch for material ["
+             << batch.material->Name() << "]" << std::endl;
+      continue;
+    }
+
+    batch.item->setDatablock(batch.material->Datablock());
+    batch.item->setCastShadows(batch.material->CastShadows());
+
+    // static objects are skipped by ogre's per frame transform and bounds
+    // updates
+    batch.item->setStatic(true);
+    batch.node = root->createChildSceneNode(Ogre::SCENE_STATIC);
+    batch.node->attachObject(batch.item);
+  }
+
+  this->dataPtr->sceneManager->notifyStaticDirty(root);
+}
+
+//////////////////////////////////////////////////
+void Ogre2StaticGeometry::Clear()
+{
+  for (auto &it : this->dataPtr->batches)
+  {
+    Ogre2StaticGeometryPrivate::Batch &batch = it.second;
+    if (batch.item)
+      this->dataPtr->sceneManager->destroyItem(batch.item);
+    if (batch.node)
+      this->dataPtr->sceneManager->destroySceneNode(batch.node);
+    if (batch.mesh)
+      this->dataPtr->meshFactory->ClearMesh(MeshDescriptor(batch.mesh.get()));
+  }
+  this->dataPtr->batches.clear();
+}
+
+//////////////////////////////////////////////////
+unsigned int Ogre2StaticGeometry::BatchCount() const
+{
+  unsigned int count = 0u;
+  for (const auto &it : this->dataPtr->batches)
+  {
+    if (it.second.item)
+      ++count;
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+void Ogre2StaticGeometry::SetRegionSize(double _size)
+{
+  if (_size <= 0.0)
+  {
+    ignerr << "Static geometry region size must be positive" << std::endl;
+    return;
+  }
+  this->dataPtr->regionSize = _size;
+}
+
+//////////////////////////////////////////////////
+double Ogre2StaticGeometry::RegionSize() const
+{
+  return this->dataPtr->regionSize;
+}
@@ -44,7 +44,9 @@
 #include <ignition/common/Filesystem.hh>
 #include <ignition/math/Helpers.hh>
 
+#include "ignition/rendering/FrameSaver.hh"
 #include "ignition/rendering/RenderTypes.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/ogre2/Ogre2Conversions.hh"
 #include "ignition/rendering/ogre2/Ogre2Includes.hh"
 #include "ignition/rendering/ogre2/Ogre2Material.hh"
@@ -489,8 +491,10 @@ void Ogre2ThermalCamera::Destroy()
   }
   if (this->dataPtr->ogreCompositorWorkspace)
   {
+    engine->UnregisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
     ogreCompMgr->removeWorkspace(
         this->dataPtr->ogreCompositorWorkspace);
+    this->dataPtr->ogreCompositorWorkspace = nullptr;
   }
 
   if (this->dataPtr->thermalMaterial)
@@ -802,6 +806,7 @@ void Ogre2ThermalCamera::CreateThermalTexture()
   this->dataPtr->ogreCompositorWorkspace =
       ogreCompMgr->addWorkspace(this->scene->OgreSceneManager(),
       rt, this->ogreCamera, wsDefName, false);
+  engine->RegisterWorkspace(this->dataPtr->ogreCompositorWorkspace);
 
   // add thermal material swticher to render target listener
   // so we can switch to use heat material when the camera is being udpated
@@ -826,16 +831,16 @@ void Ogre2ThermalCamera::CreateThermalTexture()
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::Render()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2ThermalCamera::Render");
   // update the compositors
-  this->dataPtr->ogreCompositorWorkspace->setEnabled(true);
   auto engine = Ogre2RenderEngine::Instance();
-  engine->OgreRoot()->renderOneFrame();
-  this->dataPtr->ogreCompositorWorkspace->setEnabled(false);
+  engine->RenderWorkspaces({this->dataPtr->ogreCompositorWorkspace});
 }
 
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("Ogre2ThermalCamera::PreRender");
   if (!this->dataPtr->ogreThermalTexture)
     this->CreateThermalTexture();
 }
@@ -843,8 +848,12 @@ void Ogre2ThermalCamera::PreRender()
 //////////////////////////////////////////////////
 void Ogre2ThermalCamera::PostRender()
 {
-  if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u)
+  IGN_RENDERING_TRACE_ZONE("Ogre2ThermalCamera::PostRender");
+  if (this->dataPtr->newThermalFrame.ConnectionCount() <= 0u &&
+      !this->saveFrameEnabled)
+  {
     return;
+  }
 
   unsigned int width = this->ImageWidth();
   unsigned int height = this->ImageHeight();
@@ -895,9 +904,17 @@ void Ogre2ThermalCamera::PostRender()
         height * width * channelCount * bytesPerChannel);
   }
 
-  this->dataPtr->newThermalFrame(
-      this->dataPtr->thermalImage, width, height, 1,
-      PixelUtil::Name(format));
+  {
+    IGN_RENDERING_TRACE_ZONE("Ogre2ThermalCamera::NewThermalFrame");
+    this->dataPtr->newThermalFrame(
+        this->dataPtr->thermalImage, width, height, 1,
+        PixelUtil::Name(format));
+  }
+  if (this->saveFrameEnabled)
+  {
+    this->SaveNextFrame(this->FrameImage(
+        this->dataPtr->thermalBuffer, width, height, format));
+  }
 
   // Uncomment to debug thermal output
   // std::cout << "wxh: " << width << " x " << height << std::endl;
@@ -919,6 +936,22 @@ common::ConnectionPtr Ogre2ThermalCamera::ConnectNewThermalFrame(
   return this->dataPtr->newThermalFrame.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+bool Ogre2ThermalCamera::SaveFrame(const std::string &_name)
+{
+  if (!this->dataPtr->thermalBuffer)
+  {
+    ignerr << "Unable to save frame of thermal camera [" << this->Name()
+           << "]: no frame read back yet, connect to new thermal frames "
+           << "or enable saving frames" << std::endl;
+    return false;
+  }
+
+  return FrameSaver::Default().Save(this->FrameImage(
+      this->dataPtr->thermalBuffer, this->ImageWidth(), this->ImageHeight(),
+      this->ImageFormat()), _name);
+}
+
 //////////////////////////////////////////////////
 RenderTargetPtr Ogre2ThermalCamera::RenderTarget() const
 {
@@ -21,6 +21,7 @@
 #include "ignition/rendering/ogre2/Ogre2Geometry.hh"
 #include "ignition/rendering/ogre2/Ogre2ParticleEmitter.hh"
 #include "ignition/rendering/ogre2/Ogre2RenderTypes.hh"
+#include "ignition/rendering/ogre2/Ogre2Scene.hh"
 #include "ignition/rendering/ogre2/Ogre2Storage.hh"
 #include "ignition/rendering/ogre2/Ogre2Visual.hh"
 #include "ignition/rendering/ogre2/Ogre2WireBox.hh"
@@ -48,7 +49,9 @@ Ogre2Visual::~Ogre2Visual()
 //////////////////////////////////////////////////
 void Ogre2Visual::SetVisible(bool _visible)
 {
+  this->UnbakeStatic();
   this->ogreNode->setVisible(_visible);
+  this->MarkSceneChanged();
 }
 
 //////////////////////////////////////////////////
@@ -165,7 +168,9 @@ void Ogre2Visual::BoundsHelper(ignition::math::AxisAlignedBox &_box,
   {
     Ogre::MovableObject *obj = this->ogreNode->getAttachedObject(i);
 
-    if (obj->isVisible() && obj->getVisibilityFlags() != IGN_VISIBILITY_GUI)
+    // baked geometries are hidden but still part of the visual
+    if ((obj->isVisible() || this->staticBaked) &&
+        obj->getVisibilityFlags() != IGN_VISIBILITY_GUI)
     {
       Ogre::Aabb bb = obj->getLocalAabb();
 
@@ -226,6 +231,30 @@ void Ogre2Visual::BoundsHelper(ignition::math::AxisAlignedBox &_box,
   }
 }
 
+//////////////////////////////////////////////////
+void Ogre2Visual::UnbakeStatic()
+{
+  if (!this->staticBaked)
+    return;
+
+  this->SetGeometriesBaked(false);
+  if (this->scene)
+    this->scene->SetStaticGeometryDirty();
+}
+
+//////////////////////////////////////////////////
+void Ogre2Visual::SetGeometriesBaked(bool _baked)
+{
+  for (unsigned int i = 0; i < this->GeometryCount(); ++i)
+  {
+    Ogre2GeometryPtr geometry =
+        std::dynamic_pointer_cast<Ogre2Geometry>(this->GeometryByIndex(i));
+    if (geometry && geometry->OgreObject())
+      geometry->OgreObject()->setVisible(!_baked);
+  }
+  this->staticBaked = _baked;
+}
+
 //////////////////////////////////////////////////
 void Ogre2Visual::Init()
 {
@@ -15,12 +15,18 @@
  *
 */
 
+#include <string>
+#include <vector>
+
 #include <ignition/common/Console.hh>
+#include <ignition/common/MeshManager.hh>
 
+#include "ignition/rendering/ogre2/Ogre2GeometryCache.hh"
 #include "ignition/rendering/ogre2/Ogre2WireBox.hh"
 #include "ignition/rendering/ogre2/Ogre2Material.hh"
+#include "ignition/rendering/ogre2/Ogre2Mesh.hh"
 #include "ignition/rendering/ogre2/Ogre2Scene.hh"
-#include "ignition/rendering/ogre2/Ogre2DynamicRenderable.hh"
+#include "ignition/rendering/ogre2/Ogre2Visual.hh"
 
 using namespace ignition;
 using namespace rendering;
@@ -30,8 +36,12 @@ class ignition::rendering::Ogre2WireBoxPrivate
   /// \brief Wirebox material
   public: Ogre2MaterialPtr material;
 
-  /// \brief Ogre renderable used to render the wirebox.
-  public: std::shared_ptr<Ogre2DynamicRenderable> wireBox = nullptr;
+  /// \brief Mesh used to render the wirebox. The underlying ogre mesh is
+  /// shared by all wireboxes with the same box.
+  public: Ogre2MeshPtr wireBox = nullptr;
+
+  /// \brief Name of the shared wirebox mesh in the geometry cache
+  public: std::string meshName;
 };
 
 //////////////////////////////////////////////////
@@ -58,7 +68,9 @@ void Ogre2WireBox::PreRender()
 //////////////////////////////////////////////////
 Ogre::MovableObject *Ogre2WireBox::OgreObject() const
 {
-  return this->dataPtr->wireBox->OgreObject();
+  if (this->dataPtr->wireBox)
+    return this->dataPtr->wireBox->OgreObject();
+  return nullptr;
 }
 
 //////////////////////////////////////////////////
@@ -67,72 +79,134 @@ void Ogre2WireBox::Init()
   this->Create();
 }
 
+//////////////////////////////////////////////////
+void Ogre2WireBox::Destroy()
+{
+  if (this->dataPtr->wireBox)
+  {
+    this->dataPtr->wireBox->Destroy();
+    this->dataPtr->wireBox.reset();
+  }
+
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  if (!this->dataPtr->meshName.empty() && ogreScene)
+  {
+    ogreScene->GeometryCache()->Release(this->dataPtr->meshName);
+    this->dataPtr->meshName.clear();
+  }
+}
+
 //////////////////////////////////////////////////
 void Ogre2WireBox::Create()
 {
-  if (!this->dataPtr->wireBox)
+  auto ogreScene = std::dynamic_pointer_cast<Ogre2Scene>(this->Scene());
+  Ogre2GeometryCachePtr cache = ogreScene->GeometryCache();
+
+  const math::Vector3d &min = this->box.Min();
+  const math::Vector3d &max = this->box.Max();
+  std::string key = "wirebox_mesh";
+  for (const auto &v : {min, max})
   {
-    this->dataPtr->wireBox.reset(new Ogre2DynamicRenderable(this->scene));
+    for (unsigned int i = 0; i < 3u; ++i)
+      key += "_" + std::to_string(Ogre2GeometryCache::Quantize(v[i]));
   }
 
-  // Clear any previous data from the wirebox
-  this->dataPtr->wireBox->Clear();
-  this->dataPtr->wireBox->Update();
+  std::string wireBoxMeshName = cache->AcquireLineList(key, [&]()
+  {
+    std::vector<math::Vector3d> points;
+
+    // line 0
+    points.push_back({min.X(), min.Y(), min.Z()});
+    points.push_back({max.X(), min.Y(), min.Z()});
 
-  this->dataPtr->wireBox->SetOperationType(MarkerType::MT_LINE_LIST);
+    // line 1
+    points.push_back({min.X(), min.Y(), min.Z()});
+    points.push_back({min.X(), min.Y(), max.Z()});
 
-  ignition::math::Vector3d max = this->box.Max();
-  ignition::math::Vector3d min = this->box.Min();
+    // line 2
+    points.push_back({min.X(), min.Y(), min.Z()});
+    points.push_back({min.X(), max.Y(), min.Z()});
 
-  // line 0
-  this->dataPtr->wireBox->AddPoint({min.X(), min.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), min.Y(), min.Z()});
+    // line 3
+    points.push_back({min.X(), max.Y(), min.Z()});
+    points.push_back({min.X(), max.Y(), max.Z()});
 
-  // line 1
-  this->dataPtr->wireBox->AddPoint({min.X(), min.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({min.X(), min.Y(), max.Z()});
+    // line 4
+    points.push_back({min.X(), max.Y(), min.Z()});
+    points.push_back({max.X(), max.Y(), min.Z()});
 
-  // line 2
-  this->dataPtr->wireBox->AddPoint({min.X(), min.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({min.X(), max.Y(), min.Z()});
+    // line 5
+    points.push_back({max.X(), min.Y(), min.Z()});
+    points.push_back({max.X(), min.Y(), max.Z()});
 
-  // line 3
-  this->dataPtr->wireBox->AddPoint({min.X(), max.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({min.X(), max.Y(), max.Z()});
+    // line 6
+    points.push_back({max.X(), min.Y(), min.Z()});
+    points.push_back({max.X(), max.Y(), min.Z()});
 
-  // line 4
-  this->dataPtr->wireBox->AddPoint({min.X(), max.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), max.Y(), min.Z()});
+    // line 7
+    points.push_back({min.X(), max.Y(), max.Z()});
+    points.push_back({max.X(), max.Y(), max.Z()});
 
-  // line 5
-  this->dataPtr->wireBox->AddPoint({max.X(), min.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), min.Y(), max.Z()});
+    // line 8
+    points.push_back({min.X(), max.Y(), max.Z()});
+    points.push_back({min.X(), min.Y(), max.Z()});
 
-  // line 6
-  this->dataPtr->wireBox->AddPoint({max.X(), min.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), max.Y(), min.Z()});
+    // line 9
+    points.push_back({max.X(), max.Y(), min.Z()});
+    points.push_back({max.X(), max.Y(), max.Z()});
 
-  // line 7
-  this->dataPtr->wireBox->AddPoint({min.X(), max.Y(), max.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), max.Y(), max.Z()});
+    // line 10
+    points.push_back({max.X(), min.Y(), max.Z()});
+    points.push_back({max.X(), max.Y(), max.Z()});
 
-  // line 8
-  this->dataPtr->wireBox->AddPoint({min.X(), max.Y(), max.Z()});
-  this->dataPtr->wireBox->AddPoint({min.X(), min.Y(), max.Z()});
+    // line 11
+    points.push_back({min.X(), min.Y(), max.Z()});
+    points.push_back({max.X(), min.Y(), max.Z()});
 
-  // line 9
-  this->dataPtr->wireBox->AddPoint({max.X(), max.Y(), min.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), max.Y(), max.Z()});
+    return points;
+  });
+  if (wireBoxMeshName.empty())
+    return;
 
-  // line 10
-  this->dataPtr->wireBox->AddPoint({max.X(), min.Y(), max.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), max.Y(), max.Z()});
+  // nothing to do if the change does not affect the shared mesh
+  if (this->dataPtr->wireBox && wireBoxMeshName == this->dataPtr->meshName)
+  {
+    cache->Release(wireBoxMeshName);
+    return;
+  }
+
+  MeshDescriptor meshDescriptor;
+  meshDescriptor.mesh =
+      common::MeshManager::Instance()->MeshByName(wireBoxMeshName);
 
-  // line 11
-  this->dataPtr->wireBox->AddPoint({min.X(), min.Y(), max.Z()});
-  this->dataPtr->wireBox->AddPoint({max.X(), min.Y(), max.Z()});
+  auto visual = std::dynamic_pointer_cast<Ogre2Visual>(this->Parent());
 
-  this->dataPtr->wireBox->Update();
+  // clear geom if needed
+  if (this->dataPtr->wireBox)
+  {
+    if (visual)
+    {
+      visual->RemoveGeometry(
+          std::dynamic_pointer_cast<Geometry>(shared_from_this()));
+    }
+    this->dataPtr->wireBox->Destroy();
+  }
+
+  // the old mesh can only be released once its ogre item is destroyed
+  if (!this->dataPtr->meshName.empty())
+    cache->Release(this->dataPtr->meshName);
+  this->dataPtr->meshName = wireBoxMeshName;
+
+  this->dataPtr->wireBox = std::dynamic_pointer_cast<Ogre2Mesh>(
+      this->Scene()->CreateMesh(meshDescriptor));
+  if (this->dataPtr->material)
+    this->dataPtr->wireBox->SetMaterial(this->dataPtr->material, false);
+
+  if (visual)
+  {
+    visual->AddGeometry(
+        std::dynamic_pointer_cast<Geometry>(shared_from_this()));
+  }
 }
 
 //////////////////////////////////////////////////
@@ -151,8 +225,9 @@ void Ogre2WireBox::SetMaterial(MaterialPtr _material, bool _unique)
     return;
   }
 
-  // Set material for the underlying dynamic renderable
-  this->dataPtr->wireBox->SetMaterial(_material, false);
+  // Set material for the underlying mesh
+  if (this->dataPtr->wireBox)
+    this->dataPtr->wireBox->SetMaterial(_material, false);
   this->SetMaterialImpl(derived);
 }
 
@@ -24,7 +24,9 @@ in block
 } inPs;
 
 uniform sampler2D depthTexture;
+#ifndef DEPTH_ONLY
 uniform sampler2D colorTexture;
+#endif
 uniform sampler2D particleTexture;
 uniform sampler2D particleDepthTexture;
 
@@ -35,12 +37,15 @@ uniform float near;
 uniform float far;
 uniform float min;
 uniform float max;
+#ifndef DEPTH_ONLY
 uniform vec3 backgroundColor;
+#endif
 
 uniform float particleStddev;
 uniform float particleScatterRatio;
 uniform float time;
 
+#ifndef DEPTH_ONLY
 float packFloat(vec4 color)
 {
   int rgba = (int(color.x * 255.0) << 24) +
@@ -49,6 +54,7 @@ float packFloat(vec4 color)
              int(color.w * 255.0);
   return intBitsToFloat(rgba);
 }
+#endif
 
 
 // see gaussian_noise_fs.glsl for documentation on the rand and gaussrand
@@ -94,8 +100,10 @@ void main()
   // convert to z up
   vec3 point = vec3(-viewSpacePos.z, -viewSpacePos.x, viewSpacePos.y);
 
+#ifndef DEPTH_ONLY
   // color
   vec4 color = texture(colorTexture, inPs.uv0);
+#endif
 
   // particle mask - color and depth
   vec4 particle = texture(particleTexture, inPs.uv0);
@@ -149,6 +157,7 @@ void main()
     {
       point.x = max;
     }
+#ifndef DEPTH_ONLY
     // clamp to background color only if it is not a particle pixel
     // this is because point.x may have been set to background depth value
     // due to the scatter effect. We should still render particles in the color
@@ -157,6 +166,7 @@ void main()
     {
       color = vec4(backgroundColor, 1.0);
     }
+#endif
   }
   else if (point.x < near + tolerance)
   {
@@ -169,17 +179,24 @@ void main()
       point.x = min;
     }
 
+#ifndef DEPTH_ONLY
     // clamp to background color only if it is not a particle pixel
     if (particle.x < 1e-6)
     {
       color = vec4(backgroundColor, 1.0);
     }
+#endif
   }
 
+#ifdef DEPTH_ONLY
+  // only the first channel is written to the depth only render target
+  fragColor = vec4(point, 0.0);
+#else
   // gamma correct - using same method as:
   // https://bitbucket.org/sinbad/ogre/src/v2-1/Samples/Media/Hlms/Pbs/GLSL/PixelShader_ps.glsl#lines-513
   color = sqrt(color);
 
   float rgba = packFloat(color);
   fragColor = vec4(point, rgba);
+#endif
 }
@@ -52,8 +52,50 @@ uniform sampler2D tex4;
 // cube face 5 -x
 uniform sampler2D tex5;
 
+// layout of the output, see GpuRaysDataFormat
+//   0: range, retro
+//   1: range
+//   2: range, intensity in [0, 255]
+//   3: range in millimeters / 65535, for unsigned normalized 16 bit targets
+uniform int dataFormat;
+
+// noise applied to ranges of rays that hit something, see
+// Ogre2GpuRays::UpdateNoise
+//   noiseEnabled: 1 if noise is enabled
+//   noiseSeed: random seed that changes every frame
+//   noiseMean, noiseStdDev: Gaussian noise added to the range
+//   quantization: ranges are rounded to multiples of it, if not 0
+//   dropout: probability that a ray is dropped and reads outOfRange
+//   rangeMin, rangeMax: sensor range, noisy ranges are clamped to it
+uniform int noiseEnabled;
+uniform int noiseSeed;
+uniform float noiseMean;
+uniform float noiseStdDev;
+uniform float quantization;
+uniform float dropout;
+uniform float rangeMin;
+uniform float rangeMax;
+uniform float outOfRange;
+
 out vec4 fragColor;
 
+#define PI 3.14159265358979323846264
+
+// PCG hash, see "Hash Functions for GPU Rendering", Jarzynski and Olano
+uint hash(uint v)
+{
+  uint state = v * 747796405u + 2891336453u;
+  uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+  return (word >> 22u) ^ word;
+}
+
+// uniform random value in (0, 1], advancing the state
+float rand(inout uint state)
+{
+  state = hash(state);
+  return (float(state >> 8u) + 1.0) / 16777216.0;
+}
+
 vec2 getRange(vec2 uv, sampler2D tex)
 {
   vec2 range = texture(tex, uv).xy;
@@ -90,6 +132,42 @@ void main()
   float range = d.x;
   float retro = d.y;
 
-  fragColor = vec4(range, retro, 0, 1.0);
+  if (noiseEnabled != 0 && range >= rangeMin && range < rangeMax)
+  {
+    // one random sequence per ray and frame
+    uvec2 p = uvec2(gl_FragCoord.xy);
+    uint state = hash(p.x + hash(p.y + hash(uint(noiseSeed))));
+    float u1 = rand(state);
+    float u2 = rand(state);
+    float u3 = rand(state);
+
+    // Box-Muller method for sampling from the normal distribution
+    range += noiseMean +
+        noiseStdDev * sqrt(-2.0 * log(u1)) * cos(2.0 * PI * u2);
+    if (quantization > 0.0)
+      range = floor(range / quantization + 0.5) * quantization;
+    range = clamp(range, rangeMin, rangeMax);
+
+    if (u3 <= dropout)
+    {
+      range = outOfRange;
+      retro = 0.0;
+    }
+  }
+
+  if (dataFormat == 2)
+  {
+    float intensity = floor(clamp(retro / 2000.0, 0.0, 1.0) * 255.0 + 0.5);
+    fragColor = vec4(range, intensity, 0, 1.0);
+  }
+  else if (dataFormat == 3)
+  {
+    float mm = clamp(floor(range * 1000.0 + 0.5), 0.0, 65535.0);
+    fragColor = vec4(mm / 65535.0, 0, 0, 1.0);
+  }
+  else
+  {
+    fragColor = vec4(range, retro, 0, 1.0);
+  }
   return;
 }
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#version 330
+
+in block
+{
+  vec3 viewPos;
+} inPs;
+
+// unique color of the item, as set by the material switcher
+uniform vec4 inColor;
+
+out vec4 fragColor;
+
+// octahedral encoding of a unit vector
+vec2 encodeNormal(vec3 _n)
+{
+  _n /= abs(_n.x) + abs(_n.y) + abs(_n.z);
+  if (_n.z < 0.0)
+  {
+    vec2 signs = vec2(_n.x >= 0.0 ? 1.0 : -1.0, _n.y >= 0.0 ? 1.0 : -1.0);
+    _n.xy = (1.0 - abs(_n.yx)) * signs;
+  }
+  return _n.xy;
+}
+
+void main()
+{
+  // the color as a 24 bit integer, exact in a 32 bit float
+  float id = dot(floor(inColor.rgb * 255.0 + 0.5),
+      vec3(65536.0, 256.0, 1.0));
+
+  // face normal in view space, towards the camera
+  vec3 normal = normalize(cross(dFdx(inPs.viewPos), dFdy(inPs.viewPos)));
+  if (dot(normal, inPs.viewPos) > 0.0)
+    normal = -normal;
+
+  fragColor = vec4(id, length(inPs.viewPos), encodeNormal(normal));
+}
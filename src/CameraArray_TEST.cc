@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/CameraArray.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class CameraArrayTest : public testing::Test,
+                        public testing::WithParamInterface<const char *>
+{
+  /// \brief Test camera array basic API and atlas layout
+  public: void CameraArray(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void CameraArrayTest::CameraArray(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "CameraArray not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.0, 0.0, 0.0);
+  VisualPtr root = scene->RootVisual();
+
+  CameraArrayPtr cameraArray = scene->CreateCameraArray();
+  ASSERT_NE(nullptr, cameraArray);
+  root->AddChild(cameraArray);
+
+  // default values
+  EXPECT_EQ(0u, cameraArray->ViewCount());
+  EXPECT_EQ(0u, cameraArray->ColumnCount());
+  EXPECT_EQ(0u, cameraArray->RowCount());
+  EXPECT_EQ(PF_R8G8B8, cameraArray->ImageFormat());
+  EXPECT_EQ(nullptr, cameraArray->Data());
+
+  // layout is as square as possible
+  cameraArray->SetViewCount(5u);
+  EXPECT_EQ(5u, cameraArray->ViewCount());
+  EXPECT_EQ(3u, cameraArray->ColumnCount());
+  EXPECT_EQ(2u, cameraArray->RowCount());
+  cameraArray->SetViewCount(16u);
+  EXPECT_EQ(4u, cameraArray->ColumnCount());
+  EXPECT_EQ(4u, cameraArray->RowCount());
+
+  // invalid values are ignored
+  cameraArray->SetImageWidth(32u);
+  cameraArray->SetImageHeight(24u);
+  cameraArray->SetImageWidth(0u);
+  cameraArray->SetImageHeight(0u);
+  EXPECT_EQ(32u, cameraArray->ImageWidth());
+  EXPECT_EQ(24u, cameraArray->ImageHeight());
+
+  math::Pose3d pose(1, 2, 3, 0, 0, 1.57);
+  cameraArray->SetViewPose(16u, pose);
+  EXPECT_EQ(math::Pose3d::Zero, cameraArray->ViewPose(16u));
+
+  cameraArray->SetHFOV(math::Angle(1.0));
+  EXPECT_DOUBLE_EQ(1.0, cameraArray->HFOV().Radian());
+  cameraArray->SetNearClipPlane(0.1);
+  EXPECT_DOUBLE_EQ(0.1, cameraArray->NearClipPlane());
+  cameraArray->SetFarClipPlane(100.0);
+  EXPECT_DOUBLE_EQ(100.0, cameraArray->FarClipPlane());
+
+  // a red box in front of the first view only, all other views look away
+  // from it
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetAmbient(1.0, 0.0, 0.0);
+  red->SetDiffuse(1.0, 0.0, 0.0);
+  red->SetEmissive(1.0, 0.0, 0.0);
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetMaterial(red);
+  box->SetLocalPosition(2.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  cameraArray->SetViewCount(3u);
+  cameraArray->SetViewPose(0u, math::Pose3d::Zero);
+  cameraArray->SetViewPose(1u, math::Pose3d(0, 0, 0, 0, 0, IGN_PI));
+  cameraArray->SetViewPose(2u, math::Pose3d(0, 0, 0, 0, 0, IGN_PI * 0.5));
+  EXPECT_EQ(math::Pose3d(0, 0, 0, 0, 0, IGN_PI), cameraArray->ViewPose(1u));
+
+  unsigned int width = cameraArray->ImageWidth();
+  unsigned int height = cameraArray->ImageHeight();
+  std::vector<unsigned int> centerRed(cameraArray->ViewCount(), 0u);
+  std::vector<unsigned int> strides(cameraArray->ViewCount(), 0u);
+  unsigned int frames = 0u;
+  common::ConnectionPtr connection = cameraArray->ConnectNewImageFrame(
+      [&](const unsigned char *_data, unsigned int _view,
+          unsigned int _width, unsigned int _height, unsigned int _stride,
+          PixelFormat _format)
+      {
+        EXPECT_EQ(width, _width);
+        EXPECT_EQ(height, _height);
+        EXPECT_EQ(PF_R8G8B8, _format);
+        ASSERT_LT(_view, centerRed.size());
+        unsigned int idx = (_height / 2) * _stride + (_width / 2) * 3;
+        centerRed[_view] = _data[idx];
+        strides[_view] = _stride;
+        if (_view == 0u)
+          ++frames;
+      });
+
+  cameraArray->Update();
+  EXPECT_EQ(1u, frames);
+  ASSERT_NE(nullptr, cameraArray->Data());
+
+  // views share the rows of the atlas
+  for (auto stride : strides)
+    EXPECT_EQ(cameraArray->ColumnCount() * width * 3u, stride);
+
+  EXPECT_GT(centerRed[0], 200u);
+  EXPECT_LT(centerRed[1], 50u);
+  EXPECT_LT(centerRed[2], 50u);
+
+  // moving a view updates it without changing the layout
+  cameraArray->SetViewPose(1u, math::Pose3d::Zero);
+  cameraArray->Update();
+  EXPECT_EQ(2u, frames);
+  EXPECT_GT(centerRed[1], 200u);
+
+  // Clean up
+  connection.reset();
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CameraArrayTest, CameraArray)
+{
+  CameraArray(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(CameraArray, CameraArrayTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
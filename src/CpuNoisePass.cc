@@ -0,0 +1,458 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/CpuNoisePass.hh"
+
+/// \brief Private data for the CpuNoisePass class
+class ignition::rendering::CpuNoisePassPrivate
+{
+  /// \brief State of a wrapped frame callback
+  public: template <typename T>
+  struct Wrapper
+  {
+    /// \brief Copy of the frame noise is added to
+    std::vector<T> buffer;
+
+    /// \brief Number of the next frame
+    uint64_t frame = 0u;
+  };
+
+  /// \brief Draw the bias from the bias mean and standard deviation
+  public: void SampleBias();
+
+  /// \brief Add noise to a buffer in place
+  /// \param[in,out] _data Buffer of _count elements of _channels values
+  /// \param[in] _count Number of elements
+  /// \param[in] _channels Number of values per element
+  /// \param[in] _frame Frame number the noise is drawn for
+  public: template <typename T>
+  void Apply(T *_data, std::size_t _count, unsigned int _channels,
+      uint64_t _frame) const;
+
+  /// \brief Add noise to a range of noise indices on the calling thread
+  /// \param[in,out] _data Buffer noise is added to
+  /// \param[in] _stride Number of values between two noise indices
+  /// \param[in] _offset Offset of the first noisy value
+  /// \param[in] _begin First noise index
+  /// \param[in] _end Noise index past the last one
+  /// \param[in] _frame Frame number the noise is drawn for
+  public: template <typename T>
+  void ApplyRange(T *_data, std::size_t _stride, std::size_t _offset,
+      std::size_t _begin, std::size_t _end, uint64_t _frame) const;
+
+  /// \brief Generator of the noise
+  public: NoiseGenerator generator;
+
+  /// \brief Mean of the Gaussian noise
+  public: double mean = 0.0;
+
+  /// \brief Standard deviation of the Gaussian noise
+  public: double stdDev = 0.0;
+
+  /// \brief Bias added to all values
+  public: double bias = 0.0;
+
+  /// \brief Mean of the bias
+  public: double biasMean = 0.0;
+
+  /// \brief Standard deviation of the bias
+  public: double biasStdDev = 0.0;
+
+  /// \brief Amplitude of the uniform noise
+  public: double amplitude = 0.0;
+
+  /// \brief Quantization step
+  public: double step = 0.0;
+
+  /// \brief Minimum value
+  public: double min = -std::numeric_limits<double>::infinity();
+
+  /// \brief Maximum value
+  public: double max = std::numeric_limits<double>::infinity();
+
+  /// \brief Channel noise is added to, -1 for all channels
+  public: int channel = -1;
+
+  /// \brief Number of threads, 0 for one per hardware thread
+  public: unsigned int threadCount = 1u;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Number of values generated at a time
+  const std::size_t kTileSize = 256u;
+
+  /// \brief Smallest number of values worth splitting between threads
+  const std::size_t kMinThreadValues = 65536u;
+
+  /// \brief Offset of the indices of the uniform noise, so that it does not
+  /// use the same counters as the Gaussian noise
+  const uint64_t kUniformIndexOffset = 1ull << 62;
+
+  /// \brief Frame the bias is drawn for, not used by sensor frames in
+  /// practice
+  const uint64_t kBiasFrame = std::numeric_limits<uint64_t>::max();
+
+  /// \brief Convert a noisy value back to the buffer type
+  /// \param[in] _value Noisy value
+  /// \return Value of the buffer type
+  template <typename T>
+  T Store(float _value)
+  {
+    if constexpr (std::is_floating_point<T>::value)
+    {
+      return static_cast<T>(_value);
+    }
+    else
+    {
+      _value = std::min(std::max(_value,
+          static_cast<float>(std::numeric_limits<T>::lowest())),
+          static_cast<float>(std::numeric_limits<T>::max()));
+      return static_cast<T>(std::lround(_value));
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePassPrivate::SampleBias()
+{
+  float values[2];
+  this->generator.Gaussian(kBiasFrame, 0u, values, 1u);
+  this->generator.Uniform(kBiasFrame, kUniformIndexOffset, values + 1, 1u);
+  this->bias = this->biasMean + this->biasStdDev * values[0];
+  // With equal probability, we pick a negative bias as GaussianNoisePass
+  // does
+  if (values[1] < 0.5f)
+    this->bias = -this->bias;
+}
+
+//////////////////////////////////////////////////
+template <typename T>
+void CpuNoisePassPrivate::Apply(T *_data, std::size_t _count,
+    unsigned int _channels, uint64_t _frame) const
+{
+  if (!_data || _count == 0u || _channels == 0u)
+    return;
+
+  // noise index i is the value index when all channels are noisy, and the
+  // element index when only one is
+  std::size_t stride = 1u;
+  std::size_t offset = 0u;
+  std::size_t total = _count * _channels;
+  if (this->channel >= 0)
+  {
+    if (static_cast<unsigned int>(this->channel) >= _channels)
+    {
+      ignerr << "Noise channel [" << this->channel << "] is out of range, "
+             << "data has [" << _channels << "] channels" << std::endl;
+      return;
+    }
+    stride = _channels;
+    offset = static_cast<std::size_t>(this->channel);
+    total = _count;
+  }
+
+  unsigned int threads = this->threadCount;
+  if (threads == 0u)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  threads = static_cast<unsigned int>(std::min<std::size_t>(threads,
+      std::max<std::size_t>(1u, total / kMinThreadValues)));
+
+  if (threads <= 1u)
+  {
+    this->ApplyRange(_data, stride, offset, 0u, total, _frame);
+    return;
+  }
+
+  std::size_t chunk = (total + threads - 1u) / threads;
+  std::vector<std::thread> workers;
+  for (unsigned int t = 1u; t < threads; ++t)
+  {
+    std::size_t begin = std::min(total, t * chunk);
+    std::size_t end = std::min(total, begin + chunk);
+    workers.emplace_back([=]()
+        {
+          this->ApplyRange(_data, stride, offset, begin, end, _frame);
+        });
+  }
+  this->ApplyRange(_data, stride, offset, 0u, std::min(total, chunk),
+      _frame);
+  for (auto &worker : workers)
+    worker.join();
+}
+
+//////////////////////////////////////////////////
+template <typename T>
+void CpuNoisePassPrivate::ApplyRange(T *_data, std::size_t _stride,
+    std::size_t _offset, std::size_t _begin, std::size_t _end,
+    uint64_t _frame) const
+{
+  const bool gaussian = this->stdDev > 0.0;
+  const bool uniform = this->amplitude > 0.0;
+  const bool quantize = this->step > 0.0;
+  const float base = static_cast<float>(
+      this->bias + (gaussian ? 0.0 : this->mean));
+  const float amplitude = static_cast<float>(this->amplitude);
+  const float step = static_cast<float>(this->step);
+  const float min = static_cast<float>(this->min);
+  const float max = static_cast<float>(this->max);
+
+  float noise[kTileSize];
+  float uniformNoise[kTileSize];
+  for (std::size_t first = _begin; first < _end; first += kTileSize)
+  {
+    std::size_t n = std::min(kTileSize, _end - first);
+    if (gaussian)
+    {
+      this->generator.Gaussian(_frame, first, noise, n,
+          static_cast<float>(this->mean), static_cast<float>(this->stdDev));
+    }
+    else
+    {
+      std::fill(noise, noise + n, 0.0f);
+    }
+    if (uniform)
+    {
+      this->generator.Uniform(_frame, kUniformIndexOffset + first,
+          uniformNoise, n);
+      for (std::size_t i = 0; i < n; ++i)
+        noise[i] += amplitude * (2.0f * uniformNoise[i] - 1.0f);
+    }
+
+    T *values = _data + first * _stride + _offset;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      T &value = values[i * _stride];
+      float noisy = static_cast<float>(value);
+      if (!std::isfinite(noisy))
+        continue;
+
+      noisy += base + noise[i];
+      if (quantize)
+        noisy = std::round(noisy / step) * step;
+      noisy = std::min(std::max(noisy, min), max);
+      value = Store<T>(noisy);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+CpuNoisePass::CpuNoisePass(uint64_t _seed)
+  : dataPtr(new CpuNoisePassPrivate)
+{
+  this->dataPtr->generator.SetSeed(_seed);
+}
+
+//////////////////////////////////////////////////
+CpuNoisePass::~CpuNoisePass() = default;
+
+//////////////////////////////////////////////////
+const NoiseGenerator &CpuNoisePass::Generator() const
+{
+  return this->dataPtr->generator;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetSeed(uint64_t _seed)
+{
+  this->dataPtr->generator.SetSeed(_seed);
+  this->dataPtr->SampleBias();
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::Mean() const
+{
+  return this->dataPtr->mean;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetMean(double _mean)
+{
+  this->dataPtr->mean = _mean;
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::StdDev() const
+{
+  return this->dataPtr->stdDev;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetStdDev(double _stdDev)
+{
+  this->dataPtr->stdDev = _stdDev;
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::Bias() const
+{
+  return this->dataPtr->bias;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetBiasMean(double _biasMean)
+{
+  this->dataPtr->biasMean = _biasMean;
+  this->dataPtr->SampleBias();
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetBiasStdDev(double _biasStdDev)
+{
+  this->dataPtr->biasStdDev = _biasStdDev;
+  this->dataPtr->SampleBias();
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::UniformAmplitude() const
+{
+  return this->dataPtr->amplitude;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetUniformAmplitude(double _amplitude)
+{
+  this->dataPtr->amplitude = _amplitude;
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::Quantization() const
+{
+  return this->dataPtr->step;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetQuantization(double _step)
+{
+  this->dataPtr->step = _step;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetClamp(double _min, double _max)
+{
+  if (_min > _max)
+  {
+    ignerr << "Invalid noise clamp range [" << _min << ", " << _max << "]"
+           << std::endl;
+    return;
+  }
+  this->dataPtr->min = _min;
+  this->dataPtr->max = _max;
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::ClampMin() const
+{
+  return this->dataPtr->min;
+}
+
+//////////////////////////////////////////////////
+double CpuNoisePass::ClampMax() const
+{
+  return this->dataPtr->max;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetChannel(int _channel)
+{
+  this->dataPtr->channel = std::max(-1, _channel);
+}
+
+//////////////////////////////////////////////////
+int CpuNoisePass::Channel() const
+{
+  return this->dataPtr->channel;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::SetThreadCount(unsigned int _count)
+{
+  this->dataPtr->threadCount = _count;
+}
+
+//////////////////////////////////////////////////
+unsigned int CpuNoisePass::ThreadCount() const
+{
+  return this->dataPtr->threadCount;
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::Apply(float *_data, std::size_t _count,
+    unsigned int _channels, uint64_t _frame) const
+{
+  this->dataPtr->Apply(_data, _count, _channels, _frame);
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::Apply(uint16_t *_data, std::size_t _count,
+    unsigned int _channels, uint64_t _frame) const
+{
+  this->dataPtr->Apply(_data, _count, _channels, _frame);
+}
+
+//////////////////////////////////////////////////
+void CpuNoisePass::Apply(uint8_t *_data, std::size_t _count,
+    unsigned int _channels, uint64_t _frame) const
+{
+  this->dataPtr->Apply(_data, _count, _channels, _frame);
+}
+
+//////////////////////////////////////////////////
+CpuNoisePass::FloatFrameCallback CpuNoisePass::WrapFloatFrame(
+    FloatFrameCallback _callback)
+{
+  auto state = std::make_shared<CpuNoisePassPrivate::Wrapper<float>>();
+  return [this, state, _callback](const float *_frame, unsigned int _width,
+      unsigned int _height, unsigned int _channels,
+      const std::string &_format)
+  {
+    std::size_t count = static_cast<std::size_t>(_width) * _height;
+    state->buffer.assign(_frame, _frame + count * _channels);
+    this->Apply(state->buffer.data(), count, _channels, state->frame++);
+    _callback(state->buffer.data(), _width, _height, _channels, _format);
+  };
+}
+
+//////////////////////////////////////////////////
+CpuNoisePass::U16FrameCallback CpuNoisePass::WrapU16Frame(
+    U16FrameCallback _callback)
+{
+  auto state = std::make_shared<CpuNoisePassPrivate::Wrapper<uint16_t>>();
+  return [this, state, _callback](const uint16_t *_frame,
+      unsigned int _width, unsigned int _height, unsigned int _channels,
+      const std::string &_format)
+  {
+    std::size_t count = static_cast<std::size_t>(_width) * _height;
+    state->buffer.assign(_frame, _frame + count * _channels);
+    this->Apply(state->buffer.data(), count, _channels, state->frame++);
+    _callback(state->buffer.data(), _width, _height, _channels, _format);
+  };
+}
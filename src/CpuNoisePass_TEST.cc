@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/CpuNoisePass.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(CpuNoisePassTest, Properties)
+{
+  CpuNoisePass pass;
+  EXPECT_DOUBLE_EQ(0.0, pass.Mean());
+  EXPECT_DOUBLE_EQ(0.0, pass.StdDev());
+  EXPECT_DOUBLE_EQ(0.0, pass.Bias());
+  EXPECT_DOUBLE_EQ(0.0, pass.UniformAmplitude());
+  EXPECT_DOUBLE_EQ(0.0, pass.Quantization());
+  EXPECT_EQ(-1, pass.Channel());
+  EXPECT_TRUE(std::isinf(pass.ClampMin()));
+  EXPECT_TRUE(std::isinf(pass.ClampMax()));
+
+  pass.SetMean(0.1);
+  EXPECT_DOUBLE_EQ(0.1, pass.Mean());
+  pass.SetStdDev(0.2);
+  EXPECT_DOUBLE_EQ(0.2, pass.StdDev());
+  pass.SetUniformAmplitude(0.3);
+  EXPECT_DOUBLE_EQ(0.3, pass.UniformAmplitude());
+  pass.SetQuantization(0.01);
+  EXPECT_DOUBLE_EQ(0.01, pass.Quantization());
+  pass.SetChannel(0);
+  EXPECT_EQ(0, pass.Channel());
+  pass.SetThreadCount(4u);
+  EXPECT_EQ(4u, pass.ThreadCount());
+
+  pass.SetClamp(1.0, 2.0);
+  EXPECT_DOUBLE_EQ(1.0, pass.ClampMin());
+  EXPECT_DOUBLE_EQ(2.0, pass.ClampMax());
+  // invalid range is ignored
+  pass.SetClamp(3.0, 2.0);
+  EXPECT_DOUBLE_EQ(1.0, pass.ClampMin());
+  EXPECT_DOUBLE_EQ(2.0, pass.ClampMax());
+
+  // bias without deviation is the bias mean with a random sign
+  pass.SetBiasMean(0.5);
+  EXPECT_DOUBLE_EQ(0.5, std::abs(pass.Bias()));
+  pass.SetBiasStdDev(0.1);
+  double bias = pass.Bias();
+  pass.SetBiasStdDev(0.1);
+  EXPECT_DOUBLE_EQ(bias, pass.Bias());
+}
+
+/////////////////////////////////////////////////
+TEST(CpuNoisePassTest, ThreadCount)
+{
+  const std::size_t count = 300001u;
+  std::vector<float> input(count);
+  for (std::size_t i = 0; i < count; ++i)
+    input[i] = static_cast<float>(i % 100u);
+
+  CpuNoisePass pass(3u);
+  pass.SetStdDev(0.1);
+  pass.SetUniformAmplitude(0.05);
+
+  std::vector<float> single = input;
+  pass.SetThreadCount(1u);
+  pass.Apply(single.data(), count, 1u, 5u);
+  EXPECT_NE(input, single);
+
+  for (unsigned int threads : {0u, 2u, 3u, 7u})
+  {
+    std::vector<float> multi = input;
+    pass.SetThreadCount(threads);
+    pass.Apply(multi.data(), count, 1u, 5u);
+    EXPECT_EQ(single, multi) << threads;
+  }
+}
+
+/////////////////////////////////////////////////
+TEST(CpuNoisePassTest, Apply)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+
+  // noise only on the range of 3 channel gpu rays readings, with infinite
+  // ranges untouched
+  std::vector<float> rays = {1.0f, 0.5f, 0.0f, inf, 0.5f, 0.0f,
+      2.0f, 0.5f, 0.0f, -inf, 0.5f, 0.0f};
+  CpuNoisePass pass;
+  pass.SetStdDev(0.1);
+  pass.SetQuantization(0.01);
+  pass.SetChannel(0);
+  pass.Apply(rays.data(), 4u, 3u, 0u);
+  EXPECT_NE(1.0f, rays[0]);
+  EXPECT_NEAR(1.0f, rays[0], 1.0f);
+  EXPECT_FLOAT_EQ(std::round(rays[0] * 100.0f) / 100.0f, rays[0]);
+  EXPECT_EQ(inf, rays[3]);
+  EXPECT_EQ(-inf, rays[9]);
+  for (std::size_t i = 0; i < rays.size(); i += 3u)
+  {
+    EXPECT_FLOAT_EQ(0.5f, rays[i + 1u]);
+    EXPECT_FLOAT_EQ(0.0f, rays[i + 2u]);
+  }
+
+  // a channel out of range leaves the data unchanged
+  std::vector<float> one = {1.0f, 2.0f};
+  pass.SetChannel(1);
+  pass.Apply(one.data(), 2u, 1u, 0u);
+  EXPECT_FLOAT_EQ(1.0f, one[0]);
+  EXPECT_FLOAT_EQ(2.0f, one[1]);
+
+  // integer buffers are rounded and clamped to their type
+  CpuNoisePass intPass;
+  intPass.SetMean(1000.0);
+  std::vector<uint16_t> thermal = {100u, 65000u};
+  intPass.Apply(thermal.data(), 2u, 1u, 0u);
+  EXPECT_EQ(1100u, thermal[0]);
+  EXPECT_EQ(65535u, thermal[1]);
+
+  intPass.SetMean(-10.0);
+  intPass.SetClamp(0.0, 200.0);
+  std::vector<uint8_t> image = {5u, 100u, 255u};
+  intPass.Apply(image.data(), 1u, 3u, 0u);
+  EXPECT_EQ(0u, image[0]);
+  EXPECT_EQ(90u, image[1]);
+  EXPECT_EQ(200u, image[2]);
+}
+
+/////////////////////////////////////////////////
+TEST(CpuNoisePassTest, WrapFrame)
+{
+  CpuNoisePass pass(9u);
+  pass.SetStdDev(0.5);
+
+  std::vector<std::vector<float>> received;
+  auto callback = pass.WrapFloatFrame(
+      [&received](const float *_frame, unsigned int _width,
+          unsigned int _height, unsigned int _channels, const std::string &)
+      {
+        received.emplace_back(_frame, _frame + _width * _height * _channels);
+      });
+
+  std::vector<float> frame(16u, 1.0f);
+  callback(frame.data(), 4u, 2u, 2u, "FLOAT32");
+  callback(frame.data(), 4u, 2u, 2u, "FLOAT32");
+  ASSERT_EQ(2u, received.size());
+
+  // the source frame is not modified and each frame gets its own noise
+  EXPECT_EQ(std::vector<float>(16u, 1.0f), frame);
+  EXPECT_NE(frame, received[0]);
+  EXPECT_NE(received[0], received[1]);
+
+  // frames are numbered from 0
+  std::vector<float> expected = frame;
+  pass.Apply(expected.data(), 8u, 2u, 1u);
+  EXPECT_EQ(expected, received[1]);
+
+  unsigned int count = 0u;
+  auto thermalCallback = pass.WrapU16Frame(
+      [&count](const uint16_t *_frame, unsigned int, unsigned int,
+          unsigned int, const std::string &)
+      {
+        ++count;
+        EXPECT_NE(nullptr, _frame);
+      });
+  std::vector<uint16_t> thermal(4u, 30000u);
+  thermalCallback(thermal.data(), 2u, 2u, 1u, "L16");
+  EXPECT_EQ(1u, count);
+}
@@ -0,0 +1,439 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <FreeImage.h>
+
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/FrameSaver.hh"
+
+/// \brief Private data for the FrameSaver class
+class ignition::rendering::FrameSaverPrivate
+{
+  /// \brief A frame waiting to be written
+  public: struct Frame
+  {
+    /// \brief Image to write, shares the buffer of the saved image
+    Image image;
+
+    /// \brief Name of the output file
+    std::string filename;
+  };
+
+  /// \brief Worker thread loop, writes queued frames until stopped
+  public: void Run();
+
+  /// \brief Frames waiting to be written
+  public: std::deque<Frame> queue;
+
+  /// \brief Maximum number of frames in the queue
+  public: unsigned int queueSize = 16u;
+
+  /// \brief Number of frames being written by the workers
+  public: unsigned int busyCount = 0u;
+
+  /// \brief Number of frames written
+  public: uint64_t savedCount = 0u;
+
+  /// \brief Number of frames that could not be written
+  public: uint64_t failedCount = 0u;
+
+  /// \brief Number of frames dropped because the queue was full
+  public: uint64_t droppedCount = 0u;
+
+  /// \brief How long Save waits for room in a full queue
+  public: std::chrono::milliseconds maxWait{1000};
+
+  /// \brief True when the workers should exit once the queue is empty
+  public: bool stop = false;
+
+  /// \brief Encoder threads
+  public: std::vector<std::thread> workers;
+
+  /// \brief Mutex protecting the members above
+  public: mutable std::mutex mutex;
+
+  /// \brief Notified when a frame is queued or the workers should stop
+  public: std::condition_variable frameQueued;
+
+  /// \brief Notified when a worker takes a frame from the queue
+  public: std::condition_variable frameTaken;
+
+  /// \brief Notified when a worker finished writing a frame
+  public: std::condition_variable frameDone;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Write an 8 or 16 bit image through FreeImage
+  /// \param[in] _image Image to write
+  /// \param[in] _filename Name of the output file
+  /// \param[in] _fif Output file format, PNG or JPEG
+  /// \return True on success
+  bool WriteFreeImage(const Image &_image, const std::string &_filename,
+      FREE_IMAGE_FORMAT _fif)
+  {
+    unsigned int width = _image.Width();
+    unsigned int height = _image.Height();
+    const unsigned char *data = _image.Data<unsigned char>();
+
+    // FreeImage stores rows bottom up and 24 bit pixels in its own
+    // channel order
+    FIBITMAP *bitmap = nullptr;
+    switch (_image.Format())
+    {
+      case PF_L8:
+      case PF_BAYER_RGGB8:
+      case PF_BAYER_BGGR8:
+      case PF_BAYER_GBGR8:
+      case PF_BAYER_GRGB8:
+        bitmap = FreeImage_Allocate(width, height, 8);
+        for (unsigned int y = 0; bitmap && y < height; ++y)
+        {
+          std::memcpy(FreeImage_GetScanLine(bitmap, height - 1u - y),
+              data + y * _image.Stride(), width);
+        }
+        break;
+      case PF_R8G8B8:
+      case PF_B8G8R8:
+      {
+        bool rgb = _image.Format() == PF_R8G8B8;
+        bitmap = FreeImage_Allocate(width, height, 24);
+        for (unsigned int y = 0; bitmap && y < height; ++y)
+        {
+          const unsigned char *src = data + y * _image.Stride();
+          BYTE *dst = FreeImage_GetScanLine(bitmap, height - 1u - y);
+          for (unsigned int x = 0; x < width; ++x, src += 3, dst += 3)
+          {
+            dst[FI_RGBA_RED] = rgb ? src[0] : src[2];
+            dst[FI_RGBA_GREEN] = src[1];
+            dst[FI_RGBA_BLUE] = rgb ? src[2] : src[0];
+          }
+        }
+        break;
+      }
+      case PF_L16:
+        if (_fif != FIF_PNG)
+          break;
+        bitmap = FreeImage_AllocateT(FIT_UINT16, width, height, 16);
+        for (unsigned int y = 0; bitmap && y < height; ++y)
+        {
+          std::memcpy(FreeImage_GetScanLine(bitmap, height - 1u - y),
+              data + y * _image.Stride(), width * 2u);
+        }
+        break;
+      default:
+        break;
+    }
+
+    if (!bitmap)
+    {
+      ignerr << "Unable to save frame [" << _filename << "]: pixel format ["
+             << PixelUtil::Name(_image.Format())
+             << "] is not supported by this file format" << std::endl;
+      return false;
+    }
+
+    // favor speed over size, frames are saved while rendering
+    int flags = _fif == FIF_PNG ? PNG_Z_BEST_SPEED : JPEG_QUALITYGOOD;
+    bool result = FreeImage_Save(_fif, bitmap, _filename.c_str(), flags);
+    FreeImage_Unload(bitmap);
+    if (!result)
+      ignerr << "Unable to save frame [" << _filename << "]" << std::endl;
+    return result;
+  }
+
+  /// \brief Write a float image as a portable float map
+  /// \param[in] _image Image to write
+  /// \param[in] _filename Name of the output file
+  /// \return True on success
+  bool WritePfm(const Image &_image, const std::string &_filename)
+  {
+    unsigned int srcChannels = PixelUtil::ChannelCount(_image.Format());
+    if (PixelUtil::BytesPerChannel(_image.Format()) != sizeof(float))
+    {
+      ignerr << "Unable to save frame [" << _filename << "]: PFM files "
+             << "require a float pixel format" << std::endl;
+      return false;
+    }
+
+    std::ofstream out(_filename, std::ios::binary);
+    if (!out)
+    {
+      ignerr << "Unable to open [" << _filename << "] for writing"
+             << std::endl;
+      return false;
+    }
+
+    // grayscale or RGB, alpha is discarded. A negative scale marks little
+    // endian data
+    unsigned int channels = srcChannels == 1u ? 1u : 3u;
+    const uint16_t one = 1u;
+    bool littleEndian = *reinterpret_cast<const uint8_t *>(&one) == 1u;
+    unsigned int width = _image.Width();
+    unsigned int height = _image.Height();
+    out << (channels == 1u ? "Pf" : "PF") << "\n" << width << " " << height
+        << "\n" << (littleEndian ? "-1.0" : "1.0") << "\n";
+
+    // rows are stored bottom up
+    const unsigned char *data = _image.Data<unsigned char>();
+    std::vector<float> row(width * channels);
+    for (unsigned int y = height; y > 0u; --y)
+    {
+      const float *src = reinterpret_cast<const float *>(
+          data + (y - 1u) * _image.Stride());
+      for (unsigned int x = 0; x < width; ++x)
+      {
+        for (unsigned int c = 0; c < channels; ++c)
+          row[x * channels + c] = src[x * srcChannels + c];
+      }
+      out.write(reinterpret_cast<const char *>(row.data()),
+          row.size() * sizeof(float));
+    }
+
+    if (!out)
+    {
+      ignerr << "Unable to save frame [" << _filename << "]" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /// \brief Write the pixels of an image as they are in memory
+  /// \param[in] _image Image to write
+  /// \param[in] _filename Name of the output file
+  /// \return True on success
+  bool WriteRaw(const Image &_image, const std::string &_filename)
+  {
+    std::ofstream out(_filename, std::ios::binary);
+    if (!out)
+    {
+      ignerr << "Unable to open [" << _filename << "] for writing"
+             << std::endl;
+      return false;
+    }
+
+    std::size_t rowSize =
+        _image.Width() * PixelUtil::BytesPerPixel(_image.Format());
+    const char *data = reinterpret_cast<const char *>(_image.Data());
+    for (unsigned int y = 0; y < _image.Height(); ++y)
+      out.write(data + y * _image.Stride(), rowSize);
+
+    if (!out)
+    {
+      ignerr << "Unable to save frame [" << _filename << "]" << std::endl;
+      return false;
+    }
+    return true;
+  }
+}
+
+//////////////////////////////////////////////////
+void FrameSaverPrivate::Run()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->frameQueued.wait(lock, [this]
+        {
+          return this->stop || !this->queue.empty();
+        });
+
+    // stopping, the remaining frames have been written
+    if (this->queue.empty())
+      return;
+
+    Frame frame = std::move(this->queue.front());
+    this->queue.pop_front();
+    ++this->busyCount;
+    this->frameTaken.notify_one();
+
+    lock.unlock();
+    bool result = FrameSaver::Write(frame.image, frame.filename);
+    // give the buffer back before waking up anyone waiting on the frame
+    frame.image = Image();
+    lock.lock();
+
+    --this->busyCount;
+    if (result)
+      ++this->savedCount;
+    else
+      ++this->failedCount;
+    this->frameDone.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+FrameSaver::FrameSaver(unsigned int _workerCount, unsigned int _queueSize)
+  : dataPtr(std::make_unique<FrameSaverPrivate>())
+{
+  this->dataPtr->queueSize = std::max(_queueSize, 1u);
+  for (unsigned int i = 0; i < std::max(_workerCount, 1u); ++i)
+  {
+    this->dataPtr->workers.emplace_back(
+        &FrameSaverPrivate::Run, this->dataPtr.get());
+  }
+}
+
+//////////////////////////////////////////////////
+FrameSaver::~FrameSaver()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->frameQueued.notify_all();
+  for (auto &worker : this->dataPtr->workers)
+    worker.join();
+}
+
+//////////////////////////////////////////////////
+FrameSaver &FrameSaver::Default()
+{
+  static FrameSaver saver;
+  return saver;
+}
+
+//////////////////////////////////////////////////
+bool FrameSaver::Save(const Image &_image, const std::string &_filename)
+{
+  if (!_image.Data() || _filename.empty())
+  {
+    ignerr << "Unable to save frame [" << _filename << "]: "
+           << "invalid image or file name" << std::endl;
+    return false;
+  }
+
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  auto hasRoom = [this]
+      {
+        return this->dataPtr->queue.size() < this->dataPtr->queueSize;
+      };
+  if (!this->dataPtr->frameTaken.wait_for(lock, this->dataPtr->maxWait,
+      hasRoom))
+  {
+    // warn once, the count tells how many followed
+    if (this->dataPtr->droppedCount++ == 0u)
+    {
+      ignwarn << "Frames are saved slower than they are rendered, dropping "
+              << "frame [" << _filename << "]" << std::endl;
+    }
+    return false;
+  }
+
+  this->dataPtr->queue.push_back({_image, _filename});
+  lock.unlock();
+  this->dataPtr->frameQueued.notify_one();
+  return true;
+}
+
+//////////////////////////////////////////////////
+void FrameSaver::SetMaxWait(std::chrono::milliseconds _wait)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->maxWait = _wait;
+}
+
+//////////////////////////////////////////////////
+std::chrono::milliseconds FrameSaver::MaxWait() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->maxWait;
+}
+
+//////////////////////////////////////////////////
+void FrameSaver::Flush()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->frameDone.wait(lock, [this]
+      {
+        return this->dataPtr->queue.empty() && this->dataPtr->busyCount == 0u;
+      });
+}
+
+//////////////////////////////////////////////////
+unsigned int FrameSaver::PendingCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return static_cast<unsigned int>(this->dataPtr->queue.size()) +
+      this->dataPtr->busyCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameSaver::SavedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->savedCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameSaver::FailedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->failedCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameSaver::DroppedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->droppedCount;
+}
+
+//////////////////////////////////////////////////
+bool FrameSaver::Write(const Image &_image, const std::string &_filename)
+{
+  if (!_image.Data())
+  {
+    ignerr << "Unable to save frame [" << _filename << "]: image is empty"
+           << std::endl;
+    return false;
+  }
+
+  std::string extension;
+  std::size_t dot = _filename.find_last_of('.');
+  if (dot != std::string::npos)
+    extension = _filename.substr(dot + 1u);
+  std::transform(extension.begin(), extension.end(), extension.begin(),
+      [](unsigned char _c) { return std::tolower(_c); });
+
+  if (extension == "png")
+    return WriteFreeImage(_image, _filename, FIF_PNG);
+  else if (extension == "jpg" || extension == "jpeg")
+    return WriteFreeImage(_image, _filename, FIF_JPEG);
+  else if (extension == "pfm")
+    return WritePfm(_image, _filename);
+  else if (extension == "raw")
+    return WriteRaw(_image, _filename);
+
+  ignerr << "Unable to save frame [" << _filename << "]: unknown file "
+         << "extension, expected png, jpg, pfm or raw" << std::endl;
+  return false;
+}
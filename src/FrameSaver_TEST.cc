@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <ignition/common/Image.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/FrameSaver.hh"
+#include "ignition/rendering/Image.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Read a whole file
+/// \param[in] _filename File to read
+/// \return Content of the file
+std::string ReadFile(const std::string &_filename)
+{
+  std::ifstream in(_filename, std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(in),
+      std::istreambuf_iterator<char>());
+}
+
+/////////////////////////////////////////////////
+TEST(FrameSaverTest, Png)
+{
+  Image image(4u, 2u, PF_R8G8B8);
+  unsigned char *data = image.Data<unsigned char>();
+  std::memset(data, 0, image.MemorySize());
+  // red left column, blue right column
+  for (unsigned int y = 0; y < 2u; ++y)
+  {
+    data[y * image.Stride()] = 255u;
+    data[y * image.Stride() + 3u * 3u + 2u] = 255u;
+  }
+
+  std::string filename =
+      std::string(PROJECT_BUILD_PATH) + "/frame_saver_test.png";
+  EXPECT_TRUE(FrameSaver::Write(image, filename));
+
+  common::Image saved(filename);
+  EXPECT_EQ(4u, saved.Width());
+  EXPECT_EQ(2u, saved.Height());
+  EXPECT_EQ(math::Color::Red, saved.Pixel(0u, 0u));
+  EXPECT_EQ(math::Color::Red, saved.Pixel(0u, 1u));
+  EXPECT_EQ(math::Color::Blue, saved.Pixel(3u, 1u));
+  EXPECT_EQ(math::Color::Black, saved.Pixel(1u, 0u));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameSaverTest, Pfm)
+{
+  Image image(3u, 2u, PF_FLOAT32_R);
+  float *data = reinterpret_cast<float *>(image.Data());
+  for (unsigned int i = 0; i < 6u; ++i)
+    data[i] = 0.5f * i;
+
+  std::string filename =
+      std::string(PROJECT_BUILD_PATH) + "/frame_saver_test.pfm";
+  EXPECT_TRUE(FrameSaver::Write(image, filename));
+
+  std::string content = ReadFile(filename);
+  const uint16_t one = 1u;
+  bool littleEndian = *reinterpret_cast<const uint8_t *>(&one) == 1u;
+  std::string header =
+      std::string("Pf\n3 2\n") + (littleEndian ? "-1.0\n" : "1.0\n");
+  ASSERT_EQ(header.size() + 6u * sizeof(float), content.size());
+  EXPECT_EQ(header, content.substr(0u, header.size()));
+
+  // rows are stored bottom up
+  float pixels[6];
+  std::memcpy(pixels, content.data() + header.size(), sizeof(pixels));
+  EXPECT_FLOAT_EQ(1.5f, pixels[0]);
+  EXPECT_FLOAT_EQ(2.5f, pixels[2]);
+  EXPECT_FLOAT_EQ(0.0f, pixels[3]);
+  EXPECT_FLOAT_EQ(1.0f, pixels[5]);
+
+  // not a float image
+  EXPECT_FALSE(FrameSaver::Write(Image(3u, 2u, PF_L8), filename));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameSaverTest, Raw)
+{
+  Image image(4u, 3u, PF_L8);
+  unsigned char *data = image.Data<unsigned char>();
+  for (unsigned int i = 0; i < 12u; ++i)
+    data[i] = static_cast<unsigned char>(i);
+
+  // rows of views are packed in the file
+  std::string filename =
+      std::string(PROJECT_BUILD_PATH) + "/frame_saver_test.raw";
+  EXPECT_TRUE(FrameSaver::Write(image.View(1u, 1u, 2u, 2u), filename));
+  EXPECT_EQ(std::string("\x05\x06\x09\x0a", 4u), ReadFile(filename));
+
+  EXPECT_FALSE(FrameSaver::Write(image, "frame_saver_test.unknown"));
+  EXPECT_FALSE(FrameSaver::Write(Image(), filename));
+}
+
+/////////////////////////////////////////////////
+TEST(FrameSaverTest, Queue)
+{
+  const unsigned int count = 20u;
+  std::string prefix = std::string(PROJECT_BUILD_PATH) + "/frame_saver_";
+
+  // waiting for room, every frame is saved
+  {
+    FrameSaver saver(2u, 2u);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      Image image(64u, 64u, PF_FLOAT32_R);
+      std::memset(image.Data(), 0, image.MemorySize());
+      EXPECT_TRUE(saver.Save(image, prefix + std::to_string(i) + ".raw"));
+    }
+    saver.Flush();
+    EXPECT_EQ(0u, saver.PendingCount());
+    EXPECT_EQ(count, saver.SavedCount());
+    EXPECT_EQ(0u, saver.DroppedCount());
+    EXPECT_EQ(0u, saver.FailedCount());
+  }
+
+  // not waiting, frames are dropped once the queue is full
+  {
+    FrameSaver saver(1u, 1u);
+    saver.SetMaxWait(std::chrono::milliseconds(0));
+    EXPECT_EQ(std::chrono::milliseconds(0), saver.MaxWait());
+    Image image(512u, 512u, PF_FLOAT32_RGBA);
+    std::memset(image.Data(), 0, image.MemorySize());
+    unsigned int queued = 0u;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      if (saver.Save(image, prefix + std::to_string(i) + ".raw"))
+        ++queued;
+    }
+    saver.Flush();
+    EXPECT_EQ(queued, saver.SavedCount());
+    EXPECT_EQ(count, saver.SavedCount() + saver.DroppedCount());
+  }
+
+  // failures are counted
+  {
+    FrameSaver saver;
+    EXPECT_FALSE(saver.Save(Image(), prefix + "empty.raw"));
+    EXPECT_TRUE(saver.Save(Image(2u, 2u, PF_L8), prefix + "bad.unknown"));
+    saver.Flush();
+    EXPECT_EQ(1u, saver.FailedCount());
+  }
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
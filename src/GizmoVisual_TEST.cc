@@ -43,6 +43,13 @@ class GizmoVisualTest : public testing::Test,
 /////////////////////////////////////////////////
 void GizmoVisualTest::GizmoVisual(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "GizmoVisual not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
   RenderEngine *engine = rendering::engine(_renderEngine);
   if (!engine)
   {
@@ -114,6 +121,13 @@ void GizmoVisualTest::GizmoVisual(const std::string &_renderEngine)
 /////////////////////////////////////////////////
 void GizmoVisualTest::Material(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "GizmoVisual not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
   RenderEngine *engine = rendering::engine(_renderEngine);
   if (!engine)
   {
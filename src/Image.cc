@@ -14,30 +14,32 @@
  * limitations under the License.
  *
  */
+#include <cstdint>
+
+#include <ignition/common/Console.hh>
+
 #include "ignition/rendering/Image.hh"
+#include "ignition/rendering/ImagePool.hh"
 
 using namespace ignition;
 using namespace rendering;
 
 //////////////////////////////////////////////////
-template <class T>
-struct ArrayDeleter
+Image::Image(unsigned int _width, unsigned int _height,
+  PixelFormat _format) :
+  Image(ImagePool::Default().Acquire(_width, _height, _format))
 {
-  void operator () (T const * p)
-  {
-    delete [] p;
-  }
-};
+}
 
 //////////////////////////////////////////////////
 Image::Image(unsigned int _width, unsigned int _height,
-  PixelFormat _format) :
+  PixelFormat _format, DataPtr _data, unsigned int _stride) :
   width(_width),
-  height(_height)
+  height(_height),
+  format(_format),
+  stride(_stride),
+  data(_data)
 {
-  this->format = PixelUtil::Sanitize(_format);
-  unsigned int size = this->MemorySize();
-  this->data = DataPtr(new unsigned char[size], ArrayDeleter<unsigned char>());
 }
 
 //////////////////////////////////////////////////
@@ -70,11 +72,38 @@ unsigned int Image::Depth() const
 }
 
 //////////////////////////////////////////////////
-unsigned int Image::MemorySize() const
+std::size_t Image::MemorySize() const
 {
   return PixelUtil::MemorySize(this->format, this->width, this->height);
 }
 
+//////////////////////////////////////////////////
+unsigned int Image::Stride() const
+{
+  return this->stride;
+}
+
+//////////////////////////////////////////////////
+Image Image::View(unsigned int _x, unsigned int _y, unsigned int _width,
+    unsigned int _height) const
+{
+  if (!this->data || _width == 0u || _height == 0u ||
+      static_cast<uint64_t>(_x) + _width > this->width ||
+      static_cast<uint64_t>(_y) + _height > this->height)
+  {
+    ignerr << "Image view [" << _x << ", " << _y << ", " << _width << ", "
+           << _height << "] is outside of the " << this->width << "x"
+           << this->height << " image" << std::endl;
+    return Image();
+  }
+
+  // the view shares ownership of the buffer but points to its first pixel
+  std::size_t offset = static_cast<std::size_t>(_y) * this->stride +
+      static_cast<std::size_t>(_x) * PixelUtil::BytesPerPixel(this->format);
+  DataPtr viewData(this->data, this->data.get() + offset);
+  return Image(_width, _height, this->format, viewData, this->stride);
+}
+
 //////////////////////////////////////////////////
 const void *Image::Data() const
 {
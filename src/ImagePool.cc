@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "ignition/rendering/ImagePool.hh"
+
+/// \brief Private data for the ImagePool class
+class ignition::rendering::ImagePoolPrivate
+{
+  /// \brief An aligned image buffer
+  public: struct Buffer
+  {
+    /// \brief Allocated memory, larger than the buffer to align it
+    std::unique_ptr<unsigned char[]> memory;
+
+    /// \brief Aligned start of the buffer
+    unsigned char *data = nullptr;
+
+    /// \brief Size of the buffer in bytes, its size class
+    std::size_t size = 0u;
+  };
+
+  /// \brief Returns a buffer to its pool when the last image using it is
+  /// destroyed, frees it if the pool no longer exists
+  public: struct Releaser
+  {
+    /// \brief Pool the buffer belongs to
+    std::weak_ptr<ImagePoolPrivate> pool;
+
+    /// \brief Buffer to release
+    Buffer *buffer;
+
+    /// \brief Release the buffer
+    void operator()(unsigned char *)
+    {
+      std::unique_ptr<Buffer> released(this->buffer);
+      if (auto p = this->pool.lock())
+        p->Release(std::move(released));
+    }
+  };
+
+  /// \brief Take an unused buffer of the size class or allocate a new one
+  /// \param[in] _size Size class in bytes
+  /// \return The buffer
+  public: std::unique_ptr<Buffer> Take(std::size_t _size);
+
+  /// \brief Keep a buffer for reuse if the cache has room for it
+  /// \param[in] _buffer Buffer no longer used
+  public: void Release(std::unique_ptr<Buffer> _buffer);
+
+  /// \brief Free unused buffers until the cache fits in its maximum size.
+  /// Must be called with the mutex locked.
+  public: void Trim();
+
+  /// \brief Unused buffers by size class
+  public: std::map<std::size_t, std::vector<std::unique_ptr<Buffer>>> unused;
+
+  /// \brief Size of the unused buffers in bytes
+  public: std::size_t cachedSize = 0u;
+
+  /// \brief Maximum size of the unused buffers in bytes
+  public: std::size_t maxCachedSize = 0u;
+
+  /// \brief Number of buffers allocated
+  public: uint64_t allocationCount = 0u;
+
+  /// \brief Mutex protecting the members above
+  public: std::mutex mutex;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+std::unique_ptr<ImagePoolPrivate::Buffer> ImagePoolPrivate::Take(
+    std::size_t _size)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    auto it = this->unused.find(_size);
+    if (it != this->unused.end() && !it->second.empty())
+    {
+      std::unique_ptr<Buffer> buffer = std::move(it->second.back());
+      it->second.pop_back();
+      this->cachedSize -= _size;
+      return buffer;
+    }
+    ++this->allocationCount;
+  }
+
+  // allocate outside of the lock, large buffers take a while
+  auto buffer = std::make_unique<Buffer>();
+  buffer->memory.reset(new unsigned char[_size + ImagePool::kAlignment - 1u]);
+  std::uintptr_t address =
+      reinterpret_cast<std::uintptr_t>(buffer->memory.get());
+  std::size_t padding = (ImagePool::kAlignment -
+      address % ImagePool::kAlignment) % ImagePool::kAlignment;
+  buffer->data = buffer->memory.get() + padding;
+  buffer->size = _size;
+  return buffer;
+}
+
+//////////////////////////////////////////////////
+void ImagePoolPrivate::Release(std::unique_ptr<Buffer> _buffer)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (_buffer->size > this->maxCachedSize)
+    return;
+  this->cachedSize += _buffer->size;
+  this->unused[_buffer->size].push_back(std::move(_buffer));
+  this->Trim();
+}
+
+//////////////////////////////////////////////////
+void ImagePoolPrivate::Trim()
+{
+  // free the largest buffers first, they are the most likely to be rare
+  auto it = this->unused.rbegin();
+  while (this->cachedSize > this->maxCachedSize && it != this->unused.rend())
+  {
+    while (!it->second.empty() && this->cachedSize > this->maxCachedSize)
+    {
+      this->cachedSize -= it->first;
+      it->second.pop_back();
+    }
+    ++it;
+  }
+}
+
+//////////////////////////////////////////////////
+ImagePool::ImagePool(std::size_t _maxCachedSize)
+  : dataPtr(std::make_shared<ImagePoolPrivate>())
+{
+  this->dataPtr->maxCachedSize = _maxCachedSize;
+}
+
+//////////////////////////////////////////////////
+ImagePool::~ImagePool()
+{
+}
+
+//////////////////////////////////////////////////
+ImagePool &ImagePool::Default()
+{
+  static ImagePool pool;
+  return pool;
+}
+
+//////////////////////////////////////////////////
+Image ImagePool::Acquire(unsigned int _width, unsigned int _height,
+    PixelFormat _format)
+{
+  PixelFormat format = PixelUtil::Sanitize(_format);
+  std::size_t size = PixelUtil::MemorySize(format, _width, _height);
+  unsigned int stride = _width * PixelUtil::BytesPerPixel(format);
+
+  std::unique_ptr<ImagePoolPrivate::Buffer> buffer =
+      this->dataPtr->Take(SizeClass(size));
+  unsigned char *data = buffer->data;
+  ImagePoolPrivate::Releaser releaser{this->dataPtr, buffer.release()};
+  return Image(_width, _height, format, Image::DataPtr(data, releaser),
+      stride);
+}
+
+//////////////////////////////////////////////////
+void ImagePool::SetMaxCachedSize(std::size_t _size)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->maxCachedSize = _size;
+  this->dataPtr->Trim();
+}
+
+//////////////////////////////////////////////////
+std::size_t ImagePool::MaxCachedSize() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->maxCachedSize;
+}
+
+//////////////////////////////////////////////////
+std::size_t ImagePool::CachedSize() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->cachedSize;
+}
+
+//////////////////////////////////////////////////
+uint64_t ImagePool::AllocationCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->allocationCount;
+}
+
+//////////////////////////////////////////////////
+void ImagePool::Clear()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->unused.clear();
+  this->dataPtr->cachedSize = 0u;
+}
+
+//////////////////////////////////////////////////
+std::size_t ImagePool::SizeClass(std::size_t _size)
+{
+  // small buffers share one class, larger ones get four classes between
+  // consecutive powers of two so that at most a quarter is wasted
+  const std::size_t minSize = 256u;
+  if (_size <= minSize)
+    return minSize;
+
+  std::size_t power = minSize;
+  while (power * 2u < _size)
+    power *= 2u;
+  std::size_t step = power / 4u;
+  return (_size + step - 1u) / step * step;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/ImagePool.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(ImagePoolTest, SizeClass)
+{
+  EXPECT_EQ(256u, ImagePool::SizeClass(0u));
+  EXPECT_EQ(256u, ImagePool::SizeClass(256u));
+  EXPECT_EQ(320u, ImagePool::SizeClass(257u));
+  EXPECT_EQ(512u, ImagePool::SizeClass(512u));
+
+  // at most a quarter of a buffer is unused
+  for (std::size_t size = 257u; size < 100000u; size += 997u)
+  {
+    std::size_t sizeClass = ImagePool::SizeClass(size);
+    EXPECT_GE(sizeClass, size);
+    EXPECT_LE(sizeClass - size, size / 4u);
+  }
+
+  // 4K RGB image
+  std::size_t size = 3840u * 2160u * 3u;
+  EXPECT_EQ(24u << 20, ImagePool::SizeClass(size));
+}
+
+/////////////////////////////////////////////////
+TEST(ImagePoolTest, Reuse)
+{
+  ImagePool pool;
+  const void *data = nullptr;
+  {
+    Image image = pool.Acquire(64u, 48u, PF_R8G8B8);
+    EXPECT_EQ(64u, image.Width());
+    EXPECT_EQ(48u, image.Height());
+    EXPECT_EQ(PF_R8G8B8, image.Format());
+    EXPECT_EQ(64u * 3u, image.Stride());
+    EXPECT_EQ(64u * 48u * 3u, image.MemorySize());
+    data = image.Data();
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(0u,
+        reinterpret_cast<std::uintptr_t>(data) % ImagePool::kAlignment);
+    EXPECT_EQ(0u, pool.CachedSize());
+  }
+  EXPECT_EQ(1u, pool.AllocationCount());
+  EXPECT_EQ(ImagePool::SizeClass(64u * 48u * 3u), pool.CachedSize());
+
+  // same size class reuses the buffer, copies share it
+  {
+    Image image = pool.Acquire(48u, 64u, PF_R8G8B8);
+    EXPECT_EQ(data, image.Data());
+    Image copy = image;
+    EXPECT_EQ(data, copy.Data());
+  }
+  EXPECT_EQ(1u, pool.AllocationCount());
+
+  // a different size class allocates
+  {
+    Image image = pool.Acquire(640u, 480u, PF_R8G8B8);
+    EXPECT_NE(data, image.Data());
+  }
+  EXPECT_EQ(2u, pool.AllocationCount());
+
+  // no reuse without cache
+  pool.SetMaxCachedSize(0u);
+  EXPECT_EQ(0u, pool.CachedSize());
+  {
+    Image image = pool.Acquire(64u, 48u, PF_R8G8B8);
+  }
+  EXPECT_EQ(3u, pool.AllocationCount());
+  EXPECT_EQ(0u, pool.CachedSize());
+
+  pool.SetMaxCachedSize(1u << 20);
+  {
+    Image image = pool.Acquire(64u, 48u, PF_R8G8B8);
+  }
+  EXPECT_GT(pool.CachedSize(), 0u);
+  pool.Clear();
+  EXPECT_EQ(0u, pool.CachedSize());
+}
+
+/////////////////////////////////////////////////
+TEST(ImagePoolTest, OutlivePool)
+{
+  auto pool = std::make_unique<ImagePool>();
+  Image image = pool->Acquire(16u, 16u, PF_L8);
+  pool.reset();
+
+  // the buffer is still valid and freed with the image
+  image.Data<unsigned char>()[255] = 7u;
+  EXPECT_EQ(7u, image.Data<unsigned char>()[255]);
+}
+
+/////////////////////////////////////////////////
+TEST(ImagePoolTest, View)
+{
+  Image image(8u, 4u, PF_L8);
+  unsigned char *data = image.Data<unsigned char>();
+  for (unsigned int i = 0; i < 32u; ++i)
+    data[i] = static_cast<unsigned char>(i);
+
+  Image view = image.View(2u, 1u, 3u, 2u);
+  EXPECT_EQ(3u, view.Width());
+  EXPECT_EQ(2u, view.Height());
+  EXPECT_EQ(PF_L8, view.Format());
+  EXPECT_EQ(8u, view.Stride());
+  EXPECT_EQ(6u, view.MemorySize());
+
+  // the view points into the buffer of the image
+  const unsigned char *viewData = view.Data<unsigned char>();
+  EXPECT_EQ(data + 10, viewData);
+  EXPECT_EQ(10u, viewData[0]);
+  EXPECT_EQ(12u, viewData[2]);
+  EXPECT_EQ(18u, viewData[view.Stride()]);
+
+  // views of views
+  Image nested = view.View(1u, 1u, 2u, 1u);
+  EXPECT_EQ(19u, nested.Data<unsigned char>()[0]);
+
+  // the view keeps the buffer alive
+  image = Image();
+  EXPECT_EQ(10u, view.Data<unsigned char>()[0]);
+
+  // regions outside of the image
+  EXPECT_EQ(nullptr, view.View(2u, 0u, 2u, 1u).Data());
+  EXPECT_EQ(nullptr, view.View(0u, 0u, 0u, 1u).Data());
+  EXPECT_EQ(0u, view.View(0u, 2u, 1u, 1u).Width());
+}
+
+/////////////////////////////////////////////////
+TEST(ImagePoolTest, LargeMemorySize)
+{
+  // overflows 32 bit arithmetic
+  EXPECT_EQ(static_cast<std::size_t>(40000u) * 40000u * 16u,
+      PixelUtil::MemorySize(PF_FLOAT32_RGBA, 40000u, 40000u));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/InstanceBatch.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class InstanceBatchTest : public testing::Test,
+                          public testing::WithParamInterface<const char *>
+{
+  /// \brief Test instance batch basic API
+  public: void InstanceBatch(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void InstanceBatchTest::InstanceBatch(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "InstanceBatch not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // invalid batches
+  EXPECT_EQ(nullptr, scene->CreateInstanceBatch(
+      MeshDescriptor("unit_box"), nullptr, 0u));
+  EXPECT_EQ(nullptr, scene->CreateInstanceBatch(
+      MeshDescriptor("invalid_mesh"), nullptr, 10u));
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(1.0, 0.0, 0.0);
+
+  const unsigned int count = 10u;
+  InstanceBatchPtr batch = scene->CreateInstanceBatch(
+      MeshDescriptor("unit_box"), material, count);
+  ASSERT_NE(nullptr, batch);
+  EXPECT_EQ(count, batch->InstanceCount());
+  EXPECT_EQ(material, batch->Material());
+
+  // default values
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(math::Pose3d::Zero, batch->InstancePose(i));
+    EXPECT_EQ(math::Vector3d::One, batch->InstanceScale(i));
+    EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), batch->InstanceColor(i));
+    EXPECT_EQ(math::Vector4d::Zero, batch->InstanceCustomParameter(i));
+    EXPECT_TRUE(batch->InstanceVisible(i));
+  }
+
+  // single instance setters
+  math::Pose3d pose(1, 2, 3, 0, 0, 1.57);
+  batch->SetInstancePose(3u, pose);
+  EXPECT_EQ(pose, batch->InstancePose(3u));
+
+  batch->SetInstanceScale(3u, math::Vector3d(0.5, 2.0, 1.0));
+  EXPECT_EQ(math::Vector3d(0.5, 2.0, 1.0), batch->InstanceScale(3u));
+
+  batch->SetInstanceColor(3u, math::Color::Green);
+  EXPECT_EQ(math::Color::Green, batch->InstanceColor(3u));
+
+  batch->SetInstanceCustomParameter(3u, math::Vector4d(1, 2, 3, 4));
+  EXPECT_EQ(math::Vector4d(1, 2, 3, 4), batch->InstanceCustomParameter(3u));
+
+  batch->SetInstanceVisible(3u, false);
+  EXPECT_FALSE(batch->InstanceVisible(3u));
+
+  // out of range indices are ignored
+  batch->SetInstancePose(count, pose);
+  batch->SetInstanceColor(count, math::Color::Blue);
+  batch->SetInstanceVisible(count, false);
+  EXPECT_EQ(math::Pose3d::Zero, batch->InstancePose(count));
+  EXPECT_FALSE(batch->InstanceVisible(count));
+
+  scene->PreRender();
+
+  // bulk setters, extra entries are ignored
+  std::vector<math::Pose3d> poses;
+  std::vector<math::Vector3d> scales;
+  std::vector<math::Color> colors;
+  std::vector<math::Vector4d> params;
+  for (unsigned int i = 0; i < count + 2u; ++i)
+  {
+    poses.push_back(math::Pose3d(i, 0, 0, 0, 0, 0));
+    scales.push_back(math::Vector3d(1, 1, 1 + i));
+    colors.push_back(i % 2 ? math::Color::Blue : math::Color::Green);
+    params.push_back(math::Vector4d(i, i, i, i));
+  }
+  batch->SetInstancePoses(poses);
+  batch->SetInstanceScales(scales);
+  batch->SetInstanceColors(colors);
+  batch->SetInstanceCustomParameters(params);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    EXPECT_EQ(poses[i], batch->InstancePose(i));
+    EXPECT_EQ(scales[i], batch->InstanceScale(i));
+    EXPECT_EQ(colors[i], batch->InstanceColor(i));
+    EXPECT_EQ(params[i], batch->InstanceCustomParameter(i));
+  }
+  scene->PreRender();
+
+  // restore the material colour
+  batch->SetInstanceColor(1u, math::Color(1.0f, 0.0f, 0.0f));
+  scene->PreRender();
+  EXPECT_EQ(math::Color(1.0f, 0.0f, 0.0f), batch->InstanceColor(1u));
+
+  // batch without material uses the mesh materials
+  InstanceBatchPtr meshBatch = scene->CreateInstanceBatch(
+      MeshDescriptor("unit_sphere"), nullptr, 2u);
+  ASSERT_NE(nullptr, meshBatch);
+  EXPECT_EQ(nullptr, meshBatch->Material());
+  EXPECT_EQ(math::Color::White, meshBatch->InstanceColor(0u));
+  meshBatch->SetInstanceColor(0u, math::Color::Blue);
+  scene->PreRender();
+  meshBatch->SetInstanceColor(0u, math::Color::White);
+  scene->PreRender();
+
+  // batches released by the user are dropped by the scene
+  meshBatch.reset();
+  scene->PreRender();
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(InstanceBatchTest, InstanceBatch)
+{
+  InstanceBatch(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceBatch, InstanceBatchTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -37,7 +37,7 @@ class LidarVisualTest : public testing::Test,
 /////////////////////////////////////////////////
 void LidarVisualTest::LidarVisual(const std::string &_renderEngine)
 {
-  if (_renderEngine == "optix")
+  if (_renderEngine == "optix" || _renderEngine == "cpu")
   {
     igndbg << "LidarVisual not supported yet in rendering engine: "
             << _renderEngine << std::endl;
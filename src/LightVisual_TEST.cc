@@ -40,6 +40,13 @@ class LightVisualTest : public testing::Test,
 /////////////////////////////////////////////////
 void LightVisualTest::LightVisual(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "LightVisual not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
   RenderEngine *engine = rendering::engine(_renderEngine);
   if (!engine)
   {
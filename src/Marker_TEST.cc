@@ -37,7 +37,7 @@ class MarkerTest : public testing::Test,
 /////////////////////////////////////////////////
 void MarkerTest::Marker(const std::string &_renderEngine)
 {
-  if (_renderEngine == "optix")
+  if (_renderEngine == "optix" || _renderEngine == "cpu")
   {
     igndbg << "Marker not supported yet in rendering engine: "
             << _renderEngine << std::endl;
@@ -109,6 +109,13 @@ TEST_P(MeshTest, MeshSubMesh)
 /////////////////////////////////////////////////
 void MeshTest::MeshSkeletonAnimation(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "Skeleton animation not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
   RenderEngine *engine = rendering::engine(_renderEngine);
   if (!engine)
   {
@@ -191,6 +198,32 @@ void MeshTest::MeshSkeletonAnimation(const std::string &_renderEngine)
     }
   }
 
+  // verify bone index api
+  EXPECT_EQ(0u, boxMesh->SkeletonBoneCount());
+  EXPECT_TRUE(boxMesh->SkeletonBoneNames().empty());
+  EXPECT_EQ(-1, boxMesh->SkeletonBoneIndex(nodeName));
+
+  std::vector<std::string> boneNames = mesh->SkeletonBoneNames();
+  EXPECT_EQ(skel->NodeCount(), boneNames.size());
+  EXPECT_EQ(boneNames.size(), mesh->SkeletonBoneCount());
+  for (unsigned int i = 0; i < boneNames.size(); ++i)
+    EXPECT_EQ(static_cast<int>(i), mesh->SkeletonBoneIndex(boneNames[i]));
+  EXPECT_EQ(-1, mesh->SkeletonBoneIndex("invalid"));
+
+  // set pose by bone index and verify with the name based api
+  int rootIdx = mesh->SkeletonBoneIndex(nodeName);
+  ASSERT_GE(rootIdx, 0);
+  std::map<std::string, math::Matrix4d> tfs = mesh->SkeletonLocalTransforms();
+  std::vector<math::Matrix4d> boneTfs;
+  for (const auto &name : boneNames)
+    boneTfs.push_back(tfs[name]);
+  math::Matrix4d rootTf(math::Pose3d(1, 2, 3, 0, 0, 0));
+  boneTfs[rootIdx] = rootTf;
+  mesh->SetSkeletonBoneTransforms(boneTfs);
+
+  tfs = mesh->SkeletonLocalTransforms();
+  EXPECT_EQ(rootTf.Translation(), tfs[nodeName].Translation());
+
   // Clean up
   engine->DestroyScene(scene);
   rendering::unloadEngine(engine->Name());
@@ -0,0 +1,313 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "ignition/rendering/NoiseGenerator.hh"
+
+/// \brief Private data for the NoiseGenerator class
+class ignition::rendering::NoiseGeneratorPrivate
+{
+  /// \brief Seed of the generator
+  public: uint64_t seed = 0u;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief Philox multipliers
+  const uint32_t kPhiloxM0 = 0xD2511F53u;
+  const uint32_t kPhiloxM1 = 0xCD9E8D57u;
+
+  /// \brief Philox key increments
+  const uint32_t kPhiloxW0 = 0x9E3779B9u;
+  const uint32_t kPhiloxW1 = 0xBB67AE85u;
+
+  /// \brief Number of counters computed together. The lane loops have no
+  /// dependencies between lanes so they can be vectorized.
+  const std::size_t kLanes = 8u;
+
+  /// \brief Number of values given by one counter
+  const std::size_t kBlockSize = 4u;
+
+  /// \brief Scale from a 24 bit integer to [0, 1)
+  const float kUnitScale = 1.0f / 16777216.0f;
+
+  /// \brief Two pi
+  const float kTwoPi = 6.28318530717958647692f;
+
+  /// \brief Natural log of a value in (0, 1]. Unlike std::log it has no
+  /// calls or branches, so loops over it can be vectorized. The maximum
+  /// relative error is about 1e-7.
+  /// \param[in] _x Value in (0, 1]
+  /// \return Natural log of the value
+  inline float Log(float _x)
+  {
+    uint32_t bits;
+    std::memcpy(&bits, &_x, sizeof(bits));
+    float e = static_cast<float>(static_cast<int>(bits >> 23) - 127);
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m;
+    std::memcpy(&m, &bits, sizeof(m));
+
+    // bring the mantissa to [sqrt(0.5), sqrt(2)), then use the cephes logf
+    // polynomial for log(1 + x)
+    bool high = m > 1.41421356f;
+    m = high ? 0.5f * m : m;
+    e = high ? e + 1.0f : e;
+    float x = m - 1.0f;
+    float z = x * x;
+    float y = 7.0376836292e-2f;
+    y = y * x - 1.1514610310e-1f;
+    y = y * x + 1.1676998740e-1f;
+    y = y * x - 1.2420140846e-1f;
+    y = y * x + 1.4249322787e-1f;
+    y = y * x - 1.6668057665e-1f;
+    y = y * x + 2.0000714765e-1f;
+    y = y * x - 2.4999993993e-1f;
+    y = y * x + 3.3333331174e-1f;
+    y = y * x * z;
+    y += -2.12194440e-4f * e;
+    y += -0.5f * z;
+    return x + y + 0.693359375f * e;
+  }
+
+  /// \brief Sine and cosine of 2 pi times a value in [0, 1), without calls
+  /// or branches. The absolute error is below 1e-6.
+  /// \param[in] _u Value in [0, 1)
+  /// \param[out] _sin Sine of 2 pi _u
+  /// \param[out] _cos Cosine of 2 pi _u
+  inline void SinCos(float _u, float &_sin, float &_cos)
+  {
+    // reduce to w in [-0.25, 0.25], i.e. an angle in [-pi/2, pi/2], where
+    // the Taylor series converge quickly
+    float w = _u >= 0.5f ? _u - 1.0f : _u;
+    float half = w > 0.0f ? 0.5f : -0.5f;
+    bool flip = std::abs(w) > 0.25f;
+    w = flip ? half - w : w;
+
+    float a = kTwoPi * w;
+    float a2 = a * a;
+    float s = -2.5052108e-8f;
+    s = s * a2 + 2.7557319e-6f;
+    s = s * a2 - 1.9841270e-4f;
+    s = s * a2 + 8.3333333e-3f;
+    s = s * a2 - 1.6666667e-1f;
+    s = a + a * a2 * s;
+    float c = -1.1470746e-11f;
+    c = c * a2 + 2.0876757e-9f;
+    c = c * a2 - 2.7557319e-7f;
+    c = c * a2 + 2.4801587e-5f;
+    c = c * a2 - 1.3888889e-3f;
+    c = c * a2 + 4.1666667e-2f;
+    c = c * a2 - 0.5f;
+    c = 1.0f + a2 * c;
+
+    _sin = s;
+    _cos = flip ? -c : c;
+  }
+
+  /// \brief Run the Philox4x32-10 rounds on _N counters in place
+  /// \param[in,out] _c Counter words, replaced by the random words
+  /// \param[in] _key Key words
+  template <std::size_t _N>
+  void PhiloxRounds(uint32_t _c[4][_N], const uint32_t _key[2])
+  {
+    // keep the words in separate arrays so that each round is a few vector
+    // instructions over the lanes
+    uint32_t c0[_N], c1[_N], c2[_N], c3[_N];
+    for (std::size_t lane = 0; lane < _N; ++lane)
+    {
+      c0[lane] = _c[0][lane];
+      c1[lane] = _c[1][lane];
+      c2[lane] = _c[2][lane];
+      c3[lane] = _c[3][lane];
+    }
+
+    uint32_t k0 = _key[0];
+    uint32_t k1 = _key[1];
+    for (unsigned int round = 0; round < 10u; ++round)
+    {
+      for (std::size_t lane = 0; lane < _N; ++lane)
+      {
+        uint64_t p0 = static_cast<uint64_t>(kPhiloxM0) * c0[lane];
+        uint64_t p1 = static_cast<uint64_t>(kPhiloxM1) * c2[lane];
+        c0[lane] = static_cast<uint32_t>(p1 >> 32) ^ c1[lane] ^ k0;
+        c1[lane] = static_cast<uint32_t>(p1);
+        c2[lane] = static_cast<uint32_t>(p0 >> 32) ^ c3[lane] ^ k1;
+        c3[lane] = static_cast<uint32_t>(p0);
+      }
+      k0 += kPhiloxW0;
+      k1 += kPhiloxW1;
+    }
+
+    for (std::size_t lane = 0; lane < _N; ++lane)
+    {
+      _c[0][lane] = c0[lane];
+      _c[1][lane] = c1[lane];
+      _c[2][lane] = c2[lane];
+      _c[3][lane] = c3[lane];
+    }
+  }
+
+  /// \brief Generate values block by block. Block b of a frame uses the
+  /// counter (b, frame) and gives the elements 4b to 4b + 3.
+  /// \param[in] _seed Seed of the generator
+  /// \param[in] _frame Frame the values are generated for
+  /// \param[in] _index Index of the first element
+  /// \param[out] _out Generated values
+  /// \param[in] _count Number of values to generate
+  /// \param[in] _transform Converts the random words of kLanes counters to
+  /// kLanes * 4 values, written block after block
+  template <typename T>
+  void Generate(uint64_t _seed, uint64_t _frame, uint64_t _index,
+      float *_out, std::size_t _count, T _transform)
+  {
+    const uint32_t key[2] = {static_cast<uint32_t>(_seed),
+        static_cast<uint32_t>(_seed >> 32)};
+    const uint32_t frameLo = static_cast<uint32_t>(_frame);
+    const uint32_t frameHi = static_cast<uint32_t>(_frame >> 32);
+
+    uint32_t words[4][kLanes];
+    float values[kLanes * kBlockSize];
+
+    uint64_t block = _index / kBlockSize;
+    std::size_t skip = static_cast<std::size_t>(_index % kBlockSize);
+    std::size_t done = 0u;
+    while (done < _count)
+    {
+      for (std::size_t lane = 0; lane < kLanes; ++lane)
+      {
+        uint64_t b = block + lane;
+        words[0][lane] = static_cast<uint32_t>(b);
+        words[1][lane] = static_cast<uint32_t>(b >> 32);
+        words[2][lane] = frameLo;
+        words[3][lane] = frameHi;
+      }
+      PhiloxRounds<kLanes>(words, key);
+      _transform(words, values);
+
+      std::size_t n = std::min(kLanes * kBlockSize - skip, _count - done);
+      for (std::size_t i = 0; i < n; ++i)
+        _out[done + i] = values[skip + i];
+      done += n;
+      skip = 0u;
+      block += kLanes;
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+NoiseGenerator::NoiseGenerator(uint64_t _seed)
+  : dataPtr(new NoiseGeneratorPrivate)
+{
+  this->dataPtr->seed = _seed;
+}
+
+//////////////////////////////////////////////////
+NoiseGenerator::NoiseGenerator(const NoiseGenerator &_other)
+  : dataPtr(new NoiseGeneratorPrivate(*_other.dataPtr))
+{
+}
+
+//////////////////////////////////////////////////
+NoiseGenerator::~NoiseGenerator() = default;
+
+//////////////////////////////////////////////////
+NoiseGenerator &NoiseGenerator::operator=(const NoiseGenerator &_other)
+{
+  *this->dataPtr = *_other.dataPtr;
+  return *this;
+}
+
+//////////////////////////////////////////////////
+uint64_t NoiseGenerator::Seed() const
+{
+  return this->dataPtr->seed;
+}
+
+//////////////////////////////////////////////////
+void NoiseGenerator::SetSeed(uint64_t _seed)
+{
+  this->dataPtr->seed = _seed;
+}
+
+//////////////////////////////////////////////////
+void NoiseGenerator::Uniform(uint64_t _frame, uint64_t _index, float *_out,
+    std::size_t _count) const
+{
+  Generate(this->dataPtr->seed, _frame, _index, _out, _count,
+      [](const uint32_t _words[4][kLanes], float *_values)
+      {
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+          for (std::size_t w = 0; w < kBlockSize; ++w)
+          {
+            _values[lane * kBlockSize + w] =
+                static_cast<float>(_words[w][lane] >> 8) * kUnitScale;
+          }
+        }
+      });
+}
+
+//////////////////////////////////////////////////
+void NoiseGenerator::Gaussian(uint64_t _frame, uint64_t _index, float *_out,
+    std::size_t _count, float _mean, float _stdDev) const
+{
+  Generate(this->dataPtr->seed, _frame, _index, _out, _count,
+      [_mean, _stdDev](const uint32_t _words[4][kLanes], float *_values)
+      {
+        // Box-Muller on the word pairs (0, 1) and (2, 3). The first uniform
+        // of a pair is in (0, 1] so that its log is finite.
+        float z[kBlockSize][kLanes];
+        for (std::size_t w = 0; w < kBlockSize; w += 2u)
+        {
+          for (std::size_t lane = 0; lane < kLanes; ++lane)
+          {
+            float u1 = static_cast<float>((_words[w][lane] >> 8) + 1u) *
+                kUnitScale;
+            float u2 = static_cast<float>(_words[w + 1u][lane] >> 8) *
+                kUnitScale;
+            float r = _stdDev * std::sqrt(-2.0f * Log(u1));
+            float s, c;
+            SinCos(u2, s, c);
+            z[w][lane] = _mean + r * c;
+            z[w + 1u][lane] = _mean + r * s;
+          }
+        }
+        for (std::size_t lane = 0; lane < kLanes; ++lane)
+        {
+          for (std::size_t w = 0; w < kBlockSize; ++w)
+            _values[lane * kBlockSize + w] = z[w][lane];
+        }
+      });
+}
+
+//////////////////////////////////////////////////
+void NoiseGenerator::Philox(const uint32_t _counter[4],
+    const uint32_t _key[2], uint32_t _out[4])
+{
+  uint32_t words[4][1] = {{_counter[0]}, {_counter[1]}, {_counter[2]},
+      {_counter[3]}};
+  PhiloxRounds<1u>(words, _key);
+  for (unsigned int i = 0; i < 4u; ++i)
+    _out[i] = words[i][0];
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/NoiseGenerator.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(NoiseGeneratorTest, Philox)
+{
+  // known answers of the Philox4x32-10 reference implementation
+  uint32_t counter[4] = {0u, 0u, 0u, 0u};
+  uint32_t key[2] = {0u, 0u};
+  uint32_t out[4];
+  NoiseGenerator::Philox(counter, key, out);
+  EXPECT_EQ(0x6627e8d5u, out[0]);
+  EXPECT_EQ(0xe169c58du, out[1]);
+  EXPECT_EQ(0xbc57ac4cu, out[2]);
+  EXPECT_EQ(0x9b00dbd8u, out[3]);
+
+  uint32_t counter2[4] = {0x243f6a88u, 0x85a308d3u, 0x13198a2eu,
+      0x03707344u};
+  uint32_t key2[2] = {0xa4093822u, 0x299f31d0u};
+  NoiseGenerator::Philox(counter2, key2, out);
+  EXPECT_EQ(0xd16cfe09u, out[0]);
+  EXPECT_EQ(0x94fdccebu, out[1]);
+  EXPECT_EQ(0x5001e420u, out[2]);
+  EXPECT_EQ(0x24126ea1u, out[3]);
+}
+
+/////////////////////////////////////////////////
+TEST(NoiseGeneratorTest, Determinism)
+{
+  NoiseGenerator generator(42u);
+  EXPECT_EQ(42u, generator.Seed());
+
+  std::vector<float> all(1000u);
+  generator.Gaussian(7u, 0u, all.data(), all.size());
+
+  // generating any sub range gives the same values
+  std::vector<float> part(333u);
+  generator.Gaussian(7u, 101u, part.data(), part.size());
+  for (std::size_t i = 0; i < part.size(); ++i)
+    EXPECT_FLOAT_EQ(all[101u + i], part[i]);
+
+  // another frame or seed gives other values
+  std::vector<float> other(all.size());
+  generator.Gaussian(8u, 0u, other.data(), other.size());
+  EXPECT_NE(all, other);
+  NoiseGenerator copy(generator);
+  copy.SetSeed(43u);
+  copy.Gaussian(7u, 0u, other.data(), other.size());
+  EXPECT_NE(all, other);
+}
+
+/////////////////////////////////////////////////
+TEST(NoiseGeneratorTest, Distributions)
+{
+  NoiseGenerator generator(1u);
+  const std::size_t count = 200000u;
+  std::vector<float> values(count);
+
+  generator.Uniform(0u, 0u, values.data(), count);
+  double sum = 0.0;
+  for (float v : values)
+  {
+    EXPECT_GE(v, 0.0f);
+    EXPECT_LT(v, 1.0f);
+    sum += v;
+  }
+  EXPECT_NEAR(0.5, sum / count, 0.005);
+
+  const double mean = 1.5;
+  const double stdDev = 0.25;
+  generator.Gaussian(0u, 0u, values.data(), count, mean, stdDev);
+  sum = 0.0;
+  double sumSq = 0.0;
+  std::size_t inOneSigma = 0u;
+  for (float v : values)
+  {
+    ASSERT_TRUE(std::isfinite(v));
+    sum += v;
+    sumSq += v * v;
+    if (std::abs(v - mean) < stdDev)
+      ++inOneSigma;
+  }
+  double m = sum / count;
+  EXPECT_NEAR(mean, m, 0.005);
+  EXPECT_NEAR(stdDev, std::sqrt(sumSq / count - m * m), 0.005);
+  EXPECT_NEAR(0.6827, static_cast<double>(inOneSigma) / count, 0.005);
+}
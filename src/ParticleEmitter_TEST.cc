@@ -59,6 +59,13 @@ class ParticleEmitterTest : public testing::Test,
 /////////////////////////////////////////////////
 bool ParticleEmitterTest::SetUp(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "ParticleEmitter not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return false;
+  }
+
   this->engine = rendering::engine(_renderEngine);
   if (!this->engine)
   {
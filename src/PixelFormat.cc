@@ -147,11 +147,12 @@ unsigned int PixelUtil::BytesPerPixel(PixelFormat _format)
 }
 
 //////////////////////////////////////////////////
-unsigned int PixelUtil::MemorySize(PixelFormat _format, unsigned int _width,
+std::size_t PixelUtil::MemorySize(PixelFormat _format, unsigned int _width,
     unsigned int _height)
 {
-  unsigned int bytesPerPixel = PixelUtil::BytesPerPixel(_format);
-  return _width * _height * bytesPerPixel;
+  // in size_t, large images overflow unsigned int
+  std::size_t bytesPerPixel = PixelUtil::BytesPerPixel(_format);
+  return static_cast<std::size_t>(_width) * _height * bytesPerPixel;
 }
 
 //////////////////////////////////////////////////
@@ -433,6 +433,12 @@ void RenderEngineManagerPrivate::RegisterDefaultEngines()
   if (this->engines.find(libName + engineName) == this->engines.end())
     this->engines[libName + engineName] = nullptr;
 #endif
+#if HAVE_CPU
+  engineName = "cpu";
+  this->defaultEngines[engineName] = libName + engineName;
+  if (this->engines.find(libName + engineName) == this->engines.end())
+    this->engines[libName + engineName] = nullptr;
+#endif
 }
 
 //////////////////////////////////////////////////
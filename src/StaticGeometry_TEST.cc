@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class StaticGeometryTest : public testing::Test,
+                           public testing::WithParamInterface<const char *>
+{
+  /// \brief Test baking static visuals
+  public: void StaticGeometry(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void StaticGeometryTest::StaticGeometry(const std::string &_renderEngine)
+{
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  // visuals are not static by default
+  VisualPtr visual = scene->CreateVisual();
+  EXPECT_FALSE(visual->Static());
+  visual->SetStatic(true);
+  EXPECT_TRUE(visual->Static());
+  visual->SetStatic(false);
+  EXPECT_FALSE(visual->Static());
+  scene->DestroyVisual(visual);
+
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "Static geometry not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    scene->BakeStaticGeometry();
+    EXPECT_EQ(0u, scene->StaticGeometryBatchCount());
+    engine->DestroyScene(scene);
+    rendering::unloadEngine(engine->Name());
+    return;
+  }
+
+  // nothing to bake
+  EXPECT_EQ(0u, scene->StaticGeometryBatchCount());
+  scene->BakeStaticGeometry();
+  EXPECT_EQ(0u, scene->StaticGeometryBatchCount());
+
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetDiffuse(1.0, 0.0, 0.0);
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetDiffuse(0.0, 1.0, 0.0);
+
+  // boxes with two materials, all within one region
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0; i < 20u; ++i)
+  {
+    VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetMaterial(i % 2 ? red : green, false);
+    box->SetLocalPosition(i, 0, 0);
+    box->SetStatic(true);
+    root->AddChild(box);
+    visuals.push_back(box);
+  }
+
+  // a dynamic box is never baked
+  VisualPtr dynamicBox = scene->CreateVisual();
+  dynamicBox->AddGeometry(scene->CreateBox());
+  dynamicBox->SetMaterial(red, false);
+  root->AddChild(dynamicBox);
+
+  scene->PreRender();
+  scene->BakeStaticGeometry();
+  EXPECT_EQ(2u, scene->StaticGeometryBatchCount());
+
+  // baked visuals keep their bounds
+  math::AxisAlignedBox box = visuals[3]->BoundingBox();
+  EXPECT_EQ(math::Vector3d(2.5, -0.5, -0.5), box.Min());
+  EXPECT_EQ(math::Vector3d(3.5, 0.5, 0.5), box.Max());
+
+  // moving a baked visual removes it from the static geometry
+  visuals[0]->SetLocalPosition(0, 10, 0);
+  scene->PreRender();
+  EXPECT_EQ(2u, scene->StaticGeometryBatchCount());
+
+  // removing all visuals of one material removes its batch
+  for (unsigned int i = 0; i < visuals.size(); i += 2)
+    visuals[i]->SetStatic(false);
+  scene->PreRender();
+  EXPECT_EQ(1u, scene->StaticGeometryBatchCount());
+
+  // baking again picks up the static visuals
+  for (auto &v : visuals)
+    v->SetStatic(true);
+  scene->BakeStaticGeometry();
+  EXPECT_EQ(2u, scene->StaticGeometryBatchCount());
+
+  // destroying a baked visual
+  scene->DestroyVisual(visuals[1]);
+  scene->PreRender();
+  EXPECT_EQ(2u, scene->StaticGeometryBatchCount());
+
+  // scaling the remaining baked red visuals removes them and their batch
+  for (unsigned int i = 3; i < visuals.size(); i += 2)
+    visuals[i]->SetLocalScale(0.5);
+  scene->PreRender();
+  EXPECT_EQ(1u, scene->StaticGeometryBatchCount());
+  EXPECT_EQ(math::Vector3d(0.5, 0.5, 0.5), visuals[3]->LocalScale());
+
+  scene->ClearStaticGeometry();
+  EXPECT_EQ(0u, scene->StaticGeometryBatchCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(StaticGeometryTest, StaticGeometry)
+{
+  StaticGeometry(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(StaticGeometry, StaticGeometryTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,499 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/TextureStreamer.hh"
+
+/// \brief Private data for the TextureStreamer class
+class ignition::rendering::TextureStreamerPrivate
+{
+  /// \brief Streaming data of a single texture
+  public: struct Entry
+  {
+    /// \brief Number of outstanding requests
+    unsigned int useCount = 0u;
+
+    /// \brief Value of the usage tick when the texture was last requested or
+    /// released. Used for LRU eviction.
+    uint64_t lastUse = 0u;
+
+    /// \brief True if the texture is queued or being decoded
+    bool pending = false;
+
+    /// \brief Highest state available from the decoding threads
+    TextureStreamer::State ready =
+        TextureStreamer::State::UNLOADED;
+
+    /// \brief State reported to the render engine
+    TextureStreamer::State published =
+        TextureStreamer::State::UNLOADED;
+
+    /// \brief Low resolution placeholder
+    TextureStreamer::Data placeholder;
+
+    /// \brief Full resolution texture
+    TextureStreamer::Data full;
+  };
+
+  /// \brief Decoding thread loop
+  public: void Run();
+
+  /// \brief Decode a texture image and build its placeholder
+  /// \param[in] _filename Texture file name
+  /// \param[in] _placeholderSize Max size of the placeholder
+  /// \param[out] _placeholder Placeholder texture
+  /// \param[out] _full Full resolution texture
+  /// \return True if the texture was decoded successfully
+  public: static bool Decode(const std::string &_filename,
+      unsigned int _placeholderSize, TextureStreamer::Data &_placeholder,
+      TextureStreamer::Data &_full);
+
+  /// \brief Get the number of bytes used by texture data
+  /// \param[in] _data Texture data
+  /// \return Number of bytes
+  public: static uint64_t Size(const TextureStreamer::Data &_data);
+
+  /// \brief Evict unused textures until the memory usage is within budget.
+  /// Must be called with the mutex locked.
+  /// \param[out] _transitions List to append state changes to
+  public: void Evict(std::vector<TextureStreamer::Transition> &_transitions);
+
+  /// \brief Protects all members below
+  public: mutable std::mutex mutex;
+
+  /// \brief Notifies the decoding threads of new work
+  public: std::condition_variable workCondition;
+
+  /// \brief Notifies waiting threads that a texture has been decoded
+  public: std::condition_variable doneCondition;
+
+  /// \brief Textures by file name
+  public: std::map<std::string, Entry> entries;
+
+  /// \brief Queue of textures to decode
+  public: std::deque<std::string> queue;
+
+  /// \brief Number of textures queued or being decoded
+  public: unsigned int pendingCount = 0u;
+
+  /// \brief Decoding threads
+  public: std::vector<std::thread> workers;
+
+  /// \brief Flag to stop the decoding threads
+  public: bool stop = false;
+
+  /// \brief Usage tick, incremented on every request and release
+  public: uint64_t tick = 0u;
+
+  /// \brief Memory used by decoded textures in bytes
+  public: uint64_t memoryUsage = 0u;
+
+  /// \brief Memory budget in bytes
+  public: uint64_t memoryBudget = 512u * 1024u * 1024u;
+
+  /// \brief Max size of placeholder textures
+  public: unsigned int placeholderSize = 64u;
+
+  /// \brief True if a warning about exceeding the budget was printed
+  public: bool budgetWarned = false;
+};
+
+using namespace ignition;
+using namespace rendering;
+
+//////////////////////////////////////////////////
+TextureStreamer::TextureStreamer(unsigned int _workerCount)
+  : dataPtr(std::make_unique<TextureStreamerPrivate>())
+{
+  _workerCount = std::max(_workerCount, 1u);
+  for (unsigned int i = 0; i < _workerCount; ++i)
+  {
+    this->dataPtr->workers.emplace_back(
+        &TextureStreamerPrivate::Run, this->dataPtr.get());
+  }
+}
+
+//////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->workCondition.notify_all();
+  for (auto &worker : this->dataPtr->workers)
+    worker.join();
+}
+
+//////////////////////////////////////////////////
+void TextureStreamer::Request(const std::string &_filename)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    TextureStreamerPrivate::Entry &entry = this->dataPtr->entries[_filename];
+    entry.useCount++;
+    entry.lastUse = ++this->dataPtr->tick;
+
+    // decode if the full resolution texture is missing, either because this
+    // is a new texture or because it was evicted
+    if (entry.pending || entry.ready == State::FINAL ||
+        entry.ready == State::FAILED)
+    {
+      return;
+    }
+
+    entry.pending = true;
+    this->dataPtr->pendingCount++;
+    this->dataPtr->queue.push_back(_filename);
+  }
+  this->dataPtr->workCondition.notify_one();
+}
+
+//////////////////////////////////////////////////
+void TextureStreamer::Release(const std::string &_filename)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->entries.find(_filename);
+  if (it == this->dataPtr->entries.end() || it->second.useCount == 0u)
+    return;
+
+  it->second.useCount--;
+  it->second.lastUse = ++this->dataPtr->tick;
+}
+
+//////////////////////////////////////////////////
+std::vector<TextureStreamer::Transition> TextureStreamer::Update()
+{
+  std::vector<Transition> transitions;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  for (auto &[filename, entry] : this->dataPtr->entries)
+  {
+    if (entry.published == entry.ready)
+      continue;
+
+    Transition t;
+    t.filename = filename;
+    t.previous = entry.published;
+
+    if (entry.ready == State::FAILED)
+      entry.published = State::FAILED;
+    else if (entry.published == State::UNLOADED && entry.placeholder.bytes)
+      entry.published = State::PLACEHOLDER;
+    else
+      entry.published = State::FINAL;
+
+    t.current = entry.published;
+    transitions.push_back(t);
+  }
+
+  this->dataPtr->Evict(transitions);
+
+  return transitions;
+}
+
+//////////////////////////////////////////////////
+TextureStreamer::State TextureStreamer::TextureState(
+    const std::string &_filename) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->entries.find(_filename);
+  if (it == this->dataPtr->entries.end())
+    return State::UNLOADED;
+  return it->second.published;
+}
+
+//////////////////////////////////////////////////
+TextureStreamer::Data TextureStreamer::TextureData(
+    const std::string &_filename) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto it = this->dataPtr->entries.find(_filename);
+  if (it == this->dataPtr->entries.end())
+    return Data();
+
+  if (it->second.published == State::FINAL)
+    return it->second.full;
+  if (it->second.published == State::PLACEHOLDER)
+    return it->second.placeholder;
+  return Data();
+}
+
+//////////////////////////////////////////////////
+void TextureStreamer::SetMemoryBudget(uint64_t _bytes)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->memoryBudget = _bytes;
+  this->dataPtr->budgetWarned = false;
+}
+
+//////////////////////////////////////////////////
+uint64_t TextureStreamer::MemoryBudget() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->memoryBudget;
+}
+
+//////////////////////////////////////////////////
+uint64_t TextureStreamer::MemoryUsage() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->memoryUsage;
+}
+
+//////////////////////////////////////////////////
+void TextureStreamer::SetPlaceholderSize(unsigned int _size)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->placeholderSize = std::max(_size, 1u);
+}
+
+//////////////////////////////////////////////////
+unsigned int TextureStreamer::PlaceholderSize() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->placeholderSize;
+}
+
+//////////////////////////////////////////////////
+bool TextureStreamer::Wait(std::chrono::milliseconds _timeout)
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->doneCondition.wait_for(lock, _timeout, [this]()
+  {
+    return this->dataPtr->pendingCount == 0u;
+  });
+}
+
+//////////////////////////////////////////////////
+TextureStreamer::Data TextureStreamer::HalfSize(const Data &_data)
+{
+  unsigned int channels = 0u;
+  switch (_data.format)
+  {
+    case common::Image::L_INT8:
+      channels = 1u;
+      break;
+    case common::Image::RGB_INT8:
+      channels = 3u;
+      break;
+    case common::Image::RGBA_INT8:
+      channels = 4u;
+      break;
+    default:
+      return Data();
+  }
+
+  if (!_data.bytes || _data.width == 0u || _data.height == 0u)
+    return Data();
+
+  Data half;
+  half.format = _data.format;
+  half.width = std::max((_data.width + 1u) / 2u, 1u);
+  half.height = std::max((_data.height + 1u) / 2u, 1u);
+
+  const std::vector<unsigned char> &src = *_data.bytes;
+  auto dst = std::make_shared<std::vector<unsigned char>>(
+      static_cast<size_t>(half.width) * half.height * channels);
+
+  for (unsigned int y = 0; y < half.height; ++y)
+  {
+    unsigned int y0 = std::min(y * 2u, _data.height - 1u);
+    unsigned int y1 = std::min(y * 2u + 1u, _data.height - 1u);
+    for (unsigned int x = 0; x < half.width; ++x)
+    {
+      unsigned int x0 = std::min(x * 2u, _data.width - 1u);
+      unsigned int x1 = std::min(x * 2u + 1u, _data.width - 1u);
+      for (unsigned int c = 0; c < channels; ++c)
+      {
+        unsigned int sum =
+            src[(static_cast<size_t>(y0) * _data.width + x0) * channels + c] +
+            src[(static_cast<size_t>(y0) * _data.width + x1) * channels + c] +
+            src[(static_cast<size_t>(y1) * _data.width + x0) * channels + c] +
+            src[(static_cast<size_t>(y1) * _data.width + x1) * channels + c];
+        (*dst)[(static_cast<size_t>(y) * half.width + x) * channels + c] =
+            static_cast<unsigned char>((sum + 2u) / 4u);
+      }
+    }
+  }
+
+  half.bytes = dst;
+  return half;
+}
+
+//////////////////////////////////////////////////
+void TextureStreamerPrivate::Run()
+{
+  while (true)
+  {
+    std::string filename;
+    unsigned int maxSize = 0u;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->workCondition.wait(lock, [this]()
+      {
+        return this->stop || !this->queue.empty();
+      });
+      if (this->stop)
+        return;
+
+      filename = this->queue.front();
+      this->queue.pop_front();
+      maxSize = this->placeholderSize;
+    }
+
+    TextureStreamer::Data placeholder;
+    TextureStreamer::Data full;
+    bool result = Decode(filename, maxSize, placeholder, full);
+
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->pendingCount--;
+      auto it = this->entries.find(filename);
+      if (it != this->entries.end())
+      {
+        TextureStreamerPrivate::Entry &entry = it->second;
+        entry.pending = false;
+        if (result)
+        {
+          this->memoryUsage -= Size(entry.placeholder) + Size(entry.full);
+          entry.placeholder = placeholder;
+          entry.full = full;
+          this->memoryUsage += Size(entry.placeholder) + Size(entry.full);
+          entry.ready = TextureStreamer::State::FINAL;
+        }
+        else
+        {
+          entry.ready = TextureStreamer::State::FAILED;
+        }
+      }
+    }
+    this->doneCondition.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+bool TextureStreamerPrivate::Decode(const std::string &_filename,
+    unsigned int _placeholderSize, TextureStreamer::Data &_placeholder,
+    TextureStreamer::Data &_full)
+{
+  common::Image image;
+  if (image.Load(_filename) != 0 || !image.Valid())
+    return false;
+
+  common::Image::PixelFormatType format = image.PixelFormat();
+  if (format != common::Image::L_INT8 && format != common::Image::RGB_INT8 &&
+      format != common::Image::RGBA_INT8)
+  {
+    // other formats are left to the synchronous loader of the render engine
+    return false;
+  }
+
+  unsigned char *data = nullptr;
+  unsigned int count = 0u;
+  image.Data(&data, count);
+  if (!data)
+    return false;
+
+  _full.width = image.Width();
+  _full.height = image.Height();
+  _full.format = format;
+  _full.bytes = std::make_shared<std::vector<unsigned char>>(
+      data, data + count);
+  delete [] data;
+
+  // reduce the mip chain down to the placeholder size
+  TextureStreamer::Data mip = _full;
+  while (mip.width > _placeholderSize || mip.height > _placeholderSize)
+    mip = TextureStreamer::HalfSize(mip);
+
+  // small textures do not need a placeholder
+  if (mip.bytes != _full.bytes)
+    _placeholder = mip;
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+uint64_t TextureStreamerPrivate::Size(const TextureStreamer::Data &_data)
+{
+  return _data.bytes ? _data.bytes->size() : 0u;
+}
+
+//////////////////////////////////////////////////
+void TextureStreamerPrivate::Evict(
+    std::vector<TextureStreamer::Transition> &_transitions)
+{
+  while (this->memoryUsage > this->memoryBudget)
+  {
+    // find least recently used texture that nobody requests
+    auto lru = this->entries.end();
+    for (auto it = this->entries.begin(); it != this->entries.end(); ++it)
+    {
+      const TextureStreamerPrivate::Entry &entry = it->second;
+      if (entry.useCount > 0u || entry.pending ||
+          (Size(entry.placeholder) + Size(entry.full)) == 0u)
+      {
+        continue;
+      }
+      if (lru == this->entries.end() || entry.lastUse < lru->second.lastUse)
+        lru = it;
+    }
+
+    if (lru == this->entries.end())
+    {
+      if (!this->budgetWarned)
+      {
+        ignwarn << "Textures in use exceed the texture memory budget of "
+                << this->memoryBudget << " bytes" << std::endl;
+        this->budgetWarned = true;
+      }
+      return;
+    }
+
+    TextureStreamerPrivate::Entry &entry = lru->second;
+    TextureStreamer::Transition t;
+    t.filename = lru->first;
+    t.previous = entry.published;
+
+    // drop the full resolution level first and keep the mip tail
+    if (entry.full.bytes && entry.placeholder.bytes)
+    {
+      this->memoryUsage -= Size(entry.full);
+      entry.full = TextureStreamer::Data();
+      entry.ready = TextureStreamer::State::PLACEHOLDER;
+      entry.published = std::min(entry.published,
+          TextureStreamer::State::PLACEHOLDER);
+      t.current = entry.published;
+      _transitions.push_back(t);
+      continue;
+    }
+
+    this->memoryUsage -= Size(entry.placeholder) + Size(entry.full);
+    t.current = TextureStreamer::State::UNLOADED;
+    _transitions.push_back(t);
+    this->entries.erase(lru);
+  }
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Filesystem.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/TextureStreamer.hh"
+
+using namespace ignition;
+using namespace rendering;
+using namespace std::chrono_literals;
+
+const std::string TEST_MEDIA_PATH =
+    common::joinPaths(std::string(PROJECT_SOURCE_PATH), "test", "media",
+        "materials", "textures");
+
+/////////////////////////////////////////////////
+TEST(TextureStreamerTest, HalfSize)
+{
+  TextureStreamer::Data data;
+  data.width = 3u;
+  data.height = 2u;
+  data.format = common::Image::L_INT8;
+  data.bytes = std::make_shared<std::vector<unsigned char>>(
+      std::vector<unsigned char>{0, 100, 200, 100, 200, 0});
+
+  TextureStreamer::Data half = TextureStreamer::HalfSize(data);
+  EXPECT_EQ(2u, half.width);
+  EXPECT_EQ(1u, half.height);
+  ASSERT_NE(nullptr, half.bytes);
+  ASSERT_EQ(2u, half.bytes->size());
+  EXPECT_EQ(100u, (*half.bytes)[0]);
+  // odd column is replicated
+  EXPECT_EQ(100u, (*half.bytes)[1]);
+
+  // unsupported format
+  data.format = common::Image::RGB_FLOAT32;
+  EXPECT_EQ(nullptr, TextureStreamer::HalfSize(data).bytes);
+}
+
+/////////////////////////////////////////////////
+TEST(TextureStreamerTest, PlaceholderThenFinal)
+{
+  // 200 x 100 RGBA texture
+  std::string texture = common::joinPaths(TEST_MEDIA_PATH, "texture.png");
+
+  TextureStreamer streamer;
+  streamer.SetPlaceholderSize(16u);
+  EXPECT_EQ(16u, streamer.PlaceholderSize());
+
+  streamer.Request(texture);
+  EXPECT_EQ(TextureStreamer::State::UNLOADED, streamer.TextureState(texture));
+  EXPECT_EQ(nullptr, streamer.TextureData(texture).bytes);
+  ASSERT_TRUE(streamer.Wait(10s));
+
+  // first update publishes the placeholder
+  std::vector<TextureStreamer::Transition> transitions = streamer.Update();
+  ASSERT_EQ(1u, transitions.size());
+  EXPECT_EQ(texture, transitions[0].filename);
+  EXPECT_EQ(TextureStreamer::State::UNLOADED, transitions[0].previous);
+  EXPECT_EQ(TextureStreamer::State::PLACEHOLDER, transitions[0].current);
+  EXPECT_EQ(TextureStreamer::State::PLACEHOLDER,
+      streamer.TextureState(texture));
+
+  TextureStreamer::Data data = streamer.TextureData(texture);
+  EXPECT_EQ(13u, data.width);
+  EXPECT_EQ(7u, data.height);
+  EXPECT_EQ(common::Image::RGBA_INT8, data.format);
+  ASSERT_NE(nullptr, data.bytes);
+  EXPECT_EQ(13u * 7u * 4u, data.bytes->size());
+
+  // second update upgrades to full resolution
+  transitions = streamer.Update();
+  ASSERT_EQ(1u, transitions.size());
+  EXPECT_EQ(TextureStreamer::State::PLACEHOLDER, transitions[0].previous);
+  EXPECT_EQ(TextureStreamer::State::FINAL, transitions[0].current);
+
+  data = streamer.TextureData(texture);
+  EXPECT_EQ(200u, data.width);
+  EXPECT_EQ(100u, data.height);
+  ASSERT_NE(nullptr, data.bytes);
+  EXPECT_EQ(200u * 100u * 4u, data.bytes->size());
+
+  // nothing left to do
+  EXPECT_TRUE(streamer.Update().empty());
+  EXPECT_EQ(200u * 100u * 4u + 13u * 7u * 4u, streamer.MemoryUsage());
+
+  // requesting the texture again does not decode it again
+  streamer.Request(texture);
+  EXPECT_TRUE(streamer.Wait(0ms));
+  EXPECT_EQ(TextureStreamer::State::FINAL, streamer.TextureState(texture));
+  streamer.Release(texture);
+  streamer.Release(texture);
+}
+
+/////////////////////////////////////////////////
+TEST(TextureStreamerTest, Eviction)
+{
+  std::string texture = common::joinPaths(TEST_MEDIA_PATH, "texture.png");
+
+  TextureStreamer streamer(1u);
+  streamer.SetPlaceholderSize(16u);
+  streamer.SetMemoryBudget(0u);
+  EXPECT_EQ(0u, streamer.MemoryBudget());
+
+  streamer.Request(texture);
+  ASSERT_TRUE(streamer.Wait(10s));
+  streamer.Update();
+  streamer.Update();
+
+  // textures in use are never evicted
+  EXPECT_EQ(TextureStreamer::State::FINAL, streamer.TextureState(texture));
+  EXPECT_TRUE(streamer.Update().empty());
+
+  // once released the full resolution level is dropped, then the mip tail
+  streamer.Release(texture);
+  std::vector<TextureStreamer::Transition> transitions = streamer.Update();
+  ASSERT_EQ(2u, transitions.size());
+  EXPECT_EQ(TextureStreamer::State::FINAL, transitions[0].previous);
+  EXPECT_EQ(TextureStreamer::State::PLACEHOLDER, transitions[0].current);
+  EXPECT_EQ(TextureStreamer::State::PLACEHOLDER, transitions[1].previous);
+  EXPECT_EQ(TextureStreamer::State::UNLOADED, transitions[1].current);
+  EXPECT_EQ(0u, streamer.MemoryUsage());
+  EXPECT_EQ(TextureStreamer::State::UNLOADED, streamer.TextureState(texture));
+
+  // with enough budget only the full resolution level of unused textures is
+  // evicted
+  streamer.SetMemoryBudget(1024u);
+  streamer.Request(texture);
+  ASSERT_TRUE(streamer.Wait(10s));
+  streamer.Update();
+  streamer.Update();
+  streamer.Release(texture);
+  transitions = streamer.Update();
+  ASSERT_EQ(1u, transitions.size());
+  EXPECT_EQ(TextureStreamer::State::PLACEHOLDER, transitions[0].current);
+  EXPECT_EQ(13u * 7u * 4u, streamer.MemoryUsage());
+
+  // requesting it again restores the full resolution
+  streamer.Request(texture);
+  ASSERT_TRUE(streamer.Wait(10s));
+  transitions = streamer.Update();
+  ASSERT_EQ(1u, transitions.size());
+  EXPECT_EQ(TextureStreamer::State::FINAL, transitions[0].current);
+  streamer.Release(texture);
+}
+
+/////////////////////////////////////////////////
+TEST(TextureStreamerTest, InvalidTexture)
+{
+  std::string texture = common::joinPaths(TEST_MEDIA_PATH, "invalid.png");
+
+  TextureStreamer streamer;
+  streamer.Request(texture);
+  ASSERT_TRUE(streamer.Wait(10s));
+
+  std::vector<TextureStreamer::Transition> transitions = streamer.Update();
+  ASSERT_EQ(1u, transitions.size());
+  EXPECT_EQ(TextureStreamer::State::FAILED, transitions[0].current);
+  EXPECT_EQ(nullptr, streamer.TextureData(texture).bytes);
+  streamer.Release(texture);
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
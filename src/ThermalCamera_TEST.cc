@@ -38,6 +38,13 @@ class ThermalCameraTest : public testing::Test,
 /////////////////////////////////////////////////
 void ThermalCameraTest::ThermalCamera(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "ThermalCamera not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
   // create and populate scene
   RenderEngine *engine = rendering::engine(_renderEngine);
   if (!engine)
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Trace.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+namespace
+{
+  /// \brief A completed zone
+  struct Event
+  {
+    /// \brief Zone name
+    const char *name;
+
+    /// \brief Start time in nanoseconds
+    int64_t start;
+
+    /// \brief End time in nanoseconds
+    int64_t end;
+  };
+
+  /// \brief Ring buffer of the events of one thread. Only its thread
+  /// writes to it, including when a new capture resets it.
+  struct ThreadBuffer
+  {
+    /// \brief Events, the oldest ones are overwritten when full
+    std::vector<Event> events;
+
+    /// \brief Number of events written during the capture
+    std::atomic<uint64_t> written{0u};
+
+    /// \brief Generation of the capture the events belong to
+    std::atomic<uint64_t> generation{0u};
+
+    /// \brief Thread id in the exported trace
+    unsigned int id = 0u;
+  };
+
+  /// \brief Buffers of all threads that recorded events
+  struct Registry
+  {
+    /// \brief Buffers, kept after their thread exits so that its events
+    /// can still be exported
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    /// \brief Capacity of new buffers
+    std::size_t eventsPerThread = 65536u;
+
+    /// \brief Protects the members above, not taken when recording
+    std::mutex mutex;
+
+    /// \brief Start time of the capture in nanoseconds
+    std::atomic<int64_t> epoch{0};
+
+    /// \brief Generation of the capture, incremented by Start after the
+    /// epoch is set
+    std::atomic<uint64_t> generation{0u};
+  };
+
+  /// \brief Get the registry. It is never destroyed so that threads may
+  /// record while the process exits.
+  /// \return The registry
+  Registry &TraceRegistry()
+  {
+    static Registry *registry = new Registry;
+    return *registry;
+  }
+
+  /// \brief Get the buffer of the calling thread, creating it on first use
+  /// \return The buffer
+  ThreadBuffer &LocalBuffer()
+  {
+    thread_local ThreadBuffer *local = nullptr;
+    if (!local)
+    {
+      Registry &registry = TraceRegistry();
+      auto buffer = std::make_shared<ThreadBuffer>();
+      std::lock_guard<std::mutex> lock(registry.mutex);
+      buffer->events.resize(std::max<std::size_t>(
+          registry.eventsPerThread, 1u));
+      buffer->id = static_cast<unsigned int>(registry.buffers.size()) + 1u;
+      registry.buffers.push_back(buffer);
+      local = buffer.get();
+    }
+    return *local;
+  }
+
+  /// \brief Get the number of events a buffer wrote during the current
+  /// capture
+  /// \param[in] _buffer Thread buffer
+  /// \param[in] _generation Generation of the current capture
+  /// \return Number of events, 0 if the thread has not recorded anything
+  /// since the capture started
+  uint64_t Written(const ThreadBuffer &_buffer, uint64_t _generation)
+  {
+    if (_buffer.generation.load(std::memory_order_acquire) != _generation)
+      return 0u;
+    return _buffer.written.load(std::memory_order_acquire);
+  }
+
+  /// \brief Write a zone name as a JSON string
+  /// \param[in] _out Output stream
+  /// \param[in] _name Zone name
+  void WriteJsonString(std::ostream &_out, const char *_name)
+  {
+    _out << '"';
+    for (const char *c = _name; *c; ++c)
+    {
+      if (*c == '"' || *c == '\\')
+        _out << '\\' << *c;
+      else if (static_cast<unsigned char>(*c) >= 0x20u)
+        _out << *c;
+    }
+    _out << '"';
+  }
+}
+
+std::atomic<bool> Trace::capturing{false};
+
+//////////////////////////////////////////////////
+void Trace::Start()
+{
+  // the buffers are reset by their own thread when it records the first
+  // event of the new generation
+  Registry &registry = TraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.epoch.store(Now(), std::memory_order_relaxed);
+  registry.generation.fetch_add(1u, std::memory_order_release);
+  capturing.store(true, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////
+void Trace::Stop()
+{
+  capturing.store(false, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////
+void Trace::SetEventsPerThread(std::size_t _count)
+{
+  Registry &registry = TraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.eventsPerThread = _count;
+}
+
+//////////////////////////////////////////////////
+std::size_t Trace::EventsPerThread()
+{
+  Registry &registry = TraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.eventsPerThread;
+}
+
+//////////////////////////////////////////////////
+std::size_t Trace::EventCount()
+{
+  Registry &registry = TraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  uint64_t generation = registry.generation.load(std::memory_order_acquire);
+  std::size_t count = 0u;
+  for (auto &buffer : registry.buffers)
+  {
+    count += static_cast<std::size_t>(std::min<uint64_t>(
+        Written(*buffer, generation), buffer->events.size()));
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+uint64_t Trace::LostEventCount()
+{
+  Registry &registry = TraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  uint64_t generation = registry.generation.load(std::memory_order_acquire);
+  uint64_t count = 0u;
+  for (auto &buffer : registry.buffers)
+  {
+    uint64_t written = Written(*buffer, generation);
+    if (written > buffer->events.size())
+      count += written - buffer->events.size();
+  }
+  return count;
+}
+
+//////////////////////////////////////////////////
+std::string Trace::ChromeTraceJson()
+{
+  Registry &registry = TraceRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  // complete events, timestamps in microseconds since the capture started
+  uint64_t generation = registry.generation.load(std::memory_order_acquire);
+  int64_t epoch = registry.epoch.load(std::memory_order_relaxed);
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(3);
+  out << "{\"traceEvents\":[";
+  bool first = true;
+  for (auto &buffer : registry.buffers)
+  {
+    uint64_t written = Written(*buffer, generation);
+    uint64_t size = buffer->events.size();
+    uint64_t begin = written > size ? written - size : 0u;
+    for (uint64_t i = begin; i < written; ++i)
+    {
+      const Event &event = buffer->events[i % size];
+      out << (first ? "\n" : ",\n") << "{\"name\":";
+      WriteJsonString(out, event.name);
+      out << ",\"cat\":\"ign-rendering\",\"ph\":\"X\",\"pid\":1"
+          << ",\"tid\":" << buffer->id
+          << ",\"ts\":" << (event.start - epoch) * 1e-3
+          << ",\"dur\":" << (event.end - event.start) * 1e-3 << "}";
+      first = false;
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return out.str();
+}
+
+//////////////////////////////////////////////////
+bool Trace::ExportChromeTrace(const std::string &_filename)
+{
+  std::ofstream out(_filename);
+  if (!out)
+  {
+    ignerr << "Unable to open [" << _filename << "] for writing"
+           << std::endl;
+    return false;
+  }
+  out << ChromeTraceJson();
+  if (!out)
+  {
+    ignerr << "Unable to write trace to [" << _filename << "]" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Trace::Record(const char *_name, int64_t _start, int64_t _end)
+{
+  Registry &registry = TraceRegistry();
+  uint64_t generation = registry.generation.load(std::memory_order_acquire);
+  int64_t epoch = registry.epoch.load(std::memory_order_relaxed);
+
+  // zones that ended before the capture started belong to the previous
+  // one, zones that were open when it started are cut at its start
+  if (_end < epoch)
+    return;
+  _start = std::max(_start, epoch);
+
+  ThreadBuffer &buffer = LocalBuffer();
+  uint64_t index = 0u;
+  if (buffer.generation.load(std::memory_order_relaxed) == generation)
+  {
+    index = buffer.written.load(std::memory_order_relaxed);
+  }
+  else
+  {
+    buffer.written.store(0u, std::memory_order_relaxed);
+    buffer.generation.store(generation, std::memory_order_release);
+  }
+  buffer.events[index % buffer.events.size()] = {_name, _start, _end};
+  buffer.written.store(index + 1u, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////
+int64_t Trace::Now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
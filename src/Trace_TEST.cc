@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Trace.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/////////////////////////////////////////////////
+TEST(TraceTest, Capture)
+{
+  // nothing is recorded while not capturing
+  Trace::Start();
+  Trace::Stop();
+  EXPECT_FALSE(Trace::Capturing());
+  {
+    TraceZone zone("idle");
+  }
+  EXPECT_EQ(0u, Trace::EventCount());
+
+  Trace::Start();
+  EXPECT_TRUE(Trace::Capturing());
+  {
+    TraceZone outer("outer");
+    TraceZone inner("in\"ner");
+  }
+  Trace::Stop();
+  EXPECT_EQ(2u, Trace::EventCount());
+  EXPECT_EQ(0u, Trace::LostEventCount());
+
+  std::string json = Trace::ChromeTraceJson();
+  EXPECT_EQ(0u, json.find("{\"traceEvents\":["));
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"outer\""));
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"in\\\"ner\""));
+  EXPECT_NE(std::string::npos, json.find("\"ph\":\"X\""));
+
+  // the inner zone ends first and is recorded first
+  EXPECT_LT(json.find("in\\\"ner"), json.find("outer"));
+
+  // a new capture discards the previous one
+  Trace::Start();
+  Trace::Stop();
+  EXPECT_EQ(0u, Trace::EventCount());
+}
+
+/////////////////////////////////////////////////
+TEST(TraceTest, Threads)
+{
+  const unsigned int threadCount = 4u;
+  const unsigned int zoneCount = 100u;
+
+  Trace::Start();
+  std::vector<std::thread> threads;
+  for (unsigned int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&]
+        {
+          for (unsigned int i = 0; i < zoneCount; ++i)
+            TraceZone zone("thread");
+        });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  Trace::Stop();
+
+  // events of exited threads are kept
+  EXPECT_EQ(threadCount * zoneCount, Trace::EventCount());
+}
+
+/////////////////////////////////////////////////
+TEST(TraceTest, Restart)
+{
+  // a thread that recorded during the previous capture and stays idle does
+  // not contribute events to the new one
+  Trace::Start();
+  std::thread thread([]
+      {
+        TraceZone zone("previous");
+      });
+  thread.join();
+  EXPECT_EQ(1u, Trace::EventCount());
+
+  // a zone open while a capture starts is cut at the start of the capture
+  {
+    TraceZone zone("open");
+    Trace::Start();
+  }
+  Trace::Stop();
+  EXPECT_EQ(1u, Trace::EventCount());
+  EXPECT_EQ(0u, Trace::LostEventCount());
+
+  std::string json = Trace::ChromeTraceJson();
+  EXPECT_EQ(std::string::npos, json.find("previous"));
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"open\""));
+  EXPECT_NE(std::string::npos, json.find("\"ts\":0.000,"));
+
+  // a zone that ended before the capture started is dropped
+  int64_t end = Trace::Now();
+  Trace::Start();
+  Trace::Record("ended", end - 1000, end);
+  Trace::Stop();
+  EXPECT_EQ(0u, Trace::EventCount());
+}
+
+/////////////////////////////////////////////////
+TEST(TraceTest, RingBuffer)
+{
+  std::size_t eventsPerThread = Trace::EventsPerThread();
+  Trace::SetEventsPerThread(8u);
+  EXPECT_EQ(8u, Trace::EventsPerThread());
+
+  // only threads recording afterwards get the new size
+  Trace::Start();
+  std::thread thread([]
+      {
+        for (unsigned int i = 0; i < 20u; ++i)
+          TraceZone zone("ring");
+      });
+  thread.join();
+  Trace::Stop();
+  EXPECT_EQ(8u, Trace::EventCount());
+  EXPECT_EQ(12u, Trace::LostEventCount());
+
+  Trace::SetEventsPerThread(eventsPerThread);
+}
+
+/////////////////////////////////////////////////
+TEST(TraceTest, Export)
+{
+  Trace::Start();
+  {
+    TraceZone zone("export");
+  }
+  Trace::Stop();
+
+  std::string filename = std::string(PROJECT_BUILD_PATH) + "/trace_test.json";
+  EXPECT_TRUE(Trace::ExportChromeTrace(filename));
+  std::ifstream in(filename);
+  std::string content((std::istreambuf_iterator<char>(in)),
+      std::istreambuf_iterator<char>());
+  EXPECT_EQ(Trace::ChromeTraceJson(), content);
+
+  EXPECT_FALSE(Trace::ExportChromeTrace(""));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
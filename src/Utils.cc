@@ -20,6 +20,9 @@
 #include <X11/Xresource.h>
 #endif
 
+#include <ignition/common/Console.hh>
+
+#include "ignition/rendering/Mesh.hh"
 #include "ignition/rendering/Utils.hh"
 
 namespace ignition
@@ -155,6 +158,64 @@ ignition::math::AxisAlignedBox transformAxisAlignedBox(
   }
   return ignition::math::AxisAlignedBox(min, max);
 }
+
+/////////////////////////////////////////////////
+bool setSkeletonBoneTransforms(const std::vector<MeshPtr> &_meshes,
+    const std::vector<ignition::math::Matrix4d> &_tfs)
+{
+  if (_meshes.empty())
+    return true;
+
+  if (!_meshes[0])
+    return false;
+
+  // meshes sharing a skeleton definition have the same bone order, so the
+  // bone count is only queried on the first mesh. Each mesh clamps the
+  // transforms to its own bone count.
+  bool result = _tfs.size() == _meshes[0]->SkeletonBoneCount();
+  for (const auto &mesh : _meshes)
+  {
+    if (!mesh)
+    {
+      result = false;
+      continue;
+    }
+    mesh->SetSkeletonBoneTransforms(_tfs);
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+bool setSkeletonBoneTransforms(const std::vector<MeshPtr> &_meshes,
+    const std::vector<std::vector<ignition::math::Matrix4d>> &_tfs)
+{
+  if (_meshes.size() != _tfs.size())
+  {
+    ignerr << "Number of skeleton poses [" << _tfs.size() << "] does not "
+           << "match number of meshes [" << _meshes.size() << "]"
+           << std::endl;
+    return false;
+  }
+
+  if (_meshes.empty())
+    return true;
+
+  if (!_meshes[0])
+    return false;
+
+  unsigned int boneCount = _meshes[0]->SkeletonBoneCount();
+  bool result = true;
+  for (unsigned int i = 0; i < _meshes.size(); ++i)
+  {
+    if (!_meshes[i] || _tfs[i].size() != boneCount)
+    {
+      result = false;
+      continue;
+    }
+    _meshes[i]->SetSkeletonBoneTransforms(_tfs[i]);
+  }
+  return result;
+}
 }
 }
 }
@@ -17,7 +17,10 @@
 
 #include <ignition/common/Console.hh>
 
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/CameraArray.hh"
 #include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/Scene.hh"
 #include "ignition/rendering/base/BaseRenderEngine.hh"
 
 using namespace ignition;
@@ -241,6 +244,46 @@ void BaseRenderEngine::Destroy()
   this->initialized = false;
 }
 
+//////////////////////////////////////////////////
+void BaseRenderEngine::RenderScenes(const std::vector<ScenePtr> &_scenes)
+{
+  std::vector<ScenePtr> scenes;
+  scenes.reserve(_scenes.size());
+  for (auto &scene : _scenes)
+  {
+    if (!scene || !this->HasScene(scene))
+    {
+      ignerr << "Unable to render a scene not created by this render-engine"
+             << std::endl;
+      continue;
+    }
+    scenes.push_back(scene);
+  }
+
+  for (auto &scene : scenes)
+    scene->PreRender();
+
+  this->BeginRenderBatch();
+  for (auto &scene : scenes)
+  {
+    for (unsigned int i = 0; i < scene->SensorCount(); ++i)
+    {
+      SensorPtr sensor = scene->SensorByIndex(i);
+      if (auto camera = std::dynamic_pointer_cast<Camera>(sensor))
+        camera->Render();
+      else if (auto array = std::dynamic_pointer_cast<CameraArray>(sensor))
+        array->Render();
+    }
+  }
+  this->EndRenderBatch();
+
+  for (auto &scene : scenes)
+  {
+    for (unsigned int i = 0; i < scene->SensorCount(); ++i)
+      scene->SensorByIndex(i)->PostRender();
+  }
+}
+
 //////////////////////////////////////////////////
 void BaseRenderEngine::AddResourcePath(const std::string &_path)
 {
@@ -257,6 +300,16 @@ void BaseRenderEngine::PrepareScene(ScenePtr _scene)
   }
 }
 
+//////////////////////////////////////////////////
+void BaseRenderEngine::BeginRenderBatch()
+{
+}
+
+//////////////////////////////////////////////////
+void BaseRenderEngine::EndRenderBatch()
+{
+}
+
 //////////////////////////////////////////////////
 unsigned int BaseRenderEngine::NextSceneId()
 {
@@ -274,3 +327,9 @@ RenderPassSystemPtr BaseRenderEngine::RenderPassSystem() const
   }
   return this->renderPassSystem;
 }
+
+//////////////////////////////////////////////////
+rendering::EngineResourceStats BaseRenderEngine::ResourceStats() const
+{
+  return rendering::EngineResourceStats();
+}
@@ -30,16 +30,19 @@
 #include "ignition/rendering/LidarVisual.hh"
 #include "ignition/rendering/LightVisual.hh"
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/CameraArray.hh"
 #include "ignition/rendering/Capsule.hh"
 #include "ignition/rendering/DepthCamera.hh"
 #include "ignition/rendering/GizmoVisual.hh"
 #include "ignition/rendering/GpuRays.hh"
 #include "ignition/rendering/Grid.hh"
+#include "ignition/rendering/InstanceBatch.hh"
 #include "ignition/rendering/ParticleEmitter.hh"
 #include "ignition/rendering/RayQuery.hh"
 #include "ignition/rendering/RenderTarget.hh"
 #include "ignition/rendering/Text.hh"
 #include "ignition/rendering/ThermalCamera.hh"
+#include "ignition/rendering/Trace.hh"
 #include "ignition/rendering/Visual.hh"
 #include "ignition/rendering/base/BaseStorage.hh"
 #include "ignition/rendering/base/BaseScene.hh"
@@ -838,6 +841,33 @@ GpuRaysPtr BaseScene::CreateGpuRays(const unsigned int _id,
   return (result) ? gpuRays : nullptr;
 }
 
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray()
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateCameraArray(objId);
+}
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray(const unsigned int _id)
+{
+  std::string objName = this->CreateObjectName(_id, "CameraArray");
+  return this->CreateCameraArray(_id, objName);
+}
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray(const std::string &_name)
+{
+  unsigned int objId = this->CreateObjectId();
+  return this->CreateCameraArray(objId, _name);
+}
+//////////////////////////////////////////////////
+CameraArrayPtr BaseScene::CreateCameraArray(const unsigned int _id,
+    const std::string &_name)
+{
+  CameraArrayPtr cameraArray = this->CreateCameraArrayImpl(_id, _name);
+  bool result = this->RegisterSensor(cameraArray);
+  return (result) ? cameraArray : nullptr;
+}
+
 //////////////////////////////////////////////////
 VisualPtr BaseScene::CreateVisual()
 {
@@ -1181,6 +1211,23 @@ RayQueryPtr BaseScene::CreateRayQuery()
   return this->CreateRayQueryImpl(objId, objName);
 }
 
+//////////////////////////////////////////////////
+InstanceBatchPtr BaseScene::CreateInstanceBatch(const MeshDescriptor &_desc,
+    MaterialPtr _material, unsigned int _count)
+{
+  if (_count == 0u)
+  {
+    ignerr << "Unable to create instance batch without instances"
+           << std::endl;
+    return InstanceBatchPtr();
+  }
+
+  unsigned int objId = this->CreateObjectId();
+  std::string objName = this->CreateObjectName(objId, "InstanceBatch");
+  return this->CreateInstanceBatchImpl(objId, objName, _desc, _material,
+      _count);
+}
+
 //////////////////////////////////////////////////
 ParticleEmitterPtr BaseScene::CreateParticleEmitter()
 {
@@ -1228,13 +1275,52 @@ bool BaseScene::SkyEnabled() const
   return false;
 }
 
+//////////////////////////////////////////////////
+void BaseScene::BakeStaticGeometry()
+{
+  // no op, let derived class implement this.
+  ignerr << "Static geometry baking not supported by: "
+         << this->Engine()->Name() << std::endl;
+}
+
+//////////////////////////////////////////////////
+void BaseScene::ClearStaticGeometry()
+{
+  // no op, let derived class implement this.
+}
+
+//////////////////////////////////////////////////
+unsigned int BaseScene::StaticGeometryBatchCount() const
+{
+  return 0u;
+}
+
 
 //////////////////////////////////////////////////
 void BaseScene::PreRender()
 {
+  IGN_RENDERING_TRACE_ZONE("BaseScene::PreRender");
   this->RootVisual()->PreRender();
 }
 
+//////////////////////////////////////////////////
+void BaseScene::MarkChanged()
+{
+  ++this->changeGeneration;
+}
+
+//////////////////////////////////////////////////
+uint64_t BaseScene::ChangeGeneration() const
+{
+  return this->changeGeneration;
+}
+
+//////////////////////////////////////////////////
+rendering::ResourceStats BaseScene::ResourceStats() const
+{
+  return rendering::ResourceStats();
+}
+
 //////////////////////////////////////////////////
 void BaseScene::Clear()
 {
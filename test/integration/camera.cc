@@ -22,9 +22,12 @@
 #include "test_config.h"  // NOLINT(build/include)
 
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/RayQuery.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/base/BaseScene.hh"
 
 using namespace ignition;
 using namespace rendering;
@@ -49,6 +52,18 @@ class CameraTest: public testing::Test,
 
   // Test and verify camera select function method using Selection Buffer
   public: void VisualAt(const std::string &_renderEngine);
+
+  // Test and verify rectangle and multi-point selection using the id buffer
+  public: void VisualsInRect(const std::string &_renderEngine);
+
+  // Test and verify the GPU pick against ray queries
+  public: void PickAt(const std::string &_renderEngine);
+
+  // Test that picking reuses the id buffer until the scene changes
+  public: void PickAtCache(const std::string &_renderEngine);
+
+  // Test and verify render statistics of a camera
+  public: void RenderStats(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -282,6 +297,303 @@ void CameraTest::VisualAt(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void CameraTest::VisualsInRect(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "VisualsInRect not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  // same layout as VisualAt, sphere on the left and box on the right
+  VisualPtr box = scene->CreateVisual("box");
+  ASSERT_TRUE(box != nullptr);
+  box->AddGeometry(scene->CreateBox());
+  box->SetOrigin(0.0, 0.7, 0.0);
+  box->SetLocalPosition(2, 0, 0);
+  root->AddChild(box);
+
+  VisualPtr sphere = scene->CreateVisual("sphere");
+  ASSERT_TRUE(sphere != nullptr);
+  sphere->AddGeometry(scene->CreateSphere());
+  sphere->SetOrigin(0.0, -0.7, 0.0);
+  sphere->SetLocalPosition(2, 0, 0);
+  root->AddChild(sphere);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetLocalPosition(0.0, 0.0, 0.0);
+  camera->SetLocalRotation(0.0, 0.0, 0.0);
+  camera->SetImageWidth(800);
+  camera->SetImageHeight(600);
+  camera->SetAspectRatio(1.333);
+  camera->SetHFOV(IGN_PI / 2);
+  root->AddChild(camera);
+  camera->Update();
+
+  // whole image
+  auto visuals = camera->VisualsInRect(math::Vector2i(0, 0),
+      math::Vector2i(799, 599));
+  EXPECT_EQ(2u, visuals.size());
+  EXPECT_NE(visuals.end(), visuals.find(box->Id()));
+  EXPECT_NE(visuals.end(), visuals.find(sphere->Id()));
+
+  // left half, corners in any order
+  visuals = camera->VisualsInRect(math::Vector2i(350, 599),
+      math::Vector2i(0, 0));
+  EXPECT_EQ(1u, visuals.size());
+  EXPECT_NE(visuals.end(), visuals.find(sphere->Id()));
+  unsigned int spherePixels = visuals[sphere->Id()];
+  EXPECT_GT(spherePixels, 0u);
+
+  // a rectangle outside of the image
+  EXPECT_TRUE(camera->VisualsInRect(math::Vector2i(-10, -10),
+      math::Vector2i(-1, -1)).empty());
+
+  // several points, one on the background
+  visuals = camera->VisualsAt({math::Vector2i(200, 300),
+      math::Vector2i(210, 300), math::Vector2i(550, 300),
+      math::Vector2i(50, 300), math::Vector2i(1000, 300)});
+  EXPECT_EQ(2u, visuals.size());
+  EXPECT_EQ(2u, visuals[sphere->Id()]);
+  EXPECT_EQ(1u, visuals[box->Id()]);
+
+  // agrees with VisualAt
+  for (auto x = 0u; x < camera->ImageWidth(); x = x + 100)
+  {
+    math::Vector2i point(x, camera->ImageHeight() / 2);
+    auto vis = camera->VisualAt(point);
+    visuals = camera->VisualsAt({point});
+    if (vis)
+    {
+      EXPECT_EQ(1u, visuals.size()) << "X: " << x;
+      EXPECT_NE(visuals.end(), visuals.find(vis->Id())) << "X: " << x;
+    }
+  }
+
+  // the id buffer follows the scene
+  box->SetLocalPosition(2, 0, 5);
+  camera->Update();
+  visuals = camera->VisualsInRect(math::Vector2i(0, 0),
+      math::Vector2i(799, 599));
+  EXPECT_EQ(1u, visuals.size());
+  EXPECT_EQ(visuals.end(), visuals.find(box->Id()));
+
+  // lower resolution id buffer, out of range scales are ignored
+  EXPECT_DOUBLE_EQ(1.0, camera->SelectionBufferScale());
+  camera->SetSelectionBufferScale(0.5);
+  camera->SetSelectionBufferScale(0.0);
+  camera->SetSelectionBufferScale(2.0);
+  EXPECT_DOUBLE_EQ(0.5, camera->SelectionBufferScale());
+  visuals = camera->VisualsInRect(math::Vector2i(0, 0),
+      math::Vector2i(350, 599));
+  EXPECT_EQ(1u, visuals.size());
+  EXPECT_NE(visuals.end(), visuals.find(sphere->Id()));
+  EXPECT_NEAR(spherePixels / 4.0, visuals[sphere->Id()],
+      spherePixels * 0.05);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void CameraTest::PickAt(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "PickAt not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  // a rotated box and a sphere so that normals vary
+  VisualPtr box = scene->CreateVisual("box");
+  ASSERT_TRUE(box != nullptr);
+  box->AddGeometry(scene->CreateBox());
+  box->SetOrigin(0.0, 0.7, 0.0);
+  box->SetLocalPosition(2, 0, 0);
+  box->SetLocalRotation(0.3, 0.2, 0.5);
+  root->AddChild(box);
+
+  VisualPtr sphere = scene->CreateVisual("sphere");
+  ASSERT_TRUE(sphere != nullptr);
+  sphere->AddGeometry(scene->CreateSphere());
+  sphere->SetOrigin(0.0, -0.7, 0.0);
+  sphere->SetLocalPosition(2, 0, 0);
+  root->AddChild(sphere);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetLocalPosition(0.0, 0.0, 0.0);
+  camera->SetLocalRotation(0.0, 0.0, 0.0);
+  camera->SetImageWidth(800);
+  camera->SetImageHeight(600);
+  camera->SetAspectRatio(1.333);
+  camera->SetHFOV(IGN_PI / 2);
+  root->AddChild(camera);
+  camera->Update();
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_TRUE(rayQuery != nullptr);
+
+  // background
+  EXPECT_FALSE(camera->PickAt(math::Vector2i(50, 300)));
+
+  unsigned int hits = 0u;
+  for (int y = 100; y < 600; y += 50)
+  {
+    for (int x = 0; x < 800; x += 25)
+    {
+      math::Vector2i pos(x, y);
+      RayQueryResult pick = camera->PickAt(pos);
+      if (!pick)
+        continue;
+      ++hits;
+
+      VisualPtr vis = camera->VisualAt(pos);
+      if (vis)
+      {
+        EXPECT_EQ(vis->Id(), pick.objectId) << pos;
+      }
+
+      // the same ray tested against the triangles on the CPU
+      math::Vector3d origin = camera->WorldPosition();
+      EXPECT_NEAR(pick.distance, origin.Distance(pick.point), 1e-3) << pos;
+      rayQuery->SetOrigin(origin);
+      rayQuery->SetDirection((pick.point - origin).Normalized());
+      RayQueryResult expected = rayQuery->ClosestPoint();
+      EXPECT_TRUE(expected) << pos;
+      if (!expected)
+        continue;
+
+      EXPECT_EQ(expected.objectId, pick.objectId) << pos;
+      EXPECT_NEAR(expected.distance, pick.distance, 0.01) << pos;
+      EXPECT_LT(expected.point.Distance(pick.point), 0.01) << pos;
+      EXPECT_NEAR(1.0, pick.normal.Length(), 1e-3) << pos;
+      EXPECT_GT(expected.normal.Dot(pick.normal), 0.95) << pos;
+    }
+  }
+  EXPECT_GT(hits, 20u);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void CameraTest::PickAtCache(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "PickAt not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+  auto baseScene = std::dynamic_pointer_cast<BaseScene>(scene);
+  ASSERT_TRUE(baseScene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  VisualPtr box = scene->CreateVisual("box");
+  ASSERT_TRUE(box != nullptr);
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(2, 0, 0);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  camera->SetHFOV(IGN_PI / 2);
+  root->AddChild(camera);
+  camera->Update();
+
+  math::Vector2i center(160, 120);
+  RayQueryResult pick = camera->PickAt(center);
+  EXPECT_TRUE(pick);
+  EXPECT_EQ(box->Id(), pick.objectId);
+
+  // rendering again without changing anything keeps the scene generation
+  uint64_t generation = baseScene->ChangeGeneration();
+  camera->Update();
+  camera->Update();
+  EXPECT_EQ(generation, baseScene->ChangeGeneration());
+
+  // so the second pick reuses the id buffer instead of rendering it again
+  Trace::Start();
+  pick = camera->PickAt(center);
+  Trace::Stop();
+  EXPECT_TRUE(pick);
+  EXPECT_EQ(box->Id(), pick.objectId);
+  EXPECT_EQ(std::string::npos, Trace::ChromeTraceJson().find(
+      "\"name\":\"BaseCamera::UpdateIdBuffer\""));
+
+  // moving the box out of view changes the generation and the pick
+  box->SetLocalPosition(2, 10, 0);
+  EXPECT_LT(generation, baseScene->ChangeGeneration());
+  camera->Update();
+  generation = baseScene->ChangeGeneration();
+
+  Trace::Start();
+  EXPECT_FALSE(camera->PickAt(center));
+  Trace::Stop();
+#ifdef IGN_RENDERING_TRACING
+  EXPECT_NE(std::string::npos, Trace::ChromeTraceJson().find(
+      "\"name\":\"BaseCamera::UpdateIdBuffer\""));
+#endif
+
+  // hiding the box changes the generation too
+  box->SetVisible(false);
+  EXPECT_LT(generation, baseScene->ChangeGeneration());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 void CameraTest::Follow(const std::string &_renderEngine)
 {
@@ -531,6 +843,70 @@ void CameraTest::Visibility(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void CameraTest::RenderStats(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "RenderStats not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(64);
+  root->AddChild(camera);
+
+  // nothing rendered yet
+  rendering::RenderStats stats = camera->RenderStats();
+  EXPECT_EQ(0u, stats.drawCalls);
+  EXPECT_EQ(0u, stats.triangles);
+
+  // boxes in front of the camera
+  camera->Update();
+  rendering::RenderStats emptyStats = camera->RenderStats();
+  for (unsigned int i = 0u; i < 10u; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(3.0, -2.0 + i * 0.4, 0.0);
+    visual->SetLocalScale(0.2, 0.2, 0.2);
+    root->AddChild(visual);
+  }
+  camera->Update();
+  stats = camera->RenderStats();
+  EXPECT_GT(stats.drawCalls, emptyStats.drawCalls);
+  EXPECT_GT(stats.triangles, emptyStats.triangles);
+  EXPECT_GT(stats.cpuTime, 0.0);
+  if (_renderEngine == "ogre2" || _renderEngine == "cpu")
+    EXPECT_GT(stats.passCount, 0u);
+
+  // GPU time is read back a few frames later where supported
+  for (unsigned int i = 0u; i < 5u; ++i)
+    camera->Update();
+  stats = camera->RenderStats();
+  EXPECT_LT(stats.gpuTime, 1.0);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(CameraTest, Track)
 {
@@ -555,6 +931,30 @@ TEST_P(CameraTest, VisualAt)
   VisualAt(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(CameraTest, VisualsInRect)
+{
+  VisualsInRect(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CameraTest, PickAt)
+{
+  PickAt(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CameraTest, PickAtCache)
+{
+  PickAtCache(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CameraTest, RenderStats)
+{
+  RenderStats(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(Camera, CameraTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
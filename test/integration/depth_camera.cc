@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Filesystem.hh>
 #include <ignition/common/Event.hh>
@@ -66,6 +69,10 @@ class DepthCameraTest: public testing::Test,
   // Compare depth camera image before and after adding particles
   // in the scene
   public: void DepthCameraParticles(const std::string &_renderEngine);
+
+  // Compare depth images with and without point cloud subscribers
+  public: void DepthCameraPointCloudSubscribers(
+      const std::string &_renderEngine);
 };
 
 void DepthCameraTest::DepthCameraBoxes(
@@ -766,6 +773,131 @@ void DepthCameraTest::DepthCameraParticles(
   ignition::rendering::unloadEngine(engine->Name());
 }
 
+void DepthCameraTest::DepthCameraPointCloudSubscribers(
+    const std::string &_renderEngine)
+{
+  unsigned int imgWidth = 128;
+  unsigned int imgHeight = 96;
+
+  // Optix is not supported
+  if (_renderEngine.compare("optix") == 0)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' doesn't support depth cameras" << std::endl;
+    return;
+  }
+
+  auto *engine = ignition::rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ignition::rendering::ScenePtr scene = engine->CreateScene("scene");
+  ignition::rendering::VisualPtr root = scene->RootVisual();
+
+  // boxes at different ranges, partially out of range
+  for (unsigned int i = 0; i < 3u; ++i)
+  {
+    ignition::rendering::VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetLocalPosition(2.0 + 4.0 * i, -1.0 + i, 0.0);
+    root->AddChild(box);
+  }
+
+  {
+    auto depthCamera = scene->CreateDepthCamera("DepthCamera");
+    ASSERT_NE(depthCamera, nullptr);
+    depthCamera->SetImageWidth(imgWidth);
+    depthCamera->SetImageHeight(imgHeight);
+    depthCamera->SetFarClipPlane(8.0);
+    depthCamera->SetNearClipPlane(0.1);
+    depthCamera->SetAspectRatio(
+        static_cast<double>(imgWidth) / imgHeight);
+    depthCamera->SetHFOV(1.05);
+    root->AddChild(depthCamera);
+
+    unsigned int size = imgWidth * imgHeight;
+    std::vector<float> depthOnly(size);
+    std::vector<float> depthWithPointCloud(size);
+    std::vector<float> pointCloud(size * 4u);
+
+    // depth only
+    ignition::common::ConnectionPtr connection =
+      depthCamera->ConnectNewDepthFrame(
+          std::bind(&::OnNewDepthFrame, depthOnly.data(),
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+    g_depthCounter = 0u;
+    depthCamera->Update();
+    EXPECT_EQ(1u, g_depthCounter);
+
+    // depth and point cloud
+    connection = depthCamera->ConnectNewDepthFrame(
+        std::bind(&::OnNewDepthFrame, depthWithPointCloud.data(),
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+    ignition::common::ConnectionPtr connection2 =
+      depthCamera->ConnectNewRgbPointCloud(
+          std::bind(&::OnNewRgbPointCloud, pointCloud.data(),
+            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+            std::placeholders::_4, std::placeholders::_5));
+    g_depthCounter = 0u;
+    g_pointCloudCounter = 0u;
+    depthCamera->Update();
+    EXPECT_EQ(1u, g_depthCounter);
+    EXPECT_EQ(1u, g_pointCloudCounter);
+
+    // depth values are the same in both modes and match the point cloud
+    unsigned int inRange = 0u;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+      if (std::isinf(depthOnly[i]))
+      {
+        EXPECT_TRUE(std::isinf(depthWithPointCloud[i]));
+        continue;
+      }
+      EXPECT_FLOAT_EQ(depthOnly[i], depthWithPointCloud[i]);
+      EXPECT_FLOAT_EQ(depthWithPointCloud[i], pointCloud[i * 4u]);
+      ++inRange;
+    }
+    EXPECT_GT(inRange, 0u);
+    EXPECT_LT(inRange, size);
+
+    // back to depth only once the point cloud subscriber is gone
+    connection2.reset();
+    connection = depthCamera->ConnectNewDepthFrame(
+        std::bind(&::OnNewDepthFrame, depthWithPointCloud.data(),
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+    g_pointCloudCounter = 0u;
+    depthCamera->Update();
+    depthCamera->Update();
+    EXPECT_EQ(0u, g_pointCloudCounter);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+      if (std::isinf(depthOnly[i]))
+        EXPECT_TRUE(std::isinf(depthWithPointCloud[i]));
+      else
+        EXPECT_FLOAT_EQ(depthOnly[i], depthWithPointCloud[i]);
+    }
+
+    // DepthData holds one value per pixel in both modes
+    const float *depthData = depthCamera->DepthData();
+    ASSERT_NE(nullptr, depthData);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+      if (!std::isinf(depthOnly[i]))
+        EXPECT_FLOAT_EQ(depthOnly[i], depthData[i]);
+    }
+  }
+
+  engine->DestroyScene(scene);
+  ignition::rendering::unloadEngine(engine->Name());
+}
+
 TEST_P(DepthCameraTest, DepthCameraBoxes)
 {
   DepthCameraBoxes(GetParam());
@@ -776,6 +908,11 @@ TEST_P(DepthCameraTest, DepthCameraParticles)
   DepthCameraParticles(GetParam());
 }
 
+TEST_P(DepthCameraTest, DepthCameraPointCloudSubscribers)
+{
+  DepthCameraPointCloudSubscribers(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(DepthCamera, DepthCameraTest,
     RENDER_ENGINE_VALUES, ignition::rendering::PrintToStringParam());
 
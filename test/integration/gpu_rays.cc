@@ -17,15 +17,26 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Image.hh>
 #include <ignition/common/Filesystem.hh>
 
 #include "test_config.h"  // NOLINT(build/include)
 
+#include "ignition/rendering/GaussianNoisePass.hh"
 #include "ignition/rendering/GpuRays.hh"
 #include "ignition/rendering/ParticleEmitter.hh"
+#include "ignition/rendering/RangeNoisePass.hh"
 #include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/Scene.hh"
 
@@ -64,6 +75,21 @@ class GpuRaysTest: public testing::Test,
 
   // Test detection of particles
   public: void RaysParticles(const std::string &_renderEngine);
+
+  // Test compact data formats against the default format
+  public: void DataFormats(const std::string &_renderEngine);
+
+  // Test rays with a field of view below 90 degrees
+  public: void NarrowFieldOfView(const std::string &_renderEngine);
+
+  // Test sensors with the same configuration
+  public: void IdenticalSensors(const std::string &_renderEngine);
+
+  // Test range accuracy of a spinning lidar at reduced resolutions
+  public: void ResolutionScale(const std::string &_renderEngine);
+
+  // Test the range distributions of noise render passes
+  public: void Noise(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -150,6 +176,33 @@ void GpuRaysTest::Configure(const std::string &_renderEngine)
     gpuRays->SetVerticalResolution(-0.8);
     EXPECT_DOUBLE_EQ(2.4, gpuRays->HorizontalResolution());
     EXPECT_DOUBLE_EQ(0.8, gpuRays->VerticalResolution());
+
+    EXPECT_DOUBLE_EQ(1.0, gpuRays->ResolutionScale());
+    gpuRays->SetResolutionScale(0.5);
+    EXPECT_DOUBLE_EQ(0.5, gpuRays->ResolutionScale());
+    gpuRays->SetResolutionScale(-1.0);
+    EXPECT_DOUBLE_EQ(0.5, gpuRays->ResolutionScale());
+  }
+
+  // data formats
+  {
+    EXPECT_EQ(GRDF_RANGE_RETRO, gpuRays->DataFormat());
+    EXPECT_EQ(3u, gpuRays->Channels());
+
+    gpuRays->SetDataFormat(GRDF_RANGE);
+    EXPECT_EQ(GRDF_RANGE, gpuRays->DataFormat());
+    EXPECT_EQ(1u, gpuRays->Channels());
+
+    gpuRays->SetDataFormat(GRDF_RANGE_INTENSITY_U8);
+    EXPECT_EQ(GRDF_RANGE_INTENSITY_U8, gpuRays->DataFormat());
+    EXPECT_EQ(2u, gpuRays->Channels());
+
+    gpuRays->SetDataFormat(GRDF_RANGE_U16_MM);
+    EXPECT_EQ(GRDF_RANGE_U16_MM, gpuRays->DataFormat());
+    EXPECT_EQ(1u, gpuRays->Channels());
+
+    gpuRays->SetDataFormat(GRDF_RANGE_RETRO);
+    EXPECT_EQ(3u, gpuRays->Channels());
   }
 
   // Clean up
@@ -690,6 +743,614 @@ void GpuRaysTest::RaysParticles(const std::string &_renderEngine)
   engine->DestroyScene(scene);
   rendering::unloadEngine(engine->Name());
 }
+/////////////////////////////////////////////////
+/// \brief Test that the compact data formats hold the same ranges as the
+/// default format
+void GpuRaysTest::DataFormats(const std::string &_renderEngine)
+{
+#ifdef __APPLE__
+  std::cerr << "Skipping test for apple, see issue #35." << std::endl;
+  return;
+#endif
+
+  if (_renderEngine == "optix")
+  {
+    igndbg << "GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  const double hMinAngle = -IGN_PI/2.0;
+  const double hMaxAngle = IGN_PI/2.0;
+  const double minRange = 0.1;
+  const double maxRange = 10.0;
+  const unsigned int hRayCount = 320;
+  const unsigned int vRayCount = 1;
+  const unsigned int count = hRayCount * vRayCount;
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays_formats");
+  gpuRays->SetWorldPosition(0, 0, 0.1);
+  gpuRays->SetNearClipPlane(minRange);
+  gpuRays->SetFarClipPlane(maxRange);
+  gpuRays->SetAngleMin(hMinAngle);
+  gpuRays->SetAngleMax(hMaxAngle);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  root->AddChild(gpuRays);
+
+  // one box in front and one on the right, the left side is out of range
+  VisualPtr visualBox1 = scene->CreateVisual("FormatBox1");
+  visualBox1->AddGeometry(scene->CreateBox());
+  visualBox1->SetWorldPosition(3.0123, 0, 0.5);
+  visualBox1->SetUserData("laser_retro", 3000.0);
+  root->AddChild(visualBox1);
+
+  VisualPtr visualBox2 = scene->CreateVisual("FormatBox2");
+  visualBox2->AddGeometry(scene->CreateBox());
+  visualBox2->SetWorldPosition(0, -5, 0.5);
+  visualBox2->SetUserData("laser_retro", 500.0);
+  root->AddChild(visualBox2);
+
+  // reference data in the default format
+  gpuRays->Update();
+  std::vector<float> ref(count * 3);
+  gpuRays->Copy(ref.data());
+
+  std::vector<unsigned char> data;
+  std::string format;
+  unsigned int channels = 0u;
+  common::ConnectionPtr c = gpuRays->ConnectNewGpuRaysData(
+      [&](const void *_data, unsigned int _width, unsigned int _height,
+          unsigned int _channels, const std::string &_format)
+      {
+        size_t size = _width * _height;
+        if (_format == "RANGE_FLOAT32_INTENSITY_U8")
+          size *= sizeof(float) + 1u;
+        else if (_format == "RANGE_U16_MM")
+          size *= sizeof(uint16_t);
+        else
+          size *= _channels * sizeof(float);
+        data.resize(size);
+        memcpy(data.data(), _data, size);
+        channels = _channels;
+        format = _format;
+      });
+
+  // range only
+  gpuRays->SetDataFormat(GRDF_RANGE);
+  std::vector<float> scan(count);
+  common::ConnectionPtr c2 = gpuRays->ConnectNewGpuRaysFrame(
+      std::bind(&::OnNewGpuRaysFrame, scan.data(),
+        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+        std::placeholders::_4, std::placeholders::_5));
+  gpuRays->Update();
+  EXPECT_EQ("PF_FLOAT32_R", format);
+  EXPECT_EQ(1u, channels);
+  ASSERT_EQ(count * sizeof(float), data.size());
+  ASSERT_NE(nullptr, gpuRays->Data());
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    EXPECT_FLOAT_EQ(ref[i * 3], scan[i]);
+    EXPECT_FLOAT_EQ(ref[i * 3], gpuRays->Data()[i]);
+  }
+  c2.reset();
+
+  // range and intensity
+  gpuRays->SetDataFormat(GRDF_RANGE_INTENSITY_U8);
+  gpuRays->Update();
+  EXPECT_EQ("RANGE_FLOAT32_INTENSITY_U8", format);
+  EXPECT_EQ(2u, channels);
+  EXPECT_EQ(nullptr, gpuRays->Data());
+  ASSERT_EQ(count * (sizeof(float) + 1u), data.size());
+  const float *ranges = reinterpret_cast<const float *>(data.data());
+  const unsigned char *intensities = data.data() + count * sizeof(float);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    EXPECT_FLOAT_EQ(ref[i * 3], ranges[i]);
+    double expected =
+        std::round(std::min(ref[i * 3 + 1] / 2000.0, 1.0) * 255.0);
+    EXPECT_NEAR(expected, intensities[i], 1.0);
+  }
+  // retro values above 2000 saturate instead of wrapping around
+  EXPECT_EQ(255u, intensities[count / 2]);
+  EXPECT_NEAR(64.0, intensities[0], 1.0);
+
+  // range in millimeters
+  gpuRays->SetDataFormat(GRDF_RANGE_U16_MM);
+  gpuRays->Update();
+  EXPECT_EQ("RANGE_U16_MM", format);
+  EXPECT_EQ(1u, channels);
+  EXPECT_EQ(nullptr, gpuRays->Data());
+  ASSERT_EQ(count * sizeof(uint16_t), data.size());
+  const uint16_t *mm = reinterpret_cast<const uint16_t *>(data.data());
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    if (std::isinf(ref[i * 3]))
+      EXPECT_EQ(65535u, mm[i]);
+    else
+      EXPECT_NEAR(ref[i * 3], mm[i] / 1000.0, 0.0005 + LASER_TOL);
+  }
+
+  // back to the default format
+  gpuRays->SetDataFormat(GRDF_RANGE_RETRO);
+  gpuRays->Update();
+  EXPECT_EQ("PF_FLOAT32_RGB", format);
+  EXPECT_EQ(3u, channels);
+  std::vector<float> scan3(count * 3);
+  gpuRays->Copy(scan3.data());
+  for (unsigned int i = 0; i < count * 3; ++i)
+    EXPECT_FLOAT_EQ(ref[i], scan3[i]);
+
+  c.reset();
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+/// \brief Test rays with a narrow, off center field of view, as used by
+/// solid state lidars. Ogre2 renders those with a single perspective camera.
+void GpuRaysTest::NarrowFieldOfView(const std::string &_renderEngine)
+{
+#ifdef __APPLE__
+  std::cerr << "Skipping test for apple, see issue #35." << std::endl;
+  return;
+#endif
+
+  if (_renderEngine == "optix")
+  {
+    igndbg << "GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  const double hMinAngle = -0.2;
+  const double hMaxAngle = 0.8;
+  const double vMinAngle = -0.3;
+  const double vMaxAngle = 0.05;
+  const double minRange = 0.1;
+  const double maxRange = 10.0;
+  const unsigned int hRayCount = 64;
+  const unsigned int vRayCount = 8;
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays_narrow");
+  gpuRays->SetWorldPosition(0, 0, 0);
+  gpuRays->SetNearClipPlane(minRange);
+  gpuRays->SetFarClipPlane(maxRange);
+  gpuRays->SetAngleMin(hMinAngle);
+  gpuRays->SetAngleMax(hMaxAngle);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalAngleMin(vMinAngle);
+  gpuRays->SetVerticalAngleMax(vMaxAngle);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  root->AddChild(gpuRays);
+
+  // wall in front of the rays, its face is at x = 2.5
+  const double wallDist = 2.5;
+  VisualPtr wall = scene->CreateVisual("NarrowWall");
+  wall->AddGeometry(scene->CreateBox());
+  wall->SetLocalScale(1, 20, 20);
+  wall->SetWorldPosition(wallDist + 0.5, 0, 0);
+  root->AddChild(wall);
+
+  std::vector<float> scan(hRayCount * vRayCount * 3);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+
+  // rays are sampled from the closest pixel, allow for half a pixel of
+  // angular error at the steepest incidence
+  const double tol = 0.03;
+  double hStep = (hMaxAngle - hMinAngle) / (hRayCount - 1);
+  double vStep = (vMaxAngle - vMinAngle) / (vRayCount - 1);
+  for (unsigned int i = 0; i < vRayCount; ++i)
+  {
+    double v = vMinAngle + i * vStep;
+    for (unsigned int j = 0; j < hRayCount; ++j)
+    {
+      double h = hMinAngle + j * hStep;
+      double expected = wallDist / (std::cos(v) * std::cos(h));
+      EXPECT_NEAR(expected, scan[(i * hRayCount + j) * 3], tol)
+          << "ray " << j << ", " << i;
+    }
+  }
+
+  // move the wall out of range
+  wall->SetWorldPosition(maxRange + 1, 0, 0);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  for (unsigned int i = 0; i < hRayCount * vRayCount; ++i)
+    EXPECT_DOUBLE_EQ(ignition::math::INF_D, scan[i * 3]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+/// \brief Test that sensors with the same configuration, which share
+/// resources on some engines, give the same data and keep working when one
+/// of them is destroyed
+void GpuRaysTest::IdenticalSensors(const std::string &_renderEngine)
+{
+#ifdef __APPLE__
+  std::cerr << "Skipping test for apple, see issue #35." << std::endl;
+  return;
+#endif
+
+  if (_renderEngine == "optix")
+  {
+    igndbg << "GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  const unsigned int hRayCount = 320;
+  const unsigned int vRayCount = 4;
+  const unsigned int count = hRayCount * vRayCount * 3;
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  auto createRays = [&](const std::string &_name)
+  {
+    GpuRaysPtr rays = scene->CreateGpuRays(_name);
+    rays->SetWorldPosition(0, 0, 0.1);
+    rays->SetNearClipPlane(0.1);
+    rays->SetFarClipPlane(10.0);
+    rays->SetAngleMin(-IGN_PI/2.0);
+    rays->SetAngleMax(IGN_PI/2.0);
+    rays->SetRayCount(hRayCount);
+    rays->SetVerticalAngleMin(-IGN_PI/8.0);
+    rays->SetVerticalAngleMax(IGN_PI/8.0);
+    rays->SetVerticalRayCount(vRayCount);
+    root->AddChild(rays);
+    return rays;
+  };
+  GpuRaysPtr gpuRays1 = createRays("gpu_rays_identical_1");
+  GpuRaysPtr gpuRays2 = createRays("gpu_rays_identical_2");
+
+  VisualPtr visualBox = scene->CreateVisual("IdenticalBox");
+  visualBox->AddGeometry(scene->CreateBox());
+  visualBox->SetWorldPosition(2.0, 0.5, 0.1);
+  root->AddChild(visualBox);
+
+  std::vector<float> scan1(count);
+  std::vector<float> scan2(count);
+  gpuRays1->Update();
+  gpuRays1->Copy(scan1.data());
+  gpuRays2->Update();
+  gpuRays2->Copy(scan2.data());
+  for (unsigned int i = 0; i < count; i += 3)
+    EXPECT_FLOAT_EQ(scan1[i], scan2[i]);
+
+  // the box is in front of the sensors
+  unsigned int mid = (hRayCount / 2 + (vRayCount / 2) * hRayCount) * 3;
+  EXPECT_LT(scan1[mid], 2.0);
+
+  // the remaining sensor still works
+  scene->DestroySensor(gpuRays1);
+  gpuRays2->Update();
+  std::vector<float> scan3(count);
+  gpuRays2->Copy(scan3.data());
+  for (unsigned int i = 0; i < count; i += 3)
+    EXPECT_FLOAT_EQ(scan2[i], scan3[i]);
+
+  // a new sensor with the same configuration
+  GpuRaysPtr gpuRays3 = createRays("gpu_rays_identical_3");
+  gpuRays3->Update();
+  gpuRays3->Copy(scan3.data());
+  for (unsigned int i = 0; i < count; i += 3)
+    EXPECT_FLOAT_EQ(scan2[i], scan3[i]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+/// \brief Test the range error of a spinning lidar in a room, for the
+/// default resolution and an under-sampled resolution
+void GpuRaysTest::ResolutionScale(const std::string &_renderEngine)
+{
+#ifdef __APPLE__
+  std::cerr << "Skipping test for apple, see issue #35." << std::endl;
+  return;
+#endif
+
+  if (_renderEngine == "optix")
+  {
+    igndbg << "GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  const double hMinAngle = -IGN_PI;
+  const double hMaxAngle = IGN_PI;
+  const double vMinAngle = -IGN_PI/12.0;
+  const double vMaxAngle = IGN_PI/12.0;
+  const unsigned int hRayCount = 720;
+  const unsigned int vRayCount = 16;
+
+  // create and populate scene
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  // square room around the sensors, the inner faces of the walls are at
+  // +-wallDist
+  const double wallDist = 4.0;
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    VisualPtr wall = scene->CreateVisual("ScaleWall" + std::to_string(i));
+    wall->AddGeometry(scene->CreateBox());
+    double sign = i % 2 ? -1.0 : 1.0;
+    if (i < 2)
+    {
+      wall->SetLocalScale(1, 20, 20);
+      wall->SetWorldPosition(sign * (wallDist + 0.5), 0, 0);
+    }
+    else
+    {
+      wall->SetLocalScale(20, 1, 20);
+      wall->SetWorldPosition(0, sign * (wallDist + 0.5), 0);
+    }
+    root->AddChild(wall);
+  }
+
+  // maximum range error for each resolution scale
+  std::vector<std::pair<double, double>> scales = {{1.0, 0.05}, {0.5, 0.1}};
+  for (const auto &scale : scales)
+  {
+    GpuRaysPtr gpuRays = scene->CreateGpuRays(
+        "gpu_rays_scale_" + std::to_string(scale.first));
+    gpuRays->SetWorldPosition(0, 0, 0);
+    gpuRays->SetNearClipPlane(0.1);
+    gpuRays->SetFarClipPlane(20.0);
+    gpuRays->SetAngleMin(hMinAngle);
+    gpuRays->SetAngleMax(hMaxAngle);
+    gpuRays->SetRayCount(hRayCount);
+    gpuRays->SetVerticalAngleMin(vMinAngle);
+    gpuRays->SetVerticalAngleMax(vMaxAngle);
+    gpuRays->SetVerticalRayCount(vRayCount);
+    gpuRays->SetResolutionScale(scale.first);
+    root->AddChild(gpuRays);
+
+    std::vector<float> scan(hRayCount * vRayCount * 3);
+    gpuRays->Update();
+    gpuRays->Copy(scan.data());
+
+    double hStep = (hMaxAngle - hMinAngle) / (hRayCount - 1);
+    double vStep = (vMaxAngle - vMinAngle) / (vRayCount - 1);
+    for (unsigned int i = 0; i < vRayCount; ++i)
+    {
+      double v = vMinAngle + i * vStep;
+      for (unsigned int j = 0; j < hRayCount; ++j)
+      {
+        double h = hMinAngle + j * hStep;
+        double x = std::abs(std::cos(h));
+        double y = std::abs(std::sin(h));
+        // the range is not continuous at the corners of the room
+        if (std::abs(x - y) < 0.05)
+          continue;
+        double expected = wallDist / (std::cos(v) * std::max(x, y));
+        EXPECT_NEAR(expected, scan[(i * hRayCount + j) * 3], scale.second)
+            << "scale " << scale.first << ", ray " << j << ", " << i;
+      }
+    }
+
+    scene->DestroySensor(gpuRays);
+  }
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+/// \brief Test that Gaussian and range noise passes give ranges with the
+/// requested distributions
+void GpuRaysTest::Noise(const std::string &_renderEngine)
+{
+#ifdef __APPLE__
+  std::cerr << "Skipping test for apple, see issue #35." << std::endl;
+  return;
+#endif
+
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "GpuRays render passes not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  const unsigned int hRayCount = 320;
+  const unsigned int vRayCount = 8;
+  const unsigned int rayCount = hRayCount * vRayCount;
+  const unsigned int frameCount = 10;
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  ASSERT_NE(nullptr, rpSystem);
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+
+  VisualPtr root = scene->RootVisual();
+
+  GpuRaysPtr gpuRays = scene->CreateGpuRays("gpu_rays_noise");
+  gpuRays->SetWorldPosition(0, 0, 0);
+  gpuRays->SetNearClipPlane(0.1);
+  gpuRays->SetFarClipPlane(10.0);
+  gpuRays->SetAngleMin(-0.3);
+  gpuRays->SetAngleMax(0.3);
+  gpuRays->SetRayCount(hRayCount);
+  gpuRays->SetVerticalAngleMin(-0.1);
+  gpuRays->SetVerticalAngleMax(0.1);
+  gpuRays->SetVerticalRayCount(vRayCount);
+  root->AddChild(gpuRays);
+
+  // wall in front of the rays, its face is at x = 2.5
+  VisualPtr wall = scene->CreateVisual("NoiseWall");
+  wall->AddGeometry(scene->CreateBox());
+  wall->SetLocalScale(1, 20, 20);
+  wall->SetWorldPosition(3.0, 0, 0);
+  root->AddChild(wall);
+
+  // ranges without noise
+  std::vector<float> clean(rayCount * 3);
+  gpuRays->Update();
+  gpuRays->Copy(clean.data());
+
+  // Gaussian noise
+  const double mean = 0.1;
+  const double stdDev = 0.05;
+  GaussianNoisePassPtr noisePass =
+      std::dynamic_pointer_cast<GaussianNoisePass>(
+      rpSystem->Create<GaussianNoisePass>());
+  ASSERT_NE(nullptr, noisePass);
+  noisePass->SetMean(mean);
+  noisePass->SetStdDev(stdDev);
+  gpuRays->AddRenderPass(noisePass);
+  EXPECT_EQ(1u, gpuRays->RenderPassCount());
+  EXPECT_EQ(noisePass, gpuRays->RenderPassByIndex(0u));
+
+  std::vector<float> scan(rayCount * 3);
+  std::vector<float> previous;
+  double sum = 0.0;
+  double sumSq = 0.0;
+  unsigned int inOneSigma = 0u;
+  for (unsigned int f = 0; f < frameCount; ++f)
+  {
+    gpuRays->Update();
+    gpuRays->Copy(scan.data());
+    // the noise changes every frame
+    EXPECT_NE(previous, scan);
+    previous = scan;
+    for (unsigned int i = 0; i < rayCount; ++i)
+    {
+      double error = scan[i * 3] - clean[i * 3];
+      sum += error;
+      sumSq += error * error;
+      if (std::abs(error - mean) < stdDev)
+        ++inOneSigma;
+      // retro is not noisy
+      EXPECT_FLOAT_EQ(clean[i * 3 + 1], scan[i * 3 + 1]);
+    }
+  }
+  double sampleCount = rayCount * frameCount;
+  double sampleMean = sum / sampleCount;
+  double sampleStdDev = std::sqrt(sumSq / sampleCount -
+      sampleMean * sampleMean);
+  EXPECT_NEAR(mean, sampleMean, 0.005);
+  EXPECT_NEAR(stdDev, sampleStdDev, 0.005);
+  EXPECT_NEAR(0.6827, inOneSigma / sampleCount, 0.02);
+
+  // a disabled pass leaves the ranges unchanged
+  noisePass->SetEnabled(false);
+  gpuRays->Update();
+  gpuRays->Copy(scan.data());
+  for (unsigned int i = 0; i < rayCount; ++i)
+    EXPECT_FLOAT_EQ(clean[i * 3], scan[i * 3]);
+  gpuRays->RemoveRenderPass(noisePass);
+  EXPECT_EQ(0u, gpuRays->RenderPassCount());
+
+  // quantization and dropout
+  const double quantization = 0.25;
+  const double dropout = 0.3;
+  RangeNoisePassPtr rangePass = std::dynamic_pointer_cast<RangeNoisePass>(
+      rpSystem->Create<RangeNoisePass>());
+  ASSERT_NE(nullptr, rangePass);
+  rangePass->SetQuantization(quantization);
+  rangePass->SetDropoutProbability(dropout);
+  EXPECT_DOUBLE_EQ(quantization, rangePass->Quantization());
+  EXPECT_DOUBLE_EQ(dropout, rangePass->DropoutProbability());
+  gpuRays->AddRenderPass(rangePass);
+
+  unsigned int dropped = 0u;
+  for (unsigned int f = 0; f < frameCount; ++f)
+  {
+    gpuRays->Update();
+    gpuRays->Copy(scan.data());
+    for (unsigned int i = 0; i < rayCount; ++i)
+    {
+      float range = scan[i * 3];
+      if (std::isinf(range))
+      {
+        ++dropped;
+        EXPECT_FLOAT_EQ(0.0f, scan[i * 3 + 1]);
+        continue;
+      }
+      double steps = range / quantization;
+      EXPECT_NEAR(std::round(steps), steps, 1e-4) << range;
+      EXPECT_NEAR(clean[i * 3], range, quantization * 0.5 + 1e-4);
+    }
+  }
+  EXPECT_NEAR(dropout, dropped / sampleCount, 0.02);
+
+  // passes other than noise are not supported
+  gpuRays->AddRenderPass(RenderPassPtr());
+  EXPECT_EQ(1u, gpuRays->RenderPassCount());
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(GpuRaysTest, Configure)
 {
@@ -714,6 +1375,36 @@ TEST_P(GpuRaysTest, RaysParticles)
   RaysParticles(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, DataFormats)
+{
+  DataFormats(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, NarrowFieldOfView)
+{
+  NarrowFieldOfView(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, IdenticalSensors)
+{
+  IdenticalSensors(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, ResolutionScale)
+{
+  ResolutionScale(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysTest, Noise)
+{
+  Noise(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(GpuRays, GpuRaysTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
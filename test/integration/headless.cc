@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class HeadlessTest: public testing::Test,
+                    public testing::WithParamInterface<const char *>
+{
+  // Test capturing an image without a display server
+  public: void CaptureWithoutDisplay(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void HeadlessTest::CaptureWithoutDisplay(const std::string &_renderEngine)
+{
+  // the cpu engine never uses a display server
+  if (_renderEngine != "ogre2" && _renderEngine != "cpu")
+  {
+    igndbg << "Headless rendering not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  // make sure no X server is used
+  unsetenv("DISPLAY");
+
+  std::map<std::string, std::string> params;
+  if (_renderEngine == "ogre2")
+  {
+#ifndef HAVE_OGRE2_HEADLESS
+    std::cerr << "Skipping test, headless rendering requires ogre-next 2.2 "
+              << "or later on Linux" << std::endl;
+    return;
+#else
+    params["headless"] = "1";
+#endif
+  }
+  RenderEngine *engine = rendering::engine(_renderEngine, params);
+  ASSERT_NE(nullptr, engine) << "Failed to load '" << _renderEngine
+      << "' without a display, is ogre built with EGL support?";
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetBackgroundColor(0.0, 0.0, 0.0);
+  VisualPtr root = scene->RootVisual();
+
+  MaterialPtr red = scene->CreateMaterial();
+  red->SetAmbient(1.0, 0.0, 0.0);
+  red->SetDiffuse(1.0, 0.0, 0.0);
+  red->SetEmissive(1.0, 0.0, 0.0);
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetMaterial(red);
+  box->SetLocalPosition(2.0, 0.0, 0.0);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(64);
+  camera->SetHFOV(IGN_PI / 2);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+
+  // the box covers the center of the image and nothing else is in view
+  unsigned char *data = image.Data<unsigned char>();
+  unsigned int center = (32u * 64u + 32u) * 3u;
+  EXPECT_GT(data[center], 200u);
+  EXPECT_LT(data[center + 1u], 50u);
+  EXPECT_LT(data[center + 2u], 50u);
+  EXPECT_EQ(0u, data[0]);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(HeadlessTest, CaptureWithoutDisplay)
+{
+  CaptureWithoutDisplay(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Headless, HeadlessTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/InstanceBatch.hh"
+#include "ignition/rendering/PixelFormat.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class InstanceBatchTest: public testing::Test,
+                         public testing::WithParamInterface<const char *>
+{
+  // Test and verify that instances are drawn with a few draw calls
+  public: void DrawCalls(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void InstanceBatchTest::DrawCalls(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "InstanceBatch not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  scene->SetBackgroundColor(0.0, 0.0, 0.0);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(64);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  const unsigned int emptyDrawCalls = camera->RenderStats().drawCalls;
+
+  // a grid of boxes in front of the camera, with two colours
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetDiffuse(0.0, 1.0, 0.0);
+  green->SetAmbient(0.0, 1.0, 0.0);
+
+  const unsigned int count = 100u;
+  InstanceBatchPtr batch = scene->CreateInstanceBatch(
+      MeshDescriptor("unit_box"), green, count);
+  ASSERT_NE(nullptr, batch);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    batch->SetInstancePose(i, math::Pose3d(5.0, -1.8 + (i % 10) * 0.4,
+        -1.8 + (i / 10) * 0.4, 0, 0, 0));
+    batch->SetInstanceScale(i, math::Vector3d(0.3, 0.3, 0.3));
+    if (i % 2)
+      batch->SetInstanceColor(i, math::Color::Red);
+  }
+
+  camera->Capture(image);
+  const unsigned int drawCalls =
+      camera->RenderStats().drawCalls - emptyDrawCalls;
+
+  // the unit box has a single sub-mesh. Ogre draws it with one draw call
+  // whatever the colours, ogre2 with one draw call per colour.
+  if (_renderEngine == "ogre")
+  {
+    EXPECT_EQ(1u, drawCalls);
+  }
+  else
+  {
+    EXPECT_GE(drawCalls, 1u);
+    EXPECT_LE(drawCalls, 2u);
+  }
+
+  // both colours are drawn
+  unsigned int channelCount = PixelUtil::ChannelCount(camera->ImageFormat());
+  unsigned char *data = image.Data<unsigned char>();
+  unsigned int redCount = 0u;
+  unsigned int greenCount = 0u;
+  for (unsigned int i = 0; i < camera->ImageWidth() * camera->ImageHeight();
+      ++i)
+  {
+    unsigned char r = data[i * channelCount];
+    unsigned char g = data[i * channelCount + 1];
+    if (r > 100u && g < 50u)
+      ++redCount;
+    else if (g > 100u && r < 50u)
+      ++greenCount;
+  }
+  EXPECT_GT(redCount, 0u);
+  EXPECT_GT(greenCount, 0u);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(InstanceBatchTest, DrawCalls)
+{
+  DrawCalls(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(InstanceBatch, InstanceBatchTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
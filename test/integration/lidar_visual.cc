@@ -65,7 +65,7 @@ class LidarVisualTest: public testing::Test,
 /// \brief Test LidarVisual configuraions
 void LidarVisualTest::Configure(const std::string &_renderEngine)
 {
-  if (_renderEngine == "optix")
+  if (_renderEngine == "optix" || _renderEngine == "cpu")
   {
     igndbg << "LidarVisual not supported yet in rendering engine: "
             << _renderEngine << std::endl;
@@ -163,7 +163,7 @@ void LidarVisualTest::RaysUnitBox(const std::string &_renderEngine)
   return;
 #endif
 
-  if (_renderEngine == "optix")
+  if (_renderEngine == "optix" || _renderEngine == "cpu")
   {
     igndbg << "LidarVisual not supported yet in rendering engine: "
             << _renderEngine << std::endl;
@@ -405,7 +405,7 @@ void LidarVisualTest::LaserVertical(const std::string &_renderEngine)
   return;
 #endif
 
-  if (_renderEngine == "optix")
+  if (_renderEngine == "optix" || _renderEngine == "cpu")
   {
     igndbg << "LidarVisual not supported yet in rendering engine: "
             << _renderEngine << std::endl;
@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include <ignition/common/Console.hh>
 #include <ignition/common/Image.hh>
 
@@ -56,6 +60,10 @@ class RenderPassTest: public testing::Test,
 
   // Test and verify Gaussian noise pass is applied to a depth camera
   public: void DepthGaussianNoise(const std::string &_renderEngine);
+
+  // Test and verify consecutive noise passes give the same result when they
+  // are fused, and can still be disabled one by one
+  public: void FusedPasses(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -399,6 +407,144 @@ void RenderPassTest::DepthGaussianNoise(const std::string &_renderEngine)
   ignition::rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void RenderPassTest::FusedPasses(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Engine '" << _renderEngine
+           << "' doesn't support fused render passes " << std::endl;
+    return;
+  }
+
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  ASSERT_NE(nullptr, rpSystem);
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+  scene->SetAmbientLight(0.3, 0.3, 0.3);
+  scene->SetBackgroundColor(0.2, 0.2, 0.2);
+
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera();
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetImageWidth(100);
+  camera->SetImageHeight(100);
+  root->AddChild(camera);
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.0, 0.0, -1);
+  light->SetDiffuseColor(0.5, 0.5, 0.5);
+  root->AddChild(light);
+
+  MaterialPtr green = scene->CreateMaterial();
+  green->SetDiffuse(0.0, 0.7, 0.0);
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.0, 0.0, 0.5);
+  box->SetMaterial(green);
+  root->AddChild(box);
+
+  Image image = camera->CreateImage();
+  camera->Capture(image);
+  unsigned int channelCount = PixelUtil::ChannelCount(camera->ImageFormat());
+  unsigned int size = camera->ImageWidth() * camera->ImageHeight() *
+      channelCount;
+  std::vector<unsigned char> clean(image.Data<unsigned char>(),
+      image.Data<unsigned char>() + size);
+  const unsigned int basePassCount = camera->RenderStats().passCount;
+  EXPECT_GT(basePassCount, 0u);
+
+  // without std dev the noise passes add the same offset to every pixel,
+  // which is mean^2.1 as the noise shader raises the noise to this power
+  const double mean = 0.5;
+  const double offset = std::pow(mean, 2.1) * 255.0;
+
+  // check that the color channels of the captured image are the clean ones
+  // plus _count offsets
+  auto checkOffset = [&](unsigned int _count)
+  {
+    Image imageNoise = camera->CreateImage();
+    camera->Capture(imageNoise);
+    unsigned char *data = imageNoise.Data<unsigned char>();
+    unsigned int errors = 0u;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+      // alpha is not modified by the noise
+      if (i % channelCount == 3u)
+        continue;
+      double expected = std::min(255.0, clean[i] + _count * offset);
+      if (std::abs(data[i] - expected) > 2.0)
+        ++errors;
+    }
+    EXPECT_EQ(0u, errors) << _count << " passes";
+  };
+
+  std::vector<GaussianNoisePassPtr> passes;
+  for (unsigned int i = 0; i < 2u; ++i)
+  {
+    GaussianNoisePassPtr noisePass =
+        std::dynamic_pointer_cast<GaussianNoisePass>(
+        rpSystem->Create<GaussianNoisePass>());
+    ASSERT_NE(nullptr, noisePass);
+    noisePass->SetMean(mean);
+    noisePass->SetStdDev(0.0);
+    passes.push_back(noisePass);
+  }
+
+  // every noise node runs one quad pass after the passes of the scene
+  // a single pass is not fused
+  camera->AddRenderPass(passes[0]);
+  checkOffset(1u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+
+  // the two passes are fused into a single node, so a single quad pass
+  camera->AddRenderPass(passes[1]);
+  EXPECT_EQ(2u, camera->RenderPassCount());
+  checkOffset(2u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+
+  // disable the passes one by one, the fused node runs as long as one of
+  // its passes is enabled
+  passes[1]->SetEnabled(false);
+  checkOffset(1u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+  passes[0]->SetEnabled(false);
+  checkOffset(0u);
+  EXPECT_EQ(basePassCount, camera->RenderStats().passCount);
+  passes[1]->SetEnabled(true);
+  checkOffset(1u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+  passes[0]->SetEnabled(true);
+  checkOffset(2u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+
+  // removing a pass leaves a single pass that is not fused
+  camera->RemoveRenderPass(passes[0]);
+  EXPECT_EQ(1u, camera->RenderPassCount());
+  checkOffset(1u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+
+  // fusing the passes again after the fused node was released
+  camera->AddRenderPass(passes[0]);
+  EXPECT_EQ(2u, camera->RenderPassCount());
+  checkOffset(2u);
+  EXPECT_EQ(basePassCount + 1u, camera->RenderStats().passCount);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(RenderPassTest, GaussianNoise)
 {
@@ -411,6 +557,12 @@ TEST_P(RenderPassTest, DepthGaussianNoise)
   DepthGaussianNoise(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(RenderPassTest, FusedPasses)
+{
+  FusedPasses(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(GaussianNoise, RenderPassTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
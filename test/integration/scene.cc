@@ -22,6 +22,7 @@
 #include "test_config.h"  // NOLINT(build/include)
 
 #include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/Scene.hh"
@@ -39,6 +40,12 @@ class SceneTest: public testing::Test,
 
   // Test and verify camera tracking
   public: void VisualAt(const std::string &_renderEngine);
+
+  // Test rendering several scenes sharing the same meshes at once
+  public: void RenderScenes(const std::string &_renderEngine);
+
+  // Test the resources reported by a scene
+  public: void ResourceStats(const std::string &_renderEngine);
 };
 
 /////////////////////////////////////////////////
@@ -220,6 +227,130 @@ void SceneTest::VisualAt(const std::string &_renderEngine)
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+void SceneTest::RenderScenes(const std::string &_renderEngine)
+{
+  RenderEngine *engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  // two scenes with a box in front of the camera, only the box colour
+  // differs. Both scenes use the same box mesh.
+  std::vector<ScenePtr> scenes;
+  std::vector<CameraPtr> cameras;
+  std::vector<math::Color> colors = {math::Color::Red, math::Color::Green};
+  for (unsigned int i = 0u; i < colors.size(); ++i)
+  {
+    ScenePtr scene = engine->CreateScene("scene" + std::to_string(i));
+    ASSERT_TRUE(scene != nullptr);
+    scene->SetBackgroundColor(0.0, 0.0, 0.0);
+    VisualPtr root = scene->RootVisual();
+
+    MaterialPtr material = scene->CreateMaterial();
+    material->SetAmbient(colors[i]);
+    material->SetDiffuse(colors[i]);
+    material->SetEmissive(colors[i]);
+    VisualPtr box = scene->CreateVisual();
+    box->AddGeometry(scene->CreateBox());
+    box->SetMaterial(material);
+    box->SetLocalPosition(2.0, 0.0, 0.0);
+    root->AddChild(box);
+
+    CameraPtr camera = scene->CreateCamera();
+    ASSERT_TRUE(camera != nullptr);
+    camera->SetImageWidth(32);
+    camera->SetImageHeight(32);
+    camera->SetHFOV(IGN_PI / 2);
+    root->AddChild(camera);
+
+    scenes.push_back(scene);
+    cameras.push_back(camera);
+  }
+
+  // all cameras are updated by a single call
+  engine->RenderScenes(scenes);
+
+  Image image = cameras[0]->CreateImage();
+  unsigned int center = (16u * 32u + 16u) * 3u;
+  cameras[0]->Copy(image);
+  EXPECT_GT(image.Data<unsigned char>()[center], 200u);
+  EXPECT_LT(image.Data<unsigned char>()[center + 1u], 50u);
+  cameras[1]->Copy(image);
+  EXPECT_LT(image.Data<unsigned char>()[center], 50u);
+  EXPECT_GT(image.Data<unsigned char>()[center + 1u], 200u);
+
+  // destroying a scene keeps the meshes used by the other scene
+  engine->DestroyScene(scenes[0]);
+  scenes.erase(scenes.begin());
+  cameras.erase(cameras.begin());
+  engine->RenderScenes(scenes);
+  cameras[0]->Copy(image);
+  EXPECT_GT(image.Data<unsigned char>()[center + 1u], 200u);
+
+  // Clean up
+  engine->DestroyScene(scenes[0]);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void SceneTest::ResourceStats(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix" || _renderEngine == "cpu")
+  {
+    igndbg << "ResourceStats not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+  VisualPtr root = scene->RootVisual();
+
+  rendering::ResourceStats before = scene->ResourceStats();
+  rendering::EngineResourceStats engineBefore = engine->ResourceStats();
+  for (unsigned int i = 0u; i < 5u; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateSphere());
+    visual->SetMaterial(scene->CreateMaterial());
+    root->AddChild(visual);
+  }
+  rendering::ResourceStats after = scene->ResourceStats();
+  rendering::EngineResourceStats engineAfter = engine->ResourceStats();
+  EXPECT_EQ(before.objectCount + 5u, after.objectCount);
+  EXPECT_GT(engineAfter.materialCount, engineBefore.materialCount);
+  EXPECT_GT(engineAfter.bufferBytes, 0u);
+  EXPECT_LE(engineAfter.bufferBytes, engineAfter.bufferCapacityBytes);
+
+  // objects of another scene are not counted, resources loaded by the
+  // engine are shared by both scenes
+  ScenePtr other = engine->CreateScene("other");
+  ASSERT_TRUE(other != nullptr);
+  VisualPtr otherVisual = other->CreateVisual();
+  otherVisual->AddGeometry(other->CreateBox());
+  other->RootVisual()->AddChild(otherVisual);
+  EXPECT_EQ(after.objectCount, scene->ResourceStats().objectCount);
+  EXPECT_LE(other->ResourceStats().objectCount, 1u);
+  EXPECT_GE(engine->ResourceStats().bufferBytes, engineAfter.bufferBytes);
+  engine->DestroyScene(other);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 TEST_P(SceneTest, AddRemoveVisuals)
 {
@@ -232,6 +363,18 @@ TEST_P(SceneTest, VisualAt)
   VisualAt(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(SceneTest, RenderScenes)
+{
+  RenderScenes(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneTest, ResourceStats)
+{
+  ResourceStats(GetParam());
+}
+
 // It doesn't suppot optix just yet
 INSTANTIATE_TEST_CASE_P(Scene, SceneTest,
     RENDER_ENGINE_VALUES,
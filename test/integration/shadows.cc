@@ -42,6 +42,13 @@ class ShadowsTest: public testing::Test,
 /////////////////////////////////////////////////
 void ShadowsTest::Shadows(const std::string &_renderEngine)
 {
+  if (_renderEngine == "cpu")
+  {
+    igndbg << "Shadows not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
   // override and make sure not to look for resources in installed share dir
   std::string projectSrcPath = PROJECT_SOURCE_PATH;
   std::string env = "IGN_RENDERING_RESOURCE_PATH=" + projectSrcPath;
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/PixelFormat.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+class TextureStreamingTest: public testing::Test,
+                            public testing::WithParamInterface<const char *>
+{
+  // Documentation inherited
+  public: void SetUp() override
+  {
+    ignition::common::Console::SetVerbosity(4);
+  }
+
+  // Test that the textures of baked static geometry are streamed in
+  public: void StaticGeometry(const std::string &_renderEngine);
+
+  // Path to test textures
+  public: const std::string TEST_MEDIA_PATH =
+          ignition::common::joinPaths(std::string(PROJECT_SOURCE_PATH),
+                "test", "media", "materials", "textures");
+};
+
+/////////////////////////////////////////////////
+void TextureStreamingTest::StaticGeometry(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "Texture streaming not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  std::map<std::string, std::string> params;
+  params["textureStreaming"] = "1";
+  RenderEngine *engine = rendering::engine(_renderEngine, params);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine
+              << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_TRUE(scene != nullptr);
+  scene->SetAmbientLight(1.0, 1.0, 1.0);
+  VisualPtr root = scene->RootVisual();
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(1.0, 0.0, 0.0);
+  light->SetDiffuseColor(1.0, 1.0, 1.0);
+  root->AddChild(light);
+
+  // 2 pixels wide dark lines, the low resolution placeholder of the
+  // texture blends them into gray lines
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetAmbient(1.0, 1.0, 1.0);
+  material->SetDiffuse(1.0, 1.0, 1.0);
+  material->SetTexture(
+      common::joinPaths(TEST_MEDIA_PATH, "thin_lines.png"));
+
+  // a box baked into static geometry, its visual is not traversed any more
+  // when rendering
+  VisualPtr box = scene->CreateVisual("box");
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(1.0, 0.0, 0.0);
+  box->SetMaterial(material);
+  box->SetStatic(true);
+  root->AddChild(box);
+  scene->BakeStaticGeometry();
+  EXPECT_LT(0u, scene->StaticGeometryBatchCount());
+
+  // the camera sees part of the box face, magnified so that the lines of
+  // the full resolution texture cover a few pixels
+  CameraPtr camera = scene->CreateCamera("camera");
+  ASSERT_TRUE(camera != nullptr);
+  camera->SetImageWidth(256);
+  camera->SetImageHeight(256);
+  camera->SetHFOV(IGN_PI / 4);
+  root->AddChild(camera);
+
+  Image image = camera->CreateImage();
+  unsigned int channelCount = PixelUtil::ChannelCount(camera->ImageFormat());
+  unsigned int size = camera->ImageWidth() * camera->ImageHeight();
+  unsigned char darkest = 255u;
+  unsigned char brightest = 0u;
+
+  // textures are decoded in the background and upgraded from the
+  // placeholder to the full texture over a few frames
+  for (unsigned int i = 0; i < 300u; ++i)
+  {
+    camera->Capture(image);
+    unsigned char *data = image.Data<unsigned char>();
+    darkest = 255u;
+    brightest = 0u;
+    for (unsigned int p = 0; p < size; ++p)
+    {
+      unsigned char g = data[p * channelCount + 1];
+      darkest = std::min(darkest, g);
+      brightest = std::max(brightest, g);
+    }
+    if (brightest > 0u && darkest < brightest / 5u)
+      break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // the dark lines are only that dark with the full texture
+  EXPECT_LT(100u, brightest);
+  EXPECT_LT(darkest, brightest / 5u);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(TextureStreamingTest, StaticGeometry)
+{
+  StaticGeometry(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(TextureStreaming, TextureStreamingTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
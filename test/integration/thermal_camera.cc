@@ -92,8 +92,9 @@ void ThermalCameraTest::ThermalCameraBoxes(
   double unitBoxSize = 1.0;
   ignition::math::Vector3d boxPosition(1.8, 0.0, 0.0);
 
-  // Optix is not supported
-  if (_renderEngine.compare("optix") == 0)
+  // Optix and cpu are not supported
+  if (_renderEngine.compare("optix") == 0 ||
+      _renderEngine.compare("cpu") == 0)
   {
     igndbg << "Engine '" << _renderEngine
               << "' doesn't support thermal cameras" << std::endl;
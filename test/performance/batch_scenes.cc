@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/MeshDescriptor.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure memory and frame time of many small scenes, e.g. the
+/// environments of a parallel training setup
+class BatchScenesTest: public testing::Test,
+                       public testing::WithParamInterface<const char *>
+{
+  /// \brief Render many scenes with the same content
+  public: void Environments(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+double residentMemory()
+{
+#ifdef __linux__
+  int totalSize = 0;
+  int residentPages = 0;
+  std::ifstream buffer("/proc/self/statm");
+  buffer >> totalSize >> residentPages;
+  buffer.close();
+
+  int64_t pageSizeKb = sysconf(_SC_PAGE_SIZE) / 1024;
+  return residentPages * pageSizeKb;
+#else
+  return 0;
+#endif
+}
+
+/////////////////////////////////////////////////
+void BatchScenesTest::Environments(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  const std::string meshPath = common::joinPaths(
+      std::string(PROJECT_SOURCE_PATH), "test", "media", "meshes",
+      "walk.dae");
+  const unsigned int numFrames = 20u;
+
+  for (unsigned int count : {1u, 8u, 32u})
+  {
+    double memStart = residentMemory();
+
+    // every environment has the same content and a small camera
+    std::vector<ScenePtr> scenes;
+    std::vector<CameraPtr> cameras;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      ScenePtr scene = engine->CreateScene("env" + std::to_string(i));
+      ASSERT_NE(nullptr, scene);
+      VisualPtr root = scene->RootVisual();
+
+      DirectionalLightPtr light = scene->CreateDirectionalLight();
+      light->SetDirection(0.5, 0.5, -1);
+      root->AddChild(light);
+
+      MaterialPtr material = scene->CreateMaterial();
+      material->SetDiffuse(0.8, 0.6, 0.2);
+      for (int j = 0; j < 10; ++j)
+      {
+        VisualPtr visual = scene->CreateVisual();
+        MeshDescriptor desc(meshPath);
+        visual->AddGeometry(scene->CreateMesh(desc));
+        visual->SetMaterial(material, false);
+        visual->SetLocalPosition(4, j - 5, 0);
+        root->AddChild(visual);
+      }
+
+      CameraPtr camera = scene->CreateCamera();
+      camera->SetImageWidth(84);
+      camera->SetImageHeight(84);
+      root->AddChild(camera);
+
+      scenes.push_back(scene);
+      cameras.push_back(camera);
+    }
+    engine->RenderScenes(scenes);
+    double memEnd = residentMemory();
+
+    // one frame per camera
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+    {
+      for (auto &camera : cameras)
+        camera->Update();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double cameraMs = std::chrono::duration<double, std::milli>(
+        end - start).count() / numFrames;
+
+    // one frame for all cameras
+    start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+      engine->RenderScenes(scenes);
+    end = std::chrono::steady_clock::now();
+    double batchMs = std::chrono::duration<double, std::milli>(
+        end - start).count() / numFrames;
+
+    std::cout << "[" << _renderEngine << "] " << count << " scenes: "
+              << (memEnd - memStart) / 1024.0 / count << " MB per scene, "
+              << cameraMs << " ms per frame updating each camera, "
+              << batchMs << " ms per frame rendering all scenes"
+              << std::endl;
+
+    for (auto &scene : scenes)
+      engine->DestroyScene(scene);
+  }
+
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(BatchScenesTest, Environments)
+{
+  Environments(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(BatchScenes, BatchScenesTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
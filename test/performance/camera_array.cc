@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/CameraArray.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Compare many independent cameras with a camera array rendering
+/// the same views
+class CameraArrayPerformanceTest: public testing::Test,
+    public testing::WithParamInterface<const char *>
+{
+  /// \brief Render many small views with both approaches
+  public: void SmallViews(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void CameraArrayPerformanceTest::SmallViews(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre2")
+  {
+    igndbg << "CameraArray not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.5, 0.5, -1);
+  root->AddChild(light);
+
+  // a grid of boxes around the views
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0.8, 0.6, 0.2);
+  for (int i = 0; i < 400; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetMaterial(material, false);
+    visual->SetLocalPosition(i % 20 - 10, i / 20 - 10, 0);
+    root->AddChild(visual);
+  }
+
+  const unsigned int width = 84u;
+  const unsigned int height = 84u;
+  const unsigned int numFrames = 20u;
+
+  for (unsigned int count : {64u, 256u})
+  {
+    std::vector<math::Pose3d> poses;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      double yaw = 2.0 * IGN_PI * i / count;
+      poses.push_back(math::Pose3d(0, 0, 2, 0, 0.3, yaw));
+    }
+
+    // independent cameras, one render and one read back each
+    std::vector<CameraPtr> cameras;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      CameraPtr camera = scene->CreateCamera();
+      camera->SetImageWidth(width);
+      camera->SetImageHeight(height);
+      camera->SetLocalPose(poses[i]);
+      root->AddChild(camera);
+      cameras.push_back(camera);
+    }
+    Image image = cameras[0]->CreateImage();
+    for (auto &camera : cameras)
+      camera->Capture(image);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+    {
+      for (auto &camera : cameras)
+        camera->Capture(image);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+    std::cout << "[" << _renderEngine << "] " << count
+              << " cameras: " << count * numFrames / elapsed
+              << " views/s" << std::endl;
+
+    for (auto &camera : cameras)
+      scene->DestroySensor(camera);
+    cameras.clear();
+
+    // camera array, one render and one read back for all views
+    CameraArrayPtr cameraArray = scene->CreateCameraArray();
+    ASSERT_NE(nullptr, cameraArray);
+    cameraArray->SetViewCount(count);
+    cameraArray->SetImageWidth(width);
+    cameraArray->SetImageHeight(height);
+    for (unsigned int i = 0; i < count; ++i)
+      cameraArray->SetViewPose(i, poses[i]);
+    root->AddChild(cameraArray);
+
+    unsigned int views = 0u;
+    common::ConnectionPtr connection = cameraArray->ConnectNewImageFrame(
+        [&](const unsigned char *, unsigned int, unsigned int, unsigned int,
+            unsigned int, PixelFormat)
+        {
+          ++views;
+        });
+    cameraArray->Update();
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+      cameraArray->Update();
+    end = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration<double>(end - start).count();
+    std::cout << "[" << _renderEngine << "] " << count
+              << " view camera array: " << count * numFrames / elapsed
+              << " views/s" << std::endl;
+
+    EXPECT_EQ(count * (numFrames + 1u), views);
+
+    connection.reset();
+    scene->DestroySensor(cameraArray);
+  }
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CameraArrayPerformanceTest, SmallViews)
+{
+  SmallViews(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(CameraArray, CameraArrayPerformanceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Capsule.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/WireBox.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure creation time and memory usage of scenes with a large
+/// number of collision visuals, and check that visuals of the same size
+/// share their meshes
+class CollisionGeometryTest: public testing::Test,
+                     public testing::WithParamInterface<const char *>
+{
+  /// \brief Create many capsules with a small set of distinct sizes
+  public: void Capsules(const std::string &_renderEngine);
+
+  /// \brief Create many wire boxes with a small set of distinct sizes
+  public: void WireBoxes(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+double residentMemory()
+{
+#ifdef __linux__
+  int totalSize = 0;
+  int residentPages = 0;
+  std::ifstream buffer("/proc/self/statm");
+  buffer >> totalSize >> residentPages;
+  buffer.close();
+
+  int64_t pageSizeKb = sysconf(_SC_PAGE_SIZE) / 1024;
+  return residentPages * pageSizeKb;
+#else
+  return 0;
+#endif
+}
+
+/////////////////////////////////////////////////
+void CollisionGeometryTest::Capsules(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "Capsule not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  const unsigned int numCapsules = 10000;
+  const unsigned int numSizes = 10;
+
+  double memStart = residentMemory();
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0; i < numCapsules; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visuals.push_back(visual);
+    CapsulePtr capsule = scene->CreateCapsule();
+    // sizes differ by less than the cache quantization step within a group
+    double jitter = (i % 7) * 1e-6;
+    capsule->SetRadius(0.05 + 0.01 * (i % numSizes) + jitter);
+    capsule->SetLength(0.2 + 0.02 * (i % numSizes) + jitter);
+    visual->AddGeometry(capsule);
+    visual->SetLocalPosition(i % 100, i / 100, 0);
+    root->AddChild(visual);
+  }
+  scene->PreRender();
+
+  auto end = std::chrono::steady_clock::now();
+  double memEnd = residentMemory();
+
+  double elapsedMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numCapsules << " capsules, "
+            << numSizes << " sizes: " << elapsedMs << " ms, "
+            << (memEnd - memStart) / 1024.0 << " MB" << std::endl;
+
+  EXPECT_EQ(numCapsules, scene->VisualCount());
+
+  // ogre2 shares one mesh per distinct quantized size
+  bool sharesMeshes = _renderEngine == "ogre2";
+  if (sharesMeshes)
+    EXPECT_EQ(numSizes, scene->ResourceStats().sharedMeshCount);
+
+  // update the radius of all capsules, they switch to the meshes of the
+  // new sizes and the old meshes are released
+  start = std::chrono::steady_clock::now();
+  for (auto &visual : visuals)
+  {
+    CapsulePtr capsule =
+        std::dynamic_pointer_cast<Capsule>(visual->GeometryByIndex(0u));
+    ASSERT_NE(nullptr, capsule);
+    capsule->SetRadius(0.1);
+  }
+  scene->PreRender();
+  end = std::chrono::steady_clock::now();
+  elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numCapsules
+            << " capsule updates: " << elapsedMs << " ms" << std::endl;
+
+  // the lengths still differ
+  if (sharesMeshes)
+    EXPECT_EQ(numSizes, scene->ResourceStats().sharedMeshCount);
+
+  // the meshes are removed with the last capsules using them
+  for (auto &visual : visuals)
+    scene->DestroyVisual(visual);
+  visuals.clear();
+  EXPECT_EQ(0u, scene->ResourceStats().sharedMeshCount);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void CollisionGeometryTest::WireBoxes(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "WireBox not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  const unsigned int numBoxes = 10000;
+  const unsigned int numSizes = 10;
+
+  double memStart = residentMemory();
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0; i < numBoxes; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visuals.push_back(visual);
+    WireBoxPtr wireBox = scene->CreateWireBox();
+    double size = 0.1 * (1 + i % numSizes);
+    wireBox->SetBox(math::AxisAlignedBox(
+        math::Vector3d(-size, -size, -size), math::Vector3d(size, size, size)));
+    visual->AddGeometry(wireBox);
+    visual->SetLocalPosition(i % 100, i / 100, 0);
+    root->AddChild(visual);
+  }
+  scene->PreRender();
+
+  auto end = std::chrono::steady_clock::now();
+  double memEnd = residentMemory();
+
+  double elapsedMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numBoxes << " wire boxes, "
+            << numSizes << " sizes: " << elapsedMs << " ms, "
+            << (memEnd - memStart) / 1024.0 << " MB" << std::endl;
+
+  EXPECT_EQ(numBoxes, scene->VisualCount());
+
+  // ogre2 shares one mesh per distinct quantized size
+  if (_renderEngine == "ogre2")
+    EXPECT_EQ(numSizes, scene->ResourceStats().sharedMeshCount);
+
+  // the meshes are removed with the last wire boxes using them
+  for (auto &visual : visuals)
+    scene->DestroyVisual(visual);
+  visuals.clear();
+  EXPECT_EQ(0u, scene->ResourceStats().sharedMeshCount);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CollisionGeometryTest, Capsules)
+{
+  Capsules(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(CollisionGeometryTest, WireBoxes)
+{
+  WireBoxes(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(CollisionGeometry, CollisionGeometryTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
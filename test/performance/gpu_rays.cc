@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/GpuRays.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure the throughput of gpu rays for typical lidar
+/// configurations
+class GpuRaysPerformanceTest: public testing::Test,
+                              public testing::WithParamInterface<const char *>
+{
+  /// \brief Render solid state lidars with narrow field of views and a
+  /// spinning lidar for comparison
+  public: void SolidStateLidar(const std::string &_renderEngine);
+
+  /// \brief Create many sensors with the same configuration, as in a fleet
+  /// of identical robots, and sensors that all differ
+  public: void Fleet(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void GpuRaysPerformanceTest::SolidStateLidar(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  // boxes scattered around the sensors
+  for (unsigned int i = 0; i < 200; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(2.0 + (i % 20) * 0.8, (i / 20) * 1.5 - 7.5,
+        (i % 3) * 0.5 - 0.5);
+    root->AddChild(visual);
+  }
+
+  struct LidarConfig
+  {
+    std::string name;
+    double hfov;
+    double vfov;
+    unsigned int hRays;
+    unsigned int vRays;
+  };
+  std::vector<LidarConfig> configs = {
+    {"60x20 deg", IGN_DTOR(60), IGN_DTOR(20), 256, 64},
+    {"70x30 deg", IGN_DTOR(70), IGN_DTOR(30), 320, 96},
+    {"80x25 deg", IGN_DTOR(80), IGN_DTOR(25), 512, 128},
+    // uses all cubemap faces on ogre2, for comparison
+    {"120x30 deg", IGN_DTOR(120), IGN_DTOR(30), 512, 128},
+  };
+
+  const unsigned int numFrames = 50;
+  for (const auto &config : configs)
+  {
+    GpuRaysPtr gpuRays = scene->CreateGpuRays();
+    gpuRays->SetNearClipPlane(0.1);
+    gpuRays->SetFarClipPlane(50.0);
+    gpuRays->SetAngleMin(-config.hfov * 0.5);
+    gpuRays->SetAngleMax(config.hfov * 0.5);
+    gpuRays->SetRayCount(config.hRays);
+    gpuRays->SetVerticalAngleMin(-config.vfov * 0.5);
+    gpuRays->SetVerticalAngleMax(config.vfov * 0.5);
+    gpuRays->SetVerticalRayCount(config.vRays);
+    root->AddChild(gpuRays);
+
+    // the first update creates the textures
+    std::vector<float> scan(config.hRays * config.vRays * 3);
+    gpuRays->Update();
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+    {
+      gpuRays->Update();
+      gpuRays->Copy(scan.data());
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double rays = static_cast<double>(config.hRays) * config.vRays *
+        numFrames;
+    std::cout << "[" << _renderEngine << "] " << config.name << " "
+              << config.hRays << "x" << config.vRays << " rays: "
+              << seconds * 1000.0 / numFrames << " ms/frame, "
+              << rays / seconds / 1e6 << " Mrays/s" << std::endl;
+
+    EXPECT_GT(seconds, 0.0);
+    scene->DestroySensor(gpuRays);
+  }
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void GpuRaysPerformanceTest::Fleet(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "GpuRays not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  const unsigned int numSensors = 50;
+  const unsigned int hRays = 2048;
+  const unsigned int vRays = 64;
+
+  // the sample texture holds 3 floats per ray, sensors with the same
+  // configuration can share it
+  double sampleTexMb = hRays * vRays * 3.0 * sizeof(float) / 1e6;
+
+  // creates the sensors, the first update creates the textures
+  auto createSensors = [&](const std::string &_name, bool _identical)
+  {
+    std::vector<GpuRaysPtr> sensors;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < numSensors; ++i)
+    {
+      double offset = _identical ? 0.0 : i * 1e-3;
+      GpuRaysPtr gpuRays = scene->CreateGpuRays();
+      gpuRays->SetNearClipPlane(0.1);
+      gpuRays->SetFarClipPlane(50.0);
+      gpuRays->SetAngleMin(-IGN_PI + offset);
+      gpuRays->SetAngleMax(IGN_PI);
+      gpuRays->SetRayCount(hRays);
+      gpuRays->SetVerticalAngleMin(-IGN_DTOR(15));
+      gpuRays->SetVerticalAngleMax(IGN_DTOR(15));
+      gpuRays->SetVerticalRayCount(vRays);
+      gpuRays->SetLocalPosition(i * 2.0, 0, 0.5);
+      root->AddChild(gpuRays);
+      gpuRays->Update();
+      sensors.push_back(gpuRays);
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "[" << _renderEngine << "] " << numSensors << " " << _name
+              << " " << hRays << "x" << vRays << " sensors creation time: "
+              << std::chrono::duration<double, std::milli>(end - start).count()
+              << " ms, sample textures: "
+              << (_identical ? 1u : numSensors) * sampleTexMb
+              << " MB if shared, " << numSensors * sampleTexMb
+              << " MB otherwise" << std::endl;
+
+    for (auto &sensor : sensors)
+      scene->DestroySensor(sensor);
+  };
+
+  createSensors("identical", true);
+  createSensors("different", false);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysPerformanceTest, SolidStateLidar)
+{
+  SolidStateLidar(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(GpuRaysPerformanceTest, Fleet)
+{
+  Fleet(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(GpuRays, GpuRaysPerformanceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/ImagePool.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure image allocations of a capture loop creating a new image
+/// every frame
+class ImagePoolTest: public testing::Test,
+                     public testing::WithParamInterface<const char *>
+{
+  /// \brief Capture 4K images with and without buffer reuse
+  public: void Capture4K(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void ImagePoolTest::Capture4K(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(3, 0, 0);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(3840);
+  camera->SetImageHeight(2160);
+  root->AddChild(camera);
+  camera->Update();
+
+  const unsigned int numFrames = 30u;
+  ImagePool &pool = ImagePool::Default();
+  std::size_t maxCachedSize = pool.MaxCachedSize();
+
+  // a cache of 0 disables reuse, every image allocates as it did before
+  // the pool existed
+  for (std::size_t cachedSize : {std::size_t(0u), maxCachedSize})
+  {
+    pool.SetMaxCachedSize(cachedSize);
+    uint64_t allocations = pool.AllocationCount();
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < numFrames; ++i)
+    {
+      Image image = camera->CreateImage();
+      camera->Capture(image);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+    allocations = pool.AllocationCount() - allocations;
+
+    std::cout << "[" << _renderEngine << "] 4K capture "
+              << (cachedSize > 0u ? "with" : "without") << " reuse: "
+              << allocations / elapsed << " allocations/s, "
+              << numFrames / elapsed << " frames/s" << std::endl;
+
+    if (cachedSize > 0u)
+      EXPECT_LE(allocations, 1u);
+    else
+      EXPECT_EQ(numFrames, allocations);
+  }
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(ImagePoolTest, Capture4K)
+{
+  Capture4K(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(ImagePool, ImagePoolTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
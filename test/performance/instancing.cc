@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/InstanceBatch.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Compare a scene of individual visuals with an instance batch of
+/// the same mesh and material
+class InstancingTest: public testing::Test,
+                      public testing::WithParamInterface<const char *>
+{
+  /// \brief Create and move many boxes as visuals and as instances
+  public: void Boxes(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void InstancingTest::Boxes(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "InstanceBatch not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  camera->SetLocalPosition(-50, 0, 100);
+  camera->SetLocalRotation(0, 1.0, 0);
+  root->AddChild(camera);
+
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0.8, 0.6, 0.2);
+
+  const unsigned int numVisuals = 10000;
+  const unsigned int numInstances = 100000;
+  const unsigned int numFrames = 10;
+
+  // individual visuals
+  auto start = std::chrono::steady_clock::now();
+  std::vector<VisualPtr> visuals;
+  for (unsigned int i = 0; i < numVisuals; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetMaterial(material, false);
+    visual->SetLocalPosition(i % 100, i / 100, 0);
+    root->AddChild(visual);
+    visuals.push_back(visual);
+  }
+  scene->PreRender();
+  auto end = std::chrono::steady_clock::now();
+  double elapsedMs =
+      std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numVisuals
+            << " visuals created: " << elapsedMs << " ms" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int f = 0; f < numFrames; ++f)
+  {
+    for (unsigned int i = 0; i < numVisuals; ++i)
+      visuals[i]->SetLocalPosition(i % 100, i / 100, f * 0.01);
+    camera->Update();
+  }
+  end = std::chrono::steady_clock::now();
+  elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numVisuals
+            << " visuals frame time: " << elapsedMs / numFrames << " ms"
+            << std::endl;
+
+  for (auto &visual : visuals)
+    scene->DestroyVisual(visual);
+  visuals.clear();
+
+  // instance batch
+  start = std::chrono::steady_clock::now();
+  InstanceBatchPtr batch = scene->CreateInstanceBatch(
+      MeshDescriptor("unit_box"), material, numInstances);
+  ASSERT_NE(nullptr, batch);
+  std::vector<math::Pose3d> poses(numInstances);
+  for (unsigned int i = 0; i < numInstances; ++i)
+    poses[i].Pos().Set(i % 316, i / 316, 0);
+  batch->SetInstancePoses(poses);
+  scene->PreRender();
+  end = std::chrono::steady_clock::now();
+  elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numInstances
+            << " instances created: " << elapsedMs << " ms" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int f = 0; f < numFrames; ++f)
+  {
+    for (auto &pose : poses)
+      pose.Pos().Z(f * 0.01);
+    batch->SetInstancePoses(poses);
+    camera->Update();
+  }
+  end = std::chrono::steady_clock::now();
+  elapsedMs = std::chrono::duration<double, std::milli>(end - start).count();
+  std::cout << "[" << _renderEngine << "] " << numInstances
+            << " instances frame time: " << elapsedMs / numFrames << " ms"
+            << std::endl;
+
+  EXPECT_EQ(numInstances, batch->InstanceCount());
+
+  batch.reset();
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(InstancingTest, Boxes)
+{
+  Boxes(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Instancing, InstancingTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/GaussianNoisePass.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/Material.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderPassSystem.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure the cost of render pass chains on large images
+class RenderPassPerformanceTest: public testing::Test,
+    public testing::WithParamInterface<const char *>
+{
+  /// \brief Capture 4K images through chains of up to 4 noise passes
+  public: void NoiseChain(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void RenderPassPerformanceTest::NoiseChain(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  RenderPassSystemPtr rpSystem = engine->RenderPassSystem();
+  if (!rpSystem)
+  {
+    igndbg << "Engine '" << _renderEngine << "' does not support "
+           << "render pass system" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.5, 0.5, -1);
+  root->AddChild(light);
+
+  // a few boxes in front of the camera, the cost is dominated by the passes
+  MaterialPtr material = scene->CreateMaterial();
+  material->SetDiffuse(0.8, 0.6, 0.2);
+  for (int i = 0; i < 9; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetMaterial(material, false);
+    visual->SetLocalPosition(4, i % 3 - 1, i / 3 - 1);
+    root->AddChild(visual);
+  }
+
+  // 4K
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(3840u);
+  camera->SetImageHeight(2160u);
+  root->AddChild(camera);
+
+  const unsigned int numFrames = 50u;
+  Image image = camera->CreateImage();
+
+  for (unsigned int passCount = 0u; passCount <= 4u; ++passCount)
+  {
+    if (passCount > 0u)
+    {
+      GaussianNoisePassPtr noisePass =
+          std::dynamic_pointer_cast<GaussianNoisePass>(
+          rpSystem->Create<GaussianNoisePass>());
+      ASSERT_NE(nullptr, noisePass);
+      noisePass->SetMean(0.0);
+      noisePass->SetStdDev(0.01);
+      camera->AddRenderPass(noisePass);
+    }
+    EXPECT_EQ(passCount, camera->RenderPassCount());
+
+    // build the chain before timing
+    camera->Capture(image);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+      camera->Capture(image);
+    auto end = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+    std::cout << "[" << _renderEngine << "] 3840x2160, " << passCount
+              << " noise passes: " << elapsed * 1000.0 / numFrames
+              << " ms/frame" << std::endl;
+  }
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(RenderPassPerformanceTest, NoiseChain)
+{
+  NoiseChain(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(RenderPass, RenderPassPerformanceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
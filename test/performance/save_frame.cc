@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/FrameSaver.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure the frame rate of a camera saving every frame
+class SaveFrameTest: public testing::Test,
+                     public testing::WithParamInterface<const char *>
+{
+  /// \brief Render and save 1080p frames, encoding on the render thread
+  /// and on the encoder threads
+  public: void Save1080p(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void SaveFrameTest::Save1080p(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  VisualPtr box = scene->CreateVisual();
+  box->AddGeometry(scene->CreateBox());
+  box->SetLocalPosition(3, 0, 0);
+  root->AddChild(box);
+
+  CameraPtr camera = scene->CreateCamera("camera");
+  camera->SetImageWidth(1920);
+  camera->SetImageHeight(1080);
+  root->AddChild(camera);
+  camera->Update();
+
+  std::string path = common::joinPaths(PROJECT_BUILD_PATH, "save_frame");
+  common::createDirectories(path);
+  const unsigned int numFrames = 60u;
+
+  // encoding on the render thread
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < numFrames; ++i)
+  {
+    Image image = camera->CreateImage();
+    camera->Capture(image);
+    EXPECT_TRUE(FrameSaver::Write(image, common::joinPaths(path,
+        "sync-" + std::to_string(i) + ".png")));
+  }
+  double elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  std::cout << "[" << _renderEngine << "] 1080p synchronous save: "
+            << numFrames / elapsed << " frames/s" << std::endl;
+
+  // encoding on the encoder threads, the rate is limited by the slower of
+  // rendering and encoding once the queue is full
+  FrameSaver &saver = FrameSaver::Default();
+  uint64_t saved = saver.SavedCount();
+  uint64_t dropped = saver.DroppedCount();
+  camera->SetSaveFramePath(path);
+  camera->EnableSaveFrame(true);
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < numFrames; ++i)
+    camera->Update();
+  double renderElapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  saver.Flush();
+  elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  camera->EnableSaveFrame(false);
+
+  saved = saver.SavedCount() - saved;
+  dropped = saver.DroppedCount() - dropped;
+  std::cout << "[" << _renderEngine << "] 1080p asynchronous save: "
+            << numFrames / renderElapsed << " frames/s rendered, "
+            << saved / elapsed << " frames/s saved, "
+            << dropped << " dropped" << std::endl;
+  EXPECT_EQ(numFrames, saved + dropped);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SaveFrameTest, Save1080p)
+{
+  Save1080p(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(SaveFrame, SaveFrameTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -22,13 +22,28 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include <ignition/common/Console.hh>
+#include <ignition/common/Filesystem.hh>
+#include <ignition/common/ImageHeightmap.hh>
 
 #include "test_config.h"  // NOLINT(build/include)
 
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/DepthCamera.hh"
+#include "ignition/rendering/GpuRays.hh"
+#include "ignition/rendering/Heightmap.hh"
+#include "ignition/rendering/LidarVisual.hh"
+#include "ignition/rendering/Marker.hh"
+#include "ignition/rendering/ParticleEmitter.hh"
 #include "ignition/rendering/RenderEngine.hh"
 #include "ignition/rendering/RenderingIface.hh"
 #include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Text.hh"
+#include "ignition/rendering/ThermalCamera.hh"
 
 using namespace ignition;
 using namespace rendering;
@@ -44,6 +59,27 @@ class SceneFactoryTest: public testing::Test,
 
   /// \brief Test creating and destroying visuals
   public: void VisualMemoryLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying cameras
+  public: void CameraResourceLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying gpu rays
+  public: void GpuRaysResourceLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying markers
+  public: void MarkerResourceLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying lidar visuals
+  public: void LidarVisualResourceLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying heightmaps
+  public: void HeightmapResourceLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying text
+  public: void TextResourceLeak(const std::string &_renderEngine);
+
+  /// \brief Test creating and destroying particle emitters
+  public: void ParticleEmitterResourceLeak(const std::string &_renderEngine);
 };
 
 
@@ -132,6 +168,97 @@ void checkMemLeak(const std::string &_renderEngine,
   rendering::unloadEngine(engine->Name());
 }
 
+/////////////////////////////////////////////////
+/// \brief Check that the GPU resources of a scene return to their baseline
+/// after objects are repeatedly created, rendered and destroyed
+/// \param[in] _renderEngine Render engine name
+/// \param[in] _cycle Creates objects, renders them with the given camera
+/// and destroys them. Returns false if the objects are not supported by
+/// the render engine.
+void checkResourceLeak(const std::string &_renderEngine,
+    const std::function<bool(ScenePtr, CameraPtr)> &_cycle)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "Resource stats not supported yet in rendering engine: "
+           << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  auto scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+
+  // camera that renders the objects while they exist
+  CameraPtr camera = scene->CreateCamera("leak_camera");
+  ASSERT_NE(nullptr, camera);
+  camera->SetImageWidth(64);
+  camera->SetImageHeight(64);
+  scene->RootVisual()->AddChild(camera);
+
+  // some resources are released a few frames after their owner is
+  // destroyed, e.g. dynamic buffers still read by the GPU
+  auto flush = [&camera]()
+  {
+    for (unsigned int i = 0; i < 5; ++i)
+      camera->Update();
+  };
+
+  // a first cycle loads the resources shared by all objects of a type,
+  // e.g. shaders and unit meshes
+  if (!_cycle(scene, camera))
+  {
+    engine->DestroyScene(scene);
+    rendering::unloadEngine(engine->Name());
+    return;
+  }
+  flush();
+  ResourceStats baseline = scene->ResourceStats();
+  EngineResourceStats engineBaseline = engine->ResourceStats();
+  double residentStart = 0;
+  double shareStart = 0;
+  getMemInfo(residentStart, shareStart);
+
+  const unsigned int numCycles = 20;
+  for (unsigned int i = 0; i < numCycles; ++i)
+    _cycle(scene, camera);
+  flush();
+
+  ResourceStats end = scene->ResourceStats();
+  EngineResourceStats engineEnd = engine->ResourceStats();
+  double residentEnd = 0;
+  double shareEnd = 0;
+  getMemInfo(residentEnd, shareEnd);
+
+  igndbg << "objects " << baseline.objectCount << " -> " << end.objectCount
+         << ", materials " << engineBaseline.materialCount << " -> "
+         << engineEnd.materialCount << ", textures "
+         << engineBaseline.textureCount << " -> " << engineEnd.textureCount
+         << " (" << engineBaseline.textureBytes << " -> "
+         << engineEnd.textureBytes << " bytes), buffers "
+         << engineBaseline.bufferBytes << " -> " << engineEnd.bufferBytes
+         << " bytes, workspaces " << baseline.workspaceCount << " -> "
+         << end.workspaceCount << ", resident " << residentStart << " -> "
+         << residentEnd << " kB" << std::endl;
+
+  EXPECT_EQ(baseline.objectCount, end.objectCount);
+  EXPECT_EQ(engineBaseline.materialCount, engineEnd.materialCount);
+  EXPECT_EQ(engineBaseline.textureCount, engineEnd.textureCount);
+  EXPECT_LE(engineEnd.textureBytes, engineBaseline.textureBytes);
+  EXPECT_LE(engineEnd.bufferBytes, engineBaseline.bufferBytes);
+  EXPECT_EQ(baseline.workspaceCount, end.workspaceCount);
+
+  // Clean up
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
 /////////////////////////////////////////////////
 void SceneFactoryTest::MaterialMemoryLeak(const std::string &_renderEngine)
 {
@@ -178,6 +305,166 @@ void SceneFactoryTest::VisualMemoryLeak(const std::string &_renderEngine)
   checkMemLeak(_renderEngine, function);
 }
 
+/////////////////////////////////////////////////
+void SceneFactoryTest::CameraResourceLeak(const std::string &_renderEngine)
+{
+  auto function = [&_renderEngine](ScenePtr _scene, CameraPtr)
+  {
+    std::vector<CameraPtr> cameras;
+    cameras.push_back(_scene->CreateCamera());
+    cameras.push_back(_scene->CreateDepthCamera());
+    // thermal cameras need ogre2
+    if (_renderEngine == "ogre2")
+      cameras.push_back(_scene->CreateThermalCamera());
+    for (auto &camera : cameras)
+    {
+      camera->SetImageWidth(64);
+      camera->SetImageHeight(64);
+      _scene->RootVisual()->AddChild(camera);
+      camera->Update();
+    }
+    for (auto &camera : cameras)
+      _scene->DestroySensor(camera);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
+/////////////////////////////////////////////////
+void SceneFactoryTest::GpuRaysResourceLeak(const std::string &_renderEngine)
+{
+  auto function = [](ScenePtr _scene, CameraPtr)
+  {
+    GpuRaysPtr gpuRays = _scene->CreateGpuRays();
+    gpuRays->SetNearClipPlane(0.1);
+    gpuRays->SetFarClipPlane(10.0);
+    gpuRays->SetAngleMin(-1.4);
+    gpuRays->SetAngleMax(1.4);
+    gpuRays->SetRayCount(320);
+    gpuRays->SetVerticalRayCount(4);
+    _scene->RootVisual()->AddChild(gpuRays);
+    gpuRays->Update();
+    _scene->DestroySensor(gpuRays);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
+/////////////////////////////////////////////////
+void SceneFactoryTest::MarkerResourceLeak(const std::string &_renderEngine)
+{
+  auto function = [](ScenePtr _scene, CameraPtr _camera)
+  {
+    VisualPtr visual = _scene->CreateVisual();
+    MarkerPtr marker = _scene->CreateMarker();
+    marker->SetType(MT_LINE_STRIP);
+    for (unsigned int i = 0; i < 100; ++i)
+      marker->AddPoint(math::Vector3d(2.0, i * 0.01, 0.0), math::Color::Red);
+    visual->AddGeometry(marker);
+    _scene->RootVisual()->AddChild(visual);
+    _camera->Update();
+    _scene->DestroyVisual(visual);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
+/////////////////////////////////////////////////
+void SceneFactoryTest::LidarVisualResourceLeak(
+    const std::string &_renderEngine)
+{
+  auto function = [](ScenePtr _scene, CameraPtr _camera)
+  {
+    LidarVisualPtr lidar = _scene->CreateLidarVisual();
+    lidar->SetMinHorizontalAngle(-1.4);
+    lidar->SetMaxHorizontalAngle(1.4);
+    lidar->SetHorizontalRayCount(100);
+    lidar->SetVerticalRayCount(1);
+    lidar->SetMinRange(0.1);
+    lidar->SetMaxRange(10.0);
+    lidar->SetPoints(std::vector<double>(100, 5.0));
+    _scene->RootVisual()->AddChild(lidar);
+    lidar->Update();
+    _camera->Update();
+    _scene->DestroyVisual(lidar);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
+/////////////////////////////////////////////////
+void SceneFactoryTest::HeightmapResourceLeak(const std::string &_renderEngine)
+{
+  auto data = std::make_shared<common::ImageHeightmap>();
+  data->Load(common::joinPaths(std::string(PROJECT_SOURCE_PATH), "test",
+      "media", "heightmap_bowl.png"));
+
+  auto function = [&data](ScenePtr _scene, CameraPtr _camera)
+  {
+    HeightmapDescriptor desc;
+    desc.SetData(data);
+    desc.SetSize(math::Vector3d(17, 17, 10));
+    desc.SetSampling(1u);
+    HeightmapPtr heightmap = _scene->CreateHeightmap(desc);
+    if (!heightmap)
+      return false;
+
+    VisualPtr visual = _scene->CreateVisual();
+    visual->AddGeometry(heightmap);
+    _scene->RootVisual()->AddChild(visual);
+    _camera->Update();
+    _scene->DestroyVisual(visual);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
+/////////////////////////////////////////////////
+void SceneFactoryTest::TextResourceLeak(const std::string &_renderEngine)
+{
+  auto function = [](ScenePtr _scene, CameraPtr _camera)
+  {
+    TextPtr text = _scene->CreateText();
+    if (!text)
+      return false;
+
+    text->SetTextString("leak");
+    VisualPtr visual = _scene->CreateVisual();
+    visual->AddGeometry(text);
+    visual->SetLocalPosition(2.0, 0.0, 0.0);
+    _scene->RootVisual()->AddChild(visual);
+    _camera->Update();
+    _scene->DestroyVisual(visual);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
+/////////////////////////////////////////////////
+void SceneFactoryTest::ParticleEmitterResourceLeak(
+    const std::string &_renderEngine)
+{
+  auto function = [](ScenePtr _scene, CameraPtr _camera)
+  {
+    ParticleEmitterPtr emitter = _scene->CreateParticleEmitter();
+    emitter->SetLocalPosition(2.0, 0.0, 0.0);
+    emitter->SetRate(100.0);
+    emitter->SetEmitting(true);
+    _scene->RootVisual()->AddChild(emitter);
+    _camera->Update();
+    _scene->DestroyVisual(emitter);
+    return true;
+  };
+
+  checkResourceLeak(_renderEngine, function);
+}
+
 /////////////////////////////////////////////////
 TEST_P(SceneFactoryTest, MaterialMemoryLeak)
 {
@@ -190,6 +477,48 @@ TEST_P(SceneFactoryTest, VisualMemoryLeak)
   VisualMemoryLeak(GetParam());
 }
 
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, CameraResourceLeak)
+{
+  CameraResourceLeak(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, GpuRaysResourceLeak)
+{
+  GpuRaysResourceLeak(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, MarkerResourceLeak)
+{
+  MarkerResourceLeak(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, LidarVisualResourceLeak)
+{
+  LidarVisualResourceLeak(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, HeightmapResourceLeak)
+{
+  HeightmapResourceLeak(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, TextResourceLeak)
+{
+  TextResourceLeak(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneFactoryTest, ParticleEmitterResourceLeak)
+{
+  ParticleEmitterResourceLeak(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(SceneFactory, SceneFactoryTest,
     RENDER_ENGINE_VALUES,
     ignition::rendering::PrintToStringParam());
@@ -0,0 +1,547 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/common/Util.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/DepthCamera.hh"
+#include "ignition/rendering/GpuRays.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/RayQuery.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Results of all benchmarks, by engine and then by key. Keys are
+/// stable across builds and end with their unit so that the JSON output
+/// of two builds can be diffed.
+static std::map<std::string, std::map<std::string, double>> results;
+
+/// \brief Time a function
+/// \param[in] _func Function to time
+/// \return Elapsed seconds
+template <typename F>
+static double Seconds(F _func)
+{
+  auto start = std::chrono::steady_clock::now();
+  _func();
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+/// \brief Write the results as JSON
+/// \param[in] _out Output stream
+static void WriteJson(std::ostream &_out)
+{
+  _out << "{\n";
+  for (auto e = results.begin(); e != results.end(); ++e)
+  {
+    _out << "  \"" << e->first << "\": {\n";
+    for (auto r = e->second.begin(); r != e->second.end(); ++r)
+    {
+      _out << "    \"" << r->first << "\": " << r->second
+           << (std::next(r) == e->second.end() ? "\n" : ",\n");
+    }
+    _out << "  }" << (std::next(e) == results.end() ? "\n" : ",\n");
+  }
+  _out << "}\n";
+}
+
+/// \brief Throughput and latency of scene graph hot paths and sensor
+/// updates
+class SceneGraphBenchmark: public testing::Test,
+                           public testing::WithParamInterface<const char *>
+{
+  /// \brief Create and destroy visuals
+  public: void VisualLifecycle(const std::string &_renderEngine);
+
+  /// \brief Scene::PreRender on wide and deep trees, pose updates and
+  /// bounding boxes
+  public: void Tree(const std::string &_renderEngine);
+
+  /// \brief Visual and node lookups by id and name
+  public: void Lookup(const std::string &_renderEngine);
+
+  /// \brief RayQuery::ClosestPoint from a camera
+  public: void ClosestPoint(const std::string &_renderEngine);
+
+  /// \brief Camera, depth camera and gpu rays update rates at several
+  /// resolutions
+  public: void Sensors(const std::string &_renderEngine);
+
+  /// \brief Create an engine and a scene for a benchmark
+  /// \param[in] _renderEngine Name of the engine
+  /// \return The scene or null if the engine is not supported
+  protected: ScenePtr CreateScene(const std::string &_renderEngine);
+
+  /// \brief Destroy the scene and unload its engine
+  /// \param[in] _scene Scene to destroy
+  protected: void DestroyScene(ScenePtr _scene);
+};
+
+/////////////////////////////////////////////////
+ScenePtr SceneGraphBenchmark::CreateScene(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return nullptr;
+  }
+  return engine->CreateScene("scene");
+}
+
+/////////////////////////////////////////////////
+void SceneGraphBenchmark::DestroyScene(ScenePtr _scene)
+{
+  RenderEngine *engine = _scene->Engine();
+  engine->DestroyScene(_scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+void SceneGraphBenchmark::VisualLifecycle(const std::string &_renderEngine)
+{
+  ScenePtr scene = this->CreateScene(_renderEngine);
+  if (!scene)
+    return;
+  VisualPtr root = scene->RootVisual();
+  auto &r = results[_renderEngine];
+
+  const unsigned int count = 1000u;
+  const unsigned int visualCount = scene->VisualCount();
+  std::vector<VisualPtr> visuals;
+  double seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+          VisualPtr visual = scene->CreateVisual();
+          visual->AddGeometry(scene->CreateBox());
+          root->AddChild(visual);
+          visuals.push_back(visual);
+        }
+      });
+  r["visual_create_us"] = seconds * 1e6 / count;
+  EXPECT_EQ(visualCount + count, scene->VisualCount());
+
+  seconds = Seconds([&]
+      {
+        for (auto &visual : visuals)
+          scene->DestroyVisual(visual);
+      });
+  r["visual_destroy_us"] = seconds * 1e6 / count;
+  EXPECT_EQ(visualCount, scene->VisualCount());
+  visuals.clear();
+
+  this->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+void SceneGraphBenchmark::Tree(const std::string &_renderEngine)
+{
+  ScenePtr scene = this->CreateScene(_renderEngine);
+  if (!scene)
+    return;
+  VisualPtr root = scene->RootVisual();
+  auto &r = results[_renderEngine];
+
+  // wide: all visuals children of one parent
+  const unsigned int wideCount = 2000u;
+  VisualPtr wide = scene->CreateVisual();
+  root->AddChild(wide);
+  std::vector<VisualPtr> wideVisuals;
+  for (unsigned int i = 0; i < wideCount; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(i % 50, i / 50, 0);
+    wide->AddChild(visual);
+    wideVisuals.push_back(visual);
+  }
+
+  // deep: chains of visuals, each the child of the previous one
+  const unsigned int chainCount = 10u;
+  const unsigned int depth = 100u;
+  std::vector<VisualPtr> leaves;
+  VisualPtr deep = scene->CreateVisual();
+  root->AddChild(deep);
+  for (unsigned int c = 0; c < chainCount; ++c)
+  {
+    VisualPtr parent = deep;
+    for (unsigned int d = 0; d < depth; ++d)
+    {
+      VisualPtr visual = scene->CreateVisual();
+      visual->AddGeometry(scene->CreateBox());
+      visual->SetLocalPosition(0.01, 0, 0);
+      parent->AddChild(visual);
+      parent = visual;
+    }
+    leaves.push_back(parent);
+  }
+
+  const unsigned int iterations = 100u;
+  scene->PreRender();
+  double seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+          scene->PreRender();
+      });
+  r["prerender_static_ms"] = seconds * 1e3 / iterations;
+
+  // move every visual of the wide tree before each PreRender
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          for (auto &visual : wideVisuals)
+            visual->SetLocalRotation(0, 0, i * 0.01);
+          scene->PreRender();
+        }
+      });
+  r["prerender_wide_ms"] = seconds * 1e3 / iterations;
+
+  // move the root of every chain of the deep tree before each PreRender
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          deep->SetLocalRotation(0, 0, i * 0.01);
+          scene->PreRender();
+        }
+      });
+  r["prerender_deep_ms"] = seconds * 1e3 / iterations;
+
+  // pose updates alone
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          for (auto &visual : wideVisuals)
+            visual->SetLocalPose(math::Pose3d(i % 50, i / 50, 0, 0, 0, i));
+        }
+      });
+  r["pose_update_ns"] = seconds * 1e9 / (iterations * wideCount);
+
+  // world poses of the leaves of the deep tree walk up their chain
+  math::Pose3d pose;
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          for (auto &leaf : leaves)
+            pose = leaf->WorldPose();
+        }
+      });
+  r["world_pose_deep_us"] = seconds * 1e6 / (iterations * chainCount);
+  EXPECT_GT(pose.Pos().Length(), 0.0);
+
+  // bounding box of a single visual and of whole trees
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          for (auto &visual : wideVisuals)
+            visual->BoundingBox();
+        }
+      });
+  r["bounding_box_visual_us"] = seconds * 1e6 / (iterations * wideCount);
+
+  const unsigned int treeIterations = 10u;
+  math::AxisAlignedBox box;
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < treeIterations; ++i)
+          box = wide->BoundingBox();
+      });
+  r["bounding_box_wide_ms"] = seconds * 1e3 / treeIterations;
+  EXPECT_GT(box.XLength(), 0.0);
+
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < treeIterations; ++i)
+          box = deep->BoundingBox();
+      });
+  r["bounding_box_deep_ms"] = seconds * 1e3 / treeIterations;
+
+  this->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+void SceneGraphBenchmark::Lookup(const std::string &_renderEngine)
+{
+  ScenePtr scene = this->CreateScene(_renderEngine);
+  if (!scene)
+    return;
+  VisualPtr root = scene->RootVisual();
+  auto &r = results[_renderEngine];
+
+  const unsigned int count = 2000u;
+  std::vector<unsigned int> ids;
+  std::vector<std::string> names;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual("visual_" + std::to_string(i));
+    root->AddChild(visual);
+    ids.push_back(visual->Id());
+    names.push_back(visual->Name());
+  }
+
+  const unsigned int iterations = 100u;
+  unsigned int found = 0u;
+  double seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          for (auto id : ids)
+            found += scene->VisualById(id) != nullptr;
+        }
+      });
+  r["visual_by_id_ns"] = seconds * 1e9 / (iterations * count);
+  EXPECT_EQ(iterations * count, found);
+
+  found = 0u;
+  seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+          for (auto &name : names)
+            found += scene->NodeByName(name) != nullptr;
+        }
+      });
+  r["node_by_name_ns"] = seconds * 1e9 / (iterations * count);
+  EXPECT_EQ(iterations * count, found);
+
+  this->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+void SceneGraphBenchmark::ClosestPoint(const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "RayQuery not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  ScenePtr scene = this->CreateScene(_renderEngine);
+  if (!scene)
+    return;
+  VisualPtr root = scene->RootVisual();
+  auto &r = results[_renderEngine];
+
+  for (unsigned int i = 0; i < 400u; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(5.0 + (i % 20), (i / 20) * 1.5 - 15.0, 0.0);
+    root->AddChild(visual);
+  }
+
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(640);
+  camera->SetImageHeight(480);
+  root->AddChild(camera);
+  camera->Update();
+
+  RayQueryPtr rayQuery = scene->CreateRayQuery();
+  ASSERT_NE(nullptr, rayQuery);
+  const unsigned int count = 200u;
+  unsigned int hits = 0u;
+  double seconds = Seconds([&]
+      {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+          math::Vector2d point(-0.5 + (i % 20) * 0.05, 0.0);
+          rayQuery->SetFromCamera(camera, point);
+          hits += static_cast<bool>(rayQuery->ClosestPoint());
+        }
+      });
+  r["ray_query_closest_point_us"] = seconds * 1e6 / count;
+  EXPECT_GT(hits, 0u);
+
+  this->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+void SceneGraphBenchmark::Sensors(const std::string &_renderEngine)
+{
+  ScenePtr scene = this->CreateScene(_renderEngine);
+  if (!scene)
+    return;
+  VisualPtr root = scene->RootVisual();
+  auto &r = results[_renderEngine];
+
+  for (unsigned int i = 0; i < 200u; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(3.0 + (i % 20) * 0.8, (i / 20) * 1.5 - 7.5, 0.0);
+    root->AddChild(visual);
+  }
+
+  const unsigned int frames = 30u;
+  const std::vector<std::pair<unsigned int, unsigned int>> resolutions =
+      {{320u, 240u}, {640u, 480u}, {1280u, 720u}};
+
+  for (const auto &res : resolutions)
+  {
+    std::string size =
+        std::to_string(res.first) + "x" + std::to_string(res.second);
+
+    CameraPtr camera = scene->CreateCamera();
+    camera->SetImageWidth(res.first);
+    camera->SetImageHeight(res.second);
+    root->AddChild(camera);
+    Image image = camera->CreateImage();
+    camera->Capture(image);
+    double seconds = Seconds([&]
+        {
+          for (unsigned int i = 0; i < frames; ++i)
+            camera->Capture(image);
+        });
+    r["camera_" + size + "_fps"] = frames / seconds;
+    scene->DestroySensor(camera);
+
+    if (_renderEngine == "optix")
+      continue;
+
+    DepthCameraPtr depthCamera = scene->CreateDepthCamera();
+    depthCamera->SetImageWidth(res.first);
+    depthCamera->SetImageHeight(res.second);
+    depthCamera->SetNearClipPlane(0.1);
+    depthCamera->SetFarClipPlane(30.0);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+    depthCamera->Update();
+    seconds = Seconds([&]
+        {
+          for (unsigned int i = 0; i < frames; ++i)
+            depthCamera->Update();
+        });
+    r["depth_camera_" + size + "_fps"] = frames / seconds;
+    scene->DestroySensor(depthCamera);
+  }
+
+  if (_renderEngine != "optix")
+  {
+    // horizontal x vertical rays
+    const std::vector<std::pair<unsigned int, unsigned int>> rays =
+        {{360u, 16u}, {1024u, 32u}, {2048u, 64u}};
+    for (const auto &res : rays)
+    {
+      GpuRaysPtr gpuRays = scene->CreateGpuRays();
+      gpuRays->SetNearClipPlane(0.1);
+      gpuRays->SetFarClipPlane(30.0);
+      gpuRays->SetAngleMin(-IGN_PI);
+      gpuRays->SetAngleMax(IGN_PI);
+      gpuRays->SetRayCount(res.first);
+      gpuRays->SetVerticalAngleMin(-IGN_DTOR(15));
+      gpuRays->SetVerticalAngleMax(IGN_DTOR(15));
+      gpuRays->SetVerticalRayCount(res.second);
+      root->AddChild(gpuRays);
+
+      std::vector<float> scan(res.first * res.second * 3u);
+      gpuRays->Update();
+      double seconds = Seconds([&]
+          {
+            for (unsigned int i = 0; i < frames; ++i)
+            {
+              gpuRays->Update();
+              gpuRays->Copy(scan.data());
+            }
+          });
+      r["gpu_rays_" + std::to_string(res.first) + "x" +
+          std::to_string(res.second) + "_fps"] = frames / seconds;
+      scene->DestroySensor(gpuRays);
+    }
+  }
+
+  this->DestroyScene(scene);
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneGraphBenchmark, VisualLifecycle)
+{
+  VisualLifecycle(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneGraphBenchmark, Tree)
+{
+  Tree(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneGraphBenchmark, Lookup)
+{
+  Lookup(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneGraphBenchmark, ClosestPoint)
+{
+  ClosestPoint(GetParam());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SceneGraphBenchmark, Sensors)
+{
+  Sensors(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(SceneGraph, SceneGraphBenchmark,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+/// Results are printed and written to the file named by the
+/// IGN_RENDERING_BENCHMARK_OUTPUT environment variable, or to
+/// scene_graph_benchmark.json in the build directory.
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  int result = RUN_ALL_TESTS();
+
+  WriteJson(std::cout);
+
+  std::string filename;
+  if (!common::env("IGN_RENDERING_BENCHMARK_OUTPUT", filename))
+    filename = std::string(PROJECT_BUILD_PATH) + "/scene_graph_benchmark.json";
+  std::ofstream out(filename);
+  WriteJson(out);
+  if (!out)
+    std::cerr << "Unable to write benchmark results to " << filename << "\n";
+
+  return result;
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Time a function
+/// \param[in] _func Function to time
+/// \return Elapsed seconds
+template <typename F>
+static double Seconds(F _func)
+{
+  auto start = std::chrono::steady_clock::now();
+  _func();
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+/// \brief Hovering and box selection on a large scene
+class SelectionPerformanceTest: public testing::Test,
+                                public testing::WithParamInterface<const char *>
+{
+  /// \brief Compare VisualAt with the cached id buffer of VisualsAt and
+  /// time VisualsInRect on a 50k visual scene
+  public: void HoverAndBoxSelect(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void SelectionPerformanceTest::HoverAndBoxSelect(
+    const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "Selection not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  // a 250 x 200 wall of small boxes filling the view
+  const unsigned int columns = 250u;
+  const unsigned int rows = 200u;
+  for (unsigned int i = 0; i < columns * rows; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalScale(0.1, 0.1, 0.1);
+    visual->SetLocalPosition(20.0, (i % columns) * 0.15 - 18.75,
+        (i / columns) * 0.15 - 15.0);
+    root->AddChild(visual);
+  }
+
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(800);
+  camera->SetImageHeight(600);
+  camera->SetAspectRatio(800.0 / 600.0);
+  camera->SetHFOV(IGN_PI / 2);
+  root->AddChild(camera);
+  camera->Update();
+
+  // pointer path across the image
+  std::vector<math::Vector2i> path;
+  for (unsigned int i = 0; i < 200u; ++i)
+    path.push_back(math::Vector2i(100 + 3 * i, 150 + i));
+
+  // hover with VisualAt, one render per query. Only a few queries since
+  // each renders the whole scene.
+  const unsigned int visualAtCount = 10u;
+  unsigned int visualAtHits = 0u;
+  double visualAtSec = Seconds([&]
+      {
+        for (unsigned int i = 0; i < visualAtCount; ++i)
+        {
+          if (camera->VisualAt(path[i * path.size() / visualAtCount]))
+            ++visualAtHits;
+        }
+      });
+
+  // hover with VisualsAt, the first query renders the id buffer
+  unsigned int visualsAtHits = 0u;
+  double firstSec = Seconds([&]
+      {
+        visualsAtHits += camera->VisualsAt({path[0]}).size();
+      });
+  double visualsAtSec = Seconds([&]
+      {
+        for (unsigned int i = 1; i < path.size(); ++i)
+          visualsAtHits += camera->VisualsAt({path[i]}).size();
+      });
+  EXPECT_GT(visualAtHits, 0u);
+  EXPECT_GT(visualsAtHits, 0u);
+
+  // box select over the cached id buffer
+  std::map<unsigned int, unsigned int> visuals;
+  double boxSec = Seconds([&]
+      {
+        visuals = camera->VisualsInRect(math::Vector2i(100, 100),
+            math::Vector2i(700, 500));
+      });
+  EXPECT_GT(visuals.size(), 1000u);
+
+  // box select after the scene was rendered again
+  camera->Update();
+  double boxRenderSec = Seconds([&]
+      {
+        visuals = camera->VisualsInRect(math::Vector2i(100, 100),
+            math::Vector2i(700, 500));
+      });
+
+  // box select at a quarter of the pixels
+  camera->SetSelectionBufferScale(0.5);
+  double boxHalfSec = Seconds([&]
+      {
+        visuals = camera->VisualsInRect(math::Vector2i(100, 100),
+            math::Vector2i(700, 500));
+      });
+
+  double visualAtMs = visualAtSec * 1e3 / visualAtCount;
+  double visualsAtMs = visualsAtSec * 1e3 / (path.size() - 1u);
+  std::cout << "[" << _renderEngine << "] " << columns * rows
+            << " visuals\n"
+            << "  hover VisualAt: " << visualAtMs << " ms/query\n"
+            << "  hover VisualsAt: " << firstSec * 1e3
+            << " ms first query, " << visualsAtMs << " ms/query cached\n"
+            << "  box select: " << boxRenderSec * 1e3 << " ms, "
+            << boxHalfSec * 1e3 << " ms at half resolution, "
+            << boxSec * 1e3 << " ms cached, " << visuals.size()
+            << " visuals" << std::endl;
+
+  // cached queries only read memory
+  EXPECT_LT(visualsAtMs, visualAtMs);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SelectionPerformanceTest, HoverAndBoxSelect)
+{
+  HoverAndBoxSelect(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Selection, SelectionPerformanceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
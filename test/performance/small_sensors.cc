@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+#include <ignition/math/Helpers.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/DepthCamera.hh"
+#include "ignition/rendering/GpuRays.hh"
+#include "ignition/rendering/Image.hh"
+#include "ignition/rendering/Light.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure the frame times of sensors with small images, as used by
+/// learning pipelines and low resolution simulated cameras. Compare the
+/// output of the cpu engine with the ogre2 engine.
+class SmallSensorsPerformanceTest: public testing::Test,
+    public testing::WithParamInterface<const char *>
+{
+  /// \brief Render cameras, depth cameras and gpu rays at increasing
+  /// resolutions
+  public: void SmallSensors(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void SmallSensorsPerformanceTest::SmallSensors(
+    const std::string &_renderEngine)
+{
+  if (_renderEngine == "optix")
+  {
+    igndbg << "Depth cameras not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  DirectionalLightPtr light = scene->CreateDirectionalLight();
+  light->SetDirection(0.5, 0.5, -1.0);
+  root->AddChild(light);
+
+  // boxes scattered in front of the sensors
+  for (unsigned int i = 0; i < 200; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(2.0 + (i % 20) * 0.8, (i / 20) * 1.5 - 7.5,
+        (i % 3) * 0.5 - 0.5);
+    root->AddChild(visual);
+  }
+
+  struct Resolution
+  {
+    unsigned int width;
+    unsigned int height;
+  };
+  // the last one for comparison
+  std::vector<Resolution> resolutions = {
+    {64, 48}, {84, 84}, {160, 120}, {320, 240}, {640, 480}};
+
+  // returns the average frame time in ms of an update function
+  const unsigned int numFrames = 100;
+  auto measure = [&](const std::function<void()> &_update)
+  {
+    // the first update creates the render targets
+    _update();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+      _update();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() /
+        numFrames;
+  };
+
+  for (const auto &res : resolutions)
+  {
+    CameraPtr camera = scene->CreateCamera();
+    camera->SetImageWidth(res.width);
+    camera->SetImageHeight(res.height);
+    camera->SetHFOV(IGN_PI / 2.0);
+    camera->SetAspectRatio(static_cast<double>(res.width) / res.height);
+    root->AddChild(camera);
+    Image image = camera->CreateImage();
+    double cameraMs = measure([&]()
+        {
+          camera->Capture(image);
+        });
+
+    DepthCameraPtr depthCamera = scene->CreateDepthCamera();
+    depthCamera->SetImageWidth(res.width);
+    depthCamera->SetImageHeight(res.height);
+    depthCamera->SetHFOV(IGN_PI / 2.0);
+    depthCamera->SetAspectRatio(static_cast<double>(res.width) / res.height);
+    depthCamera->SetNearClipPlane(0.1);
+    depthCamera->SetFarClipPlane(50.0);
+    depthCamera->CreateDepthTexture();
+    root->AddChild(depthCamera);
+    std::vector<float> depth(res.width * res.height);
+    common::ConnectionPtr connection = depthCamera->ConnectNewDepthFrame(
+        [&depth](const float *_scan, unsigned int _width,
+          unsigned int _height, unsigned int /*_channels*/,
+          const std::string &/*_format*/)
+        {
+          std::copy(_scan, _scan + _width * _height, depth.begin());
+        });
+    double depthMs = measure([&]()
+        {
+          depthCamera->Update();
+        });
+    connection.reset();
+
+    GpuRaysPtr gpuRays = scene->CreateGpuRays();
+    gpuRays->SetNearClipPlane(0.1);
+    gpuRays->SetFarClipPlane(50.0);
+    gpuRays->SetAngleMin(-IGN_PI / 4.0);
+    gpuRays->SetAngleMax(IGN_PI / 4.0);
+    gpuRays->SetRayCount(res.width);
+    gpuRays->SetVerticalAngleMin(-IGN_PI / 8.0);
+    gpuRays->SetVerticalAngleMax(IGN_PI / 8.0);
+    gpuRays->SetVerticalRayCount(res.height);
+    root->AddChild(gpuRays);
+    std::vector<float> scan(res.width * res.height * 3);
+    double raysMs = measure([&]()
+        {
+          gpuRays->Update();
+          gpuRays->Copy(scan.data());
+        });
+
+    std::cout << "[" << _renderEngine << "] " << res.width << "x"
+              << res.height << " camera: " << cameraMs
+              << " ms/frame, depth camera: " << depthMs
+              << " ms/frame, gpu rays: " << raysMs << " ms/frame"
+              << std::endl;
+
+    EXPECT_GT(cameraMs, 0.0);
+    EXPECT_GT(depthMs, 0.0);
+    EXPECT_GT(raysMs, 0.0);
+
+    scene->DestroySensor(camera);
+    scene->DestroySensor(depthCamera);
+    scene->DestroySensor(gpuRays);
+  }
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(SmallSensorsPerformanceTest, SmallSensors)
+{
+  SmallSensors(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(SmallSensors, SmallSensorsPerformanceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
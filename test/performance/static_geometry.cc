@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Compare the frame time of a large static scene before and after
+/// baking its static geometry
+class StaticGeometryTest: public testing::Test,
+                          public testing::WithParamInterface<const char *>
+{
+  /// \brief Render a warehouse of static shelves and boxes
+  public: void Warehouse(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void StaticGeometryTest::Warehouse(const std::string &_renderEngine)
+{
+  if (_renderEngine != "ogre" && _renderEngine != "ogre2")
+  {
+    igndbg << "Static geometry not supported yet in rendering engine: "
+            << _renderEngine << std::endl;
+    return;
+  }
+
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  camera->SetLocalPosition(-20, 50, 30);
+  camera->SetLocalRotation(0, 0.5, 0);
+  root->AddChild(camera);
+
+  // a handful of materials shared by all objects
+  const unsigned int numMaterials = 4;
+  std::vector<MaterialPtr> materials;
+  for (unsigned int i = 0; i < numMaterials; ++i)
+  {
+    MaterialPtr material = scene->CreateMaterial();
+    material->SetDiffuse(0.2 + 0.2 * i, 0.5, 0.8 - 0.2 * i);
+    materials.push_back(material);
+  }
+
+  // shelves in rows, each holding boxes and cylinders
+  const unsigned int numObjects = 20000;
+  const unsigned int numFrames = 10;
+  for (unsigned int i = 0; i < numObjects; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(i % 3 ? scene->CreateBox() : scene->CreateCylinder());
+    visual->SetMaterial(materials[i % numMaterials], false);
+    visual->SetLocalPosition((i % 200) * 0.5, (i / 200) % 50 * 2.0,
+        (i / 10000) * 1.0);
+    visual->SetLocalScale(0.4, 0.4, 0.4);
+    visual->SetStatic(true);
+    root->AddChild(visual);
+  }
+
+  auto measureFrameTime = [&]()
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int f = 0; f < numFrames; ++f)
+      camera->Update();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() /
+        numFrames;
+  };
+
+  camera->Update();
+  std::cout << "[" << _renderEngine << "] " << numObjects
+            << " objects frame time: " << measureFrameTime() << " ms"
+            << std::endl;
+
+  auto start = std::chrono::steady_clock::now();
+  scene->BakeStaticGeometry();
+  auto end = std::chrono::steady_clock::now();
+  std::cout << "[" << _renderEngine << "] bake time: "
+            << std::chrono::duration<double, std::milli>(end - start).count()
+            << " ms, batches: " << scene->StaticGeometryBatchCount()
+            << std::endl;
+
+  camera->Update();
+  std::cout << "[" << _renderEngine << "] " << numObjects
+            << " baked objects frame time: " << measureFrameTime() << " ms"
+            << std::endl;
+
+  EXPECT_GT(scene->StaticGeometryBatchCount(), 0u);
+  EXPECT_LT(scene->StaticGeometryBatchCount(), numObjects);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(StaticGeometryTest, Warehouse)
+{
+  Warehouse(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(StaticGeometry, StaticGeometryTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2021 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include <ignition/common/Console.hh>
+
+#include "test_config.h"  // NOLINT(build/include)
+
+#include "ignition/rendering/Camera.hh"
+#include "ignition/rendering/RenderEngine.hh"
+#include "ignition/rendering/RenderingIface.hh"
+#include "ignition/rendering/Scene.hh"
+#include "ignition/rendering/Trace.hh"
+#include "ignition/rendering/Visual.hh"
+
+using namespace ignition;
+using namespace rendering;
+
+/// \brief Measure the cost of trace zones while no capture runs
+class TracePerformanceTest: public testing::Test,
+                            public testing::WithParamInterface<const char *>
+{
+  /// \brief Estimate the share of a frame spent in idle trace zones
+  public: void IdleOverhead(const std::string &_renderEngine);
+};
+
+/////////////////////////////////////////////////
+void TracePerformanceTest::IdleOverhead(const std::string &_renderEngine)
+{
+  auto engine = rendering::engine(_renderEngine);
+  if (!engine)
+  {
+    igndbg << "Engine '" << _renderEngine << "' is not supported" << std::endl;
+    return;
+  }
+
+  ScenePtr scene = engine->CreateScene("scene");
+  ASSERT_NE(nullptr, scene);
+  VisualPtr root = scene->RootVisual();
+  for (unsigned int i = 0; i < 500u; ++i)
+  {
+    VisualPtr visual = scene->CreateVisual();
+    visual->AddGeometry(scene->CreateBox());
+    visual->SetLocalPosition(3.0 + (i % 20) * 0.8, (i / 20) * 1.5 - 15.0, 0);
+    root->AddChild(visual);
+  }
+
+  CameraPtr camera = scene->CreateCamera();
+  camera->SetImageWidth(320);
+  camera->SetImageHeight(240);
+  root->AddChild(camera);
+  camera->Update();
+
+  // cost of a zone while idle
+  Trace::Stop();
+  const unsigned int zoneCount = 10000000u;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < zoneCount; ++i)
+    TraceZone zone("idle");
+  double zoneNs = std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count() / zoneCount;
+
+  // frame time without capture
+  const unsigned int frames = 100u;
+  start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < frames; ++i)
+    camera->Update();
+  double frameNs = std::chrono::duration<double, std::nano>(
+      std::chrono::steady_clock::now() - start).count() / frames;
+
+  // zones entered per frame, zero if the library was built without
+  // IGN_RENDERING_TRACING
+  Trace::Start();
+  for (unsigned int i = 0; i < frames; ++i)
+    camera->Update();
+  Trace::Stop();
+  double zonesPerFrame =
+      static_cast<double>(Trace::EventCount() + Trace::LostEventCount()) /
+      frames;
+  Trace::ExportChromeTrace(
+      std::string(PROJECT_BUILD_PATH) + "/trace_" + _renderEngine + ".json");
+
+  double overhead = zonesPerFrame * zoneNs / frameNs;
+  std::cout << "[" << _renderEngine << "] idle zone: " << zoneNs << " ns, "
+            << zonesPerFrame << " zones/frame, frame: " << frameNs * 1e-6
+            << " ms, idle overhead: " << overhead * 100.0 << "%" << std::endl;
+  EXPECT_LT(overhead, 0.01);
+
+  engine->DestroyScene(scene);
+  rendering::unloadEngine(engine->Name());
+}
+
+/////////////////////////////////////////////////
+TEST_P(TracePerformanceTest, IdleOverhead)
+{
+  IdleOverhead(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Trace, TracePerformanceTest,
+    RENDER_ENGINE_VALUES,
+    ignition::rendering::PrintToStringParam());
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}